@@ -10,6 +10,8 @@
 #include "blif.h"
 #include "cycle.h"
 #include "sim.h"
+#include "bitsim.h"
+#include "parallel.h"
 #include "bdd.h"
 #include "depth.h"
 #include "cube.h"
@@ -25,7 +27,8 @@ void alloc_and_init_activity_info(Abc_Ntk_t * ntk);
 void ace_update_latch_probs(Abc_Ntk_t * ntk);
 void print_node_bdd(Abc_Ntk_t * ntk);
 void print_nodes(Vec_Ptr_t * nodes);
-int ace_calc_activity(Abc_Ntk_t * ntk, int num_vectors, char * clk_name);
+int ace_calc_activity(Abc_Ntk_t * ntk, int num_vectors, char * clk_name,
+		int num_threads);
 
 st__table * ace_info_hash_table;
 
@@ -143,14 +146,15 @@ void print_nodes(Vec_Ptr_t * nodes) {
 	fflush(0);
 }
 
-int ace_calc_activity(Abc_Ntk_t * ntk, int num_vectors, char * clk_name) {
+int ace_calc_activity(Abc_Ntk_t * ntk, int num_vectors, char * clk_name,
+		int num_threads) {
 	int error = 0;
 	Vec_Ptr_t * nodes_all;
 	Vec_Ptr_t * nodes_logic;
 	Vec_Ptr_t * next_state_node_vec;
 	Vec_Ptr_t * latches_in_cycles_vec;
 	Abc_Obj_t * obj;
-	int i, j;
+	int i;
 	Ace_Obj_Info_t * info;
 
 	//Build BDD
@@ -196,7 +200,23 @@ int ace_calc_activity(Abc_Ntk_t * ntk, int num_vectors, char * clk_name) {
 
 		//print_nodes(next_state_node_vec);
 
-		ace_sim_activities(ntk, next_state_node_vec, num_vectors, 0.05);
+		/* Random stimuli are simulated bit-parallel; input vector files
+		 * are replayed one cycle at a time */
+		bool has_vectors = FALSE;
+		Abc_NtkForEachPi(ntk, obj, i)
+		{
+			if (Ace_ObjInfo(obj)->values) {
+				has_vectors = TRUE;
+			}
+		}
+
+		if (has_vectors) {
+			ace_sim_activities(ntk, next_state_node_vec, num_vectors, 0.05);
+		} else if (num_threads > 1) {
+			ace_par_sim_activities(ntk, num_vectors, num_threads);
+		} else {
+			ace_bitsim_activities(ntk, num_vectors);
+		}
 		//ace_sim_activities(ntk, nodes_logic, num_vectors, 0.05);
 
 		ace_update_latch_probs(ntk);
@@ -272,32 +292,15 @@ int ace_calc_activity(Abc_Ntk_t * ntk, int num_vectors, char * clk_name) {
 		}
 	}
 
-	Vec_PtrForEachEntry(Abc_Obj_t*, nodes_logic, obj, i)
-	{
-		Ace_Obj_Info_t * info2 = Ace_ObjInfo(obj);
-		//Ace_Obj_Info_t * fanin_info2;
-
-		VTR_ASSERT(Abc_ObjType(obj) == ABC_OBJ_NODE);
-
-		if (Abc_ObjFaninNum(obj) < 1) {
-			info2->switch_act = 0.0;
-			continue;
-		} else {
-			Vec_Ptr_t * literals = Vec_PtrAlloc(0);
-			Abc_Obj_t * fanin;
-
-			VTR_ASSERT(obj->Type == ABC_OBJ_NODE);
-
-			Abc_ObjForEachFanin(obj, fanin, j)
-			{
-				Vec_PtrPush(literals, fanin);
-			}
-			info2->switch_act = ace_bdd_calc_switch_act((DdManager*)ntk->pManFunc, obj,
-					literals);
-			Vec_PtrFree(literals);
+	if (num_threads > 1) {
+		ace_par_calc_switch_acts(ntk, nodes_logic, num_threads);
+	} else {
+		Vec_PtrForEachEntry(Abc_Obj_t*, nodes_logic, obj, i)
+		{
+			Ace_ObjInfo(obj)->switch_act = ace_bdd_calc_node_switch_act(ntk, obj);
 		}
-		VTR_ASSERT(info2->switch_act >= 0);
 	}
+
     Vec_PtrFree(nodes_logic);
     Vec_PtrFree(latches_in_cycles_vec);
 
@@ -338,6 +341,7 @@ int main(int argc, char * argv[]) {
 	Abc_Ntk_t * ntk;
 	Abc_Obj_t * obj;
 	int seed = 0;
+	int num_threads = 1;
 
 	p = ACE_PI_STATIC_PROB;
 	d = ACE_PI_SWITCH_PROB;
@@ -346,7 +350,8 @@ int main(int argc, char * argv[]) {
 	char new_blif_file_name[BLIF_FILE_NAME_LEN];
     char* clk_name = NULL;
 	ace_io_parse_argv(argc, argv, &BLIF, &IN_ACT, &OUT_ACT, blif_file_name,
-			new_blif_file_name, &pi_format, &p, &d, &seed, &clk_name);
+			new_blif_file_name, &pi_format, &p, &d, &seed, &clk_name,
+			&num_threads);
 
 	srand(seed);
 
@@ -428,7 +433,7 @@ int main(int argc, char * argv[]) {
 	}
 
 	if (!error) {
-		error = ace_calc_activity(ntk, ACE_NUM_VECTORS, clk_name);
+		error = ace_calc_activity(ntk, ACE_NUM_VECTORS, clk_name, num_threads);
 	}
 
 	//Abc_NtkToSop(ntk, 0);
@@ -9,7 +9,8 @@
 #include "misc/st/st.h"
 
 double calc_cube_switch_prob_recur(DdManager * mgr, DdNode * bdd,
-		ace_cube_t * cube, Vec_Ptr_t * inputs, st__table * visited, int phase);
+		ace_cube_t * cube, Vec_Ptr_t * inputs, const double * prob0to1,
+		const double * prob1to0, st__table * visited, int phase);
 
 void ace_bdd_get_literals(Abc_Ntk_t * ntk, st__table ** lit_st_table,
 		Vec_Ptr_t ** literals);
@@ -20,6 +21,10 @@ int ace_bdd_build_network_bdds(Abc_Ntk_t * ntk, st__table * leaves,
 double ace_bdd_calc_switch_act(DdManager * mgr, Abc_Obj_t * obj,
 		Vec_Ptr_t * fanins);
 
+/* Switching activity of a logic node from the probabilities of its fanins.
+ * Only reads the network, so different nodes may be processed concurrently. */
+double ace_bdd_calc_node_switch_act(Abc_Ntk_t * ntk, Abc_Obj_t * obj);
+
 int node_error(int code);
 
 #endif
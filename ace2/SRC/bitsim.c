@@ -0,0 +1,462 @@
+#include "vtr_assert.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include "ace.h"
+#include "bitsim.h"
+
+#include "bdd/cudd/cudd.h"
+#include "bdd/cudd/cuddInt.h"
+
+/*
+ * Bit-parallel activity simulation.
+ *
+ * Every object carries ACE_BITSIM_WORDS 64-bit words per cycle, each bit
+ * being one independent simulation lane. The node functions are flattened
+ * once from their BDDs into small programs of multiplexers
+ *     value = (x & then) | (~x & else)
+ * which are evaluated word-wide over the network in topological order, so a
+ * single pass over the network simulates ACE_BITSIM_WORDS * 64 vectors. The
+ * word loops have a fixed trip count and no branches, letting the compiler
+ * vectorize them (e.g. into AVX2 when enabled).
+ *
+ * The primary input stimuli come from a xoshiro256** generator, seeded from
+ * rand() so the seed given to ACE still makes the results reproducible.
+ *
+ * Lanes are independent, so a simulation can also be split into several runs
+ * with different seeds, e.g. one per thread, whose counts are summed.
+ */
+
+#define ACE_BITSIM_WORDS			4		/* 64-bit words (lanes / 64) per object */
+#define ACE_BITSIM_LANES			(ACE_BITSIM_WORDS * 64)
+#define ACE_BITSIM_MIN_CYCLES		1000	/* Minimum number of counted cycles per lane */
+#define ACE_BITSIM_WARMUP_CYCLES	64		/* Cycles simulated before counting, to settle the latches */
+#define ACE_BITSIM_PROB_BITS		16		/* Fixed-point precision of the input probabilities */
+
+typedef uint64_t ace_word_t;
+
+typedef struct {
+	uint64_t s[4];
+} Ace_Rng_t;
+
+typedef struct {
+	int id;
+	unsigned prob1;		/* Fixed-point static probability */
+	unsigned prob0to1;	/* Fixed-point probability of a rising transition */
+	unsigned prob1to0;	/* Fixed-point probability of a falling transition */
+} Ace_BitsimPi_t;
+
+struct Ace_BitsimProg {
+	Vec_Ptr_t * logic_nodes;	/* Logic nodes in topological order */
+	Vec_Int_t * programs;		/* Flattened node functions */
+	int * program_offsets;		/* Offset of each logic node's program, by object id */
+	int max_ops;				/* Largest number of operations in a program */
+	Ace_BitsimPi_t * pis;		/* Primary input stimuli */
+	int num_pis;
+};
+
+static uint64_t ace_rng_rotl(uint64_t x, int k) {
+	return (x << k) | (x >> (64 - k));
+}
+
+static uint64_t ace_rng_splitmix(uint64_t * x) {
+	uint64_t z = (*x += 0x9E3779B97F4A7C15ULL);
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+	return z ^ (z >> 31);
+}
+
+static void ace_rng_seed(Ace_Rng_t * rng, uint64_t seed) {
+	int i;
+
+	for (i = 0; i < 4; i++) {
+		rng->s[i] = ace_rng_splitmix(&seed);
+	}
+}
+
+static uint64_t ace_rng_next(Ace_Rng_t * rng) {
+	uint64_t * s = rng->s;
+	uint64_t result = ace_rng_rotl(s[1] * 5, 7) * 9;
+	uint64_t t = s[1] << 17;
+
+	s[2] ^= s[0];
+	s[3] ^= s[1];
+	s[1] ^= s[2];
+	s[0] ^= s[3];
+	s[2] ^= t;
+	s[3] = ace_rng_rotl(s[3], 45);
+
+	return result;
+}
+
+static unsigned ace_bitsim_quantize(double prob) {
+	double scaled = prob * (double) (1u << ACE_BITSIM_PROB_BITS) + 0.5;
+
+	if (scaled <= 0.0) {
+		return 0;
+	}
+	if (scaled >= (double) (1u << ACE_BITSIM_PROB_BITS)) {
+		return 1u << ACE_BITSIM_PROB_BITS;
+	}
+	return (unsigned) scaled;
+}
+
+/* Returns a word whose bits are independently 1 with probability
+ * prob / 2^ACE_BITSIM_PROB_BITS. The bits of prob are consumed from the least
+ * significant one: OR-ing with a random word maps P to (1 + P) / 2 and AND-ing
+ * maps it to P / 2, which builds up the binary expansion of the probability. */
+static ace_word_t ace_bitsim_bernoulli(Ace_Rng_t * rng, unsigned prob) {
+	ace_word_t word = 0;
+
+	if (prob == 0) {
+		return 0;
+	}
+	if (prob >= (1u << ACE_BITSIM_PROB_BITS)) {
+		return ~(ace_word_t) 0;
+	}
+
+	/* Trailing zero bits would only AND zeros together */
+	int bit = 0;
+	while (!(prob & 1u)) {
+		prob >>= 1;
+		bit++;
+	}
+	for (; bit < ACE_BITSIM_PROB_BITS; bit++, prob >>= 1) {
+		if (prob & 1u) {
+			word |= ace_rng_next(rng);
+		} else {
+			word &= ace_rng_next(rng);
+		}
+	}
+	return word;
+}
+
+static int ace_bitsim_popcount(ace_word_t x) {
+	x = x - ((x >> 1) & 0x5555555555555555ULL);
+	x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+	x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+	return (int) ((x * 0x0101010101010101ULL) >> 56);
+}
+
+/* Node programs
+ *
+ * The program of a node is stored in a flat integer array as
+ *     num_ops, root_lit, (var, then_lit, else_lit) * num_ops
+ * A literal is (index << 1) | complemented, where index 0 is the constant one
+ * and index k > 0 is the result of the k'th operation. Operation variables are
+ * fanin indices, since the node BDDs use one variable per fanin. */
+
+static int ace_bitsim_flatten_rec(DdNode * f, st__table * visited,
+		Vec_Int_t * ops) {
+	DdNode * regular = Cudd_Regular(f);
+	int complement = Cudd_IsComplement(f);
+	char * value;
+	int then_lit, else_lit, index;
+
+	if (cuddIsConstant(regular)) {
+		return complement;
+	}
+
+	if (st__lookup(visited, (char *) regular, &value)) {
+		return ((int) (ABC_PTRINT_T) value << 1) | complement;
+	}
+
+	then_lit = ace_bitsim_flatten_rec(cuddT(regular), visited, ops);
+	else_lit = ace_bitsim_flatten_rec(cuddE(regular), visited, ops);
+
+	Vec_IntPush(ops, regular->index);
+	Vec_IntPush(ops, then_lit);
+	Vec_IntPush(ops, else_lit);
+	index = Vec_IntSize(ops) / 3;
+	st__insert(visited, (char *) regular, (char *) (ABC_PTRINT_T) index);
+
+	return (index << 1) | complement;
+}
+
+static void ace_bitsim_flatten(Abc_Obj_t * obj, Vec_Int_t * programs,
+		Vec_Int_t * ops) {
+	st__table * visited;
+	int root_lit, i;
+
+	Vec_IntClear(ops);
+	visited = st__init_table(st__ptrcmp, st__ptrhash);
+	root_lit = ace_bitsim_flatten_rec((DdNode *) obj->pData, visited, ops);
+	st__free_table(visited);
+
+	Vec_IntPush(programs, Vec_IntSize(ops) / 3);
+	Vec_IntPush(programs, root_lit);
+	for (i = 0; i < Vec_IntSize(ops); i++) {
+		Vec_IntPush(programs, Vec_IntEntry(ops, i));
+	}
+}
+
+
+static const ace_word_t * ace_bitsim_lit(const ace_word_t * scratch, int lit,
+		ace_word_t * mask) {
+	*mask = (lit & 1) ? ~(ace_word_t) 0 : 0;
+	return scratch + (lit >> 1) * ACE_BITSIM_WORDS;
+}
+
+static void ace_bitsim_eval_node(Abc_Obj_t * obj, const int * program,
+		ace_word_t * values, ace_word_t * scratch) {
+	int num_ops = program[0];
+	int root_lit = program[1];
+	const int * op = program + 2;
+	const ace_word_t * x, *t, *e, *root;
+	ace_word_t t_mask, e_mask, root_mask;
+	ace_word_t * dst;
+	int k, w;
+
+	for (w = 0; w < ACE_BITSIM_WORDS; w++) {
+		scratch[w] = ~(ace_word_t) 0;
+	}
+
+	for (k = 1; k <= num_ops; k++, op += 3) {
+		x = values + Abc_ObjFaninId(obj, op[0]) * ACE_BITSIM_WORDS;
+		t = ace_bitsim_lit(scratch, op[1], &t_mask);
+		e = ace_bitsim_lit(scratch, op[2], &e_mask);
+		dst = scratch + k * ACE_BITSIM_WORDS;
+		for (w = 0; w < ACE_BITSIM_WORDS; w++) {
+			dst[w] = (x[w] & (t[w] ^ t_mask)) | (~x[w] & (e[w] ^ e_mask));
+		}
+	}
+
+	root = ace_bitsim_lit(scratch, root_lit, &root_mask);
+	dst = values + Abc_ObjId(obj) * ACE_BITSIM_WORDS;
+	for (w = 0; w < ACE_BITSIM_WORDS; w++) {
+		dst[w] = root[w] ^ root_mask;
+	}
+}
+
+static void ace_bitsim_copy(ace_word_t * values, int dst_id,
+		const ace_word_t * src_values, int src_id) {
+	memcpy(values + dst_id * ACE_BITSIM_WORDS,
+			src_values + src_id * ACE_BITSIM_WORDS,
+			ACE_BITSIM_WORDS * sizeof(ace_word_t));
+}
+
+int ace_bitsim_num_cycles(int max_cycles, int num_runs) {
+	int num_cycles;
+
+	/* Spread the requested vectors over the lanes, but keep each lane's
+	 * sequence long enough to capture the sequential behaviour */
+	num_cycles = (max_cycles + ACE_BITSIM_LANES - 1) / ACE_BITSIM_LANES;
+	num_cycles = MAX(num_cycles, ACE_BITSIM_MIN_CYCLES);
+	num_cycles = MIN(num_cycles, max_cycles);
+
+	/* The runs share the counted cycles; each settles its latches with its
+	 * own warm-up */
+	num_cycles = (num_cycles + num_runs - 1) / num_runs;
+	return MAX(num_cycles, 2);
+}
+
+Ace_BitsimProg_t * ace_bitsim_prepare(Abc_Ntk_t * ntk) {
+	Ace_BitsimProg_t * prog;
+	Abc_Obj_t * obj;
+	Ace_Obj_Info_t * info;
+	Vec_Int_t * ops;
+	int i;
+
+	VTR_ASSERT(Abc_NtkHasBdd(ntk));
+
+	prog = (Ace_BitsimProg_t *) malloc(sizeof(Ace_BitsimProg_t));
+
+	/* Flatten the node functions */
+	prog->logic_nodes = Abc_NtkDfs(ntk, TRUE);
+	prog->programs = Vec_IntAlloc(16 * Vec_PtrSize(prog->logic_nodes));
+	prog->program_offsets = (int *) malloc(
+			Abc_NtkObjNumMax(ntk) * sizeof(int));
+	prog->max_ops = 0;
+	ops = Vec_IntAlloc(64);
+	Vec_PtrForEachEntry(Abc_Obj_t*, prog->logic_nodes, obj, i)
+	{
+		prog->program_offsets[Abc_ObjId(obj)] = Vec_IntSize(prog->programs);
+		ace_bitsim_flatten(obj, prog->programs, ops);
+		prog->max_ops = MAX(prog->max_ops, Vec_IntSize(ops) / 3);
+	}
+	Vec_IntFree(ops);
+
+	/* Primary input stimuli */
+	prog->num_pis = Abc_NtkPiNum(ntk);
+	prog->pis = (Ace_BitsimPi_t *) malloc(
+			MAX(prog->num_pis, 1) * sizeof(Ace_BitsimPi_t));
+	Abc_NtkForEachPi(ntk, obj, i)
+	{
+		info = Ace_ObjInfo(obj);
+		VTR_ASSERT(info->values == NULL);
+		prog->pis[i].id = Abc_ObjId(obj);
+		prog->pis[i].prob1 = ace_bitsim_quantize(info->static_prob);
+		prog->pis[i].prob0to1 = ace_bitsim_quantize(
+				ACE_P0TO1(info->static_prob, info->switch_prob));
+		prog->pis[i].prob1to0 = ace_bitsim_quantize(
+				ACE_P1TO0(info->static_prob, info->switch_prob));
+	}
+
+	return prog;
+}
+
+void ace_bitsim_free(Ace_BitsimProg_t * prog) {
+	free(prog->pis);
+	free(prog->program_offsets);
+	Vec_IntFree(prog->programs);
+	Vec_PtrFree(prog->logic_nodes);
+	free(prog);
+}
+
+void ace_bitsim_run(Abc_Ntk_t * ntk, const Ace_BitsimProg_t * prog,
+		int num_cycles, uint64_t seed, long * num_ones, long * num_toggles) {
+	Abc_Obj_t * obj;
+	const Ace_BitsimPi_t * pis = prog->pis;
+	Ace_Rng_t rng;
+	ace_word_t * cur, *prev, *scratch, *tmp;
+	int num_objs, num_pis;
+	int cycle, i, w;
+
+	VTR_ASSERT(num_cycles >= 2);
+
+	num_objs = Abc_NtkObjNumMax(ntk);
+	num_pis = prog->num_pis;
+
+	ace_rng_seed(&rng, seed);
+
+	cur = (ace_word_t *) calloc(num_objs * ACE_BITSIM_WORDS, sizeof(ace_word_t));
+	prev = (ace_word_t *) calloc(num_objs * ACE_BITSIM_WORDS, sizeof(ace_word_t));
+	scratch = (ace_word_t *) malloc(
+			(prog->max_ops + 1) * ACE_BITSIM_WORDS * sizeof(ace_word_t));
+
+	for (cycle = 0; cycle < ACE_BITSIM_WARMUP_CYCLES + num_cycles; cycle++) {
+		/* Primary inputs: the first cycle is drawn from the static
+		 * probability, later ones from the transition probabilities */
+		for (i = 0; i < num_pis; i++) {
+			ace_word_t * value = cur + pis[i].id * ACE_BITSIM_WORDS;
+			const ace_word_t * last = prev + pis[i].id * ACE_BITSIM_WORDS;
+
+			for (w = 0; w < ACE_BITSIM_WORDS; w++) {
+				if (cycle == 0) {
+					value[w] = ace_bitsim_bernoulli(&rng, pis[i].prob1);
+				} else {
+					ace_word_t rise = ace_bitsim_bernoulli(&rng, pis[i].prob0to1);
+					ace_word_t fall = ace_bitsim_bernoulli(&rng, pis[i].prob1to0);
+					value[w] = (last[w] & ~fall) | (~last[w] & rise);
+				}
+			}
+		}
+
+		/* Register outputs hold the value latched in the previous cycle
+		 * (zero initially, as in the scalar simulator) */
+		Abc_NtkForEachLatchOutput(ntk, obj, i)
+		{
+			ace_bitsim_copy(cur, Abc_ObjId(obj), prev, Abc_ObjFaninId0(obj));
+		}
+
+		Vec_PtrForEachEntry(Abc_Obj_t*, prog->logic_nodes, obj, i)
+		{
+			ace_bitsim_eval_node(obj,
+					Vec_IntArray(prog->programs)
+							+ prog->program_offsets[Abc_ObjId(obj)], cur,
+					scratch);
+		}
+
+		/* Primary outputs and register inputs, then the latches themselves */
+		Abc_NtkForEachCo(ntk, obj, i)
+		{
+			ace_bitsim_copy(cur, Abc_ObjId(obj), cur, Abc_ObjFaninId0(obj));
+		}
+		Abc_NtkForEachLatch(ntk, obj, i)
+		{
+			ace_bitsim_copy(cur, Abc_ObjId(obj), cur, Abc_ObjFaninId0(obj));
+		}
+
+		if (cycle >= ACE_BITSIM_WARMUP_CYCLES) {
+			int counted_cycle = cycle - ACE_BITSIM_WARMUP_CYCLES;
+
+			Abc_NtkForEachObj(ntk, obj, i)
+			{
+				const ace_word_t * value = cur + Abc_ObjId(obj) * ACE_BITSIM_WORDS;
+				const ace_word_t * last = prev + Abc_ObjId(obj) * ACE_BITSIM_WORDS;
+				int ones = 0;
+				int toggles = 0;
+
+				for (w = 0; w < ACE_BITSIM_WORDS; w++) {
+					ones += ace_bitsim_popcount(value[w]);
+					toggles += ace_bitsim_popcount(value[w] ^ last[w]);
+				}
+				num_ones[Abc_ObjId(obj)] += ones;
+				if (counted_cycle > 0) {
+					num_toggles[Abc_ObjId(obj)] += toggles;
+				}
+			}
+		}
+
+		tmp = prev;
+		prev = cur;
+		cur = tmp;
+	}
+
+	free(scratch);
+	free(prev);
+	free(cur);
+}
+
+void ace_bitsim_set_probs(Abc_Ntk_t * ntk, const long * num_ones,
+		const long * num_toggles, int num_cycles, int num_runs) {
+	Abc_Obj_t * obj;
+	Ace_Obj_Info_t * info;
+	double num_lanes;
+	int i, j;
+
+	num_lanes = (double) ACE_BITSIM_LANES * num_runs;
+
+	Abc_NtkForEachObj(ntk, obj, i)
+	{
+		j = Abc_ObjId(obj);
+		info = Ace_ObjInfo(obj);
+		info->static_prob = num_ones[j] / (num_lanes * num_cycles);
+		VTR_ASSERT(info->static_prob >= 0.0 && info->static_prob <= 1.0);
+		info->switch_prob = num_toggles[j] / (num_lanes * (num_cycles - 1));
+		VTR_ASSERT(info->switch_prob >= 0.0 && info->switch_prob <= 1.0);
+
+		/* A finite sequence may toggle once more than its ones/zeros allow */
+		info->switch_prob = MIN(info->switch_prob,
+				2.0 * MIN(info->static_prob, 1.0 - info->static_prob));
+
+		info->status = ACE_SIM;
+	}
+}
+
+uint64_t ace_bitsim_seed() {
+	uint64_t seed = 0;
+	int i;
+
+	//We don't need a cryptographically secure random number
+	//generator so suppress warning in coverity
+	//
+	//coverity[dont_call]
+	for (i = 0; i < 4; i++) {
+		seed = (seed << 16) ^ (uint64_t) rand();
+	}
+	return seed;
+}
+
+void ace_bitsim_activities(Abc_Ntk_t * ntk, int max_cycles) {
+	Ace_BitsimProg_t * prog;
+	long * num_ones;
+	long * num_toggles;
+	int num_cycles;
+
+	VTR_ASSERT(max_cycles > 0);
+
+	num_cycles = ace_bitsim_num_cycles(max_cycles, 1);
+	num_ones = (long *) calloc(Abc_NtkObjNumMax(ntk), sizeof(long));
+	num_toggles = (long *) calloc(Abc_NtkObjNumMax(ntk), sizeof(long));
+
+	prog = ace_bitsim_prepare(ntk);
+	ace_bitsim_run(ntk, prog, num_cycles, ace_bitsim_seed(), num_ones,
+			num_toggles);
+	ace_bitsim_free(prog);
+	ace_bitsim_set_probs(ntk, num_ones, num_toggles, num_cycles, 1);
+
+	free(num_toggles);
+	free(num_ones);
+}
@@ -0,0 +1,40 @@
+#ifndef __ACE_BITSIM_H__
+#define __ACE_BITSIM_H__
+
+#include <stdint.h>
+
+#include "ace.h"
+
+/* Bit-parallel counterpart of ace_sim_activities(): simulates many independent
+ * random input sequences at once, one per bit of a machine word, and sets
+ * the static and switching probabilities of every object in the network.
+ * The network functions must be BDDs, and the primary inputs are driven
+ * from their static/switching probabilities (vector files are not supported). */
+void ace_bitsim_activities(Abc_Ntk_t * ntk, int max_cycles);
+
+/* The steps of ace_bitsim_activities(), for splitting a simulation into
+ * several runs (e.g. one per thread).
+ *
+ * ace_bitsim_num_cycles() gives the cycles each of num_runs runs simulates
+ * for max_cycles vectors, and ace_bitsim_seed() draws a run's seed from rand().
+ * ace_bitsim_prepare() computes the topological order of the logic nodes,
+ * their flattened functions and the primary input stimuli; it traverses the
+ * network (updating its traversal ids), so it must not run concurrently with
+ * anything else using the network. ace_bitsim_run() simulates the network
+ * from the given seed with a prepared program and adds the ones and toggles of
+ * every object to num_ones and num_toggles, indexed by object id; runs sharing
+ * a program but with different counters may execute concurrently.
+ * ace_bitsim_set_probs() sets the probabilities of every object from the
+ * counts summed over num_runs runs. */
+typedef struct Ace_BitsimProg Ace_BitsimProg_t;
+
+int ace_bitsim_num_cycles(int max_cycles, int num_runs);
+uint64_t ace_bitsim_seed();
+Ace_BitsimProg_t * ace_bitsim_prepare(Abc_Ntk_t * ntk);
+void ace_bitsim_free(Ace_BitsimProg_t * prog);
+void ace_bitsim_run(Abc_Ntk_t * ntk, const Ace_BitsimProg_t * prog,
+		int num_cycles, uint64_t seed, long * num_ones, long * num_toggles);
+void ace_bitsim_set_probs(Abc_Ntk_t * ntk, const long * num_ones,
+		const long * num_toggles, int num_cycles, int num_runs);
+
+#endif
@@ -100,7 +100,8 @@ void ace_io_print_activity(Abc_Ntk_t * ntk, FILE * fp) {
 
 int ace_io_parse_argv(int argc, char ** argv, FILE ** BLIF, FILE ** IN_ACT,
 		FILE ** OUT_ACT, char * blif_file_name, char * new_blif_file_name,
-		ace_pi_format_t * pi_format, double *p, double * d, int * seed, char** clk_name) {
+		ace_pi_format_t * pi_format, double *p, double * d, int * seed, char** clk_name,
+		int * num_threads) {
 	int i;
 	char option;
 
@@ -150,6 +151,14 @@ int ace_io_parse_argv(int argc, char ** argv, FILE ** BLIF, FILE ** IN_ACT,
 			case 'c':
 				*clk_name = argv[i];
 				break;
+			case 't':
+				*num_threads = atoi(argv[i]);
+				if (*num_threads < 1) {
+					printf("Number of threads must be at least 1\n");
+					ace_io_print_usage();
+					exit(1);
+				}
+				break;
 			default:
 				ace_io_print_usage();
 				exit(1);
@@ -183,6 +192,7 @@ void ace_io_print_usage() {
 	(void) fprintf(stderr, "\n");
 	(void) fprintf(stderr, "                                --+\n");
 	(void) fprintf(stderr, "    -o [output activity filename] | optional\n");
+	(void) fprintf(stderr, "    -t [number of threads]        |\n");
 	(void) fprintf(stderr, "                                --+\n");
 	(void) fprintf(stderr, "\n");
 	(void) fprintf(stderr, "                                --+\n");
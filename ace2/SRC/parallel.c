@@ -0,0 +1,140 @@
+#include "vtr_assert.h"
+
+#include <pthread.h>
+#include <stdint.h>
+
+#include "ace.h"
+#include "bdd.h"
+#include "bitsim.h"
+#include "parallel.h"
+
+typedef struct {
+	Abc_Ntk_t * ntk;
+	const Ace_BitsimProg_t * prog;
+	int num_cycles;
+	uint64_t seed;
+	long * num_ones;
+	long * num_toggles;
+	Vec_Ptr_t * nodes;
+	int begin;
+	int end;
+} Ace_ParWork_t;
+
+static void * ace_par_sim_worker(void * arg) {
+	Ace_ParWork_t * work = (Ace_ParWork_t*) arg;
+
+	ace_bitsim_run(work->ntk, work->prog, work->num_cycles, work->seed,
+			work->num_ones, work->num_toggles);
+
+	return NULL;
+}
+
+static void * ace_par_switch_act_worker(void * arg) {
+	Ace_ParWork_t * work = (Ace_ParWork_t*) arg;
+	Abc_Obj_t * obj;
+	int i;
+
+	for (i = work->begin; i < work->end; i++) {
+		obj = (Abc_Obj_t*) Vec_PtrEntry(work->nodes, i);
+		Ace_ObjInfo(obj)->switch_act = ace_bdd_calc_node_switch_act(work->ntk,
+				obj);
+	}
+
+	return NULL;
+}
+
+/* Runs worker on each work item in its own thread, and waits for all of them.
+ * Items whose thread can not be created are run by the calling thread. */
+static void ace_par_run(void * (*worker)(void *), Ace_ParWork_t * works,
+		int num_works) {
+	pthread_t * threads;
+	int * started;
+	int i;
+
+	threads = (pthread_t*) malloc(num_works * sizeof(pthread_t));
+	started = (int*) calloc(num_works, sizeof(int));
+
+	for (i = 0; i < num_works; i++) {
+		started[i] = pthread_create(&threads[i], NULL, worker, &works[i]) == 0;
+		if (!started[i]) {
+			worker(&works[i]);
+		}
+	}
+
+	for (i = 0; i < num_works; i++) {
+		if (started[i]) {
+			pthread_join(threads[i], NULL);
+		}
+	}
+
+	free(started);
+	free(threads);
+}
+
+void ace_par_sim_activities(Abc_Ntk_t * ntk, int max_cycles, int num_threads) {
+	Ace_ParWork_t * works;
+	Ace_BitsimProg_t * prog;
+	int num_objs, num_cycles, i, j;
+
+	VTR_ASSERT(max_cycles > 0);
+	VTR_ASSERT(num_threads > 0);
+
+	num_objs = Abc_NtkObjNumMax(ntk);
+	num_cycles = ace_bitsim_num_cycles(max_cycles, num_threads);
+
+	/* The network traversal is not thread-safe, so the program is prepared
+	 * once, before the workers start, and only read by them */
+	prog = ace_bitsim_prepare(ntk);
+
+	works = (Ace_ParWork_t*) calloc(num_threads, sizeof(Ace_ParWork_t));
+	for (i = 0; i < num_threads; i++) {
+		works[i].ntk = ntk;
+		works[i].prog = prog;
+		works[i].num_cycles = num_cycles;
+		/* Seeds are drawn up front so results don't depend on thread timing */
+		works[i].seed = ace_bitsim_seed();
+		works[i].num_ones = (long*) calloc(num_objs, sizeof(long));
+		works[i].num_toggles = (long*) calloc(num_objs, sizeof(long));
+	}
+
+	ace_par_run(ace_par_sim_worker, works, num_threads);
+	ace_bitsim_free(prog);
+
+	for (i = 1; i < num_threads; i++) {
+		for (j = 0; j < num_objs; j++) {
+			works[0].num_ones[j] += works[i].num_ones[j];
+			works[0].num_toggles[j] += works[i].num_toggles[j];
+		}
+	}
+	ace_bitsim_set_probs(ntk, works[0].num_ones, works[0].num_toggles,
+			num_cycles, num_threads);
+
+	for (i = 0; i < num_threads; i++) {
+		free(works[i].num_ones);
+		free(works[i].num_toggles);
+	}
+	free(works);
+}
+
+void ace_par_calc_switch_acts(Abc_Ntk_t * ntk, Vec_Ptr_t * nodes,
+		int num_threads) {
+	Ace_ParWork_t * works;
+	int num_nodes, i;
+
+	VTR_ASSERT(num_threads > 0);
+
+	/* The node BDDs are only traversed, never built or freed, so the workers
+	 * can share the network's BDD manager */
+	num_nodes = Vec_PtrSize(nodes);
+	works = (Ace_ParWork_t*) calloc(num_threads, sizeof(Ace_ParWork_t));
+	for (i = 0; i < num_threads; i++) {
+		works[i].ntk = ntk;
+		works[i].nodes = nodes;
+		works[i].begin = (int) ((long) num_nodes * i / num_threads);
+		works[i].end = (int) ((long) num_nodes * (i + 1) / num_threads);
+	}
+
+	ace_par_run(ace_par_switch_act_worker, works, num_threads);
+
+	free(works);
+}
@@ -0,0 +1,19 @@
+#ifndef __ACE_PARALLEL_H__
+#define __ACE_PARALLEL_H__
+
+#include "ace.h"
+
+/* Multi-threaded activity estimation, with one worker thread per share of
+ * the work. */
+
+/* Splits the bit-parallel simulation of max_cycles vectors into num_threads
+ * runs on independent random sequences, and sets the probabilities of every
+ * object from their combined counts. */
+void ace_par_sim_activities(Abc_Ntk_t * ntk, int max_cycles, int num_threads);
+
+/* Computes the switching activities of the given logic nodes with their BDDs,
+ * splitting the nodes between num_threads threads. */
+void ace_par_calc_switch_acts(Abc_Ntk_t * ntk, Vec_Ptr_t * nodes,
+		int num_threads);
+
+#endif
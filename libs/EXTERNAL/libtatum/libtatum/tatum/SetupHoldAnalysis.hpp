@@ -62,6 +62,25 @@ class SetupHoldAnalysis : public GraphVisitor {
             hold_visitor_.do_slack_traverse_node(tg, dc, node); 
         }
 
+        bool do_incr_arrival_traverse_node(const TimingGraph& tg, const TimingConstraints& tc, const DelayCalculator& dc, const NodeId node_id) override { 
+            bool setup_changed = setup_visitor_.do_incr_arrival_traverse_node(tg, tc, dc, node_id); 
+            bool hold_changed = hold_visitor_.do_incr_arrival_traverse_node(tg, tc, dc, node_id); 
+
+            return setup_changed || hold_changed;
+        }
+
+        bool do_incr_required_traverse_node(const TimingGraph& tg, const TimingConstraints& tc, const DelayCalculator& dc, const NodeId node_id) override { 
+            bool setup_changed = setup_visitor_.do_incr_required_traverse_node(tg, tc, dc, node_id); 
+            bool hold_changed = hold_visitor_.do_incr_required_traverse_node(tg, tc, dc, node_id); 
+
+            return setup_changed || hold_changed;
+        }
+
+        void do_incr_slack_traverse_node(const TimingGraph& tg, const DelayCalculator& dc, const NodeId node) override {
+            setup_visitor_.do_incr_slack_traverse_node(tg, dc, node); 
+            hold_visitor_.do_incr_slack_traverse_node(tg, dc, node); 
+        }
+
         TimingTags::tag_range setup_tags(const NodeId node_id) const { return setup_visitor_.setup_tags(node_id); }
         TimingTags::tag_range setup_tags(const NodeId node_id, TagType type) const { return setup_visitor_.setup_tags(node_id, type); }
         TimingTags::tag_range setup_edge_slacks(const EdgeId edge_id) const { return setup_visitor_.setup_edge_slacks(edge_id); }
@@ -9,9 +9,10 @@ namespace tatum { namespace detail {
 /**
  * A concrete implementation of a HoldTimingAnalyzer.
  *
- * This is a full (i.e. non-incremental) analyzer, which fully
- * re-analyzes the timing graph whenever update_timing_impl() is 
- * called.
+ * This analyzer fully re-analyzes the timing graph whenever update_timing_impl()
+ * is called, unless some edges have been invalidated (with invalidate_edge()) since
+ * a previous update. In that case only the parts of the timing graph affected by
+ * the invalidated edges are re-analyzed.
  */
 template<class GraphWalker=SerialWalker>
 class FullHoldTimingAnalyzer : public HoldTimingAnalyzer {
@@ -28,6 +29,7 @@ class FullHoldTimingAnalyzer : public HoldTimingAnalyzer {
             graph_walker_.set_profiling_data("total_analysis_sec", 0.);
             graph_walker_.set_profiling_data("analysis_sec", 0.);
             graph_walker_.set_profiling_data("num_full_updates", 0.);
+            graph_walker_.set_profiling_data("num_incr_updates", 0.);
         }
 
     protected:
@@ -38,15 +40,24 @@ class FullHoldTimingAnalyzer : public HoldTimingAnalyzer {
         virtual void update_hold_timing_impl() override {
             auto start_time = Clock::now();
 
-            graph_walker_.do_reset(timing_graph_, hold_visitor_);
+            bool incremental = incr_valid_ && graph_walker_.num_invalidated_edges() > 0;
+            if(incremental) {
+                graph_walker_.do_incr_arrival_traversal(timing_graph_, timing_constraints_, delay_calculator_, hold_visitor_);
+                graph_walker_.do_incr_required_traversal(timing_graph_, timing_constraints_, delay_calculator_, hold_visitor_);
+                graph_walker_.do_incr_update_slack(timing_graph_, delay_calculator_, hold_visitor_);
+            } else {
+                graph_walker_.do_reset(timing_graph_, hold_visitor_);
 
-            graph_walker_.do_arrival_pre_traversal(timing_graph_, timing_constraints_, hold_visitor_);            
-            graph_walker_.do_arrival_traversal(timing_graph_, timing_constraints_, delay_calculator_, hold_visitor_);            
+                graph_walker_.do_arrival_pre_traversal(timing_graph_, timing_constraints_, hold_visitor_);            
+                graph_walker_.do_arrival_traversal(timing_graph_, timing_constraints_, delay_calculator_, hold_visitor_);            
 
-            graph_walker_.do_required_pre_traversal(timing_graph_, timing_constraints_, hold_visitor_);            
-            graph_walker_.do_required_traversal(timing_graph_, timing_constraints_, delay_calculator_, hold_visitor_);            
+                graph_walker_.do_required_pre_traversal(timing_graph_, timing_constraints_, hold_visitor_);            
+                graph_walker_.do_required_traversal(timing_graph_, timing_constraints_, delay_calculator_, hold_visitor_);            
 
-            graph_walker_.do_update_slack(timing_graph_, delay_calculator_, hold_visitor_);
+                graph_walker_.do_update_slack(timing_graph_, delay_calculator_, hold_visitor_);
+            }
+            graph_walker_.clear_invalidated_edges();
+            incr_valid_ = true;
 
             double analysis_sec = std::chrono::duration_cast<dsec>(Clock::now() - start_time).count();
 
@@ -54,9 +65,15 @@ class FullHoldTimingAnalyzer : public HoldTimingAnalyzer {
             double total_analysis_sec = analysis_sec + graph_walker_.get_profiling_data("total_analysis_sec");
             graph_walker_.set_profiling_data("total_analysis_sec", total_analysis_sec);
             graph_walker_.set_profiling_data("analysis_sec", analysis_sec);
-            graph_walker_.set_profiling_data("num_full_updates", graph_walker_.get_profiling_data("num_full_updates") + 1);
+            if(incremental) {
+                graph_walker_.set_profiling_data("num_incr_updates", graph_walker_.get_profiling_data("num_incr_updates") + 1);
+            } else {
+                graph_walker_.set_profiling_data("num_full_updates", graph_walker_.get_profiling_data("num_full_updates") + 1);
+            }
         }
 
+        void invalidate_edge_impl(const EdgeId edge) override { graph_walker_.invalidate_edge(edge); }
+
         double get_profiling_data_impl(std::string key) const override { return graph_walker_.get_profiling_data(key); }
         size_t num_unconstrained_startpoints_impl() const override { return graph_walker_.num_unconstrained_startpoints(); }
         size_t num_unconstrained_endpoints_impl() const override { return graph_walker_.num_unconstrained_endpoints(); }
@@ -72,6 +89,7 @@ class FullHoldTimingAnalyzer : public HoldTimingAnalyzer {
         const DelayCalculator& delay_calculator_;
         HoldAnalysis hold_visitor_;
         GraphWalker graph_walker_;
+        bool incr_valid_ = false; //True if the analysis results are valid and can be incrementally updated
 
         typedef std::chrono::duration<double> dsec;
         typedef std::chrono::high_resolution_clock Clock;
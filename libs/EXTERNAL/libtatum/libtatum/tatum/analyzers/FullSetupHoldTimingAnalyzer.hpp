@@ -9,9 +9,10 @@ namespace tatum { namespace detail {
 /**
  * A concrete implementation of a SetupHoldTimingAnalyzer.
  *
- * This is a full (i.e. non-incremental) analyzer, which fully
- * re-analyzes the timing graph whenever update_timing_impl() is 
- * called.
+ * This analyzer fully re-analyzes the timing graph whenever update_timing_impl()
+ * is called, unless some edges have been invalidated (with invalidate_edge()) since
+ * a previous update. In that case only the parts of the timing graph affected by
+ * the invalidated edges are re-analyzed.
  */
 template<class GraphWalker=SerialWalker>
 class FullSetupHoldTimingAnalyzer : public SetupHoldTimingAnalyzer {
@@ -28,6 +29,7 @@ class FullSetupHoldTimingAnalyzer : public SetupHoldTimingAnalyzer {
             graph_walker_.set_profiling_data("total_analysis_sec", 0.);
             graph_walker_.set_profiling_data("analysis_sec", 0.);
             graph_walker_.set_profiling_data("num_full_updates", 0.);
+            graph_walker_.set_profiling_data("num_incr_updates", 0.);
         }
 
     protected:
@@ -35,15 +37,24 @@ class FullSetupHoldTimingAnalyzer : public SetupHoldTimingAnalyzer {
         virtual void update_timing_impl() override {
             auto start_time = Clock::now();
 
-            graph_walker_.do_reset(timing_graph_, setup_hold_visitor_);
+            bool incremental = incr_valid_ && graph_walker_.num_invalidated_edges() > 0;
+            if(incremental) {
+                graph_walker_.do_incr_arrival_traversal(timing_graph_, timing_constraints_, delay_calculator_, setup_hold_visitor_);
+                graph_walker_.do_incr_required_traversal(timing_graph_, timing_constraints_, delay_calculator_, setup_hold_visitor_);
+                graph_walker_.do_incr_update_slack(timing_graph_, delay_calculator_, setup_hold_visitor_);
+            } else {
+                graph_walker_.do_reset(timing_graph_, setup_hold_visitor_);
 
-            graph_walker_.do_arrival_pre_traversal(timing_graph_, timing_constraints_, setup_hold_visitor_);            
-            graph_walker_.do_arrival_traversal(timing_graph_, timing_constraints_, delay_calculator_, setup_hold_visitor_);            
+                graph_walker_.do_arrival_pre_traversal(timing_graph_, timing_constraints_, setup_hold_visitor_);            
+                graph_walker_.do_arrival_traversal(timing_graph_, timing_constraints_, delay_calculator_, setup_hold_visitor_);            
 
-            graph_walker_.do_required_pre_traversal(timing_graph_, timing_constraints_, setup_hold_visitor_);            
-            graph_walker_.do_required_traversal(timing_graph_, timing_constraints_, delay_calculator_, setup_hold_visitor_);            
+                graph_walker_.do_required_pre_traversal(timing_graph_, timing_constraints_, setup_hold_visitor_);            
+                graph_walker_.do_required_traversal(timing_graph_, timing_constraints_, delay_calculator_, setup_hold_visitor_);            
 
-            graph_walker_.do_update_slack(timing_graph_, delay_calculator_, setup_hold_visitor_);
+                graph_walker_.do_update_slack(timing_graph_, delay_calculator_, setup_hold_visitor_);
+            }
+            graph_walker_.clear_invalidated_edges();
+            incr_valid_ = true;
 
             double analysis_sec = std::chrono::duration_cast<dsec>(Clock::now() - start_time).count();
 
@@ -51,9 +62,15 @@ class FullSetupHoldTimingAnalyzer : public SetupHoldTimingAnalyzer {
             double total_analysis_sec = analysis_sec + graph_walker_.get_profiling_data("total_analysis_sec");
             graph_walker_.set_profiling_data("total_analysis_sec", total_analysis_sec);
             graph_walker_.set_profiling_data("analysis_sec", analysis_sec);
-            graph_walker_.set_profiling_data("num_full_updates", graph_walker_.get_profiling_data("num_full_updates") + 1);
+            if(incremental) {
+                graph_walker_.set_profiling_data("num_incr_updates", graph_walker_.get_profiling_data("num_incr_updates") + 1);
+            } else {
+                graph_walker_.set_profiling_data("num_full_updates", graph_walker_.get_profiling_data("num_full_updates") + 1);
+            }
         }
 
+        void invalidate_edge_impl(const EdgeId edge) override { graph_walker_.invalidate_edge(edge); }
+
         //Update only setup timing
         virtual void update_setup_timing_impl() override {
             auto& setup_visitor = setup_hold_visitor_.setup_visitor();
@@ -66,6 +83,10 @@ class FullSetupHoldTimingAnalyzer : public SetupHoldTimingAnalyzer {
             graph_walker_.do_required_traversal(timing_graph_, timing_constraints_, delay_calculator_, setup_visitor);            
 
             graph_walker_.do_update_slack(timing_graph_, delay_calculator_, setup_visitor);
+
+            //Only one of setup/hold was updated, so the next update must be a full one
+            graph_walker_.clear_invalidated_edges();
+            incr_valid_ = false;
         }
 
         //Update only hold timing
@@ -80,6 +101,10 @@ class FullSetupHoldTimingAnalyzer : public SetupHoldTimingAnalyzer {
             graph_walker_.do_required_traversal(timing_graph_, timing_constraints_, delay_calculator_, hold_visitor);            
 
             graph_walker_.do_update_slack(timing_graph_, delay_calculator_, hold_visitor);
+
+            //Only one of setup/hold was updated, so the next update must be a full one
+            graph_walker_.clear_invalidated_edges();
+            incr_valid_ = false;
         }
 
         double get_profiling_data_impl(std::string key) const override { return graph_walker_.get_profiling_data(key); }
@@ -102,6 +127,7 @@ class FullSetupHoldTimingAnalyzer : public SetupHoldTimingAnalyzer {
         const DelayCalculator& delay_calculator_;
         SetupHoldAnalysis setup_hold_visitor_;
         GraphWalker graph_walker_;
+        bool incr_valid_ = false; //True if the analysis results are valid and can be incrementally updated
 
         typedef std::chrono::duration<double> dsec;
         typedef std::chrono::high_resolution_clock Clock;
@@ -9,9 +9,10 @@ namespace tatum { namespace detail {
 /**
  * A concrete implementation of a SetupTimingAnalyzer.
  *
- * This is a full (i.e. non-incremental) analyzer, which fully
- * re-analyzes the timing graph whenever update_timing_impl() is 
- * called.
+ * This analyzer fully re-analyzes the timing graph whenever update_timing_impl()
+ * is called, unless some edges have been invalidated (with invalidate_edge()) since
+ * a previous update. In that case only the parts of the timing graph affected by
+ * the invalidated edges are re-analyzed.
  */
 template<class GraphWalker=SerialWalker>
 class FullSetupTimingAnalyzer : public SetupTimingAnalyzer {
@@ -28,6 +29,7 @@ class FullSetupTimingAnalyzer : public SetupTimingAnalyzer {
             graph_walker_.set_profiling_data("total_analysis_sec", 0.);
             graph_walker_.set_profiling_data("analysis_sec", 0.);
             graph_walker_.set_profiling_data("num_full_updates", 0.);
+            graph_walker_.set_profiling_data("num_incr_updates", 0.);
         }
 
     protected:
@@ -38,15 +40,24 @@ class FullSetupTimingAnalyzer : public SetupTimingAnalyzer {
         virtual void update_setup_timing_impl() override {
             auto start_time = Clock::now();
 
-            graph_walker_.do_reset(timing_graph_, setup_visitor_);
+            bool incremental = incr_valid_ && graph_walker_.num_invalidated_edges() > 0;
+            if(incremental) {
+                graph_walker_.do_incr_arrival_traversal(timing_graph_, timing_constraints_, delay_calculator_, setup_visitor_);
+                graph_walker_.do_incr_required_traversal(timing_graph_, timing_constraints_, delay_calculator_, setup_visitor_);
+                graph_walker_.do_incr_update_slack(timing_graph_, delay_calculator_, setup_visitor_);
+            } else {
+                graph_walker_.do_reset(timing_graph_, setup_visitor_);
 
-            graph_walker_.do_arrival_pre_traversal(timing_graph_, timing_constraints_, setup_visitor_);            
-            graph_walker_.do_arrival_traversal(timing_graph_, timing_constraints_, delay_calculator_, setup_visitor_);            
+                graph_walker_.do_arrival_pre_traversal(timing_graph_, timing_constraints_, setup_visitor_);            
+                graph_walker_.do_arrival_traversal(timing_graph_, timing_constraints_, delay_calculator_, setup_visitor_);            
 
-            graph_walker_.do_required_pre_traversal(timing_graph_, timing_constraints_, setup_visitor_);            
-            graph_walker_.do_required_traversal(timing_graph_, timing_constraints_, delay_calculator_, setup_visitor_);            
+                graph_walker_.do_required_pre_traversal(timing_graph_, timing_constraints_, setup_visitor_);            
+                graph_walker_.do_required_traversal(timing_graph_, timing_constraints_, delay_calculator_, setup_visitor_);            
 
-            graph_walker_.do_update_slack(timing_graph_, delay_calculator_, setup_visitor_);
+                graph_walker_.do_update_slack(timing_graph_, delay_calculator_, setup_visitor_);
+            }
+            graph_walker_.clear_invalidated_edges();
+            incr_valid_ = true;
 
             double analysis_sec = std::chrono::duration_cast<dsec>(Clock::now() - start_time).count();
 
@@ -54,9 +65,15 @@ class FullSetupTimingAnalyzer : public SetupTimingAnalyzer {
             double total_analysis_sec = analysis_sec + graph_walker_.get_profiling_data("total_analysis_sec");
             graph_walker_.set_profiling_data("total_analysis_sec", total_analysis_sec);
             graph_walker_.set_profiling_data("analysis_sec", analysis_sec);
-            graph_walker_.set_profiling_data("num_full_updates", graph_walker_.get_profiling_data("num_full_updates") + 1);
+            if(incremental) {
+                graph_walker_.set_profiling_data("num_incr_updates", graph_walker_.get_profiling_data("num_incr_updates") + 1);
+            } else {
+                graph_walker_.set_profiling_data("num_full_updates", graph_walker_.get_profiling_data("num_full_updates") + 1);
+            }
         }
 
+        void invalidate_edge_impl(const EdgeId edge) override { graph_walker_.invalidate_edge(edge); }
+
         //TimingAnalyzer
         double get_profiling_data_impl(std::string key) const override { return graph_walker_.get_profiling_data(key); }
         size_t num_unconstrained_startpoints_impl() const override { return graph_walker_.num_unconstrained_startpoints(); }
@@ -75,6 +92,7 @@ class FullSetupTimingAnalyzer : public SetupTimingAnalyzer {
         const DelayCalculator& delay_calculator_;
         SetupAnalysis setup_visitor_;
         GraphWalker graph_walker_;
+        bool incr_valid_ = false; //True if the analysis results are valid and can be incrementally updated
 
 
         typedef std::chrono::duration<double> dsec;
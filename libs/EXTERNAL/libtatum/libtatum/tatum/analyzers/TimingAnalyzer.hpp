@@ -1,5 +1,6 @@
 #pragma once
 #include <string>
+#include "tatum/TimingGraphFwd.hpp"
 
 namespace tatum {
 
@@ -8,6 +9,8 @@ namespace tatum {
  * which can be:
  *   - updated (update_timing())
  *   - reset (reset_timing()).
+ *   - told which edge delays have changed since the last update (invalidate_edge()),
+ *     allowing the next update to be incremental
  *
  * This is the most abstract interface provided (it does not allow access
  * to any calculated data).  As a result this interface is suitable for
@@ -28,6 +31,14 @@ class TimingAnalyzer {
         ///Perform timing analysis to update timing information (i.e. arrival & required times)
         void update_timing() { update_timing_impl(); }
 
+        ///Marks an edge whose delay has changed since the last call to update_timing().
+        ///If the delays of only a few edges change, the next update may then only
+        ///re-analyze the parts of the timing graph affected by them.
+        ///
+        ///Note that all edges whose delays have changed must be invalidated, otherwise
+        ///an incremental update may produce stale results.
+        void invalidate_edge(const EdgeId edge) { invalidate_edge_impl(edge); }
+
         double get_profiling_data(std::string key) const { return get_profiling_data_impl(key); }
 
         virtual size_t num_unconstrained_startpoints() const { return num_unconstrained_startpoints_impl(); }
@@ -36,6 +47,8 @@ class TimingAnalyzer {
     protected:
         virtual void update_timing_impl() = 0;
 
+        virtual void invalidate_edge_impl(const EdgeId edge) = 0;
+
         virtual double get_profiling_data_impl(std::string key) const = 0;
 
         virtual size_t num_unconstrained_startpoints_impl() const = 0;
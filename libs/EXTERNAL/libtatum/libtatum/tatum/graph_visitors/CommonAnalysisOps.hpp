@@ -50,6 +50,22 @@ class CommonAnalysisOps {
             node_slacks_[node].clear();
         }
 
+        ///Removes the node's clock and data arrival tags (keeping its required time tags)
+        void reset_node_arr_tags(const NodeId node) {
+            node_tags_[node].clear(TagType::CLOCK_LAUNCH);
+            node_tags_[node].clear(TagType::CLOCK_CAPTURE);
+            node_tags_[node].clear(TagType::DATA_ARRIVAL);
+        }
+
+        ///Removes the node's required time tags (keeping its arrival tags)
+        void reset_node_req_tags(const NodeId node) {
+            node_tags_[node].clear(TagType::DATA_REQUIRED);
+        }
+
+        void reset_node_slacks(const NodeId node) { 
+            node_slacks_[node].clear();
+        }
+
         void merge_slack_tags(const EdgeId edge, const Time time, TimingTag ref_tag) { 
             ref_tag.set_type(TagType::SLACK);
             edge_slacks_[edge].min(time, ref_tag.origin_node(), ref_tag); 
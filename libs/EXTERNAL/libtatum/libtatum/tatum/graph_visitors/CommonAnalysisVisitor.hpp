@@ -1,5 +1,7 @@
 #ifndef TATUM_COMMON_ANALYSIS_VISITOR_HPP
 #define TATUM_COMMON_ANALYSIS_VISITOR_HPP
+#include <vector>
+
 #include "tatum/error.hpp"
 #include "tatum/TimingGraph.hpp"
 #include "tatum/TimingConstraints.hpp"
@@ -44,6 +46,12 @@ class CommonAnalysisVisitor : public GraphVisitor {
 
         void do_slack_traverse_node(const TimingGraph& tg, const DelayCalculator& dc, const NodeId node) override;
 
+        bool do_incr_arrival_traverse_node(const TimingGraph& tg, const TimingConstraints& tc, const DelayCalculator& dc, const NodeId node_id) override;
+
+        bool do_incr_required_traverse_node(const TimingGraph& tg, const TimingConstraints& tc, const DelayCalculator& dc, const NodeId node_id) override;
+
+        void do_incr_slack_traverse_node(const TimingGraph& tg, const DelayCalculator& dc, const NodeId node) override;
+
     protected:
         AnalysisOps ops_;
 
@@ -64,6 +72,8 @@ class CommonAnalysisVisitor : public GraphVisitor {
 
         bool is_clock_data_launch_edge(const TimingGraph& tg, const EdgeId edge_id) const;
         bool is_clock_data_capture_edge(const TimingGraph& tg, const EdgeId edge_id) const;
+
+        static bool tags_equivalent(const std::vector<TimingTag>& lhs, TimingTags::tag_range rhs);
 };
 
 /*
@@ -204,6 +214,75 @@ bool CommonAnalysisVisitor<AnalysisOps>::do_required_pre_traverse_node(const Tim
     return is_constrained(node_type, ops_.get_tags(node_id));
 }
 
+/*
+ * Incremental Operations
+ */
+
+template<class AnalysisOps>
+bool CommonAnalysisVisitor<AnalysisOps>::do_incr_arrival_traverse_node(const TimingGraph& tg, const TimingConstraints& tc, const DelayCalculator& dc, const NodeId node_id) {
+    //Scratch copy of the previous tags (re-used to avoid allocations)
+    thread_local std::vector<TimingTag> prev_tags;
+    TimingTags::tag_range tags = ops_.get_tags(node_id);
+    prev_tags.assign(tags.begin(), tags.end());
+
+    if(tg.node_type(node_id) == NodeType::SINK) {
+        //A sink's required times are calculated from its arrival times (in mark_sink_required_times())
+        ops_.reset_node_req_tags(node_id);
+    }
+    ops_.reset_node_arr_tags(node_id);
+
+    do_arrival_traverse_node(tg, tc, dc, node_id);
+
+    return !tags_equivalent(prev_tags, ops_.get_tags(node_id));
+}
+
+template<class AnalysisOps>
+bool CommonAnalysisVisitor<AnalysisOps>::do_incr_required_traverse_node(const TimingGraph& tg, const TimingConstraints& tc, const DelayCalculator& dc, const NodeId node_id) {
+    //Sink required times are set during the arrival traversal, and clock pins have none
+    NodeType node_type = tg.node_type(node_id);
+    if(node_type == NodeType::SINK || node_type == NodeType::CPIN) return false;
+
+    thread_local std::vector<TimingTag> prev_req_tags;
+    TimingTags::tag_range req_tags = ops_.get_tags(node_id, TagType::DATA_REQUIRED);
+    prev_req_tags.assign(req_tags.begin(), req_tags.end());
+
+    ops_.reset_node_req_tags(node_id);
+
+    do_required_traverse_node(tg, tc, dc, node_id);
+
+    return !tags_equivalent(prev_req_tags, ops_.get_tags(node_id, TagType::DATA_REQUIRED));
+}
+
+template<class AnalysisOps>
+void CommonAnalysisVisitor<AnalysisOps>::do_incr_slack_traverse_node(const TimingGraph& tg, const DelayCalculator& dc, const NodeId node) {
+    ops_.reset_node_slacks(node);
+    for(const EdgeId edge : tg.node_in_edges(node)) {
+        ops_.reset_edge(edge);
+    }
+
+    do_slack_traverse_node(tg, dc, node);
+}
+
+//Returns true if the tags have the same types, domains and times (in the same order).
+//
+//The origin nodes are ignored since they do not affect the times propagated downstream
+template<class AnalysisOps>
+bool CommonAnalysisVisitor<AnalysisOps>::tags_equivalent(const std::vector<TimingTag>& lhs, TimingTags::tag_range rhs) {
+    if(lhs.size() != rhs.size()) return false;
+
+    auto rhs_iter = rhs.begin();
+    for(const TimingTag& lhs_tag : lhs) {
+        const TimingTag& rhs_tag = *rhs_iter++;
+        if(lhs_tag.type() != rhs_tag.type()
+           || lhs_tag.launch_clock_domain() != rhs_tag.launch_clock_domain()
+           || lhs_tag.capture_clock_domain() != rhs_tag.capture_clock_domain()
+           || !(lhs_tag.time() == rhs_tag.time())) {
+            return false;
+        }
+    }
+    return true;
+}
+
 /*
  * Arrival Time Operations
  */
@@ -18,6 +18,17 @@ class GraphVisitor {
         virtual void do_required_traverse_node(const TimingGraph& tg, const TimingConstraints& tc, const DelayCalculator& dc, const NodeId node_id) = 0;
 
         virtual void do_slack_traverse_node(const TimingGraph& tg, const DelayCalculator& dc, const NodeId node) = 0;
+
+        //Incremental traversals
+        //
+        //These re-calculate a node's values from scratch (discarding the values from the previous
+        //analysis), assuming the nodes they depend on are up-to-date. The arrival and required
+        //traversals return true if the node's tags changed.
+        virtual bool do_incr_arrival_traverse_node(const TimingGraph& tg, const TimingConstraints& tc, const DelayCalculator& dc, const NodeId node_id) = 0;
+        virtual bool do_incr_required_traverse_node(const TimingGraph& tg, const TimingConstraints& tc, const DelayCalculator& dc, const NodeId node_id) = 0;
+
+        //Re-calculates the slacks of the node and its incoming edges
+        virtual void do_incr_slack_traverse_node(const TimingGraph& tg, const DelayCalculator& dc, const NodeId node) = 0;
 };
 
 }
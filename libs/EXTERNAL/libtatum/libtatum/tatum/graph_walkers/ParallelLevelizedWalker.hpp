@@ -5,6 +5,7 @@
 
 #ifdef TATUM_USE_TBB
 # include <tbb/parallel_for_each.h>
+# include <tbb/parallel_for.h>
 # include <tbb/combinable.h>
 #endif
 
@@ -116,6 +117,62 @@ class ParallelLevelizedWalker : public TimingGraphWalker {
 #endif
         }
 
+        void do_incr_arrival_traversal_impl(const TimingGraph& tg, const TimingConstraints& tc, const DelayCalculator& dc, GraphVisitor& visitor) override {
+            for(LevelId level_id : tg.levels()) {
+                const auto& level_nodes = incr_arrival_nodes(level_id);
+                node_changed_.resize(level_nodes.size());
+#if defined(TATUM_USE_TBB)
+                tbb::parallel_for(size_t(0), level_nodes.size(), [&](size_t inode) {
+                    node_changed_[inode] = visitor.do_incr_arrival_traverse_node(tg, tc, dc, level_nodes[inode]);
+                });
+#else //Serial
+                for(size_t inode = 0; inode < level_nodes.size(); ++inode) {
+                    node_changed_[inode] = visitor.do_incr_arrival_traverse_node(tg, tc, dc, level_nodes[inode]);
+                }
+#endif
+                //Record the changes serially, since they modify the (shared) sets of nodes to update
+                for(size_t inode = 0; inode < level_nodes.size(); ++inode) {
+                    if(node_changed_[inode]) {
+                        incr_arrival_changed(tg, level_nodes[inode]);
+                    }
+                }
+            }
+        }
+
+        void do_incr_required_traversal_impl(const TimingGraph& tg, const TimingConstraints& tc, const DelayCalculator& dc, GraphVisitor& visitor) override {
+            for(LevelId level_id : tg.reversed_levels()) {
+                const auto& level_nodes = incr_required_nodes(level_id);
+                node_changed_.resize(level_nodes.size());
+#if defined(TATUM_USE_TBB)
+                tbb::parallel_for(size_t(0), level_nodes.size(), [&](size_t inode) {
+                    node_changed_[inode] = visitor.do_incr_required_traverse_node(tg, tc, dc, level_nodes[inode]);
+                });
+#else //Serial
+                for(size_t inode = 0; inode < level_nodes.size(); ++inode) {
+                    node_changed_[inode] = visitor.do_incr_required_traverse_node(tg, tc, dc, level_nodes[inode]);
+                }
+#endif
+                for(size_t inode = 0; inode < level_nodes.size(); ++inode) {
+                    if(node_changed_[inode]) {
+                        incr_required_changed(tg, level_nodes[inode]);
+                    }
+                }
+            }
+        }
+
+        void do_incr_update_slack_impl(const TimingGraph& tg, const DelayCalculator& dc, GraphVisitor& visitor) override {
+            const auto& nodes = incr_slack_nodes();
+#if defined(TATUM_USE_TBB)
+            tbb::parallel_for_each(nodes.begin(), nodes.end(), [&](auto node) {
+                visitor.do_incr_slack_traverse_node(tg, dc, node);
+            });
+#else //Serial
+            for(auto iter = nodes.begin(); iter != nodes.end(); ++iter) {
+                visitor.do_incr_slack_traverse_node(tg, dc, *iter);
+            }
+#endif
+        }
+
         void do_reset_impl(const TimingGraph& tg, GraphVisitor& visitor) override {
             auto nodes = tg.nodes();
             auto edges = tg.edges();
@@ -152,6 +209,8 @@ class ParallelLevelizedWalker : public TimingGraphWalker {
 
         size_t num_unconstrained_startpoints_ = 0;
         size_t num_unconstrained_endpoints_ = 0;
+
+        std::vector<char> node_changed_; //Whether each node of the current level changed during an incremental traversal
 };
 
 } //namepsace
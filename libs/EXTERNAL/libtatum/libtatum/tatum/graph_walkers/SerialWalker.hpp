@@ -63,6 +63,32 @@ class SerialWalker : public TimingGraphWalker {
             }
         }
 
+        void do_incr_arrival_traversal_impl(const TimingGraph& tg, const TimingConstraints& tc, const DelayCalculator& dc, GraphVisitor& visitor) override {
+            for(LevelId level_id : tg.levels()) {
+                for(NodeId node_id : incr_arrival_nodes(level_id)) {
+                    if(visitor.do_incr_arrival_traverse_node(tg, tc, dc, node_id)) {
+                        incr_arrival_changed(tg, node_id);
+                    }
+                }
+            }
+        }
+
+        void do_incr_required_traversal_impl(const TimingGraph& tg, const TimingConstraints& tc, const DelayCalculator& dc, GraphVisitor& visitor) override {
+            for(LevelId level_id : tg.reversed_levels()) {
+                for(NodeId node_id : incr_required_nodes(level_id)) {
+                    if(visitor.do_incr_required_traverse_node(tg, tc, dc, node_id)) {
+                        incr_required_changed(tg, node_id);
+                    }
+                }
+            }
+        }
+
+        void do_incr_update_slack_impl(const TimingGraph& tg, const DelayCalculator& dc, GraphVisitor& visitor) override {
+            for(NodeId node : incr_slack_nodes()) {
+                visitor.do_incr_slack_traverse_node(tg, dc, node);
+            }
+        }
+
         void do_reset_impl(const TimingGraph& tg, GraphVisitor& visitor) override {
             for(NodeId node_id : tg.nodes()) {
                 visitor.do_reset_node(node_id);
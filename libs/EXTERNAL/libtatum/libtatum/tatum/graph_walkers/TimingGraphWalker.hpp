@@ -3,8 +3,11 @@
 #include "tatum/TimingConstraintsFwd.hpp"
 #include "tatum/delay_calc/DelayCalculator.hpp"
 #include "tatum/graph_visitors/GraphVisitor.hpp"
+#include "tatum/TimingGraph.hpp"
+#include "tatum/util/tatum_linear_map.hpp"
 #include <chrono>
 #include <map>
+#include <vector>
 
 namespace tatum {
 
@@ -17,6 +20,22 @@ namespace tatum {
  * Internally the do_*_traversal() methods measure record performance related information 
  * and delegate to concrete sub-classes via the do_*_traversal_impl() virtual methods.
  *
+ * Incremental Traversals
+ * ======================
+ * After a full analysis, the edges whose delays have since changed can be marked with
+ * invalidate_edge(). The do_incr_*() traversals then only re-visit the nodes whose
+ * values may have changed:
+ *   - arrival: the sinks of the invalidated edges, and (level by level) the fanout of
+ *     any node whose arrival tags changed
+ *   - required: the sources of the invalidated edges, the nodes whose arrival tags changed,
+ *     and the fanin of any node whose required tags changed
+ *   - slack: the nodes whose tags changed, the sinks of the invalidated edges and the
+ *     fanout of nodes whose arrival tags changed (edge slacks are re-calculated with
+ *     their sink nodes)
+ *
+ * The incremental traversals must be called in that order, after which the invalidated
+ * edges should be cleared with clear_invalidated_edges().
+ *
  * \see GraphVisitor
  * \see TimingAnalyzer
  */
@@ -88,6 +107,44 @@ class TimingGraphWalker {
             profiling_data_["update_slack_sec"] = std::chrono::duration_cast<dsec>(Clock::now() - start_time).count();
         }
 
+        ///Marks an edge whose delay has changed since the last traversals
+        void invalidate_edge(const EdgeId edge) { invalidated_edges_.push_back(edge); }
+
+        ///Clears the invalidated edges (once the incremental traversals are complete)
+        void clear_invalidated_edges() { invalidated_edges_.clear(); }
+
+        ///\returns The number of edges invalidated since the last call to clear_invalidated_edges()
+        size_t num_invalidated_edges() const { return invalidated_edges_.size(); }
+
+        ///Incrementally updates the arrival times affected by the invalidated edges
+        void do_incr_arrival_traversal(const TimingGraph& tg, const TimingConstraints& tc, const DelayCalculator& dc, GraphVisitor& visitor) {
+            auto start_time = Clock::now();
+
+            incr_seed(tg);
+            do_incr_arrival_traversal_impl(tg, tc, dc, visitor);
+
+            profiling_data_["arrival_traversal_sec"] = std::chrono::duration_cast<dsec>(Clock::now() - start_time).count();
+        }
+
+        ///Incrementally updates the required times affected by the invalidated edges
+        void do_incr_required_traversal(const TimingGraph& tg, const TimingConstraints& tc, const DelayCalculator& dc, GraphVisitor& visitor) {
+            auto start_time = Clock::now();
+
+            do_incr_required_traversal_impl(tg, tc, dc, visitor);
+
+            profiling_data_["required_traversal_sec"] = std::chrono::duration_cast<dsec>(Clock::now() - start_time).count();
+        }
+
+        ///Incrementally updates the slacks affected by the invalidated edges
+        void do_incr_update_slack(const TimingGraph& tg, const DelayCalculator& dc, GraphVisitor& visitor) {
+            auto start_time = Clock::now();
+
+            do_incr_update_slack_impl(tg, dc, visitor);
+
+            profiling_data_["update_slack_sec"] = std::chrono::duration_cast<dsec>(Clock::now() - start_time).count();
+            profiling_data_["incr_nodes_updated"] = incr_slack_nodes_.size();
+        }
+
         ///Retrieve profiling information
         ///\param key The profiling key
         ///\returns The profiling value for the given key, or NaN if the key is not found
@@ -141,12 +198,141 @@ class TimingGraphWalker {
         ///Sub-class defined slack calculation
         virtual void do_update_slack_impl(const TimingGraph& tg, const DelayCalculator& dc, GraphVisitor& visitor) = 0;
 
+        ///Sub-class defined incremental arrival time traversal.
+        ///Must call visitor.do_incr_arrival_traverse_node() on the nodes of incr_arrival_nodes(level)
+        ///one level at a time, calling incr_arrival_changed() for each node whose tags changed
+        ///before moving to the next level
+        virtual void do_incr_arrival_traversal_impl(const TimingGraph& tg, const TimingConstraints& tc, const DelayCalculator& dc, GraphVisitor& visitor) = 0;
+
+        ///Sub-class defined incremental required time traversal.
+        ///Like do_incr_arrival_traversal_impl() but in reverse level order, using incr_required_nodes(level)
+        ///and incr_required_changed()
+        virtual void do_incr_required_traversal_impl(const TimingGraph& tg, const TimingConstraints& tc, const DelayCalculator& dc, GraphVisitor& visitor) = 0;
+
+        ///Sub-class defined incremental slack calculation.
+        ///Must call visitor.do_incr_slack_traverse_node() on the nodes of incr_slack_nodes()
+        virtual void do_incr_update_slack_impl(const TimingGraph& tg, const DelayCalculator& dc, GraphVisitor& visitor) = 0;
+
         virtual size_t num_unconstrained_startpoints_impl() const = 0;
         virtual size_t num_unconstrained_endpoints_impl() const = 0;
 
+    protected: //Incremental traversal book-keeping
+        ///\returns The nodes in level to be re-visited by the incremental arrival traversal
+        const std::vector<NodeId>& incr_arrival_nodes(const LevelId level) const { return incr_arrival_nodes_[size_t(level)]; }
+
+        ///\returns The nodes in level to be re-visited by the incremental required traversal
+        const std::vector<NodeId>& incr_required_nodes(const LevelId level) const { return incr_required_nodes_[size_t(level)]; }
+
+        ///\returns The nodes whose slacks need to be re-calculated
+        const std::vector<NodeId>& incr_slack_nodes() const { return incr_slack_nodes_; }
+
+        ///Records that node's arrival tags changed during the incremental arrival traversal
+        void incr_arrival_changed(const TimingGraph& tg, const NodeId node) {
+            incr_mark_required(node);
+            incr_mark_slack(node);
+
+            for(EdgeId edge : tg.node_out_edges(node)) {
+                if(tg.edge_disabled(edge)) continue;
+
+                NodeId sink = tg.edge_sink_node(edge);
+                incr_mark_arrival(sink);
+                incr_mark_slack(sink); //Edge slack depends on the source arrival time
+            }
+
+            if(tg.node_type(node) == NodeType::SINK) {
+                //Sink required times are set with its arrival times, so also propagate them upstream
+                incr_required_changed(tg, node);
+            }
+        }
+
+        ///Records that node's required tags changed during the incremental required traversal
+        void incr_required_changed(const TimingGraph& tg, const NodeId node) {
+            incr_mark_slack(node);
+
+            for(EdgeId edge : tg.node_in_edges(node)) {
+                if(tg.edge_disabled(edge)) continue;
+
+                incr_mark_required(tg.edge_src_node(edge));
+            }
+        }
+
+    private:
+        //Initializes the book-keeping for the incremental traversals from the invalidated edges
+        void incr_seed(const TimingGraph& tg) {
+            if(node_levels_.size() != tg.nodes().size()) {
+                //First incremental update, record the level of each node (the graph is not modified during analysis)
+                node_levels_ = tatum::util::linear_map<NodeId,LevelId>(tg.nodes().size());
+                for(LevelId level : tg.levels()) {
+                    for(NodeId node : tg.level_nodes(level)) {
+                        node_levels_[node] = level;
+                    }
+                }
+                incr_arrival_nodes_.resize(tg.levels().size());
+                incr_required_nodes_.resize(tg.levels().size());
+                node_incr_flags_ = tatum::util::linear_map<NodeId,unsigned char>(tg.nodes().size(), 0);
+            }
+
+            //Reset the previous update's book-keeping
+            for(auto& nodes : incr_arrival_nodes_) nodes.clear();
+            for(auto& nodes : incr_required_nodes_) nodes.clear();
+            for(NodeId node : incr_slack_nodes_) node_incr_flags_[node] = 0;
+            for(NodeId node : incr_flagged_nodes_) node_incr_flags_[node] = 0;
+            incr_slack_nodes_.clear();
+            incr_flagged_nodes_.clear();
+
+            for(EdgeId edge : invalidated_edges_) {
+                if(tg.edge_disabled(edge)) continue;
+
+                NodeId sink = tg.edge_sink_node(edge);
+                incr_mark_arrival(sink);
+                incr_mark_slack(sink);
+                incr_mark_required(tg.edge_src_node(edge));
+            }
+        }
+
+        void incr_mark_arrival(const NodeId node) {
+            if(set_incr_flag(node, ARRIVAL_FLAG)) {
+                incr_arrival_nodes_[size_t(node_levels_[node])].push_back(node);
+            }
+        }
+
+        void incr_mark_required(const NodeId node) {
+            if(set_incr_flag(node, REQUIRED_FLAG)) {
+                incr_required_nodes_[size_t(node_levels_[node])].push_back(node);
+            }
+        }
+
+        void incr_mark_slack(const NodeId node) {
+            if(set_incr_flag(node, SLACK_FLAG)) {
+                incr_slack_nodes_.push_back(node);
+            }
+        }
+
+        //Sets flag on node, returning false if it was already set
+        bool set_incr_flag(const NodeId node, unsigned char flag) {
+            unsigned char& flags = node_incr_flags_[node];
+            if(flags & flag) return false;
+            if(!flags) incr_flagged_nodes_.push_back(node);
+            flags |= flag;
+            return true;
+        }
+
     private:
         std::map<std::string, double> profiling_data_;
 
+        std::vector<EdgeId> invalidated_edges_;
+
+        static constexpr unsigned char ARRIVAL_FLAG = 0x1;
+        static constexpr unsigned char REQUIRED_FLAG = 0x2;
+        static constexpr unsigned char SLACK_FLAG = 0x4;
+
+        tatum::util::linear_map<NodeId,LevelId> node_levels_;
+        tatum::util::linear_map<NodeId,unsigned char> node_incr_flags_; //Which incremental traversals will re-visit each node
+        std::vector<NodeId> incr_flagged_nodes_; //Nodes with non-zero flags
+        std::vector<std::vector<NodeId>> incr_arrival_nodes_; //Indexed by level
+        std::vector<std::vector<NodeId>> incr_required_nodes_; //Indexed by level
+        std::vector<NodeId> incr_slack_nodes_;
+
         typedef std::chrono::duration<double> dsec;
         typedef std::chrono::high_resolution_clock Clock;
 };
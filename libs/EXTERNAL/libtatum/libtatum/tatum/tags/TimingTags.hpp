@@ -91,6 +91,9 @@ class TimingTags {
         ///Clears the tags in the current set
         void clear();
 
+        ///Clears the tags of the specified type in the current set
+        void clear(const TagType type);
+
     public:
 
         //Iterator definition
@@ -194,6 +194,37 @@ inline void TimingTags::clear() {
     num_data_required_tags_ = 0;
 }
 
+inline void TimingTags::clear(const TagType type) {
+    iterator first = begin(type);
+    iterator last = end(type);
+    size_t num_removed = std::distance(first, last);
+    if(num_removed == 0) return;
+
+    //Shift the tags of later types down over the removed tags
+    std::copy(last, end(), first);
+    size_ -= num_removed;
+
+    switch(type) {
+        case TagType::CLOCK_LAUNCH: 
+            num_clock_launch_tags_ = 0;
+            break;
+        case TagType::CLOCK_CAPTURE: 
+            num_clock_capture_tags_ = 0;
+            break;
+        case TagType::DATA_ARRIVAL: 
+            num_data_arrival_tags_ = 0;
+            break;
+        case TagType::DATA_REQUIRED: 
+            num_data_required_tags_ = 0;
+            break;
+        case TagType::SLACK: 
+            //Pass
+            break;
+        default:
+            TATUM_ASSERT_MSG(false, "Invalid tag type");
+    }
+}
+
 inline std::pair<bool,TimingTags::iterator> TimingTags::find_matching_tag(const TimingTag& tag, bool arr_must_be_valid) {
     if(arr_must_be_valid) {
         TATUM_ASSERT(tag.type() == TagType::DATA_REQUIRED);
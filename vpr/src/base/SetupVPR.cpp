@@ -82,6 +82,7 @@ void SetupVPR(const t_options* Options,
     FileNameOpts->ArchFile = Options->ArchFile;
     FileNameOpts->BlifFile = Options->BlifFile;
     FileNameOpts->NetFile = Options->NetFile;
+    FileNameOpts->write_binary_net_file = Options->write_binary_net_file;
     FileNameOpts->PlaceFile = Options->PlaceFile;
     FileNameOpts->RouteFile = Options->RouteFile;
     FileNameOpts->ActFile = Options->ActFile;
@@ -166,6 +167,7 @@ void SetupVPR(const t_options* Options,
     SetupTiming(*Options, TimingEnabled, Timing);
     SetupPackerOpts(*Options, PackerOpts);
     RoutingArch->write_rr_graph_filename = Options->write_rr_graph_file;
+    RoutingArch->write_rr_graph_nodes_and_edges_only = Options->write_rr_graph_nodes_and_edges_only;
     RoutingArch->read_rr_graph_filename = Options->read_rr_graph_file;
 
     //Setup the default flow, if no specific stages specified
@@ -368,9 +370,13 @@ static void SetupRouterOpts(const t_options& Options, t_router_opts* RouterOpts)
     RouterOpts->router_debug_net = Options.router_debug_net;
     RouterOpts->router_debug_sink_rr = Options.router_debug_sink_rr;
     RouterOpts->lookahead_type = Options.router_lookahead_type;
+    RouterOpts->router_heap = Options.router_heap;
     RouterOpts->max_convergence_count = Options.router_max_convergence_count;
     RouterOpts->reconvergence_cpd_threshold = Options.router_reconvergence_cpd_threshold;
     RouterOpts->first_iteration_timing_report_file = Options.router_first_iteration_timing_report_file;
+    RouterOpts->parallel_routing = Options.parallel_routing;
+    RouterOpts->parallel_routing_deterministic = Options.parallel_routing_deterministic;
+    RouterOpts->timing_update_type = Options.timing_update_type;
 
     RouterOpts->strict_checks = Options.strict_checks;
 
@@ -439,6 +445,7 @@ void SetupPackerOpts(const t_options& Options,
     PackerOpts->high_fanout_threshold = Options.pack_high_fanout_threshold;
     PackerOpts->transitive_fanout_threshold = Options.pack_transitive_fanout_threshold;
     PackerOpts->feasible_block_array_size = Options.pack_feasible_block_array_size;
+    PackerOpts->parallel_packing = Options.parallel_packing;
 
     //TODO: document?
     PackerOpts->inter_cluster_net_delay = 1.0; /* DEFAULT */
@@ -493,6 +500,7 @@ static void SetupPlacerOpts(const t_options& Options, t_placer_opts* PlacerOpts)
     PlacerOpts->delay_ramp_slope = Options.place_delay_ramp_slope;
     PlacerOpts->tsu_rel_margin = Options.place_tsu_rel_margin;
     PlacerOpts->tsu_abs_margin = Options.place_tsu_abs_margin;
+    PlacerOpts->timing_update_type = Options.timing_update_type;
     PlacerOpts->delay_model_type = Options.place_delay_model;
     PlacerOpts->delay_model_reducer = Options.place_delay_model_reducer;
 
@@ -503,6 +511,10 @@ static void SetupPlacerOpts(const t_options& Options, t_placer_opts* PlacerOpts)
 
     PlacerOpts->rlim_escape_fraction = Options.place_rlim_escape_fraction;
     PlacerOpts->move_stats_file = Options.place_move_stats_file;
+    PlacerOpts->parallel_placement = Options.parallel_placement;
+    PlacerOpts->parallel_placement_deterministic = Options.parallel_placement_deterministic;
+    PlacerOpts->move_generators = Options.place_move_generators;
+    PlacerOpts->adaptive_move_mix = Options.place_adaptive_move_mix;
 
     PlacerOpts->strict_checks = Options.strict_checks;
 
@@ -522,12 +534,15 @@ static void SetupAnalysisOpts(const t_options& Options, t_analysis_opts& analysi
     analysis_opts.timing_report_npaths = Options.timing_report_npaths;
     analysis_opts.timing_report_detail = Options.timing_report_detail;
     analysis_opts.timing_report_skew = Options.timing_report_skew;
+    analysis_opts.timing_update_type = Options.timing_update_type;
 }
 
 static void SetupPowerOpts(const t_options& Options, t_power_opts* power_opts, t_arch* Arch) {
     auto& device_ctx = g_vpr_ctx.mutable_device();
 
     power_opts->do_power = Options.do_power;
+    power_opts->read_power_characterization = Options.read_power_characterization;
+    power_opts->write_power_characterization = Options.write_power_characterization;
 
     if (power_opts->do_power) {
         if (!Arch->power)
@@ -256,6 +256,16 @@ static void ShowRouterOpts(const t_router_opts& RouterOpts) {
             VTR_LOG("RouterOpts.routing_budgets_algorithm = SCALE_DELAY\n");
         }
 
+        if (RouterOpts.router_heap == e_heap_type::BINARY_HEAP) {
+            VTR_LOG("RouterOpts.router_heap = BINARY_HEAP\n");
+        } else {
+            VTR_ASSERT(RouterOpts.router_heap == e_heap_type::FOUR_ARY_HEAP);
+            VTR_LOG("RouterOpts.router_heap = FOUR_ARY_HEAP\n");
+        }
+
+        VTR_LOG("RouterOpts.parallel_routing: %s\n", (RouterOpts.parallel_routing ? "true" : "false"));
+        VTR_LOG("RouterOpts.parallel_routing_deterministic: %s\n", (RouterOpts.parallel_routing_deterministic ? "true" : "false"));
+
     } else {
         VTR_ASSERT(GLOBAL == RouterOpts.route_type);
 
@@ -367,6 +377,10 @@ static void ShowPlacerOpts(const t_placer_opts& PlacerOpts,
         }
 
         VTR_LOG("PlaceOpts.seed: %d\n", PlacerOpts.seed);
+        VTR_LOG("PlacerOpts.parallel_placement: %s\n", (PlacerOpts.parallel_placement ? "true" : "false"));
+        VTR_LOG("PlacerOpts.parallel_placement_deterministic: %s\n", (PlacerOpts.parallel_placement_deterministic ? "true" : "false"));
+        VTR_LOG("PlacerOpts.move_generators: %s\n", PlacerOpts.move_generators.c_str());
+        VTR_LOG("PlacerOpts.adaptive_move_mix: %s\n", (PlacerOpts.adaptive_move_mix ? "true" : "false"));
 
         ShowAnnealSched(AnnealSched);
     }
@@ -384,6 +398,21 @@ static void ShowNetlistOpts(const t_netlist_opts& NetlistOpts) {
 
 static void ShowAnalysisOpts(const t_analysis_opts& AnalysisOpts) {
     VTR_LOG("AnalysisOpts.gen_post_synthesis_netlist: %s\n", (AnalysisOpts.gen_post_synthesis_netlist) ? "true" : "false");
+
+    VTR_LOG("AnalysisOpts.timing_update_type: ");
+    switch (AnalysisOpts.timing_update_type) {
+        case e_timing_update_type::FULL:
+            VTR_LOG("FULL\n");
+            break;
+        case e_timing_update_type::INCREMENTAL:
+            VTR_LOG("INCREMENTAL\n");
+            break;
+        case e_timing_update_type::AUTO:
+            VTR_LOG("AUTO\n");
+            break;
+        default:
+            VPR_FATAL_ERROR(VPR_ERROR_UNKNOWN, "<Unknown>\n");
+    }
     VTR_LOG("\n");
 }
 
@@ -428,6 +457,7 @@ static void ShowPackerOpts(const t_packer_opts& PackerOpts) {
     VTR_LOG("PackerOpts.hill_climbing_flag: %s", (PackerOpts.hill_climbing_flag ? "true\n" : "false\n"));
     VTR_LOG("PackerOpts.inter_cluster_net_delay: %f\n", PackerOpts.inter_cluster_net_delay);
     VTR_LOG("PackerOpts.timing_driven: %s", (PackerOpts.timing_driven ? "true\n" : "false\n"));
+    VTR_LOG("PackerOpts.parallel_packing: %s", (PackerOpts.parallel_packing ? "true\n" : "false\n"));
     VTR_LOG("PackerOpts.target_external_pin_util: %s", vtr::join(PackerOpts.target_external_pin_util, " ").c_str());
     VTR_LOG("\n");
 }
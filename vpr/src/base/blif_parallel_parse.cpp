@@ -0,0 +1,612 @@
+/*
+ * Parallel BLIF Parser
+ * ====================
+ *
+ * A drop-in alternative to libblifparse's flex/bison parser for large flattened
+ * netlists. The whole file is mmap'd and split into chunks which begin at a
+ * .names, .subckt or .latch statement (so no lexer state crosses a chunk boundary).
+ * Each chunk is tokenized and parsed independently into a list of statements,
+ * with line numbers relative to the start of the chunk.
+ *
+ * The statements are then replayed, in file order, through the blifparse::Callback
+ * interface, so the netlist is built exactly as it would be by blifparse (the netlist
+ * itself interns the names it is given). Chunks are parsed a window at a time, with
+ * the next window parsed while the current one is handed to the callback, which bounds
+ * the memory held by parsed-but-unconsumed statements.
+ *
+ * The accepted syntax is that of libblifparse: whitespace separated tokens, '='
+ * as a token of its own, '\' line continuations and '#' comments.
+ */
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "vtr_assert.h"
+#include "vtr_util.h"
+
+#include "blif_parallel_parse.h"
+
+#if defined(VPR_USE_TBB)
+#    include <tbb/parallel_for.h>
+#    include <tbb/task_arena.h>
+#    include <tbb/task_group.h>
+#endif
+
+//Target size of a chunk; each chunk ends at the first statement boundary past it
+constexpr size_t MIN_BLIF_CHUNK_BYTES = 1 << 20;
+constexpr size_t MAX_BLIF_CHUNK_BYTES = 16 << 20;
+
+//Number of chunks parsed together per worker
+constexpr size_t BLIF_CHUNKS_PER_WORKER = 2;
+
+namespace {
+
+//The read-only memory mapping of a file
+class BlifMappedFile {
+  public:
+    explicit BlifMappedFile(const char* filename) {
+        fd_ = open(filename, O_RDONLY);
+        if (fd_ < 0) return;
+
+        struct stat st;
+        if (fstat(fd_, &st) != 0) return;
+        size_ = st.st_size;
+
+        if (size_ > 0) {
+            void* data = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd_, 0);
+            if (data == MAP_FAILED) return;
+            data_ = static_cast<const char*>(data);
+            madvise(data, size_, MADV_SEQUENTIAL);
+        }
+        ok_ = true;
+    }
+
+    ~BlifMappedFile() {
+        if (data_) munmap(const_cast<char*>(data_), size_);
+        if (fd_ >= 0) close(fd_);
+    }
+
+    BlifMappedFile(const BlifMappedFile&) = delete;
+    BlifMappedFile& operator=(const BlifMappedFile&) = delete;
+
+    bool ok() const { return ok_; }
+    const char* begin() const { return data_; }
+    const char* end() const { return data_ + size_; }
+    size_t size() const { return size_; }
+
+  private:
+    int fd_ = -1;
+    size_t size_ = 0;
+    const char* data_ = nullptr;
+    bool ok_ = false;
+};
+
+enum class e_blif_stmt {
+    MODEL,
+    INPUTS,
+    OUTPUTS,
+    NAMES,
+    LATCH,
+    SUBCKT,
+    BLACKBOX,
+    END,
+    CONN,
+    CNAME,
+    ATTR,
+    PARAM
+};
+
+struct t_blif_stmt {
+    e_blif_stmt type;
+    int line; //Line of the statement, relative to the start of its chunk (0-based)
+
+    //Statement arguments:
+    // .names nets, .latch input/output/control, .subckt model then ports, otherwise in order
+    std::vector<std::string> strings;
+    std::vector<std::string> nets; //.subckt nets
+
+    std::vector<std::vector<blifparse::LogicValue>> so_cover;
+
+    blifparse::LatchType latch_type = blifparse::LatchType::UNSPECIFIED;
+    blifparse::LogicValue latch_init = blifparse::LogicValue::UNKOWN;
+};
+
+struct t_blif_chunk {
+    const char* begin = nullptr;
+    const char* end = nullptr;
+
+    int num_lines = 0; //Physical lines in the chunk
+    std::vector<t_blif_stmt> stmts;
+
+    //The first parse error (statements before it are still valid)
+    bool has_error = false;
+    int error_line = 0;
+    std::string error_near;
+    std::string error_msg;
+};
+
+struct t_blif_token {
+    const char* begin;
+    const char* end;
+
+    bool is(const char* str) const {
+        size_t len = end - begin;
+        return std::strlen(str) == len && std::strncmp(begin, str, len) == 0;
+    }
+    std::string str() const { return std::string(begin, end); }
+};
+
+//Tokenizes the physical lines of a chunk into logical lines
+class BlifLineTokenizer {
+  public:
+    BlifLineTokenizer(const char* begin, const char* end)
+        : p_(begin)
+        , end_(end) {}
+
+    //Loads the tokens of the next non-empty logical line, returns false at the end of the text
+    bool next_line(std::vector<t_blif_token>& tokens, int* line) {
+        tokens.clear();
+        while (p_ < end_) {
+            char c = *p_;
+            if (c == ' ' || c == '\t') {
+                ++p_;
+            } else if (c == '\n' || c == '\r') {
+                skip_endl();
+                if (!tokens.empty()) return true;
+            } else if (c == '\\' && is_endl(p_ + 1)) {
+                //Line continuation, which is ended by a following blank line
+                ++p_;
+                skip_endl();
+                while (p_ < end_ && (*p_ == ' ' || *p_ == '\t')) ++p_;
+                if (is_endl(p_)) {
+                    skip_endl();
+                    if (!tokens.empty()) return true;
+                }
+            } else if (c == '#') {
+                //Comment to end of line
+                while (p_ < end_ && !is_endl(p_)) ++p_;
+                if (p_ < end_) skip_endl();
+                if (!tokens.empty()) return true;
+            } else {
+                if (tokens.empty()) *line = line_;
+
+                const char* tok_begin = p_;
+                if (c == '=') {
+                    ++p_;
+                } else {
+                    while (p_ < end_ && !is_token_end(p_)) ++p_;
+                }
+                tokens.push_back({tok_begin, p_});
+            }
+        }
+        return !tokens.empty();
+    }
+
+    int num_lines() const { return line_; }
+
+  private:
+    bool is_endl(const char* p) const {
+        return p < end_ && (*p == '\n' || *p == '\r');
+    }
+
+    bool is_token_end(const char* p) const {
+        char c = *p;
+        return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '='
+               || (c == '\\' && is_endl(p + 1));
+    }
+
+    //Skips one end of line ("\n", "\n\r" or "\r\n")
+    void skip_endl() {
+        char c = *p_++;
+        if (p_ < end_ && ((c == '\n' && *p_ == '\r') || (c == '\r' && *p_ == '\n'))) ++p_;
+        ++line_;
+    }
+
+    const char* p_;
+    const char* end_;
+    int line_ = 0;
+};
+
+bool is_blif_directive(const t_blif_token& tok) {
+    static const char* directives[] = {".model", ".inputs", ".outputs", ".names", ".latch", ".subckt",
+                                       ".blackbox", ".end", ".conn", ".cname", ".attr", ".param"};
+    if (tok.begin == tok.end || *tok.begin != '.') return false;
+    for (const char* directive : directives) {
+        if (tok.is(directive)) return true;
+    }
+    return false;
+}
+
+//Returns true if a chunk may begin with the line starting at p
+bool is_blif_chunk_start(const char* p, const char* end) {
+    while (p < end && (*p == ' ' || *p == '\t')) ++p;
+
+    for (const char* directive : {".names", ".subckt", ".latch"}) {
+        size_t len = std::strlen(directive);
+        if (size_t(end - p) > len && std::strncmp(p, directive, len) == 0
+            && (p[len] == ' ' || p[len] == '\t' || p[len] == '\n' || p[len] == '\r')) {
+            return true;
+        }
+    }
+    return false;
+}
+
+//Returns the start of the first line at or after 'p' which a chunk may begin with,
+//or 'end' if there is none
+const char* find_blif_chunk_start(const char* begin, const char* p, const char* end) {
+    //Move to the start of a line
+    while (p < end && p > begin && p[-1] != '\n') ++p;
+
+    while (p < end) {
+        //The line must not continue the previous one
+        const char* prev_end = p - 1; //The previous line's '\n'
+        if (prev_end > begin && prev_end[-1] == '\r') --prev_end;
+        bool continued = prev_end > begin && prev_end[-1] == '\\';
+
+        if (!continued && is_blif_chunk_start(p, end)) return p;
+
+        //Next line
+        const char* nl = static_cast<const char*>(std::memchr(p, '\n', end - p));
+        if (!nl) return end;
+        p = nl + 1;
+    }
+    return end;
+}
+
+class BlifChunkParser {
+  public:
+    explicit BlifChunkParser(t_blif_chunk& chunk)
+        : chunk_(chunk)
+        , tokenizer_(chunk.begin, chunk.end) {}
+
+    void parse() {
+        std::vector<t_blif_token> tokens;
+        int line = 0;
+        bool in_so_cover = false;
+
+        while (tokenizer_.next_line(tokens, &line)) {
+            const t_blif_token& first = tokens[0];
+
+            bool ok = true;
+            if (!is_blif_directive(first)) {
+                if (in_so_cover) {
+                    ok = parse_so_cover_row(tokens, line);
+                } else {
+                    ok = error(line, first.str(), "syntax error, unexpected STRING");
+                }
+            } else {
+                in_so_cover = first.is(".names");
+                ok = parse_statement(tokens, line);
+            }
+
+            if (!ok) break;
+        }
+        chunk_.num_lines = tokenizer_.num_lines();
+    }
+
+  private:
+    bool parse_statement(const std::vector<t_blif_token>& tokens, int line) {
+        const t_blif_token& directive = tokens[0];
+        size_t num_args = tokens.size() - 1;
+
+        //Only .subckt connections use '='
+        if (!directive.is(".subckt")) {
+            for (size_t i = 1; i < tokens.size(); ++i) {
+                if (tokens[i].is("=")) return error(line, "=", "syntax error, unexpected EQ");
+            }
+        }
+
+        t_blif_stmt stmt;
+        stmt.line = line;
+
+        if (directive.is(".model")) {
+            if (num_args != 1) return error(line, directive.str(), "syntax error, expected a single .model name");
+            stmt.type = e_blif_stmt::MODEL;
+        } else if (directive.is(".inputs")) {
+            stmt.type = e_blif_stmt::INPUTS;
+        } else if (directive.is(".outputs")) {
+            stmt.type = e_blif_stmt::OUTPUTS;
+        } else if (directive.is(".names")) {
+            stmt.type = e_blif_stmt::NAMES;
+        } else if (directive.is(".latch")) {
+            stmt.type = e_blif_stmt::LATCH;
+            return parse_latch(tokens, stmt);
+        } else if (directive.is(".subckt")) {
+            stmt.type = e_blif_stmt::SUBCKT;
+            return parse_subckt(tokens, stmt);
+        } else if (directive.is(".blackbox")) {
+            if (num_args != 0) return error(line, tokens[1].str(), "syntax error, unexpected STRING");
+            stmt.type = e_blif_stmt::BLACKBOX;
+        } else if (directive.is(".end")) {
+            if (num_args != 0) return error(line, tokens[1].str(), "syntax error, unexpected STRING");
+            stmt.type = e_blif_stmt::END;
+        } else if (directive.is(".conn")) {
+            if (num_args != 2) return error(line, directive.str(), "syntax error, expected .conn source and destination");
+            stmt.type = e_blif_stmt::CONN;
+        } else if (directive.is(".cname")) {
+            if (num_args != 1) return error(line, directive.str(), "syntax error, expected a single .cname name");
+            stmt.type = e_blif_stmt::CNAME;
+        } else if (directive.is(".attr") || directive.is(".param")) {
+            if (num_args != 1 && num_args != 2) return error(line, directive.str(), "syntax error, expected a name and optional value");
+            stmt.type = directive.is(".attr") ? e_blif_stmt::ATTR : e_blif_stmt::PARAM;
+        } else {
+            VTR_ASSERT_MSG(false, "Unhandled BLIF directive");
+        }
+
+        for (size_t i = 1; i < tokens.size(); ++i) {
+            stmt.strings.push_back(tokens[i].str());
+        }
+        if ((stmt.type == e_blif_stmt::ATTR || stmt.type == e_blif_stmt::PARAM) && num_args == 1) {
+            stmt.strings.emplace_back(); //No value
+        }
+
+        chunk_.stmts.push_back(std::move(stmt));
+        return true;
+    }
+
+    bool parse_so_cover_row(const std::vector<t_blif_token>& tokens, int line) {
+        VTR_ASSERT(!chunk_.stmts.empty() && chunk_.stmts.back().type == e_blif_stmt::NAMES);
+        t_blif_stmt& names = chunk_.stmts.back();
+
+        std::vector<blifparse::LogicValue> row;
+        for (const t_blif_token& tok : tokens) {
+            for (const char* p = tok.begin; p != tok.end; ++p) {
+                if (*p == '0') {
+                    row.push_back(blifparse::LogicValue::FALSE);
+                } else if (*p == '1') {
+                    row.push_back(blifparse::LogicValue::TRUE);
+                } else if (*p == '-') {
+                    row.push_back(blifparse::LogicValue::DONT_CARE);
+                } else {
+                    chunk_.stmts.pop_back(); //Incomplete .names
+                    return error(line, std::string(1, *p), "Unrecognized character");
+                }
+            }
+        }
+
+        if (row.size() != names.strings.size()) {
+            std::string msg = vtr::string_fmt("Mismatched .names single-output cover row."
+                                              " names connected to %zu net(s), but cover row has %zu element(s)",
+                                              names.strings.size(), row.size());
+            chunk_.stmts.pop_back();
+            return error(line, tokens.back().str(), msg);
+        }
+        names.so_cover.push_back(std::move(row));
+        return true;
+    }
+
+    bool parse_latch(const std::vector<t_blif_token>& tokens, t_blif_stmt& stmt) {
+        size_t num_args = tokens.size() - 1;
+        if (num_args < 2 || num_args > 5) {
+            return error(stmt.line, tokens[0].str(), "syntax error, invalid number of .latch arguments");
+        }
+
+        std::string control;
+        size_t iinit = 0;
+        if (num_args >= 4) {
+            //Type and control
+            const t_blif_token& type = tokens[3];
+            if (type.is("fe")) {
+                stmt.latch_type = blifparse::LatchType::FALLING_EDGE;
+            } else if (type.is("re")) {
+                stmt.latch_type = blifparse::LatchType::RISING_EDGE;
+            } else if (type.is("ah")) {
+                stmt.latch_type = blifparse::LatchType::ACTIVE_HIGH;
+            } else if (type.is("al")) {
+                stmt.latch_type = blifparse::LatchType::ACTIVE_LOW;
+            } else if (type.is("as")) {
+                stmt.latch_type = blifparse::LatchType::ASYNCHRONOUS;
+            } else {
+                return error(stmt.line, type.str(), "syntax error, invalid .latch type");
+            }
+
+            if (!tokens[4].is("NIL")) control = tokens[4].str();
+
+            if (num_args == 5) iinit = 5;
+        } else if (num_args == 3) {
+            iinit = 3;
+        }
+
+        if (iinit) {
+            const t_blif_token& init = tokens[iinit];
+            if (init.is("0")) {
+                stmt.latch_init = blifparse::LogicValue::FALSE;
+            } else if (init.is("1")) {
+                stmt.latch_init = blifparse::LogicValue::TRUE;
+            } else if (init.is("2")) {
+                stmt.latch_init = blifparse::LogicValue::DONT_CARE;
+            } else if (init.is("3")) {
+                stmt.latch_init = blifparse::LogicValue::UNKOWN;
+            } else {
+                return error(stmt.line, init.str(), "syntax error, invalid .latch initial value");
+            }
+        }
+
+        stmt.strings = {tokens[1].str(), tokens[2].str(), std::move(control)};
+        chunk_.stmts.push_back(std::move(stmt));
+        return true;
+    }
+
+    bool parse_subckt(const std::vector<t_blif_token>& tokens, t_blif_stmt& stmt) {
+        if (tokens.size() < 2 || tokens[1].is("=")) {
+            return error(stmt.line, tokens[0].str(), "syntax error, expected a .subckt model name");
+        }
+        stmt.strings.push_back(tokens[1].str());
+
+        //port=net connections
+        size_t num_conns = (tokens.size() - 2) / 3;
+        if ((tokens.size() - 2) % 3 != 0) {
+            return error(stmt.line, tokens.back().str(),
+                         vtr::string_fmt("Mismatched subckt port and net connection(s) size do not match"
+                                         " (%zu ports, %zu nets)",
+                                         num_conns + 1, num_conns));
+        }
+        stmt.nets.reserve(num_conns);
+        for (size_t i = 2; i < tokens.size(); i += 3) {
+            if (tokens[i].is("=") || !tokens[i + 1].is("=") || tokens[i + 2].is("=")) {
+                return error(stmt.line, tokens[i].str(), "syntax error, expected port=net");
+            }
+            stmt.strings.push_back(tokens[i].str());
+            stmt.nets.push_back(tokens[i + 2].str());
+        }
+
+        chunk_.stmts.push_back(std::move(stmt));
+        return true;
+    }
+
+    bool error(int line, std::string near_text, std::string msg) {
+        chunk_.has_error = true;
+        chunk_.error_line = line;
+        chunk_.error_near = std::move(near_text);
+        chunk_.error_msg = std::move(msg);
+        return false;
+    }
+
+    t_blif_chunk& chunk_;
+    BlifLineTokenizer tokenizer_;
+};
+
+void parse_blif_chunks(std::vector<t_blif_chunk>& chunks, size_t begin, size_t end) {
+#if defined(VPR_USE_TBB)
+    tbb::parallel_for(begin, end, [&](size_t ichunk) {
+        BlifChunkParser(chunks[ichunk]).parse();
+    });
+#else
+    for (size_t ichunk = begin; ichunk < end; ++ichunk) {
+        BlifChunkParser(chunks[ichunk]).parse();
+    }
+#endif
+}
+
+//Hands the statements of a parsed chunk to the callback, returns false if the chunk had a parse error
+bool replay_blif_chunk(t_blif_chunk& chunk, int first_line, blifparse::Callback& callback) {
+    for (t_blif_stmt& stmt : chunk.stmts) {
+        callback.lineno(first_line + stmt.line);
+
+        auto& strs = stmt.strings;
+        switch (stmt.type) {
+            case e_blif_stmt::MODEL:
+                callback.begin_model(std::move(strs[0]));
+                break;
+            case e_blif_stmt::INPUTS:
+                callback.inputs(std::move(strs));
+                break;
+            case e_blif_stmt::OUTPUTS:
+                callback.outputs(std::move(strs));
+                break;
+            case e_blif_stmt::NAMES:
+                callback.names(std::move(strs), std::move(stmt.so_cover));
+                break;
+            case e_blif_stmt::LATCH:
+                callback.latch(std::move(strs[0]), std::move(strs[1]), stmt.latch_type, std::move(strs[2]), stmt.latch_init);
+                break;
+            case e_blif_stmt::SUBCKT: {
+                std::string model = std::move(strs[0]);
+                strs.erase(strs.begin());
+                callback.subckt(std::move(model), std::move(strs), std::move(stmt.nets));
+                break;
+            }
+            case e_blif_stmt::BLACKBOX:
+                callback.blackbox();
+                break;
+            case e_blif_stmt::END:
+                callback.end_model();
+                break;
+            case e_blif_stmt::CONN:
+                callback.conn(std::move(strs[0]), std::move(strs[1]));
+                break;
+            case e_blif_stmt::CNAME:
+                callback.cname(std::move(strs[0]));
+                break;
+            case e_blif_stmt::ATTR:
+                callback.attr(std::move(strs[0]), std::move(strs[1]));
+                break;
+            case e_blif_stmt::PARAM:
+                callback.param(std::move(strs[0]), std::move(strs[1]));
+                break;
+        }
+    }
+
+    //Release the chunk's statements
+    std::vector<t_blif_stmt>().swap(chunk.stmts);
+
+    if (chunk.has_error) {
+        callback.parse_error(first_line + chunk.error_line, chunk.error_near, chunk.error_msg);
+        return false;
+    }
+    return true;
+}
+
+} // namespace
+
+void blif_parse_filename_parallel(const char* filename, blifparse::Callback& callback) {
+    BlifMappedFile file(filename);
+    if (!file.ok()) {
+        callback.parse_error(0, "", vtr::string_fmt("Could not open file '%s'.\n", filename));
+        return;
+    }
+
+    size_t num_workers = 1;
+#if defined(VPR_USE_TBB)
+    num_workers = tbb::this_task_arena::max_concurrency();
+#endif
+
+    //Split the file into chunks
+    size_t chunk_bytes = file.size() / (BLIF_CHUNKS_PER_WORKER * num_workers);
+    chunk_bytes = std::max(MIN_BLIF_CHUNK_BYTES, std::min(MAX_BLIF_CHUNK_BYTES, chunk_bytes));
+
+    std::vector<t_blif_chunk> chunks;
+    const char* p = file.begin();
+    while (p < file.end()) {
+        t_blif_chunk chunk;
+        chunk.begin = p;
+        if (size_t(file.end() - p) <= chunk_bytes) {
+            chunk.end = file.end();
+        } else {
+            chunk.end = find_blif_chunk_start(file.begin(), p + chunk_bytes, file.end());
+        }
+        p = chunk.end;
+        chunks.push_back(std::move(chunk));
+    }
+
+    callback.start_parse();
+    callback.filename(filename);
+
+    //Parse a window of chunks while the previous window is replayed
+    size_t window = BLIF_CHUNKS_PER_WORKER * num_workers;
+    int first_line = 1;
+
+    parse_blif_chunks(chunks, 0, std::min(window, chunks.size()));
+    for (size_t begin = 0; begin < chunks.size(); begin += window) {
+        size_t end = std::min(begin + window, chunks.size());
+        size_t next_end = std::min(end + window, chunks.size());
+
+        bool ok = true;
+#if defined(VPR_USE_TBB)
+        tbb::task_group g;
+        g.run([&] {
+            parse_blif_chunks(chunks, end, next_end);
+        });
+#endif
+
+        for (size_t ichunk = begin; ok && ichunk < end; ++ichunk) {
+            ok = replay_blif_chunk(chunks[ichunk], first_line, callback);
+            first_line += chunks[ichunk].num_lines;
+        }
+
+#if defined(VPR_USE_TBB)
+        g.wait();
+#else
+        if (ok) parse_blif_chunks(chunks, end, next_end);
+#endif
+        if (!ok) break;
+    }
+
+    callback.finish_parse();
+}
@@ -0,0 +1,14 @@
+#ifndef BLIF_PARALLEL_PARSE_H
+#define BLIF_PARALLEL_PARSE_H
+#include "blifparse.hpp"
+
+//Parses the BLIF/EBLIF file 'filename' calling the same blifparse::Callback methods,
+//in the same order, as blifparse::blif_parse_filename().
+//
+//The file is mmap'd and split into chunks at .names/.subckt/.latch statements. The
+//chunks are tokenized and parsed in parallel (up to the number of VPR workers), and
+//their statements handed to 'callback' in file order. Parsing of later chunks overlaps
+//with the (serial) callbacks of earlier ones.
+void blif_parse_filename_parallel(const char* filename, blifparse::Callback& callback);
+
+#endif
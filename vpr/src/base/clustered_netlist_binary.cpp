@@ -0,0 +1,555 @@
+/*
+ * Binary (capnproto) packed netlist reader and writer.
+ *
+ * The writer records every cluster's pb tree in pre-order, exactly as it is
+ * held in memory (including unused pbs and the routing-only pbs of .net files),
+ * together with the cluster's pb_route. The reader rebuilds the same pb trees
+ * and pb_routes directly, so the derivations the .net reader performs (pin
+ * name parsing, interconnect look-ups and net propagation through pb_route)
+ * are not repeated.
+ */
+
+#include <cstring>
+#include <limits>
+#include <unordered_map>
+
+#include "vtr_assert.h"
+#include "vtr_log.h"
+#include "vtr_time.h"
+#include "vtr_util.h"
+#include "vtr_memory.h"
+#include "vtr_version.h"
+
+#include "vpr_error.h"
+#include "vpr_utils.h"
+#include "globals.h"
+#include "atom_netlist.h"
+
+#include "clustered_netlist_binary.h"
+
+#ifdef VTR_ENABLE_CAPNPROTO
+#    include "capnp/serialize.h"
+#    include "clustered_netlist.capnp.h"
+#    include "mmap_file.h"
+#    include "serdes_utils.h"
+#endif /* VTR_ENABLE_CAPNPROTO */
+
+bool is_binary_netlist_file(const char* file_name) {
+    return vtr::check_file_name_extension(file_name, ".bin");
+}
+
+// When writing capnp targetted serialization, always allow compilation when
+// VTR_ENABLE_CAPNPROTO=OFF.  Generally this means throwing an exception
+// instead.
+//
+#ifndef VTR_ENABLE_CAPNPROTO
+
+#    define DISABLE_ERROR                               \
+        "is disable because VTR_ENABLE_CAPNPROTO=OFF." \
+        "Re-compile with CMake option VTR_ENABLE_CAPNPROTO=ON to enable."
+
+ClusteredNetlist read_binary_netlist_clusters(const char* /*net_file*/,
+                                              const t_arch* /*arch*/,
+                                              bool /*verify_file_digests*/,
+                                              int* /*num_primitives*/) {
+    VPR_THROW(VPR_ERROR_NET_F, "Reading a binary packed netlist " DISABLE_ERROR);
+}
+
+void write_binary_netlist(const char* /*file_name*/, const ClusteredNetlist& /*clb_nlist*/, const t_arch* /*arch*/) {
+    VPR_THROW(VPR_ERROR_NET_F, "Writing a binary packed netlist " DISABLE_ERROR);
+}
+
+#else /* VTR_ENABLE_CAPNPROTO */
+
+/* A pb in the pre-order of its cluster's pb tree */
+struct t_bin_pb {
+    const t_pb* pb;
+    int parent;
+    int child_type;
+    int child_index;
+};
+
+/*********************** Subroutines local to this module *******************/
+static ClusteredNetlist load_bin_netlist(const VprClusteredNetlist::Reader& netlist,
+                                         const char* net_file,
+                                         const t_arch* arch,
+                                         bool verify_file_digests,
+                                         int* num_primitives);
+static void verify_bin_netlist_id(const char* net_file, const char* what, const std::string& file_id, const std::string& loaded_id, bool verify_file_digests);
+static std::vector<t_logical_block_type_ptr> load_bin_block_types(const capnp::List<capnp::Text>::Reader& block_types);
+static std::vector<AtomNetId> load_bin_net_names(const capnp::List<capnp::Text>::Reader& net_names);
+static void load_bin_block(const NetBlock::Reader& block,
+                           const std::vector<t_logical_block_type_ptr>& block_types,
+                           const std::vector<AtomNetId>& nets,
+                           const IntraLbPbPinLookup& pb_gpin_lookup,
+                           ClusteredNetlist* clb_nlist,
+                           int* num_primitives);
+static void load_bin_pbs(const capnp::List<NetPb>::Reader& bin_pbs,
+                         const ClusterBlockId index,
+                         t_logical_block_type_ptr type,
+                         t_pb* clb_pb,
+                         const IntraLbPbPinLookup& pb_gpin_lookup,
+                         int* num_primitives);
+static void load_bin_pb_routes(const capnp::List<NetPbRoute>::Reader& routes,
+                               const std::vector<AtomNetId>& nets,
+                               t_logical_block_type_ptr type,
+                               const IntraLbPbPinLookup& pb_gpin_lookup,
+                               t_pb* clb_pb);
+
+static void collect_bin_pbs(const t_pb* pb, int parent, int child_type, int child_index, std::vector<t_bin_pb>& bin_pbs);
+static void write_bin_pb(NetPb::Builder bin_pb, const t_bin_pb& pb_info);
+static void write_bin_pb_routes(capnp::List<NetPbRoute>::Builder routes, const t_pb_routes& pb_route, std::unordered_map<AtomNetId, int>& net_indices, std::vector<AtomNetId>& nets);
+
+/************************ Subroutine definitions ****************************/
+
+ClusteredNetlist read_binary_netlist_clusters(const char* net_file,
+                                              const t_arch* arch,
+                                              bool verify_file_digests,
+                                              int* num_primitives) {
+    vtr::ScopedStartFinishTimer timer("Loading binary packed netlist");
+
+    //capnp only validates the message as it is read, reporting truncated or
+    //corrupt files (or files which are not capnp messages at all) by throwing
+    try {
+        /* The file is mmap'd and read in place, only VPR's own data structures are built */
+        MmapFile f(net_file);
+
+        //Large packed netlists are well past capnp's default traversal limit
+        //(which guards against malicious messages, not large ones)
+        ::capnp::ReaderOptions options;
+        options.traversalLimitInWords = std::numeric_limits<uint64_t>::max();
+        ::capnp::FlatArrayMessageReader reader(f.getData(), options);
+
+        return load_bin_netlist(reader.getRoot<VprClusteredNetlist>(), net_file, arch, verify_file_digests, num_primitives);
+    } catch (const VprError&) {
+        throw;
+    } catch (const vtr::VtrError& e) { //Failed to map the file
+        VPR_FATAL_ERROR(VPR_ERROR_NET_F,
+                        "Failed to read binary packed netlist '%s': %s\n", net_file, e.what());
+    } catch (const kj::Exception& e) {
+        VPR_FATAL_ERROR(VPR_ERROR_NET_F,
+                        "Failed to read binary packed netlist '%s' (truncated or not a binary packed netlist?): %s\n",
+                        net_file, e.getDescription().cStr());
+    }
+}
+
+static ClusteredNetlist load_bin_netlist(const VprClusteredNetlist::Reader& netlist,
+                                         const char* net_file,
+                                         const t_arch* arch,
+                                         bool verify_file_digests,
+                                         int* num_primitives) {
+    if (netlist.hasToolVersion() && strcmp(netlist.getToolVersion().cStr(), vtr::VERSION) != 0) {
+        VTR_LOG_WARN("Packed netlist file '%s' was written by VPR %s while your current VPR version is %s compatability issues may arise\n",
+                     net_file, netlist.getToolVersion().cStr(), vtr::VERSION);
+    }
+
+    verify_bin_netlist_id(net_file, "architecture", netlist.getArchitectureId().cStr(), arch->architecture_id, verify_file_digests);
+    verify_bin_netlist_id(net_file, "atom netlist", netlist.getAtomNetlistId().cStr(), g_vpr_ctx.atom().nlist.netlist_id(), verify_file_digests);
+
+    //The netlist keeps the id of the packed netlist it was written from, so
+    //placements made for that netlist remain valid for this one
+    ClusteredNetlist clb_nlist(net_file, netlist.getNetlistId().cStr());
+
+    std::vector<t_logical_block_type_ptr> block_types = load_bin_block_types(netlist.getBlockTypes());
+    std::vector<AtomNetId> nets = load_bin_net_names(netlist.getNetNames());
+
+    IntraLbPbPinLookup pb_gpin_lookup(g_vpr_ctx.device().logical_block_types);
+
+    auto blocks = netlist.getBlocks();
+    if (blocks.size() == 0) {
+        VTR_LOG_WARN("Packed netlist contains no clustered blocks\n");
+    }
+    for (const auto& block : blocks) {
+        load_bin_block(block, block_types, nets, pb_gpin_lookup, &clb_nlist, num_primitives);
+    }
+    VTR_ASSERT(clb_nlist.blocks().size() == blocks.size());
+
+    return clb_nlist;
+}
+
+static void verify_bin_netlist_id(const char* net_file, const char* what, const std::string& file_id, const std::string& loaded_id, bool verify_file_digests) {
+    if (file_id == loaded_id) {
+        return;
+    }
+
+    auto msg = vtr::string_fmt(
+        "Netlist was generated from a different %s file"
+        " (loaded %s ID: %s, packed netlist %s ID: %s)",
+        what, what, loaded_id.c_str(), what, file_id.c_str());
+    if (verify_file_digests) {
+        vpr_throw(VPR_ERROR_NET_F, net_file, 0, msg.c_str());
+    } else {
+        VTR_LOGF_WARN(net_file, 0, "%s\n", msg.c_str());
+    }
+}
+
+static std::vector<t_logical_block_type_ptr> load_bin_block_types(const capnp::List<capnp::Text>::Reader& block_types) {
+    auto& device_ctx = g_vpr_ctx.device();
+
+    std::vector<t_logical_block_type_ptr> types;
+    types.reserve(block_types.size());
+    for (const auto& type_name : block_types) {
+        t_logical_block_type_ptr found_type = nullptr;
+        for (const auto& type : device_ctx.logical_block_types) {
+            if (strcmp(type.name, type_name.cStr()) == 0) {
+                found_type = &type;
+                break;
+            }
+        }
+        //Types absent from the architecture are only an error if a cluster uses them
+        types.push_back(found_type);
+    }
+    return types;
+}
+
+static std::vector<AtomNetId> load_bin_net_names(const capnp::List<capnp::Text>::Reader& net_names) {
+    auto& atom_ctx = g_vpr_ctx.atom();
+
+    std::vector<AtomNetId> nets;
+    nets.reserve(net_names.size());
+    for (const auto& net_name : net_names) {
+        AtomNetId net_id = atom_ctx.nlist.find_net(net_name.cStr());
+        if (!net_id) {
+            VPR_FATAL_ERROR(VPR_ERROR_NET_F,
+                            ".blif and .net do not match, unknown net %s found in .net file.\n",
+                            net_name.cStr());
+        }
+        nets.push_back(net_id);
+    }
+    return nets;
+}
+
+static void load_bin_block(const NetBlock::Reader& block,
+                           const std::vector<t_logical_block_type_ptr>& block_types,
+                           const std::vector<AtomNetId>& nets,
+                           const IntraLbPbPinLookup& pb_gpin_lookup,
+                           ClusteredNetlist* clb_nlist,
+                           int* num_primitives) {
+    auto& atom_ctx = g_vpr_ctx.mutable_atom();
+
+    const char* block_name = block.getName().cStr();
+    if (block.getType() >= block_types.size() || block_types[block.getType()] == nullptr) {
+        VPR_FATAL_ERROR(VPR_ERROR_NET_F,
+                        "Unknown cb type for cb %s in packed netlist.\n", block_name);
+    }
+    t_logical_block_type_ptr type = block_types[block.getType()];
+    const t_pb_type* pb_type = type->pb_type;
+
+    t_pb* pb = new t_pb;
+    pb->name = vtr::strdup(block_name);
+    ClusterBlockId index = clb_nlist->create_block(block_name, pb, type);
+    pb->pb_graph_node = type->pb_graph_head;
+    atom_ctx.lookup.set_atom_pb(AtomBlockId::INVALID(), pb);
+
+    //Create the ports of the cluster
+    for (int iport = 0; iport < pb_type->num_ports; iport++) {
+        const t_port& port = pb_type->ports[iport];
+        PortType port_type = PortType::OUTPUT;
+        if (port.type == IN_PORT) {
+            port_type = port.is_clock ? PortType::CLOCK : PortType::INPUT;
+        }
+        clb_nlist->create_port(index, port.name, port.num_pins, port_type);
+    }
+
+    load_bin_pbs(block.getPbs(), index, type, pb, pb_gpin_lookup, num_primitives);
+    load_bin_pb_routes(block.getRoutes(), nets, type, pb_gpin_lookup, pb);
+}
+
+static void load_bin_pbs(const capnp::List<NetPb>::Reader& bin_pbs,
+                         const ClusterBlockId index,
+                         t_logical_block_type_ptr type,
+                         t_pb* clb_pb,
+                         const IntraLbPbPinLookup& pb_gpin_lookup,
+                         int* num_primitives) {
+    auto& atom_ctx = g_vpr_ctx.mutable_atom();
+    unsigned int itype = type->index;
+
+    if (bin_pbs.size() == 0 || bin_pbs[0].getParent() != OPEN) {
+        VPR_FATAL_ERROR(VPR_ERROR_NET_F,
+                        "Packed netlist cluster %s has no top-level pb.\n", clb_pb->name);
+    }
+
+    std::vector<t_pb*> pbs(bin_pbs.size(), nullptr);
+    for (unsigned int ipb = 0; ipb < bin_pbs.size(); ipb++) {
+        auto bin_pb = bin_pbs[ipb];
+
+        t_pb* pb = nullptr;
+        if (ipb == 0) {
+            pb = clb_pb;
+        } else {
+            int iparent = bin_pb.getParent();
+            if (iparent < 0 || iparent >= (int)ipb || pbs[iparent]->child_pbs == nullptr) {
+                VPR_FATAL_ERROR(VPR_ERROR_NET_F,
+                                "Invalid parent pb %d for pb %u of cluster %s.\n", iparent, ipb, clb_pb->name);
+            }
+            t_pb* parent = pbs[iparent];
+            const t_mode& parent_mode = parent->pb_graph_node->pb_type->modes[parent->mode];
+
+            int child_type = bin_pb.getChildType();
+            int child_index = bin_pb.getChildIndex();
+            if (child_type < 0 || child_type >= parent_mode.num_pb_type_children
+                || child_index < 0 || child_index >= parent_mode.pb_type_children[child_type].num_pb) {
+                VPR_FATAL_ERROR(VPR_ERROR_NET_F,
+                                "Invalid child pb %d[%d] of %s in cluster %s.\n",
+                                child_type, child_index, parent->pb_graph_node->pb_type->name, clb_pb->name);
+            }
+
+            pb = &parent->child_pbs[child_type][child_index];
+            pb->pb_graph_node = &parent->pb_graph_node->child_pb_graph_nodes[parent->mode][child_type][child_index];
+            if (bin_pb.getLinked()) {
+                pb->parent_pb = parent;
+            }
+            if (bin_pb.hasName()) {
+                pb->name = vtr::strdup(bin_pb.getName().cStr());
+            }
+            atom_ctx.lookup.set_atom_pb(AtomBlockId::INVALID(), pb);
+        }
+        pbs[ipb] = pb;
+
+        const t_pb_type* pb_type = pb->pb_graph_node->pb_type;
+        pb->mode = bin_pb.getMode();
+        if (pb_type->num_modes > 0 && (pb->mode < 0 || pb->mode >= pb_type->num_modes)) {
+            VPR_FATAL_ERROR(VPR_ERROR_NET_F,
+                            "Unknown mode %d for pb %s in cluster %s.\n", pb->mode, pb_type->name, clb_pb->name);
+        }
+
+        if (bin_pb.getHasChildren()) {
+            const t_mode& mode = pb_type->modes[pb->mode];
+            pb->child_pbs = new t_pb*[mode.num_pb_type_children];
+            for (int i = 0; i < mode.num_pb_type_children; i++) {
+                pb->child_pbs[i] = new t_pb[mode.pb_type_children[i].num_pb];
+            }
+        }
+
+        if (pb_type->num_modes == 0 && pb->name != nullptr) {
+            /* A primitive type */
+            AtomBlockId blk_id = atom_ctx.nlist.find_block(pb->name);
+            if (!blk_id) {
+                VPR_FATAL_ERROR(VPR_ERROR_NET_F,
+                                ".net file and .blif file do not match, encountered unknown primitive %s in .net file.\n",
+                                pb->name);
+            }
+
+            //Update atom netlist mapping
+            atom_ctx.lookup.set_atom_pb(blk_id, pb);
+            atom_ctx.lookup.set_atom_clb(blk_id, index);
+
+            for (const auto& rotation : bin_pb.getPinRotations()) {
+                int rotated_pin = rotation.getPin();
+                if (rotated_pin < 0 || rotated_pin >= clb_pb->pb_graph_node->total_pb_pins) {
+                    VPR_FATAL_ERROR(VPR_ERROR_NET_F,
+                                    "Invalid rotated pin %d of primitive %s in cluster %s.\n", rotated_pin, pb->name, clb_pb->name);
+                }
+                const t_pb_graph_pin* pb_gpin = pb_gpin_lookup.pb_gpin(itype, rotated_pin);
+                VTR_ASSERT(pb_gpin);
+                pb->set_atom_pin_bit_index(pb_gpin, rotation.getAtomPinBitIndex());
+            }
+
+            (*num_primitives)++;
+        }
+    }
+}
+
+static void load_bin_pb_routes(const capnp::List<NetPbRoute>::Reader& routes,
+                               const std::vector<AtomNetId>& nets,
+                               t_logical_block_type_ptr type,
+                               const IntraLbPbPinLookup& pb_gpin_lookup,
+                               t_pb* clb_pb) {
+    unsigned int itype = type->index;
+    int num_pins = clb_pb->pb_graph_node->total_pb_pins;
+
+    std::vector<std::pair<int, t_pb_route>> pb_routes;
+    pb_routes.reserve(routes.size());
+    for (const auto& route : routes) {
+        int ipin = route.getPin();
+        if (ipin < 0 || ipin >= num_pins) {
+            VPR_FATAL_ERROR(VPR_ERROR_NET_F,
+                            "Invalid pin %d in the routing of cluster %s.\n", ipin, clb_pb->name);
+        }
+
+        t_pb_route pb_route;
+        int inet = route.getAtomNet();
+        if (inet != OPEN) {
+            if (inet < 0 || inet >= (int)nets.size()) {
+                VPR_FATAL_ERROR(VPR_ERROR_NET_F,
+                                "Invalid atom net %d on pin %d in the routing of cluster %s.\n", inet, ipin, clb_pb->name);
+            }
+            pb_route.atom_net_id = nets[inet];
+        }
+
+        //The cluster's pb pins are exactly those of the pb graph pin look-up
+        //for its type, so are checked against the same count
+        pb_route.driver_pb_pin_id = route.getDriverPin();
+        if (pb_route.driver_pb_pin_id != OPEN && (pb_route.driver_pb_pin_id < 0 || pb_route.driver_pb_pin_id >= num_pins)) {
+            VPR_FATAL_ERROR(VPR_ERROR_NET_F,
+                            "Invalid driver pin %d of pin %d in the routing of cluster %s.\n", pb_route.driver_pb_pin_id, ipin, clb_pb->name);
+        }
+
+        auto sink_pins = route.getSinkPins();
+        pb_route.sink_pb_pin_ids.reserve(sink_pins.size());
+        for (int sink_pin : sink_pins) {
+            if (sink_pin < 0 || sink_pin >= num_pins) {
+                VPR_FATAL_ERROR(VPR_ERROR_NET_F,
+                                "Invalid sink pin %d of pin %d in the routing of cluster %s.\n", sink_pin, ipin, clb_pb->name);
+            }
+            pb_route.sink_pb_pin_ids.push_back(sink_pin);
+        }
+
+        int graph_pin = route.getGraphPin();
+        if (graph_pin != OPEN) {
+            if (graph_pin < 0 || graph_pin >= num_pins) {
+                VPR_FATAL_ERROR(VPR_ERROR_NET_F,
+                                "Invalid pb graph pin %d of pin %d in the routing of cluster %s.\n", graph_pin, ipin, clb_pb->name);
+            }
+            pb_route.pb_graph_pin = pb_gpin_lookup.pb_gpin(itype, graph_pin);
+        }
+
+        pb_routes.emplace_back(ipin, std::move(pb_route));
+    }
+
+    clb_pb->pb_route = vtr::make_flat_map2(std::move(pb_routes));
+}
+
+void write_binary_netlist(const char* file_name, const ClusteredNetlist& clb_nlist, const t_arch* arch) {
+    vtr::ScopedStartFinishTimer timer("Writing binary packed netlist");
+
+    auto& device_ctx = g_vpr_ctx.device();
+    auto& atom_ctx = g_vpr_ctx.atom();
+
+    ::capnp::MallocMessageBuilder builder;
+
+    auto netlist = builder.initRoot<VprClusteredNetlist>();
+
+    netlist.setToolVersion(vtr::VERSION);
+    netlist.setNetlistId(clb_nlist.netlist_id());
+    netlist.setArchitectureId(arch->architecture_id);
+    netlist.setAtomNetlistId(atom_ctx.nlist.netlist_id());
+
+    auto block_types = netlist.initBlockTypes(device_ctx.logical_block_types.size());
+    for (const auto& type : device_ctx.logical_block_types) {
+        block_types.set(type.index, type.name);
+    }
+
+    //Atom nets are numbered in order of first use
+    std::unordered_map<AtomNetId, int> net_indices;
+    std::vector<AtomNetId> nets;
+
+    auto blocks = netlist.initBlocks(clb_nlist.blocks().size());
+    size_t iblock = 0;
+    for (auto blk_id : clb_nlist.blocks()) {
+        auto block = blocks[iblock++];
+        const t_pb* pb = clb_nlist.block_pb(blk_id);
+
+        block.setName(clb_nlist.block_name(blk_id));
+        block.setType(clb_nlist.block_type(blk_id)->index);
+
+        std::vector<t_bin_pb> bin_pbs;
+        collect_bin_pbs(pb, OPEN, OPEN, 0, bin_pbs);
+        auto pbs = block.initPbs(bin_pbs.size());
+        for (size_t ipb = 0; ipb < bin_pbs.size(); ipb++) {
+            write_bin_pb(pbs[ipb], bin_pbs[ipb]);
+        }
+
+        write_bin_pb_routes(block.initRoutes(pb->pb_route.size()), pb->pb_route, net_indices, nets);
+    }
+
+    auto net_names = netlist.initNetNames(nets.size());
+    for (size_t inet = 0; inet < nets.size(); inet++) {
+        net_names.set(inet, atom_ctx.nlist.net_name(nets[inet]));
+    }
+
+    writeMessageToFile(file_name, &builder);
+
+    VTR_LOG("Finished generating binary packed netlist file named %s\n", file_name);
+}
+
+/* Collect the pbs of a pb tree in pre-order, skipping child pbs which were never set up */
+static void collect_bin_pbs(const t_pb* pb, int parent, int child_type, int child_index, std::vector<t_bin_pb>& bin_pbs) {
+    int ipb = bin_pbs.size();
+    bin_pbs.push_back({pb, parent, child_type, child_index});
+
+    if (pb->child_pbs == nullptr) {
+        return;
+    }
+
+    const t_mode& mode = pb->pb_graph_node->pb_type->modes[pb->mode];
+    for (int i = 0; i < mode.num_pb_type_children; i++) {
+        for (int j = 0; j < mode.pb_type_children[i].num_pb; j++) {
+            const t_pb* child = &pb->child_pbs[i][j];
+            if (child->pb_graph_node != nullptr) {
+                collect_bin_pbs(child, ipb, i, j, bin_pbs);
+            }
+        }
+    }
+}
+
+static void write_bin_pb(NetPb::Builder bin_pb, const t_bin_pb& pb_info) {
+    const t_pb* pb = pb_info.pb;
+
+    bin_pb.setParent(pb_info.parent);
+    bin_pb.setChildType(pb_info.child_type);
+    bin_pb.setChildIndex(pb_info.child_index);
+    if (pb->name != nullptr) {
+        bin_pb.setName(pb->name);
+    }
+    bin_pb.setMode(pb->mode);
+    bin_pb.setLinked(pb->parent_pb != nullptr);
+    bin_pb.setHasChildren(pb->child_pbs != nullptr);
+
+    const t_pb_graph_node* gnode = pb->pb_graph_node;
+    if (!gnode->is_primitive() || pb->name == nullptr) {
+        return;
+    }
+
+    //Record the pins rotated onto logically equivalent pins
+    std::vector<const t_pb_graph_pin*> rotated_pins;
+    auto add_rotated_pins = [&](t_pb_graph_pin** pins, int num_ports, const int* num_pins) {
+        for (int iport = 0; iport < num_ports; iport++) {
+            for (int ipin = 0; ipin < num_pins[iport]; ipin++) {
+                const t_pb_graph_pin* gpin = &pins[iport][ipin];
+                if (pb->atom_pin_bit_index(gpin) != (BitIndex)gpin->pin_number) {
+                    rotated_pins.push_back(gpin);
+                }
+            }
+        }
+    };
+    add_rotated_pins(gnode->input_pins, gnode->num_input_ports, gnode->num_input_pins);
+    add_rotated_pins(gnode->output_pins, gnode->num_output_ports, gnode->num_output_pins);
+    add_rotated_pins(gnode->clock_pins, gnode->num_clock_ports, gnode->num_clock_pins);
+
+    auto rotations = bin_pb.initPinRotations(rotated_pins.size());
+    for (size_t i = 0; i < rotated_pins.size(); i++) {
+        rotations[i].setPin(rotated_pins[i]->pin_count_in_cluster);
+        rotations[i].setAtomPinBitIndex(pb->atom_pin_bit_index(rotated_pins[i]));
+    }
+}
+
+static void write_bin_pb_routes(capnp::List<NetPbRoute>::Builder routes, const t_pb_routes& pb_route, std::unordered_map<AtomNetId, int>& net_indices, std::vector<AtomNetId>& nets) {
+    size_t iroute = 0;
+    for (const auto& kv : pb_route) {
+        auto route = routes[iroute++];
+        const t_pb_route& pin_route = kv.second;
+
+        route.setPin(kv.first);
+
+        int inet = OPEN;
+        if (pin_route.atom_net_id) {
+            auto result = net_indices.insert(std::make_pair(pin_route.atom_net_id, (int)nets.size()));
+            if (result.second) {
+                nets.push_back(pin_route.atom_net_id);
+            }
+            inet = result.first->second;
+        }
+        route.setAtomNet(inet);
+        route.setDriverPin(pin_route.driver_pb_pin_id);
+
+        auto sink_pins = route.initSinkPins(pin_route.sink_pb_pin_ids.size());
+        for (size_t i = 0; i < pin_route.sink_pb_pin_ids.size(); i++) {
+            sink_pins.set(i, pin_route.sink_pb_pin_ids[i]);
+        }
+
+        route.setGraphPin(pin_route.pb_graph_pin ? pin_route.pb_graph_pin->pin_count_in_cluster : OPEN);
+    }
+}
+
+#endif /* VTR_ENABLE_CAPNPROTO */
@@ -0,0 +1,32 @@
+/*
+ * Reads and writes the packed (clustered) netlist in a capnproto binary format
+ * (libs/libvtrcapnproto/clustered_netlist.capnp). The binary format holds the
+ * netlist as loaded from a .net file -- the pb hierarchy and intra-cluster
+ * routing (pb_route) of each cluster -- so it loads without parsing: the file
+ * is mmap'd and the pb trees and pb_routes are built straight out of it.
+ *
+ * read_netlist() uses the binary format for file names ending in '.bin', and
+ * --write_binary_net_file writes the loaded netlist out in it, so a flow can be
+ * resumed at placement without re-parsing a large .net file.
+ */
+
+#ifndef CLUSTERED_NETLIST_BINARY_H
+#define CLUSTERED_NETLIST_BINARY_H
+
+#include "vpr_types.h"
+#include "clustered_netlist.h"
+
+//Returns true if the packed netlist file name selects the binary format
+bool is_binary_netlist_file(const char* file_name);
+
+//Loads the clusters of a binary packed netlist: the cluster blocks and their
+//ports, pb trees and pb_routes, and the atom block to pb/cluster mapping.
+//The inter-cluster nets are left for the caller to build (as for .net files).
+ClusteredNetlist read_binary_netlist_clusters(const char* net_file,
+                                              const t_arch* arch,
+                                              bool verify_file_digests,
+                                              int* num_primitives);
+
+void write_binary_netlist(const char* file_name, const ClusteredNetlist& clb_nlist, const t_arch* arch);
+
+#endif /* CLUSTERED_NETLIST_BINARY_H */
@@ -380,6 +380,18 @@
  * block_num_clock_pins_). The internal dividers can then be easily calculated (e.g. see block_output_pins()), even
  * if new pins are inserted (provided the counts are updated).
  *
+ * Frozen netlists
+ * ---------------
+ * A std::vector per block/port/net costs its size/capacity fields and a separate heap allocation, which dominates
+ * the memory of large netlists. Once construction is complete freeze() packs each kind of list (block pins, block
+ * ports, port pins and net pins) into a single CSR array (frozen_block_pins_ etc.), keeping the same per-list layout
+ * described above, so the ranges returned are unchanged.
+ *
+ * Freezing also drops string_to_string_id_ (which holds a second copy of every string as its key) in favour of
+ * frozen_string_index_, an open-addressing hash table of StringIds which compares against strings_ directly.
+ *
+ * Mutating a frozen netlist first thaw()s it back to the modifiable form.
+ *
  * Adding data to the netlist
  * --------------------------
  * The Netlist should contain only information directly related to the netlist state (i.e. netlist connectivity).
@@ -488,6 +500,13 @@ class Netlist {
     //Note that this is a convenience method which is the logical inverse of is_dirty()
     bool is_compressed() const;
 
+    //Returns true if the netlist is in its compact read-only form (see freeze())
+    bool is_frozen() const;
+
+    //Returns the (estimated) heap memory in bytes used by the block/port/net pin and port
+    //lists and the name look-up, i.e. the data whose layout is compacted by freeze()
+    size_t list_and_lookup_memory_bytes() const;
+
     //Item counts and container info (for debugging)
     void print_stats() const;
 
@@ -757,6 +776,19 @@ class Netlist {
     //NOTE: this invalidates all existing IDs!
     IdRemapper compress();
 
+    //Converts the netlist to a compact read-only form, to be called once construction is
+    //complete. The pin/port lists of blocks, ports and nets are packed into CSR arrays (one
+    //array per list kind, rather than a std::vector per block/port/net) and the name look-up,
+    //which keyed a second copy of every name, becomes a flat hash index into the interned
+    //names.
+    //
+    //All accessors behave as before. Any subsequent mutation first calls thaw(), so the
+    //netlist stays modifiable; note that this invalidates pin/port ranges obtained while frozen.
+    void freeze();
+
+    //Converts a frozen netlist back to its modifiable form (does nothing if not frozen)
+    void thaw();
+
   protected: //Protected Mutators
     //Create or return an existing block in the netlist
     //  name        : The unique name of the block
@@ -869,6 +901,18 @@ class Netlist {
 
     void shrink_to_fit();
 
+    /*
+     * Frozen (compact) form
+     */
+    //Pin/port lists, from either the modifiable or the frozen storage
+    pin_range block_pin_list(const BlockId blk_id) const;
+    port_range block_port_list(const BlockId blk_id) const;
+    pin_range port_pin_list(const PortId port_id) const;
+    pin_range net_pin_list(const NetId net_id) const;
+
+    //Builds frozen_string_index_ from the current strings
+    void build_frozen_string_index();
+
     /*
      * Sanity Checks
      */
@@ -930,6 +974,7 @@ class Netlist {
     std::string netlist_name_; //Name of the top-level netlist
     std::string netlist_id_;   //Unique identifier for the netlist
     bool dirty_ = false;       //Indicates the netlist has invalid entries from remove_*() functions
+    bool frozen_ = false;      //Indicates the lists and string look-up are in their compact form (see freeze())
 
     //Block data
     vtr::vector_map<BlockId, BlockId> block_ids_;    //Valid block ids
@@ -976,10 +1021,18 @@ class Netlist {
     vtr::vector_map<StringId, StringId> string_ids_; //Valid string ids
     vtr::vector_map<StringId, std::string> strings_; //Strings
 
+    //Frozen data
+    // When frozen the block/port/net lists above are empty, and are instead stored here
+    CsrListMap<BlockId, PortId> frozen_block_ports_;
+    CsrListMap<BlockId, PinId> frozen_block_pins_;
+    CsrListMap<PortId, PinId> frozen_port_pins_;
+    CsrListMap<NetId, PinId> frozen_net_pins_;
+
   private: //Fast lookups
     vtr::vector_map<StringId, BlockId> block_name_to_block_id_;
     vtr::vector_map<StringId, NetId> net_name_to_net_id_;
-    std::unordered_map<std::string, StringId> string_to_string_id_;
+    std::unordered_map<std::string, StringId> string_to_string_id_; //Empty when frozen
+    std::vector<StringId> frozen_string_index_;                     //Open-addressing hash index of strings_ (replaces string_to_string_id_ when frozen)
 };
 
 #include "netlist.tpp"
@@ -68,6 +68,41 @@ bool Netlist<BlockId, PortId, PinId, NetId>::is_compressed() const {
     return !is_dirty();
 }
 
+template<typename BlockId, typename PortId, typename PinId, typename NetId>
+bool Netlist<BlockId, PortId, PinId, NetId>::is_frozen() const {
+    return frozen_;
+}
+
+template<typename BlockId, typename PortId, typename PinId, typename NetId>
+size_t Netlist<BlockId, PortId, PinId, NetId>::list_and_lookup_memory_bytes() const {
+    size_t bytes = 0;
+    if (frozen_) {
+        bytes += frozen_block_ports_.memory_bytes();
+        bytes += frozen_block_pins_.memory_bytes();
+        bytes += frozen_port_pins_.memory_bytes();
+        bytes += frozen_net_pins_.memory_bytes();
+        bytes += frozen_string_index_.capacity() * sizeof(StringId);
+    } else {
+        bytes += list_map_memory_bytes(block_ports_);
+        bytes += list_map_memory_bytes(block_pins_);
+        bytes += list_map_memory_bytes(port_pins_);
+        bytes += list_map_memory_bytes(net_pins_);
+
+        //Each look-up entry is a separately allocated hash node (next pointer, key, value
+        //and cached hash), with the key's characters allocated separately if they do not
+        //fit in the string's local buffer
+        const size_t local_string_capacity = std::string().capacity();
+        for (const auto& kv : string_to_string_id_) {
+            bytes += sizeof(void*) + sizeof(kv) + sizeof(size_t);
+            if (kv.first.capacity() > local_string_capacity) {
+                bytes += kv.first.capacity() + 1;
+            }
+        }
+        bytes += string_to_string_id_.bucket_count() * sizeof(void*);
+    }
+    return bytes;
+}
+
 template<typename BlockId, typename PortId, typename PinId, typename NetId>
 void Netlist<BlockId, PortId, PinId, NetId>::print_stats() const {
     VTR_LOG("Blocks  %zu capacity/size: %.2f\n", block_ids_.size(), float(block_ids_.capacity()) / block_ids_.size());
@@ -113,16 +148,16 @@ template<typename BlockId, typename PortId, typename PinId, typename NetId>
 typename Netlist<BlockId, PortId, PinId, NetId>::pin_range Netlist<BlockId, PortId, PinId, NetId>::block_pins(const BlockId blk_id) const {
     VTR_ASSERT_SAFE(valid_block_id(blk_id));
 
-    return vtr::make_range(block_pins_[blk_id].begin(), block_pins_[blk_id].end());
+    return block_pin_list(blk_id);
 }
 
 template<typename BlockId, typename PortId, typename PinId, typename NetId>
 typename Netlist<BlockId, PortId, PinId, NetId>::pin_range Netlist<BlockId, PortId, PinId, NetId>::block_input_pins(const BlockId blk_id) const {
     VTR_ASSERT_SAFE(valid_block_id(blk_id));
 
-    auto begin = block_pins_[blk_id].begin();
+    auto begin = block_pin_list(blk_id).begin();
 
-    auto end = block_pins_[blk_id].begin() + block_num_input_pins_[blk_id];
+    auto end = block_pin_list(blk_id).begin() + block_num_input_pins_[blk_id];
 
     return vtr::make_range(begin, end);
 }
@@ -131,7 +166,7 @@ template<typename BlockId, typename PortId, typename PinId, typename NetId>
 typename Netlist<BlockId, PortId, PinId, NetId>::pin_range Netlist<BlockId, PortId, PinId, NetId>::block_output_pins(const BlockId blk_id) const {
     VTR_ASSERT_SAFE(valid_block_id(blk_id));
 
-    auto begin = block_pins_[blk_id].begin() + block_num_input_pins_[blk_id];
+    auto begin = block_pin_list(blk_id).begin() + block_num_input_pins_[blk_id];
 
     auto end = begin + block_num_output_pins_[blk_id];
 
@@ -142,13 +177,13 @@ template<typename BlockId, typename PortId, typename PinId, typename NetId>
 typename Netlist<BlockId, PortId, PinId, NetId>::pin_range Netlist<BlockId, PortId, PinId, NetId>::block_clock_pins(const BlockId blk_id) const {
     VTR_ASSERT_SAFE(valid_block_id(blk_id));
 
-    auto begin = block_pins_[blk_id].begin()
+    auto begin = block_pin_list(blk_id).begin()
                  + block_num_input_pins_[blk_id]
                  + block_num_output_pins_[blk_id];
 
     auto end = begin + block_num_clock_pins_[blk_id];
 
-    VTR_ASSERT_SAFE(end == block_pins_[blk_id].end());
+    VTR_ASSERT_SAFE(end == block_pin_list(blk_id).end());
 
     return vtr::make_range(begin, end);
 }
@@ -157,16 +192,16 @@ template<typename BlockId, typename PortId, typename PinId, typename NetId>
 typename Netlist<BlockId, PortId, PinId, NetId>::port_range Netlist<BlockId, PortId, PinId, NetId>::block_ports(const BlockId blk_id) const {
     VTR_ASSERT_SAFE(valid_block_id(blk_id));
 
-    return vtr::make_range(block_ports_[blk_id].begin(), block_ports_[blk_id].end());
+    return block_port_list(blk_id);
 }
 
 template<typename BlockId, typename PortId, typename PinId, typename NetId>
 typename Netlist<BlockId, PortId, PinId, NetId>::port_range Netlist<BlockId, PortId, PinId, NetId>::block_input_ports(const BlockId blk_id) const {
     VTR_ASSERT_SAFE(valid_block_id(blk_id));
 
-    auto begin = block_ports_[blk_id].begin();
+    auto begin = block_port_list(blk_id).begin();
 
-    auto end = block_ports_[blk_id].begin() + block_num_input_ports_[blk_id];
+    auto end = block_port_list(blk_id).begin() + block_num_input_ports_[blk_id];
 
     return vtr::make_range(begin, end);
 }
@@ -175,7 +210,7 @@ template<typename BlockId, typename PortId, typename PinId, typename NetId>
 typename Netlist<BlockId, PortId, PinId, NetId>::port_range Netlist<BlockId, PortId, PinId, NetId>::block_output_ports(const BlockId blk_id) const {
     VTR_ASSERT_SAFE(valid_block_id(blk_id));
 
-    auto begin = block_ports_[blk_id].begin() + block_num_input_ports_[blk_id];
+    auto begin = block_port_list(blk_id).begin() + block_num_input_ports_[blk_id];
 
     auto end = begin + block_num_output_ports_[blk_id];
 
@@ -186,13 +221,13 @@ template<typename BlockId, typename PortId, typename PinId, typename NetId>
 typename Netlist<BlockId, PortId, PinId, NetId>::port_range Netlist<BlockId, PortId, PinId, NetId>::block_clock_ports(const BlockId blk_id) const {
     VTR_ASSERT_SAFE(valid_block_id(blk_id));
 
-    auto begin = block_ports_[blk_id].begin()
+    auto begin = block_port_list(blk_id).begin()
                  + block_num_input_ports_[blk_id]
                  + block_num_output_ports_[blk_id];
 
     auto end = begin + block_num_clock_ports_[blk_id];
 
-    VTR_ASSERT_SAFE(end == block_ports_[blk_id].end());
+    VTR_ASSERT_SAFE(end == block_port_list(blk_id).end());
 
     return vtr::make_range(begin, end);
 }
@@ -221,7 +256,7 @@ template<typename BlockId, typename PortId, typename PinId, typename NetId>
 typename Netlist<BlockId, PortId, PinId, NetId>::pin_range Netlist<BlockId, PortId, PinId, NetId>::port_pins(const PortId port_id) const {
     VTR_ASSERT_SAFE(valid_port_id(port_id));
 
-    return vtr::make_range(port_pins_[port_id].begin(), port_pins_[port_id].end());
+    return port_pin_list(port_id);
 }
 
 template<typename BlockId, typename PortId, typename PinId, typename NetId>
@@ -358,15 +393,16 @@ template<typename BlockId, typename PortId, typename PinId, typename NetId>
 typename Netlist<BlockId, PortId, PinId, NetId>::pin_range Netlist<BlockId, PortId, PinId, NetId>::net_pins(const NetId net_id) const {
     VTR_ASSERT_SAFE(valid_net_id(net_id));
 
-    return vtr::make_range(net_pins_[net_id].begin(), net_pins_[net_id].end());
+    return net_pin_list(net_id);
 }
 
 template<typename BlockId, typename PortId, typename PinId, typename NetId>
 PinId Netlist<BlockId, PortId, PinId, NetId>::net_pin(const NetId net_id, int net_pin_index) const {
     VTR_ASSERT_SAFE(valid_net_id(net_id));
-    VTR_ASSERT_SAFE_MSG(net_pin_index >= 0 && size_t(net_pin_index) < net_pins_[net_id].size(), "Pin index must be in range");
+    auto pins = net_pin_list(net_id);
+    VTR_ASSERT_SAFE_MSG(net_pin_index >= 0 && size_t(net_pin_index) < pins.size(), "Pin index must be in range");
 
-    return net_pins_[net_id][net_pin_index];
+    return pins.begin()[net_pin_index];
 }
 
 template<typename BlockId, typename PortId, typename PinId, typename NetId>
@@ -380,8 +416,9 @@ template<typename BlockId, typename PortId, typename PinId, typename NetId>
 PinId Netlist<BlockId, PortId, PinId, NetId>::net_driver(const NetId net_id) const {
     VTR_ASSERT_SAFE(valid_net_id(net_id));
 
-    if (net_pins_[net_id].size() > 0) {
-        return net_pins_[net_id][0];
+    auto pins = net_pin_list(net_id);
+    if (pins.size() > 0) {
+        return *pins.begin();
     } else {
         return PinId::INVALID();
     }
@@ -400,7 +437,8 @@ template<typename BlockId, typename PortId, typename PinId, typename NetId>
 typename Netlist<BlockId, PortId, PinId, NetId>::pin_range Netlist<BlockId, PortId, PinId, NetId>::net_sinks(const NetId net_id) const {
     VTR_ASSERT_SAFE(valid_net_id(net_id));
 
-    return vtr::make_range(++net_pins_[net_id].begin(), net_pins_[net_id].end());
+    auto pins = net_pin_list(net_id);
+    return vtr::make_range(++pins.begin(), pins.end());
 }
 
 template<typename BlockId, typename PortId, typename PinId, typename NetId>
@@ -612,6 +650,8 @@ bool Netlist<BlockId, PortId, PinId, NetId>::verify_lookups() const {
  */
 template<typename BlockId, typename PortId, typename PinId, typename NetId>
 BlockId Netlist<BlockId, PortId, PinId, NetId>::create_block(const std::string name) {
+    thaw(); //Lists must be modifiable
+
     //Must have a non-empty name
     VTR_ASSERT_MSG(!name.empty(), "Non-Empty block name");
 
@@ -655,6 +695,8 @@ BlockId Netlist<BlockId, PortId, PinId, NetId>::create_block(const std::string n
 
 template<typename BlockId, typename PortId, typename PinId, typename NetId>
 PortId Netlist<BlockId, PortId, PinId, NetId>::create_port(const BlockId blk_id, const std::string name, BitIndex width, PortType type) {
+    thaw(); //Lists must be modifiable
+
     //Check pre-conditions
     VTR_ASSERT_MSG(valid_block_id(blk_id), "Valid block id");
 
@@ -686,6 +728,8 @@ PortId Netlist<BlockId, PortId, PinId, NetId>::create_port(const BlockId blk_id,
 
 template<typename BlockId, typename PortId, typename PinId, typename NetId>
 PinId Netlist<BlockId, PortId, PinId, NetId>::create_pin(const PortId port_id, BitIndex port_bit, const NetId net_id, const PinType type, bool is_const) {
+    thaw(); //Lists must be modifiable
+
     //Check pre-conditions (valid ids)
     VTR_ASSERT_MSG(valid_port_id(port_id), "Valid port id");
     VTR_ASSERT_MSG(valid_port_bit(port_id, port_bit), "Valid port bit");
@@ -732,6 +776,8 @@ PinId Netlist<BlockId, PortId, PinId, NetId>::create_pin(const PortId port_id, B
 
 template<typename BlockId, typename PortId, typename PinId, typename NetId>
 NetId Netlist<BlockId, PortId, PinId, NetId>::create_net(const std::string name) {
+    thaw(); //Lists must be modifiable
+
     //Creates an empty net (or returns an existing one)
     VTR_ASSERT_MSG(!name.empty(), "Valid net name");
 
@@ -803,6 +849,8 @@ void Netlist<BlockId, PortId, PinId, NetId>::set_pin_is_constant(const PinId pin
 
 template<typename BlockId, typename PortId, typename PinId, typename NetId>
 void Netlist<BlockId, PortId, PinId, NetId>::set_pin_net(const PinId pin, PinType type, const NetId net) {
+    thaw(); //Lists must be modifiable
+
     VTR_ASSERT(valid_pin_id(pin));
 
     VTR_ASSERT((type == PinType::DRIVER && pin_port_type(pin) == PortType::OUTPUT)
@@ -867,6 +915,8 @@ void Netlist<BlockId, PortId, PinId, NetId>::set_block_param(const BlockId blk_i
 
 template<typename BlockId, typename PortId, typename PinId, typename NetId>
 void Netlist<BlockId, PortId, PinId, NetId>::merge_nets(const NetId driver_net, const NetId sink_net) {
+    thaw(); //Lists must be modifiable
+
     VTR_ASSERT(valid_net_id(driver_net));
     VTR_ASSERT(valid_net_id(sink_net));
 
@@ -903,6 +953,8 @@ void Netlist<BlockId, PortId, PinId, NetId>::merge_nets(const NetId driver_net,
 
 template<typename BlockId, typename PortId, typename PinId, typename NetId>
 void Netlist<BlockId, PortId, PinId, NetId>::remove_block(const BlockId blk_id) {
+    thaw(); //Lists must be modifiable
+
     VTR_ASSERT(valid_block_id(blk_id));
 
     //Remove the ports
@@ -926,6 +978,8 @@ void Netlist<BlockId, PortId, PinId, NetId>::remove_block(const BlockId blk_id)
 
 template<typename BlockId, typename PortId, typename PinId, typename NetId>
 void Netlist<BlockId, PortId, PinId, NetId>::remove_port(const PortId port_id) {
+    thaw(); //Lists must be modifiable
+
     VTR_ASSERT(valid_port_id(port_id));
 
     //Remove the pins
@@ -947,6 +1001,8 @@ void Netlist<BlockId, PortId, PinId, NetId>::remove_port(const PortId port_id) {
 
 template<typename BlockId, typename PortId, typename PinId, typename NetId>
 void Netlist<BlockId, PortId, PinId, NetId>::remove_pin(const PinId pin_id) {
+    thaw(); //Lists must be modifiable
+
     VTR_ASSERT(valid_pin_id(pin_id));
 
     //Find the associated net
@@ -967,6 +1023,8 @@ void Netlist<BlockId, PortId, PinId, NetId>::remove_pin(const PinId pin_id) {
 
 template<typename BlockId, typename PortId, typename PinId, typename NetId>
 void Netlist<BlockId, PortId, PinId, NetId>::remove_net(const NetId net_id) {
+    thaw(); //Lists must be modifiable
+
     VTR_ASSERT(valid_net_id(net_id));
 
     //Disassociate the pins from the net
@@ -992,6 +1050,8 @@ void Netlist<BlockId, PortId, PinId, NetId>::remove_net(const NetId net_id) {
 
 template<typename BlockId, typename PortId, typename PinId, typename NetId>
 void Netlist<BlockId, PortId, PinId, NetId>::remove_net_pin(const NetId net_id, const PinId pin_id) {
+    thaw(); //Lists must be modifiable
+
     //Remove a net-pin connection
     //
     //Note that during sweeping either the net or pin could be invalid (i.e. already swept)
@@ -1038,6 +1098,8 @@ typename Netlist<BlockId, PortId, PinId, NetId>::IdRemapper Netlist<BlockId, Por
 // Note: this invalidates all Ids
 template<typename BlockId, typename PortId, typename PinId, typename NetId>
 typename Netlist<BlockId, PortId, PinId, NetId>::IdRemapper Netlist<BlockId, PortId, PinId, NetId>::compress() {
+    thaw(); //Lists must be modifiable
+
     //Build the mappings from old to new id's, potentially
     //re-ordering for improved cache locality
     //
@@ -1073,8 +1135,56 @@ typename Netlist<BlockId, PortId, PinId, NetId>::IdRemapper Netlist<BlockId, Por
     return id_remapper;
 }
 
+template<typename BlockId, typename PortId, typename PinId, typename NetId>
+void Netlist<BlockId, PortId, PinId, NetId>::freeze() {
+    if (frozen_) return;
+
+    //Pack the lists
+    frozen_block_ports_.build(block_ports_);
+    frozen_block_pins_.build(block_pins_);
+    frozen_port_pins_.build(port_pins_);
+    frozen_net_pins_.build(net_pins_);
+
+    block_ports_ = vtr::vector_map<BlockId, std::vector<PortId>>();
+    block_pins_ = vtr::vector_map<BlockId, std::vector<PinId>>();
+    port_pins_ = vtr::vector_map<PortId, std::vector<PinId>>();
+    net_pins_ = vtr::vector_map<NetId, std::vector<PinId>>();
+
+    //Replace the string look-up, which holds a second copy of every string, with
+    //an index into the strings themselves
+    build_frozen_string_index();
+    std::unordered_map<std::string, StringId>().swap(string_to_string_id_);
+
+    frozen_ = true;
+}
+
+template<typename BlockId, typename PortId, typename PinId, typename NetId>
+void Netlist<BlockId, PortId, PinId, NetId>::thaw() {
+    if (!frozen_) return;
+
+    block_ports_ = frozen_block_ports_.unpack();
+    block_pins_ = frozen_block_pins_.unpack();
+    port_pins_ = frozen_port_pins_.unpack();
+    net_pins_ = frozen_net_pins_.unpack();
+
+    frozen_block_ports_.clear();
+    frozen_block_pins_.clear();
+    frozen_port_pins_.clear();
+    frozen_net_pins_.clear();
+
+    string_to_string_id_.reserve(string_ids_.size());
+    for (auto str_id : string_ids_) {
+        string_to_string_id_[strings_[str_id]] = str_id;
+    }
+    std::vector<StringId>().swap(frozen_string_index_);
+
+    frozen_ = false;
+}
+
 template<typename BlockId, typename PortId, typename PinId, typename NetId>
 void Netlist<BlockId, PortId, PinId, NetId>::remove_unused() {
+    thaw(); //Lists must be modifiable
+
     //Mark any nets/pins/ports/blocks which are not in use as invalid
     //so they will be removed
 
@@ -1469,11 +1579,11 @@ template<typename BlockId, typename PortId, typename PinId, typename NetId>
 bool Netlist<BlockId, PortId, PinId, NetId>::validate_block_sizes() const {
     size_t num_blocks = blocks().size();
     if (block_names_.size() != num_blocks
-        || block_pins_.size() != num_blocks
+        || (frozen_ ? frozen_block_pins_.size() : block_pins_.size()) != num_blocks
         || block_num_input_pins_.size() != num_blocks
         || block_num_output_pins_.size() != num_blocks
         || block_num_clock_pins_.size() != num_blocks
-        || block_ports_.size() != num_blocks
+        || (frozen_ ? frozen_block_ports_.size() : block_ports_.size()) != num_blocks
         || block_num_input_ports_.size() != num_blocks
         || block_num_output_ports_.size() != num_blocks
         || block_num_clock_ports_.size() != num_blocks
@@ -1490,7 +1600,7 @@ bool Netlist<BlockId, PortId, PinId, NetId>::validate_port_sizes() const {
     size_t num_ports = ports().size();
     if (port_names_.size() != num_ports
         || port_blocks_.size() != num_ports
-        || port_pins_.size() != num_ports
+        || (frozen_ ? frozen_port_pins_.size() : port_pins_.size()) != num_ports
         || !validate_port_sizes_impl(num_ports)) {
         VPR_FATAL_ERROR(VPR_ERROR_NETLIST, "Inconsistent port data sizes");
     }
@@ -1515,7 +1625,7 @@ template<typename BlockId, typename PortId, typename PinId, typename NetId>
 bool Netlist<BlockId, PortId, PinId, NetId>::validate_net_sizes() const {
     size_t num_nets = nets().size();
     if (net_names_.size() != num_nets
-        || net_pins_.size() != num_nets
+        || (frozen_ ? frozen_net_pins_.size() : net_pins_.size()) != num_nets
         || !validate_net_sizes_impl(num_nets)) {
         VPR_FATAL_ERROR(VPR_ERROR_NETLIST, "Inconsistent net data sizes");
     }
@@ -1801,8 +1911,72 @@ bool Netlist<BlockId, PortId, PinId, NetId>::verify_block_invariants() const {
  * Internal utilities
  *
  */
+template<typename BlockId, typename PortId, typename PinId, typename NetId>
+typename Netlist<BlockId, PortId, PinId, NetId>::pin_range Netlist<BlockId, PortId, PinId, NetId>::block_pin_list(const BlockId blk_id) const {
+    if (frozen_) {
+        return vtr::make_range(frozen_block_pins_.begin(blk_id), frozen_block_pins_.end(blk_id));
+    }
+    return vtr::make_range(block_pins_[blk_id].begin(), block_pins_[blk_id].end());
+}
+
+template<typename BlockId, typename PortId, typename PinId, typename NetId>
+typename Netlist<BlockId, PortId, PinId, NetId>::port_range Netlist<BlockId, PortId, PinId, NetId>::block_port_list(const BlockId blk_id) const {
+    if (frozen_) {
+        return vtr::make_range(frozen_block_ports_.begin(blk_id), frozen_block_ports_.end(blk_id));
+    }
+    return vtr::make_range(block_ports_[blk_id].begin(), block_ports_[blk_id].end());
+}
+
+template<typename BlockId, typename PortId, typename PinId, typename NetId>
+typename Netlist<BlockId, PortId, PinId, NetId>::pin_range Netlist<BlockId, PortId, PinId, NetId>::port_pin_list(const PortId port_id) const {
+    if (frozen_) {
+        return vtr::make_range(frozen_port_pins_.begin(port_id), frozen_port_pins_.end(port_id));
+    }
+    return vtr::make_range(port_pins_[port_id].begin(), port_pins_[port_id].end());
+}
+
+template<typename BlockId, typename PortId, typename PinId, typename NetId>
+typename Netlist<BlockId, PortId, PinId, NetId>::pin_range Netlist<BlockId, PortId, PinId, NetId>::net_pin_list(const NetId net_id) const {
+    if (frozen_) {
+        return vtr::make_range(frozen_net_pins_.begin(net_id), frozen_net_pins_.end(net_id));
+    }
+    return vtr::make_range(net_pins_[net_id].begin(), net_pins_[net_id].end());
+}
+
+template<typename BlockId, typename PortId, typename PinId, typename NetId>
+void Netlist<BlockId, PortId, PinId, NetId>::build_frozen_string_index() {
+    //Linear probing table of string ids, at most half full so probes stay short
+    //(and always terminate at an empty slot)
+    size_t num_slots = 1;
+    while (num_slots < 2 * string_ids_.size()) {
+        num_slots <<= 1;
+    }
+    size_t mask = num_slots - 1;
+
+    frozen_string_index_.assign(num_slots, StringId::INVALID());
+    for (auto str_id : string_ids_) {
+        size_t slot = std::hash<std::string>()(strings_[str_id]) & mask;
+        while (frozen_string_index_[slot]) {
+            slot = (slot + 1) & mask;
+        }
+        frozen_string_index_[slot] = str_id;
+    }
+}
+
 template<typename BlockId, typename PortId, typename PinId, typename NetId>
 typename Netlist<BlockId, PortId, PinId, NetId>::StringId Netlist<BlockId, PortId, PinId, NetId>::find_string(const std::string& str) const {
+    if (frozen_) {
+        //Probe the open-addressing hash index (see build_frozen_string_index())
+        size_t mask = frozen_string_index_.size() - 1;
+        for (size_t slot = std::hash<std::string>()(str) & mask; frozen_string_index_[slot]; slot = (slot + 1) & mask) {
+            StringId str_id = frozen_string_index_[slot];
+            if (strings_[str_id] == str) {
+                return str_id;
+            }
+        }
+        return StringId::INVALID();
+    }
+
     auto iter = string_to_string_id_.find(str);
     if (iter != string_to_string_id_.end()) {
         StringId str_id = iter->second;
@@ -1945,6 +2119,7 @@ typename Netlist<BlockId, PortId, PinId, NetId>::StringId Netlist<BlockId, PortI
     StringId str_id = find_string(str);
     if (!str_id) {
         //Not found, create
+        thaw(); //Look-up must be modifiable
 
         //Reserve an id
         str_id = StringId(string_ids_.size());
@@ -1959,7 +2134,7 @@ typename Netlist<BlockId, PortId, PinId, NetId>::StringId Netlist<BlockId, PortI
     }
 
     //Check post-conditions: sizes
-    VTR_ASSERT(string_to_string_id_.size() == string_ids_.size());
+    VTR_ASSERT(frozen_ || string_to_string_id_.size() == string_ids_.size());
     VTR_ASSERT(strings_.size() == string_ids_.size());
 
     //Check post-conditions: values
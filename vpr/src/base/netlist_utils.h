@@ -2,7 +2,10 @@
 #define NETLIST_UTILS_H
 
 #include "vtr_vector_map.h"
+#include "vtr_assert.h"
+#include <limits>
 #include <set>
+#include <vector>
 
 /*
  *
@@ -162,4 +165,90 @@ Container update_valid_refs(const Container& values,
     return updated;
 }
 
+/*
+ *
+ * Compact storage of per-Id lists
+ *
+ */
+
+//Holds the lists of a vtr::vector_map<Id, std::vector<T>> in compressed sparse row (CSR)
+//form: the elements of every list are packed into a single vector, and the list of each
+//Id is located by a pair of offsets. This avoids the size/capacity fields and separate
+//heap allocation of each list, but the lists can no longer be modified.
+template<typename Id, typename T>
+class CsrListMap {
+  public:
+    typedef typename std::vector<T>::const_iterator const_iterator;
+
+    //Packs 'lists' (which are left unmodified)
+    void build(const vtr::vector_map<Id, std::vector<T>>& lists) {
+        size_t num_values = 0;
+        for (const auto& list : lists) {
+            num_values += list.size();
+        }
+        VTR_ASSERT_MSG(num_values <= std::numeric_limits<unsigned>::max(), "List elements must be indexable by unsigned offsets");
+
+        clear();
+        offsets_.reserve(lists.size() + 1);
+        values_.reserve(num_values);
+
+        offsets_.push_back(0);
+        for (const auto& list : lists) {
+            values_.insert(values_.end(), list.begin(), list.end());
+            offsets_.push_back(values_.size());
+        }
+    }
+
+    //Returns the packed lists as (modifiable) individual vectors
+    vtr::vector_map<Id, std::vector<T>> unpack() const {
+        vtr::vector_map<Id, std::vector<T>> lists;
+        lists.resize(size());
+        for (size_t i = 0; i < size(); ++i) {
+            lists[Id(i)].assign(begin(Id(i)), end(Id(i)));
+        }
+        return lists;
+    }
+
+    //Releases all storage
+    void clear() {
+        std::vector<unsigned>().swap(offsets_);
+        std::vector<T>().swap(values_);
+    }
+
+    //Number of lists
+    size_t size() const { return offsets_.empty() ? 0 : offsets_.size() - 1; }
+
+    const_iterator begin(const Id id) const {
+        VTR_ASSERT_SAFE(size_t(id) < size());
+        return values_.begin() + offsets_[size_t(id)];
+    }
+
+    const_iterator end(const Id id) const {
+        VTR_ASSERT_SAFE(size_t(id) < size());
+        return values_.begin() + offsets_[size_t(id) + 1];
+    }
+
+    //Number of elements in the list of 'id'
+    size_t size(const Id id) const { return end(id) - begin(id); }
+
+    //Heap memory used, in bytes
+    size_t memory_bytes() const {
+        return offsets_.capacity() * sizeof(unsigned) + values_.capacity() * sizeof(T);
+    }
+
+  private:
+    std::vector<unsigned> offsets_; //Offset of the first element of each list (and one past the last list)
+    std::vector<T> values_;         //Elements of all lists
+};
+
+//Returns the heap memory (in bytes) used by the vector of vectors 'lists'
+template<typename Id, typename T>
+size_t list_map_memory_bytes(const vtr::vector_map<Id, std::vector<T>>& lists) {
+    size_t bytes = lists.capacity() * sizeof(std::vector<T>);
+    for (const auto& list : lists) {
+        bytes += list.capacity() * sizeof(T);
+    }
+    return bytes;
+}
+
 #endif
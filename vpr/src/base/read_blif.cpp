@@ -6,8 +6,9 @@
  * hierarchical) netlist in Berkely Logic Interchange Format (BLIF) file, and
  * builds a netlist data structure (AtomNetlist) from it.
  *
- * BLIF text parsing is handled by the blifparse library, while this file is responsible
- * for creating the netlist data structure.
+ * BLIF text parsing is handled by the blifparse library (or, for large netlists, by the
+ * parallel parser in blif_parallel_parse.h), while this file is responsible for creating
+ * the netlist data structure.
  *
  * The main object of interest is the BlifAllocCallback struct, which implements the
  * blifparse callback interface.  The callback methods are then called when basic blif
@@ -23,6 +24,7 @@
 #include <cctype> //std::isdigit
 
 #include "blifparse.hpp"
+#include "blif_parallel_parse.h"
 #include "atom_netlist.h"
 
 #include "vtr_assert.h"
@@ -658,12 +660,17 @@ vtr::LogicValue to_vtr_logic_value(blifparse::LogicValue val) {
 AtomNetlist read_blif(e_circuit_format circuit_format,
                       const char* blif_file,
                       const t_model* user_models,
-                      const t_model* library_models) {
+                      const t_model* library_models,
+                      bool parallel_parse) {
     AtomNetlist netlist;
     std::string netlist_id = vtr::secure_digest_file(blif_file);
 
     BlifAllocCallback alloc_callback(circuit_format, netlist, netlist_id, user_models, library_models);
-    blifparse::blif_parse_filename(blif_file, alloc_callback);
+    if (parallel_parse) {
+        blif_parse_filename_parallel(blif_file, alloc_callback);
+    } else {
+        blifparse::blif_parse_filename(blif_file, alloc_callback);
+    }
 
     return netlist;
 }
@@ -7,6 +7,7 @@
 AtomNetlist read_blif(e_circuit_format circuit_format,
                       const char* blif_file,
                       const t_model* user_models,
-                      const t_model* library_models);
+                      const t_model* library_models,
+                      bool parallel_parse);
 
 #endif /*READ_BLIF_H*/
@@ -25,6 +25,7 @@ AtomNetlist read_and_process_circuit(e_circuit_format circuit_format,
                                      const char* circuit_file,
                                      const t_model* user_models,
                                      const t_model* library_models,
+                                     bool parallel_parse,
                                      e_const_gen_inference const_gen_inference,
                                      bool should_absorb_buffers,
                                      bool should_sweep_dangling_primary_ios,
@@ -52,7 +53,7 @@ AtomNetlist read_and_process_circuit(e_circuit_format circuit_format,
         VTR_ASSERT(circuit_format == e_circuit_format::BLIF
                    || circuit_format == e_circuit_format::EBLIF);
 
-        netlist = read_blif(circuit_format, circuit_file, user_models, library_models);
+        netlist = read_blif(circuit_format, circuit_file, user_models, library_models, parallel_parse);
     }
 
     if (isEchoFileEnabled(E_ECHO_ATOM_NETLIST_ORIG)) {
@@ -128,6 +129,17 @@ static void process_circuit(AtomNetlist& netlist,
 
         netlist.verify();
     }
+    {
+        vtr::ScopedStartFinishTimer t("Freeze circuit");
+
+        //The atom netlist is read-only from here on, so switch it to its compact form
+        size_t bytes_before = netlist.list_and_lookup_memory_bytes();
+        netlist.freeze();
+        size_t bytes_after = netlist.list_and_lookup_memory_bytes();
+
+        VTR_LOG("Netlist pin lists and name look-up: %.2f MiB -> %.2f MiB\n",
+                bytes_before / (1024. * 1024.), bytes_after / (1024. * 1024.));
+    }
 }
 
 static void show_circuit_stats(const AtomNetlist& netlist) {
@@ -14,6 +14,7 @@ AtomNetlist read_and_process_circuit(const e_circuit_format circuit_format,
                                      const char* circuit_file,
                                      const t_model* user_models,
                                      const t_model* library_models,
+                                     bool parallel_parse,
                                      e_const_gen_inference const_gen_inference,
                                      bool should_absorb_buffers,
                                      bool should_sweep_dangling_primary_ios,
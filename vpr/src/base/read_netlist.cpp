@@ -30,6 +30,7 @@
 #include "atom_netlist.h"
 #include "read_xml_util.h"
 #include "read_netlist.h"
+#include "clustered_netlist_binary.h"
 #include "pb_type_graph.h"
 
 static const char* netlist_file_name = nullptr;
@@ -61,17 +62,20 @@ static t_pb_routes alloc_pb_route(t_pb_graph_node* pb_graph_node);
 static void load_atom_pin_mapping(const ClusteredNetlist& clb_nlist);
 static void set_atom_pin_mapping(const ClusteredNetlist& clb_nlist, const AtomBlockId atom_blk, const AtomPortId atom_port, const t_pb_graph_pin* gpin);
 
+static ClusteredNetlist read_xml_netlist_clusters(const char* net_file,
+                                                  const t_arch* arch,
+                                                  bool verify_file_digests,
+                                                  int* num_primitives);
+
 /**
  * Initializes the clb_nlist with info from a netlist
- * net_file - Name of the netlist file to read
+ * net_file - Name of the netlist file to read ('.bin' files are read as a binary packed netlist)
  */
 ClusteredNetlist read_netlist(const char* net_file,
                               const t_arch* arch,
                               bool verify_file_digests,
                               int verbosity) {
     clock_t begin = clock();
-    size_t bcount = 0;
-    std::vector<std::string> circuit_inputs, circuit_outputs, circuit_clocks;
 
     auto& atom_ctx = g_vpr_ctx.mutable_atom();
 
@@ -80,6 +84,83 @@ ClusteredNetlist read_netlist(const char* net_file,
     /* Parse the file */
     VTR_LOG("Begin loading packed FPGA netlist file.\n");
 
+    /* Save netlist file's name in file-scoped variable */
+    netlist_file_name = net_file;
+
+    //Reset atom/pb mapping (it is reloaded from the packed netlist file)
+    for (auto blk_id : atom_ctx.nlist.blocks())
+        atom_ctx.lookup.set_atom_pb(blk_id, nullptr);
+
+    ClusteredNetlist clb_nlist = is_binary_netlist_file(net_file)
+                                     ? read_binary_netlist_clusters(net_file, arch, verify_file_digests, &num_primitives)
+                                     : read_xml_netlist_clusters(net_file, arch, verify_file_digests, &num_primitives);
+    VTR_ASSERT(num_primitives >= 0);
+    VTR_ASSERT(static_cast<size_t>(num_primitives) == atom_ctx.nlist.blocks().size());
+
+    /* Error check */
+    for (auto blk_id : atom_ctx.nlist.blocks()) {
+        if (atom_ctx.lookup.atom_pb(blk_id) == nullptr) {
+            VPR_FATAL_ERROR(VPR_ERROR_NET_F,
+                            ".blif file and .net file do not match, .net file missing atom %s.\n",
+                            atom_ctx.nlist.block_name(blk_id).c_str());
+        }
+    }
+    /* TODO: Add additional check to make sure net connections match */
+    mark_constant_generators(clb_nlist, verbosity);
+
+    load_external_nets_and_cb(clb_nlist);
+
+    /* load mapping between external nets and all nets */
+    for (auto net_id : atom_ctx.nlist.nets()) {
+        atom_ctx.lookup.set_atom_clb_net(net_id, ClusterNetId::INVALID());
+    }
+
+    //Save the mapping between clb and atom nets
+    for (auto clb_net_id : clb_nlist.nets()) {
+        AtomNetId net_id = atom_ctx.nlist.find_net(clb_nlist.net_name(clb_net_id));
+        VTR_ASSERT(net_id);
+        atom_ctx.lookup.set_atom_clb_net(net_id, clb_net_id);
+    }
+
+    /* load mapping between atom pins and pb_graph_pins */
+    load_atom_pin_mapping(clb_nlist);
+
+    clock_t end = clock();
+
+    VTR_LOG("Finished loading packed FPGA netlist file (took %g seconds).\n", (float)(end - begin) / CLOCKS_PER_SEC);
+
+    size_t num_pb_route_used = 0;
+    size_t num_pb_route_alloc = 0;
+    size_t num_pb_pins = 0;
+    for (auto clb : clb_nlist.blocks()) {
+        t_pb* pb = clb_nlist.block_pb(clb);
+
+        for (int ipin = 0; ipin < pb->pb_graph_node->total_pb_pins; ++ipin) {
+            if (pb->pb_route.count(ipin)) {
+                ++num_pb_route_alloc;
+                if (pb->pb_route[ipin].atom_net_id) {
+                    ++num_pb_route_used;
+                }
+            }
+            ++num_pb_pins;
+        }
+    }
+
+    return clb_nlist;
+}
+
+/**
+ * Loads the clusters (blocks, ports, pb hierarchy and intra-cluster routing) of an XML .net file
+ */
+static ClusteredNetlist read_xml_netlist_clusters(const char* net_file,
+                                                  const t_arch* arch,
+                                                  bool verify_file_digests,
+                                                  int* num_primitives) {
+    size_t bcount = 0;
+    std::vector<std::string> circuit_inputs, circuit_outputs, circuit_clocks;
+
+    auto& atom_ctx = g_vpr_ctx.atom();
+
     //Save an identifier for the netlist based on it's contents
     auto clb_nlist = ClusteredNetlist(net_file, vtr::secure_digest_file(net_file));
 
@@ -93,9 +174,6 @@ ClusteredNetlist read_netlist(const char* net_file,
     }
 
     try {
-        /* Save netlist file's name in file-scoped variable */
-        netlist_file_name = net_file;
-
         /* Root node should be block */
         auto top = doc.child("block");
         if (!top) {
@@ -175,10 +253,6 @@ ClusteredNetlist read_netlist(const char* net_file,
 
         /* Parse all CLB blocks and all nets*/
 
-        //Reset atom/pb mapping (it is reloaded from the packed netlist file)
-        for (auto blk_id : atom_ctx.nlist.blocks())
-            atom_ctx.lookup.set_atom_pb(blk_id, nullptr);
-
         //Count the number of blocks for allocation
         bcount = pugiutil::count_children(top, "block", loc_data, pugiutil::ReqOpt::OPTIONAL);
         if (bcount == 0)
@@ -187,26 +261,11 @@ ClusteredNetlist read_netlist(const char* net_file,
         /* Process netlist */
         unsigned i = 0;
         for (auto curr_block = top.child("block"); curr_block; curr_block = curr_block.next_sibling("block")) {
-            processComplexBlock(curr_block, ClusterBlockId(i), &num_primitives, loc_data, &clb_nlist);
+            processComplexBlock(curr_block, ClusterBlockId(i), num_primitives, loc_data, &clb_nlist);
             i++;
         }
         VTR_ASSERT(bcount == i);
         VTR_ASSERT(clb_nlist.blocks().size() == i);
-        VTR_ASSERT(num_primitives >= 0);
-        VTR_ASSERT(static_cast<size_t>(num_primitives) == atom_ctx.nlist.blocks().size());
-
-        /* Error check */
-        for (auto blk_id : atom_ctx.nlist.blocks()) {
-            if (atom_ctx.lookup.atom_pb(blk_id) == nullptr) {
-                VPR_FATAL_ERROR(VPR_ERROR_NET_F,
-                                ".blif file and .net file do not match, .net file missing atom %s.\n",
-                                atom_ctx.nlist.block_name(blk_id).c_str());
-            }
-        }
-        /* TODO: Add additional check to make sure net connections match */
-        mark_constant_generators(clb_nlist, verbosity);
-
-        load_external_nets_and_cb(clb_nlist);
     } catch (pugiutil::XmlError& e) {
         vpr_throw(VPR_ERROR_NET_F, e.filename_c_str(), e.line(),
                   "Error loading post-pack netlist (%s)", e.what());
@@ -215,42 +274,6 @@ ClusteredNetlist read_netlist(const char* net_file,
     /* TODO: create this function later
      * check_top_IO_matches_IO_blocks(circuit_inputs, circuit_outputs, circuit_clocks, blist, bcount); */
 
-    /* load mapping between external nets and all nets */
-    for (auto net_id : atom_ctx.nlist.nets()) {
-        atom_ctx.lookup.set_atom_clb_net(net_id, ClusterNetId::INVALID());
-    }
-
-    //Save the mapping between clb and atom nets
-    for (auto clb_net_id : clb_nlist.nets()) {
-        AtomNetId net_id = atom_ctx.nlist.find_net(clb_nlist.net_name(clb_net_id));
-        VTR_ASSERT(net_id);
-        atom_ctx.lookup.set_atom_clb_net(net_id, clb_net_id);
-    }
-
-    /* load mapping between atom pins and pb_graph_pins */
-    load_atom_pin_mapping(clb_nlist);
-
-    clock_t end = clock();
-
-    VTR_LOG("Finished loading packed FPGA netlist file (took %g seconds).\n", (float)(end - begin) / CLOCKS_PER_SEC);
-
-    size_t num_pb_route_used = 0;
-    size_t num_pb_route_alloc = 0;
-    size_t num_pb_pins = 0;
-    for (auto clb : clb_nlist.blocks()) {
-        t_pb* pb = clb_nlist.block_pb(clb);
-
-        for (int ipin = 0; ipin < pb->pb_graph_node->total_pb_pins; ++ipin) {
-            if (pb->pb_route.count(ipin)) {
-                ++num_pb_route_alloc;
-                if (pb->pb_route[ipin].atom_net_id) {
-                    ++num_pb_route_used;
-                }
-            }
-            ++num_pb_pins;
-        }
-    }
-
     return clb_nlist;
 }
 
@@ -421,6 +421,41 @@ struct ParseTimingReportDetail {
     }
 };
 
+struct ParseTimingUpdateType {
+    ConvertedValue<e_timing_update_type> from_str(std::string str) {
+        ConvertedValue<e_timing_update_type> conv_value;
+        if (str == "full")
+            conv_value.set_value(e_timing_update_type::FULL);
+        else if (str == "incremental")
+            conv_value.set_value(e_timing_update_type::INCREMENTAL);
+        else if (str == "auto")
+            conv_value.set_value(e_timing_update_type::AUTO);
+        else {
+            std::stringstream msg;
+            msg << "Invalid conversion from '" << str << "' to e_timing_update_type (expected one of: " << argparse::join(default_choices(), ", ") << ")";
+            conv_value.set_error(msg.str());
+        }
+        return conv_value;
+    }
+
+    ConvertedValue<std::string> to_str(e_timing_update_type val) {
+        ConvertedValue<std::string> conv_value;
+        if (val == e_timing_update_type::FULL)
+            conv_value.set_value("full");
+        else if (val == e_timing_update_type::INCREMENTAL)
+            conv_value.set_value("incremental");
+        else {
+            VTR_ASSERT(val == e_timing_update_type::AUTO);
+            conv_value.set_value("auto");
+        }
+        return conv_value;
+    }
+
+    std::vector<std::string> default_choices() {
+        return {"auto", "full", "incremental"};
+    }
+};
+
 struct ParseClockModeling {
     ConvertedValue<e_clock_modeling> from_str(std::string str) {
         ConvertedValue<e_clock_modeling> conv_value;
@@ -679,6 +714,40 @@ struct ParseRouterLookahead {
     }
 };
 
+struct ParseRouterHeap {
+    ConvertedValue<e_heap_type> from_str(std::string str) {
+        ConvertedValue<e_heap_type> conv_value;
+        if (str == "binary")
+            conv_value.set_value(e_heap_type::BINARY_HEAP);
+        else if (str == "four_ary")
+            conv_value.set_value(e_heap_type::FOUR_ARY_HEAP);
+        else {
+            std::stringstream msg;
+            msg << "Invalid conversion from '"
+                << str
+                << "' to e_heap_type (expected one of: "
+                << argparse::join(default_choices(), ", ") << ")";
+            conv_value.set_error(msg.str());
+        }
+        return conv_value;
+    }
+
+    ConvertedValue<std::string> to_str(e_heap_type val) {
+        ConvertedValue<std::string> conv_value;
+        if (val == e_heap_type::BINARY_HEAP)
+            conv_value.set_value("binary");
+        else {
+            VTR_ASSERT(val == e_heap_type::FOUR_ARY_HEAP);
+            conv_value.set_value("four_ary");
+        }
+        return conv_value;
+    }
+
+    std::vector<std::string> default_choices() {
+        return {"binary", "four_ary"};
+    }
+};
+
 struct ParsePlaceDelayModel {
     ConvertedValue<PlaceDelayModelType> from_str(std::string str) {
         ConvertedValue<PlaceDelayModelType> conv_value;
@@ -995,8 +1064,25 @@ argparse::ArgumentParser create_arg_parser(std::string prog_name, t_options& arg
         .default_value("auto")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+    file_grp.add_argument<bool, ParseOnOff>(args.parallel_circuit_parse, "--parallel_circuit_parse")
+        .help(
+            "Controls whether the circuit file is parsed with the parallel (mmap'd and chunked) BLIF parser"
+            " rather than libblifparse. Chunks of the file are parsed in parallel using up to --num_workers threads,"
+            " which speeds up loading large circuits. Both parsers build the same netlist.")
+        .default_value("off")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     file_grp.add_argument(args.NetFile, "--net_file")
-        .help("Path to packed netlist file")
+        .help(
+            "Path to packed netlist file."
+            " Files ending in '.bin' are loaded as a binary packed netlist (see --write_binary_net_file).")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    file_grp.add_argument(args.write_binary_net_file, "--write_binary_net_file")
+        .help(
+            "Writes the loaded packed netlist to the specified file in the (much faster to load) binary format."
+            " Name the file with a '.bin' extension to load it later with --net_file.")
+        .metavar("BINARY_NET_FILE")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
     file_grp.add_argument(args.PlaceFile, "--place_file")
@@ -1014,18 +1100,34 @@ argparse::ArgumentParser create_arg_parser(std::string prog_name, t_options& arg
     file_grp.add_argument(args.read_rr_graph_file, "--read_rr_graph")
         .help(
             "The routing resource graph file to load."
-            " The loaded routing resource graph overrides any routing architecture specified in the architecture file.")
+            " The loaded routing resource graph overrides any routing architecture specified in the architecture file."
+            " Files ending in '.bin' are read in the (much faster to load) binary format, otherwise XML is expected.")
         .metavar("RR_GRAPH_FILE")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
     file_grp.add_argument(args.write_rr_graph_file, "--write_rr_graph")
-        .help("Writes the routing resource graph to the specified file")
+        .help(
+            "Writes the routing resource graph to the specified file."
+            " Files ending in '.bin' are written in the binary format, otherwise XML is written"
+            " (gzip compressed if the file name ends in '.gz')."
+            " Combined with --read_rr_graph this converts an RR graph between the two formats.")
         .metavar("RR_GRAPH_FILE")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+    file_grp.add_argument<bool, ParseOnOff>(args.write_rr_graph_nodes_and_edges_only, "--write_rr_graph_nodes_and_edges_only")
+        .help(
+            "Controls whether --write_rr_graph writes only the rr_nodes and rr_edges sections of an XML RR graph"
+            " (skipping channels, switches, segments, block types and grid)."
+            " Such files are faster to write, but can not be loaded with --read_rr_graph.")
+        .default_value("off")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     file_grp.add_argument(args.read_router_lookahead, "--read_router_lookahead")
         .help(
-            "Reads the lookahead data from the specified file instead of computing it.")
+            "Reads the lookahead data from the specified file instead of computing it."
+            " The map lookahead is computed if the file does not exist or was computed"
+            " for a different architecture or routing resource graph, so the same file"
+            " may also be passed to --write_router_lookahead to cache the lookahead between runs.")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
     file_grp.add_argument(args.write_router_lookahead, "--write_router_lookahead")
@@ -1241,6 +1343,15 @@ argparse::ArgumentParser create_arg_parser(std::string prog_name, t_options& arg
         .default_value("2")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+    pack_grp.add_argument<bool, ParseOnOff>(args.parallel_packing, "--parallel_packing")
+        .help(
+            "Controls whether the clusterer overlaps the intra-cluster routing of each cluster"
+            " with the formation of the following clusters. Up to --num_workers clusters are"
+            " routed in the background; if one turns out to be unroutable, the clusters formed"
+            " after it are discarded and re-formed, so the clustering is identical to the serial one.")
+        .default_value("off")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     auto& place_grp = parser.add_argument_group("placement options");
 
     place_grp.add_argument(args.Seed, "--seed")
@@ -1310,6 +1421,46 @@ argparse::ArgumentParser create_arg_parser(std::string prog_name, t_options& arg
         .default_value("")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+    place_grp.add_argument<bool, ParseOnOff>(args.parallel_placement, "--parallel_placement")
+        .help(
+            "Controls whether the annealer evaluates moves concurrently."
+            " Moves are proposed in batches of moves which share no blocks or nets;"
+            " the cost changes of a batch are computed in parallel (using up to --num_workers threads),"
+            " and the moves are then accepted or rejected one at a time in the order they were proposed.")
+        .default_value("off")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    place_grp.add_argument<bool, ParseOnOff>(args.parallel_placement_deterministic, "--parallel_placement_deterministic")
+        .help(
+            "Controls how moves are batched for --parallel_placement.\n"
+            " * on : a fixed batch size is used, so the placement is identical\n"
+            "        (for a given --seed) for any number of workers\n"
+            " * off: the batch size is scaled with the number of workers,\n"
+            "        which increases concurrency but makes the placement\n"
+            "        depend on --num_workers\n")
+        .default_value("on")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    place_grp.add_argument(args.place_move_generators, "--place_move_generators")
+        .help(
+            "Comma separated list of the move generators used by the annealer, each optionally"
+            " followed by ':<weight>' (default weight 1). Each move is proposed by a generator"
+            " picked at random with probability proportional to its weight.\n"
+            " * uniform : move a random block to a random location within the range limit\n"
+            " * median  : move a random block towards the median of its nets' bounding boxes\n"
+            " * critical: move an endpoint of a timing critical connection towards the\n"
+            "             blocks it connects to (timing-driven placement only)\n"
+            "For example: 'uniform:2,median:1,critical:1'")
+        .default_value("uniform")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    place_grp.add_argument<bool, ParseOnOff>(args.place_adaptive_move_mix, "--place_adaptive_move_mix")
+        .help(
+            "Controls whether the weights of --place_move_generators are periodically scaled"
+            " by each generator's recent move acceptance rate")
+        .default_value("off")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     auto& place_timing_grp = parser.add_argument_group("timing-driven placement options");
 
     place_timing_grp.add_argument(args.PlaceTimingTradeoff, "--timing_tradeoff")
@@ -1599,6 +1750,15 @@ argparse::ArgumentParser create_arg_parser(std::string prog_name, t_options& arg
         .default_value("classic")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+    route_timing_grp.add_argument<e_heap_type, ParseRouterHeap>(args.router_heap, "--router_heap")
+        .help(
+            "Controls the priority queue used by the router's wavefront expansion.\n"
+            " * binary: A binary heap\n"
+            " * four_ary: A 4-ary heap, which is shallower and keeps the children\n"
+            "             of each node in one cache line\n")
+        .default_value("binary")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     route_timing_grp.add_argument(args.router_max_convergence_count, "--router_max_convergence_count")
         .help(
             "Controls how many times the router is allowed to converge to a legal routing before halting."
@@ -1620,6 +1780,26 @@ argparse::ArgumentParser create_arg_parser(std::string prog_name, t_options& arg
         .default_value("")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+    route_timing_grp.add_argument<bool, ParseOnOff>(args.parallel_routing, "--parallel_routing")
+        .help(
+            "Controls whether the timing-driven router routes nets concurrently."
+            " Nets are partitioned by recursively bisecting the device grid; nets within"
+            " disjoint regions are routed in parallel (using up to --num_workers threads),"
+            " while nets crossing a cut line are routed after the regions on both sides.")
+        .default_value("off")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    route_timing_grp.add_argument<bool, ParseOnOff>(args.parallel_routing_deterministic, "--parallel_routing_deterministic")
+        .help(
+            "Controls how nets are partitioned for --parallel_routing.\n"
+            " * on : a fixed partition is used, so the routing is identical\n"
+            "        for any number of workers\n"
+            " * off: the partition is sized for the number of workers, which\n"
+            "        reduces the nets routed with less concurrency but makes\n"
+            "        the routing depend on --num_workers\n")
+        .default_value("on")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     route_timing_grp.add_argument(args.router_debug_net, "--router_debug_net")
         .help(
             "Controls when router debugging is enabled.\n"
@@ -1675,6 +1855,17 @@ argparse::ArgumentParser create_arg_parser(std::string prog_name, t_options& arg
         .default_value("off")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+    analysis_grp.add_argument<e_timing_update_type, ParseTimingUpdateType>(args.timing_update_type, "--timing_update_type")
+        .help(
+            "Controls how timing analysis is updated during placement and routing.\n"
+            " * full: The whole timing graph is re-analyzed on every update\n"
+            " * incremental: Only the parts of the timing graph affected by changed\n"
+            "                connection delays are re-analyzed\n"
+            " * auto: Like 'incremental', but falls back to a full update when many\n"
+            "         connection delays have changed\n")
+        .default_value("auto")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     auto& power_grp = parser.add_argument_group("power analysis options");
 
     power_grp.add_argument<bool, ParseOnOff>(args.do_power, "--power")
@@ -1691,6 +1882,19 @@ argparse::ArgumentParser create_arg_parser(std::string prog_name, t_options& arg
         .help("Signal activities file for all nets (see documentation).")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+    power_grp.add_argument(args.read_power_characterization, "--read_power_characterization")
+        .help(
+            "Reads the CMOS technology properties and component callibration from the specified file"
+            " instead of loading --tech_properties and re-callibrating."
+            " They are loaded and callibrated if the file does not exist or was computed for a different"
+            " technology properties file or architecture, so the same file may also be passed to"
+            " --write_power_characterization to cache the characterization between runs.")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    power_grp.add_argument(args.write_power_characterization, "--write_power_characterization")
+        .help("Writes the CMOS technology properties and component callibration to the specified file.")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     return parser;
 }
 
@@ -21,10 +21,13 @@ struct t_options {
     argparse::ArgValue<std::string> SDCFile;
 
     argparse::ArgValue<e_circuit_format> circuit_format;
+    argparse::ArgValue<bool> parallel_circuit_parse;
 
     argparse::ArgValue<std::string> out_file_prefix;
     argparse::ArgValue<std::string> pad_loc_file;
+    argparse::ArgValue<std::string> write_binary_net_file;
     argparse::ArgValue<std::string> write_rr_graph_file;
+    argparse::ArgValue<bool> write_rr_graph_nodes_and_edges_only;
     argparse::ArgValue<std::string> read_rr_graph_file;
 
     argparse::ArgValue<std::string> write_placement_delay_lookup;
@@ -33,6 +36,9 @@ struct t_options {
     argparse::ArgValue<std::string> write_router_lookahead;
     argparse::ArgValue<std::string> read_router_lookahead;
 
+    argparse::ArgValue<std::string> write_power_characterization;
+    argparse::ArgValue<std::string> read_power_characterization;
+
     /* Stage Options */
     argparse::ArgValue<bool> do_packing;
     argparse::ArgValue<bool> do_placement;
@@ -87,6 +93,7 @@ struct t_options {
     argparse::ArgValue<int> pack_feasible_block_array_size;
     argparse::ArgValue<std::vector<std::string>> pack_high_fanout_threshold;
     argparse::ArgValue<int> pack_verbosity;
+    argparse::ArgValue<bool> parallel_packing;
 
     /* Placement options */
     argparse::ArgValue<int> Seed;
@@ -101,6 +108,10 @@ struct t_options {
     argparse::ArgValue<int> PlaceChanWidth;
     argparse::ArgValue<float> place_rlim_escape_fraction;
     argparse::ArgValue<std::string> place_move_stats_file;
+    argparse::ArgValue<bool> parallel_placement;
+    argparse::ArgValue<bool> parallel_placement_deterministic;
+    argparse::ArgValue<std::string> place_move_generators;
+    argparse::ArgValue<bool> place_adaptive_move_mix;
 
     /* Timing-driven placement options only */
     argparse::ArgValue<float> PlaceTimingTradeoff;
@@ -149,9 +160,12 @@ struct t_options {
     argparse::ArgValue<int> router_debug_net;
     argparse::ArgValue<int> router_debug_sink_rr;
     argparse::ArgValue<e_router_lookahead> router_lookahead_type;
+    argparse::ArgValue<e_heap_type> router_heap;
     argparse::ArgValue<int> router_max_convergence_count;
     argparse::ArgValue<float> router_reconvergence_cpd_threshold;
     argparse::ArgValue<std::string> router_first_iteration_timing_report_file;
+    argparse::ArgValue<bool> parallel_routing;
+    argparse::ArgValue<bool> parallel_routing_deterministic;
 
     /* Analysis options */
     argparse::ArgValue<bool> full_stats;
@@ -159,6 +173,7 @@ struct t_options {
     argparse::ArgValue<int> timing_report_npaths;
     argparse::ArgValue<e_timing_report_detail> timing_report_detail;
     argparse::ArgValue<bool> timing_report_skew;
+    argparse::ArgValue<e_timing_update_type> timing_update_type;
 };
 
 argparse::ArgumentParser create_arg_parser(std::string prog_name, t_options& args);
@@ -90,7 +90,7 @@ bool read_route(const char* route_file, const t_router_opts& router_opts, bool v
 
     /*Allocate necessary routing structures*/
     alloc_and_load_rr_node_route_structs();
-    init_route_structs(router_opts.bb_factor);
+    init_route_structs(router_opts.bb_factor, router_opts.router_heap);
 
     /*Check dimensions*/
     std::getline(fp, header_str);
@@ -26,6 +26,7 @@
 #include "globals.h"
 #include "atom_netlist.h"
 #include "read_netlist.h"
+#include "clustered_netlist_binary.h"
 #include "check_netlist.h"
 #include "read_blif.h"
 #include "draw.h"
@@ -298,6 +299,7 @@ void vpr_init_with_options(const t_options* options, t_vpr_setup* vpr_setup, t_a
                                               vpr_setup->PackerOpts.blif_file_name.c_str(),
                                               vpr_setup->user_models,
                                               vpr_setup->library_models,
+                                              options->parallel_circuit_parse,
                                               vpr_setup->NetlistOpts.const_gen_inference,
                                               vpr_setup->NetlistOpts.absorb_buffer_luts,
                                               vpr_setup->NetlistOpts.sweep_dangling_primary_ios,
@@ -569,8 +571,15 @@ void vpr_load_packing(t_vpr_setup& vpr_setup, const t_arch& arch) {
                                          vpr_setup.FileNameOpts.verify_file_digests,
                                          vpr_setup.PackerOpts.pack_verbosity);
 
+    if (!vpr_setup.FileNameOpts.write_binary_net_file.empty()) {
+        write_binary_netlist(vpr_setup.FileNameOpts.write_binary_net_file.c_str(), cluster_ctx.clb_nlist, &arch);
+    }
+
     process_constant_nets(cluster_ctx.clb_nlist, vpr_setup.constant_net_method, vpr_setup.PackerOpts.pack_verbosity);
 
+    //The clustered netlist is read-only from here on
+    cluster_ctx.clb_nlist.freeze();
+
     {
         std::ofstream ofs("packing_pin_util.rpt");
         report_packing_pin_usage(ofs, g_vpr_ctx);
@@ -661,7 +670,7 @@ RouteStatus vpr_route_flow(t_vpr_setup& vpr_setup, const t_arch& arch) {
 
             routing_delay_calc = std::make_shared<RoutingDelayCalculator>(atom_ctx.nlist, atom_ctx.lookup, net_delay);
 
-            timing_info = make_setup_hold_timing_info(routing_delay_calc);
+            timing_info = make_setup_hold_timing_info(routing_delay_calc, router_opts.timing_update_type);
         }
 
         if (router_opts.doRouting == STAGE_DO) {
@@ -1235,7 +1244,8 @@ void vpr_power_estimation(const t_vpr_setup& vpr_setup,
 
     /* Initialize the power module */
     bool power_error = power_init(vpr_setup.FileNameOpts.PowerFile.c_str(),
-                                  vpr_setup.FileNameOpts.CmosTechFile.c_str(), &Arch, &vpr_setup.RoutingArch);
+                                  vpr_setup.FileNameOpts.CmosTechFile.c_str(), &Arch, &vpr_setup.RoutingArch,
+                                  vpr_setup.PowerOpts);
     if (power_error) {
         VTR_LOG_ERROR("Power initialization failed.\n");
     }
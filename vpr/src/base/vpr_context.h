@@ -10,6 +10,7 @@
 #include "atom_netlist.h"
 #include "clustered_netlist.h"
 #include "rr_node.h"
+#include "frozen_rr_graph.h"
 #include "tatum/TimingGraph.hpp"
 #include "tatum/TimingConstraints.hpp"
 #include "power.h"
@@ -87,6 +88,7 @@ struct TimingContext : public Context {
         size_t num_full_setup_updates = 0;
         size_t num_full_hold_updates = 0;
         size_t num_full_setup_hold_updates = 0;
+        size_t num_incr_updates = 0;
 
         double old_sta_wallclock_time = 0.;
         double old_delay_annotation_wallclock_time = 0.;
@@ -162,6 +164,10 @@ struct DeviceContext : public Context {
 
     std::vector<t_rr_switch_inf> rr_switch_inf; /* autogenerated in build_rr_graph based on switch fan-in. [0..(num_rr_switches-1)] */
 
+    //Compact read-only view of rr_nodes and rr_switch_inf used by the router's inner loop.
+    //Rebuilt by create_rr_graph() whenever the rr graph changes
+    FrozenRRGraph frozen_rr_graph;
+
     int num_arch_switches;
     t_arch_switch_inf* arch_switch_inf; /* [0..(num_arch_switches-1)] */
 
@@ -107,6 +107,11 @@ enum class e_router_lookahead {
     NO_OP    //A no-operation lookahead which always returns zero
 };
 
+enum class e_heap_type {
+    BINARY_HEAP,  //Binary heap (2 children per node)
+    FOUR_ARY_HEAP //4-ary heap: shallower, with a node's children sharing a cache line
+};
+
 enum class e_route_bb_update {
     STATIC, //Router net bounding boxes are not updated
     DYNAMIC //Rotuer net bounding boxes are updated
@@ -647,6 +652,7 @@ struct t_file_name_opts {
     std::string CircuitName;
     std::string BlifFile;
     std::string NetFile;
+    std::string write_binary_net_file;
     std::string PlaceFile;
     std::string RouteFile;
     std::string ActFile;
@@ -706,6 +712,7 @@ struct t_packer_opts {
     std::vector<std::string> high_fanout_threshold;
     int transitive_fanout_threshold;
     int feasible_block_array_size;
+    bool parallel_packing; //Route clusters in the background while forming the following clusters
     e_stage_action doPacking;
     enum e_packer_algorithm packer_algorithm;
     std::string device_layout;
@@ -773,6 +780,12 @@ enum class e_file_type {
     NONE
 };
 
+enum class e_timing_update_type {
+    FULL,        //Fully re-analyze the timing graph on every update
+    INCREMENTAL, //Only re-analyze the parts of the timing graph affected by changed delays
+    AUTO         //Update incrementally unless many delays have changed
+};
+
 struct t_placer_opts {
     enum e_place_algorithm place_algorithm;
     float timing_tradeoff;
@@ -790,6 +803,10 @@ struct t_placer_opts {
     e_stage_action doPlacement;
     float rlim_escape_fraction;
     std::string move_stats_file;
+    bool parallel_placement;               //Evaluate batches of independent moves concurrently
+    bool parallel_placement_deterministic; //Size move batches independently of the number of workers
+    std::string move_generators;           //Move generators and their weights (e.g. "uniform:2,median:1")
+    bool adaptive_move_mix;                //Scale the move generator weights by their acceptance rates
 
     PlaceDelayModelType delay_model_type;
     e_reducer delay_model_reducer;
@@ -799,6 +816,7 @@ struct t_placer_opts {
     float delay_ramp_slope;
     float tsu_rel_margin;
     float tsu_abs_margin;
+    e_timing_update_type timing_update_type;
 
     std::string post_place_timing_report_file;
 
@@ -942,10 +960,14 @@ struct t_router_opts {
     int router_debug_net;
     int router_debug_sink_rr;
     e_router_lookahead lookahead_type;
+    e_heap_type router_heap;
     int max_convergence_count;
     float reconvergence_cpd_threshold;
     std::string first_iteration_timing_report_file;
     bool strict_checks;
+    bool parallel_routing;               //Route nets of disjoint device regions concurrently
+    bool parallel_routing_deterministic; //Partition nets independently of the number of workers
+    e_timing_update_type timing_update_type;
 
     std::string write_router_lookahead;
     std::string read_router_lookahead;
@@ -959,6 +981,7 @@ struct t_analysis_opts {
     int timing_report_npaths;
     e_timing_report_detail timing_report_detail;
     bool timing_report_skew;
+    e_timing_update_type timing_update_type;
 };
 
 /* Defines the detailed routing architecture of the FPGA.  Only important   *
@@ -992,6 +1015,8 @@ struct t_analysis_opts {
  * read_rr_graph_filename: File to read the RR graph from (overrides        *
  *                         architecture)                                    *
  * write_rr_graph_filename: File to write the RR graph to after generation  *
+ * write_rr_graph_nodes_and_edges_only: Write only the nodes and edges of   *
+ *                                      the RR graph                        *
  *                                                                          */
 
 struct t_det_routing_arch {
@@ -1009,6 +1034,7 @@ struct t_det_routing_arch {
 
     std::string read_rr_graph_filename;
     std::string write_rr_graph_filename;
+    bool write_rr_graph_nodes_and_edges_only = false;
 };
 
 enum e_direction : unsigned char {
@@ -1246,6 +1272,9 @@ enum e_cost_indices {
 /* Power estimation options */
 struct t_power_opts {
     bool do_power; /* Perform power estimation? */
+
+    std::string read_power_characterization;  /* Technology/callibration file to load, if valid */
+    std::string write_power_characterization; /* Technology/callibration file to write */
 };
 
 /* Channel width data */
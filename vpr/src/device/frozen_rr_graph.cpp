@@ -0,0 +1,109 @@
+#include <limits>
+
+#include "vpr_error.h"
+
+#include "rr_graph_obj.h"
+#include "frozen_rr_graph.h"
+
+void FrozenRRGraph::build(const std::vector<t_rr_node>& rr_nodes,
+                          const std::vector<t_rr_switch_inf>& rr_switch_inf) {
+    clear();
+
+    size_t num_edges = 0;
+    for (const t_rr_node& rr_node : rr_nodes) {
+        num_edges += rr_node.num_edges();
+    }
+    if (num_edges > size_t(std::numeric_limits<int>::max())) {
+        VPR_THROW(VPR_ERROR_ROUTE, "RR graph has too many edges (%zu) for the frozen rr graph view", num_edges);
+    }
+
+    nodes_.reserve(rr_nodes.size());
+    first_edges_.reserve(rr_nodes.size() + 1);
+    edges_.reserve(num_edges);
+
+    for (const t_rr_node& rr_node : rr_nodes) {
+        t_frozen_node node;
+        node.xlow = rr_node.xlow();
+        node.ylow = rr_node.ylow();
+        node.xhigh = rr_node.xhigh();
+        node.yhigh = rr_node.yhigh();
+        node.R = rr_node.R();
+        node.C = rr_node.C();
+        node.cost_index = rr_node.cost_index();
+        node.type = rr_node.type();
+        nodes_.push_back(node);
+
+        first_edges_.push_back(RREdgeId(edges_.size()));
+        for (t_edge_size iedge = 0; iedge < rr_node.num_edges(); ++iedge) {
+            t_frozen_edge edge;
+            edge.sink_node = rr_node.edge_sink_node(iedge);
+            edge.switch_id = rr_node.edge_switch(iedge);
+            edges_.push_back(edge);
+        }
+    }
+    first_edges_.push_back(RREdgeId(edges_.size()));
+
+    switches_.reserve(rr_switch_inf.size());
+    for (const t_rr_switch_inf& switch_inf : rr_switch_inf) {
+        add_switch(switch_inf);
+    }
+}
+
+void FrozenRRGraph::build(const RRGraph& rr_graph) {
+    VTR_ASSERT_MSG(!rr_graph.is_dirty(), "RRGraph must be compressed before it is frozen");
+
+    clear();
+
+    nodes_.reserve(rr_graph.nodes().size());
+    first_edges_.reserve(rr_graph.nodes().size() + 1);
+
+    for (const RRNodeId& rr_node : rr_graph.nodes()) {
+        VTR_ASSERT(size_t(rr_node) == nodes_.size());
+
+        t_frozen_node node;
+        node.xlow = rr_graph.node_xlow(rr_node);
+        node.ylow = rr_graph.node_ylow(rr_node);
+        node.xhigh = rr_graph.node_xhigh(rr_node);
+        node.yhigh = rr_graph.node_yhigh(rr_node);
+        node.R = rr_graph.node_R(rr_node);
+        node.C = rr_graph.node_C(rr_node);
+        node.cost_index = rr_graph.node_cost_index(rr_node);
+        node.type = rr_graph.node_type(rr_node);
+        nodes_.push_back(node);
+
+        first_edges_.push_back(RREdgeId(edges_.size()));
+        for (const RREdgeId& rr_edge : rr_graph.node_out_edges(rr_node)) {
+            t_frozen_edge edge;
+            edge.sink_node = size_t(rr_graph.edge_sink_node(rr_edge));
+            edge.switch_id = size_t(rr_graph.edge_switch(rr_edge));
+            edges_.push_back(edge);
+        }
+    }
+    first_edges_.push_back(RREdgeId(edges_.size()));
+
+    for (const RRSwitchId& switch_id : rr_graph.switches()) {
+        VTR_ASSERT(size_t(switch_id) == switches_.size());
+        add_switch(rr_graph.get_switch(switch_id));
+    }
+}
+
+void FrozenRRGraph::clear() {
+    nodes_.clear();
+    nodes_.shrink_to_fit();
+    first_edges_.clear();
+    first_edges_.shrink_to_fit();
+    edges_.clear();
+    edges_.shrink_to_fit();
+    switches_.clear();
+    switches_.shrink_to_fit();
+}
+
+void FrozenRRGraph::add_switch(const t_rr_switch_inf& switch_inf) {
+    t_frozen_switch rr_switch;
+    rr_switch.R = switch_inf.R;
+    rr_switch.Tdel = switch_inf.Tdel;
+    rr_switch.Cinternal = switch_inf.Cinternal;
+    rr_switch.buffered = switch_inf.buffered();
+    rr_switch.configurable = switch_inf.configurable();
+    switches_.push_back(rr_switch);
+}
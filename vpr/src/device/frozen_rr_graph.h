@@ -0,0 +1,144 @@
+#ifndef FROZEN_RR_GRAPH_H
+#define FROZEN_RR_GRAPH_H
+
+/************************************************************************
+ * This file introduces FrozenRRGraph, a compact read-only view of a
+ * routing resource graph laid out for the router's inner loop.
+ *
+ * Overview
+ * ========
+ * The router's wavefront expansion touches, for every edge it expands,
+ * the sink node's bounding box and type, the node's R/C and the switch's
+ * delay parameters. In t_rr_node these live in per-node heap-allocated
+ * edge arrays, and R/C are an extra look-up into rr_rc_data, so each
+ * expansion hops around memory.
+ *
+ * FrozenRRGraph stores the same data in a few flat arrays:
+ *   - a CSR (compressed sparse row) edge list: the out-going edges of
+ *     node i are edges [first_edge[i], first_edge[i+1]), each holding its
+ *     sink node and switch next to each other
+ *   - one small record per node with the bounding box, R, C, cost index
+ *     and type
+ *   - a flyweight switch table with only the fields the router needs
+ *
+ * Node ids, switch ids and the order of each node's out-going edges are
+ * the same as in the graph the view was built from, so an edge can still
+ * be identified by (node, local edge index) as in t_rr_node.
+ *
+ * The view is frozen: it has no mutators, and must be rebuilt with build()
+ * whenever the graph it was built from changes. DeviceContext holds a view
+ * of device_ctx.rr_nodes which create_rr_graph() rebuilds.
+ *
+ * Example
+ * =======
+ *     const FrozenRRGraph& rr_graph = device_ctx.frozen_rr_graph;
+ *
+ *     for (t_edge_size iedge = 0; iedge < rr_graph.node_num_edges(node); ++iedge) {
+ *         RREdgeId edge = rr_graph.node_edge(node, iedge);
+ *         RRNodeId sink = rr_graph.edge_sink_node(edge);
+ *         float Tdel = rr_graph.switch_Tdel(rr_graph.edge_switch(edge));
+ *     }
+ ***********************************************************************/
+
+#include <cstdint>
+#include <vector>
+
+#include "vtr_vector.h"
+#include "vtr_assert.h"
+
+#include "rr_graph_fwd.h"
+#include "rr_node.h"
+
+class FrozenRRGraph {
+  public: /* Builders */
+    //Builds the view from the rr nodes and switches in the device context format
+    void build(const std::vector<t_rr_node>& rr_nodes,
+               const std::vector<t_rr_switch_inf>& rr_switch_inf);
+
+    //Builds the view from an RRGraph object.
+    //The RRGraph must be compressed (i.e. not dirty) so its ids are contiguous
+    void build(const RRGraph& rr_graph);
+
+    //Releases all data
+    void clear();
+
+  public: /* Aggregates */
+    bool empty() const { return nodes_.empty(); }
+    size_t num_nodes() const { return nodes_.size(); }
+    size_t num_edges() const { return edges_.size(); }
+    size_t num_switches() const { return switches_.size(); }
+
+  public: /* Node accessors */
+    t_rr_type node_type(const RRNodeId& node) const { return t_rr_type(nodes_[node].type); }
+    short node_xlow(const RRNodeId& node) const { return nodes_[node].xlow; }
+    short node_ylow(const RRNodeId& node) const { return nodes_[node].ylow; }
+    short node_xhigh(const RRNodeId& node) const { return nodes_[node].xhigh; }
+    short node_yhigh(const RRNodeId& node) const { return nodes_[node].yhigh; }
+    short node_cost_index(const RRNodeId& node) const { return nodes_[node].cost_index; }
+    float node_R(const RRNodeId& node) const { return nodes_[node].R; }
+    float node_C(const RRNodeId& node) const { return nodes_[node].C; }
+
+    //Number of out-going edges of node
+    t_edge_size node_num_edges(const RRNodeId& node) const {
+        return t_edge_size(size_t(first_edges_[RRNodeId(size_t(node) + 1)]) - size_t(first_edges_[node]));
+    }
+
+    //The iedge'th out-going edge of node (same order as t_rr_node::edge_sink_node(iedge))
+    RREdgeId node_edge(const RRNodeId& node, const t_edge_size& iedge) const {
+        VTR_ASSERT_SAFE(iedge < node_num_edges(node));
+        return RREdgeId(size_t(first_edges_[node]) + iedge);
+    }
+
+  public: /* Edge accessors */
+    RRNodeId edge_sink_node(const RREdgeId& edge) const { return RRNodeId(edges_[edge].sink_node); }
+    RRSwitchId edge_switch(const RREdgeId& edge) const { return RRSwitchId(edges_[edge].switch_id); }
+    bool edge_is_configurable(const RREdgeId& edge) const { return switch_configurable(edge_switch(edge)); }
+
+  public: /* Switch accessors */
+    float switch_R(const RRSwitchId& switch_id) const { return switches_[switch_id].R; }
+    float switch_Tdel(const RRSwitchId& switch_id) const { return switches_[switch_id].Tdel; }
+    float switch_Cinternal(const RRSwitchId& switch_id) const { return switches_[switch_id].Cinternal; }
+    bool switch_buffered(const RRSwitchId& switch_id) const { return switches_[switch_id].buffered; }
+    bool switch_configurable(const RRSwitchId& switch_id) const { return switches_[switch_id].configurable; }
+
+  private: /* Types */
+    struct t_frozen_node {
+        int16_t xlow = -1;
+        int16_t ylow = -1;
+        int16_t xhigh = -1;
+        int16_t yhigh = -1;
+        float R = 0.;
+        float C = 0.;
+        int16_t cost_index = -1;
+        uint8_t type = NUM_RR_TYPES;
+    };
+
+    struct t_frozen_edge {
+        int32_t sink_node = -1;
+        int16_t switch_id = -1;
+    };
+
+    struct t_frozen_switch {
+        float R = 0.;
+        float Tdel = 0.;
+        float Cinternal = 0.;
+        bool buffered = false;
+        bool configurable = false;
+    };
+
+  private: /* Internal helpers */
+    void add_switch(const t_rr_switch_inf& switch_inf);
+
+  private: /* Internal data */
+    vtr::vector<RRNodeId, t_frozen_node> nodes_;
+
+    //Offset of the first out-going edge of each node, with one extra
+    //trailing entry so the edges of node i end at first_edges_[i+1]
+    vtr::vector<RRNodeId, RREdgeId> first_edges_;
+
+    vtr::vector<RREdgeId, t_frozen_edge> edges_;
+
+    vtr::vector<RRSwitchId, t_frozen_switch> switches_;
+};
+
+#endif
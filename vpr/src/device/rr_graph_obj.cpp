@@ -827,6 +827,7 @@ RRNodeId RRGraph::create_node(const t_rr_type& type) {
     node_sides_.push_back(NUM_SIDES);
     node_Rs_.push_back(0.);
     node_Cs_.push_back(0.);
+    node_segments_.push_back(RRSegmentId::INVALID());
 
     node_in_edges_.emplace_back();  //Initially empty
     node_out_edges_.emplace_back(); //Initially empty
@@ -65,14 +65,15 @@ int main(int argc, const char** argv) {
         }
 
         auto& timing_ctx = g_vpr_ctx.timing();
-        VTR_LOG("Timing analysis took %g seconds (%g STA, %g slack) (%zu full updates: %zu setup, %zu hold, %zu combined).\n",
+        VTR_LOG("Timing analysis took %g seconds (%g STA, %g slack) (%zu full updates: %zu setup, %zu hold, %zu combined) (%zu incremental updates).\n",
                 timing_ctx.stats.timing_analysis_wallclock_time(),
                 timing_ctx.stats.sta_wallclock_time,
                 timing_ctx.stats.slack_wallclock_time,
                 timing_ctx.stats.num_full_updates(),
                 timing_ctx.stats.num_full_setup_updates,
                 timing_ctx.stats.num_full_hold_updates,
-                timing_ctx.stats.num_full_setup_hold_updates);
+                timing_ctx.stats.num_full_setup_hold_updates,
+                timing_ctx.stats.num_incr_updates);
 
         /* free data structures */
         vpr_free_all(Arch, vpr_setup);
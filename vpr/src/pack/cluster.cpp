@@ -40,11 +40,14 @@
 #include <map>
 #include <algorithm>
 #include <fstream>
+#include <deque>
+#include <memory>
 
 #include "vtr_assert.h"
 #include "vtr_log.h"
 #include "vtr_math.h"
 #include "vtr_memory.h"
+#include "vtr_time.h"
 
 #include "vpr_types.h"
 #include "vpr_error.h"
@@ -61,6 +64,7 @@
 #include "echo_files.h"
 #include "cluster_router.h"
 #include "lb_type_rr_graph.h"
+#include "pack_report.h"
 
 #include "timing_info.h"
 #include "timing_reports.h"
@@ -70,6 +74,11 @@
 #include "tatum/report/graphviz_dot_writer.hpp"
 #include "tatum/TimingReporter.hpp"
 
+#if defined(VPR_USE_TBB)
+#    include <tbb/task_group.h>
+#    include <tbb/task_arena.h>
+#endif
+
 #define AAPACK_MAX_HIGH_FANOUT_EXPLORE 10 /* For high-fanout nets that are ignored, consider a maximum of this many sinks, must be less than packer_opts.feasible_block_array_size */
 #define AAPACK_MAX_TRANSITIVE_EXPLORE 40  /* When investigating transitive fanout connections in packing, consider a maximum of this many molecules, must be less than packer_opts.feasible_block_array_size */
 
@@ -122,6 +131,20 @@ struct t_molecule_stats {
     int num_used_ext_outputs = 0; //Number of *used external* output pins across all primitives in molecule
 };
 
+/* A cluster whose end-of-cluster intra-cluster route is running in the background (--parallel_packing).
+ * The clusters following it are formed assuming the route succeeds; if it fails they are discarded and
+ * the cluster is re-formed from its seed, so the clustering matches the serial one. */
+struct t_pending_cluster {
+    ClusterBlockId clb_index;
+    t_pack_molecule* seed = nullptr;
+    int savedseedindex = 0; //Seed index to restore if the cluster has to be re-formed
+    t_lb_router_data* router_data = nullptr;
+    bool is_routed = false;
+#if defined(VPR_USE_TBB)
+    std::unique_ptr<tbb::task_group> route_task;
+#endif
+};
+
 /* Keeps a linked list of the unclustered blocks to speed up looking for *
  * unclustered blocks with a certain number of *external* inputs.        *
  * [0..lut_size].  Unclustered_list_head[i] points to the head of the    *
@@ -140,6 +163,11 @@ static t_molecule_link* memory_pool; /*Declared here so I can free easily.*/
  * so this should take care of all multiple connections.                */
 static std::unordered_map<AtomNetId, int> net_output_feeds_driving_block_input;
 
+/* Packing stats released by pbs which were freed or whose cluster was completed, recycled by later pbs.
+ * Their containers keep their storage, and their feasible_blocks arrays are all feasible_block_array_size long */
+static std::vector<t_pb_stats*> pb_stats_free_list;
+static t_pack_alloc_stats pb_stats_alloc_stats;
+
 /*****************************************/
 /*local functions*/
 /*****************************************/
@@ -163,6 +191,13 @@ static void alloc_and_init_clustering(const t_molecule_stats& max_molecule_stats
 
 static void free_pb_stats_recursive(t_pb* pb);
 
+static void release_pb_stats(t_pb* pb);
+
+static void free_pb_stats_free_list();
+
+template<typename T>
+static void reset_pin_class_usage(std::vector<T>& pins_used, int num_pin_classes);
+
 static void try_update_lookahead_pins_used(t_pb* cur_pb);
 
 static void reset_lookahead_pins_used(t_pb* cur_pb);
@@ -358,6 +393,12 @@ static bool pb_used_for_blif_model(const t_pb* pb, std::string blif_model_name);
 
 static void print_le_count(std::vector<int>& le_count, const t_pb_type* le_pb_type);
 
+static void print_intra_lb_route_cache_stats();
+
+static void start_pending_cluster_route(t_pending_cluster& pending_cluster, int verbosity);
+
+static void finish_pending_cluster_route(t_pending_cluster& pending_cluster);
+
 /*****************************************/
 /*globally accessible function*/
 std::map<t_logical_block_type_ptr, size_t> do_clustering(const t_packer_opts& packer_opts,
@@ -431,6 +472,13 @@ std::map<t_logical_block_type_ptr, size_t> do_clustering(const t_packer_opts& pa
 
     num_clb = 0;
 
+    vtr::Timer clustering_timer;
+    pb_stats_alloc_stats = t_pack_alloc_stats();
+    clear_lb_trace_alloc_stats();
+
+    /* Routes cached by a previous packing may refer to a different netlist */
+    clear_intra_lb_route_cache();
+
     /* TODO: This is memory inefficient, fix if causes problems */
     /* Store stats on nets used by packed block, useful for determining transitively connected blocks
      * (eg. [A1, A2, ..]->[B1, B2, ..]->C implies cluster [A1, A2, ...] and C have a weak link) */
@@ -538,6 +586,79 @@ std::map<t_logical_block_type_ptr, size_t> do_clustering(const t_packer_opts& pa
 
     istart = get_highest_gain_seed_molecule(&seedindex, atom_molecules, seed_atoms);
 
+    /* With --parallel_packing the end-of-cluster route of up to max_pending_clusters clusters runs in the
+     * background while the following clusters are formed */
+    std::deque<t_pending_cluster> pending_clusters;
+    size_t max_pending_clusters = 1;
+#if defined(VPR_USE_TBB)
+    max_pending_clusters = tbb::this_task_arena::max_concurrency();
+#endif
+    int first_detailed_routing_stage = (int)E_DETAILED_ROUTE_AT_END_ONLY;
+
+    /* Store the nets of a legal cluster which are used to find transitively connected candidates for later clusters */
+    auto store_inter_blk_nets = [&](ClusterBlockId clb_index) {
+        t_pb_stats* pb_stats = cluster_ctx.clb_nlist.block_pb(clb_index)->pb_stats;
+        for (const AtomNetId mnet_id : pb_stats->marked_nets) {
+            int external_terminals = atom_ctx.nlist.net_pins(mnet_id).size() - pb_stats->num_pins_of_net_in_pb[mnet_id];
+            /* Check if external terminals of net is within the fanout limit and that there exists external terminals */
+            if (external_terminals < packer_opts.transitive_fanout_threshold && external_terminals > 0) {
+                clb_inter_blk_nets[clb_index].push_back(mnet_id);
+            }
+        }
+    };
+
+    /* Record the intra-cluster routing of a legal cluster and free its packing stats */
+    auto commit_cluster = [&](ClusterBlockId clb_index, t_lb_router_data* cluster_router_data) {
+        intra_lb_routing.push_back(cluster_router_data->saved_lb_nets);
+        VTR_ASSERT(intra_lb_routing.size() == size_t(clb_index) + 1);
+        cluster_router_data->saved_lb_nets = nullptr;
+
+        auto cur_pb = cluster_ctx.clb_nlist.block_pb(clb_index);
+        // update the pb type count by counting the used pb types in this packed cluster
+        update_pb_type_count(cur_pb, pb_type_count);
+        // update the data structure holding the LE counts
+        update_le_count(cur_pb, logic_block_type, le_pb_type, le_count);
+        free_pb_stats_recursive(cur_pb);
+    };
+
+    /* Free up data structures and requeue used molecules of the last (illegal) cluster */
+    auto discard_cluster = [&](ClusterBlockId clb_index) {
+        VTR_ASSERT(size_t(clb_index) + 1 == cluster_ctx.clb_nlist.blocks().size());
+        num_used_type_instances[cluster_ctx.clb_nlist.block_type(clb_index)]--;
+        revalid_molecules(cluster_ctx.clb_nlist.block_pb(clb_index), atom_molecules);
+        free_pb_stats_recursive(cluster_ctx.clb_nlist.block_pb(clb_index));
+        cluster_ctx.clb_nlist.remove_block(clb_index);
+        cluster_ctx.clb_nlist.compress();
+        clb_inter_blk_nets[clb_index].clear();
+        num_clb--;
+    };
+
+    /* Wait for the route of the oldest pending cluster. If it failed, that cluster and all the clusters
+     * formed after it are discarded, and the cluster is re-formed with detailed routing at each stage */
+    auto resolve_oldest_pending_cluster = [&]() {
+        t_pending_cluster& oldest = pending_clusters.front();
+        finish_pending_cluster_route(oldest);
+        if (oldest.is_routed) {
+            VTR_LOGV(verbosity > 2, "\tPassed route at end.\n");
+            commit_cluster(oldest.clb_index, oldest.router_data);
+            free_router_data(oldest.router_data);
+            pending_clusters.pop_front();
+            return;
+        }
+
+        VTR_LOGV(verbosity > 0, "Failed route at end, repack cluster trying detailed routing at each stage.\n");
+        while (!pending_clusters.empty()) {
+            t_pending_cluster& newest = pending_clusters.back();
+            finish_pending_cluster_route(newest);
+            discard_cluster(newest.clb_index);
+            free_router_data(newest.router_data);
+            istart = newest.seed;
+            seedindex = newest.savedseedindex;
+            pending_clusters.pop_back();
+        }
+        first_detailed_routing_stage = (int)E_DETAILED_ROUTE_FOR_EACH_ATOM;
+    };
+
     /****************************************************************
      * Clustering
      *****************************************************************/
@@ -545,7 +666,9 @@ std::map<t_logical_block_type_ptr, size_t> do_clustering(const t_packer_opts& pa
     while (istart != nullptr) {
         is_cluster_legal = false;
         savedseedindex = seedindex;
-        for (detailed_routing_stage = (int)E_DETAILED_ROUTE_AT_END_ONLY; !is_cluster_legal && detailed_routing_stage != (int)E_DETAILED_ROUTE_INVALID; detailed_routing_stage++) {
+        detailed_routing_stage = first_detailed_routing_stage;
+        first_detailed_routing_stage = (int)E_DETAILED_ROUTE_AT_END_ONLY;
+        for (; !is_cluster_legal && detailed_routing_stage != (int)E_DETAILED_ROUTE_INVALID; detailed_routing_stage++) {
             ClusterBlockId clb_index(num_clb);
 
             VTR_LOGV(verbosity > 2, "Complex block %d:\n", num_clb);
@@ -692,6 +815,26 @@ std::map<t_logical_block_type_ptr, size_t> do_clustering(const t_packer_opts& pa
 
             VTR_LOGV(verbosity == 2, "\n");
 
+            if (detailed_routing_stage == (int)E_DETAILED_ROUTE_AT_END_ONLY && packer_opts.parallel_packing) {
+                /* Route the cluster in the background and carry on as if it were legal; the route is
+                 * checked (in cluster order) by resolve_oldest_pending_cluster() */
+                pending_clusters.emplace_back();
+                t_pending_cluster& pending_cluster = pending_clusters.back();
+                pending_cluster.clb_index = clb_index;
+                pending_cluster.seed = istart;
+                pending_cluster.savedseedindex = savedseedindex;
+                pending_cluster.router_data = router_data;
+                router_data = nullptr;
+                start_pending_cluster_route(pending_cluster, packer_opts.pack_verbosity);
+
+                is_cluster_legal = true;
+                store_inter_blk_nets(clb_index);
+
+                //Pick a new seed
+                istart = get_highest_gain_seed_molecule(&seedindex, atom_molecules, seed_atoms);
+                continue;
+            }
+
             if (detailed_routing_stage == (int)E_DETAILED_ROUTE_AT_END_ONLY) {
                 /* is_mode_conflict does not affect this stage. It is needed when trying to route the packed clusters.
                  *
@@ -711,10 +854,6 @@ std::map<t_logical_block_type_ptr, size_t> do_clustering(const t_packer_opts& pa
             }
 
             if (is_cluster_legal) {
-                intra_lb_routing.push_back(router_data->saved_lb_nets);
-                VTR_ASSERT((int)intra_lb_routing.size() == num_clb);
-                router_data->saved_lb_nets = nullptr;
-
                 //Pick a new seed
                 istart = get_highest_gain_seed_molecule(&seedindex, atom_molecules, seed_atoms);
 
@@ -725,32 +864,20 @@ std::map<t_logical_block_type_ptr, size_t> do_clustering(const t_packer_opts& pa
                 }
 
                 /* store info that will be used later in packing from pb_stats and free the rest */
-                t_pb_stats* pb_stats = cluster_ctx.clb_nlist.block_pb(clb_index)->pb_stats;
-                for (const AtomNetId mnet_id : pb_stats->marked_nets) {
-                    int external_terminals = atom_ctx.nlist.net_pins(mnet_id).size() - pb_stats->num_pins_of_net_in_pb[mnet_id];
-                    /* Check if external terminals of net is within the fanout limit and that there exists external terminals */
-                    if (external_terminals < packer_opts.transitive_fanout_threshold && external_terminals > 0) {
-                        clb_inter_blk_nets[clb_index].push_back(mnet_id);
-                    }
-                }
-                auto cur_pb = cluster_ctx.clb_nlist.block_pb(clb_index);
-                // update the pb type count by counting the used pb types in this packed cluster
-                update_pb_type_count(cur_pb, pb_type_count);
-                // update the data structure holding the LE counts
-                update_le_count(cur_pb, logic_block_type, le_pb_type, le_count);
-                free_pb_stats_recursive(cur_pb);
+                store_inter_blk_nets(clb_index);
+                commit_cluster(clb_index, router_data);
             } else {
-                /* Free up data structures and requeue used molecules */
-                num_used_type_instances[cluster_ctx.clb_nlist.block_type(clb_index)]--;
-                revalid_molecules(cluster_ctx.clb_nlist.block_pb(clb_index), atom_molecules);
-                cluster_ctx.clb_nlist.remove_block(clb_index);
-                cluster_ctx.clb_nlist.compress();
-                num_clb--;
+                discard_cluster(clb_index);
                 seedindex = savedseedindex;
             }
             free_router_data(router_data);
             router_data = nullptr;
         }
+
+        /* Bound the number of clusters in flight, and check them all before running out of seeds */
+        while (!pending_clusters.empty() && (pending_clusters.size() > max_pending_clusters || istart == nullptr)) {
+            resolve_oldest_pending_cluster();
+        }
     }
 
     // print the total number of used physical blocks for each
@@ -762,6 +889,12 @@ std::map<t_logical_block_type_ptr, size_t> do_clustering(const t_packer_opts& pa
         print_le_count(le_count, le_pb_type);
     }
 
+    print_intra_lb_route_cache_stats();
+
+    t_pack_alloc_stats alloc_stats = pb_stats_alloc_stats;
+    get_lb_trace_alloc_stats(&alloc_stats);
+    print_pack_alloc_stats(alloc_stats, clustering_timer.elapsed_sec());
+
     /****************************************************************
      * Free Data Structures
      *****************************************************************/
@@ -791,6 +924,9 @@ std::map<t_logical_block_type_ptr, size_t> do_clustering(const t_packer_opts& pa
 
     free(primitives_list);
 
+    clear_intra_lb_route_cache();
+    free_pb_stats_free_list();
+
     return num_used_type_instances;
 }
 
@@ -953,8 +1089,31 @@ static void free_pb_stats_recursive(t_pb* pb) {
                 }
             }
         }
-        free_pb_stats(pb);
+        release_pb_stats(pb);
+    }
+}
+
+/* Return the packing stats of pb to the free list */
+static void release_pb_stats(t_pb* pb) {
+    t_pb_stats* pb_stats = pb->pb_stats;
+    if (pb_stats == nullptr) {
+        return;
+    }
+
+    pb_stats->marked_nets.clear();
+    pb_stats->marked_blocks.clear();
+    pb_stats->transitive_fanout_candidates.clear();
+
+    pb_stats_free_list.push_back(pb_stats);
+    pb->pb_stats = nullptr;
+}
+
+static void free_pb_stats_free_list() {
+    for (t_pb_stats* pb_stats : pb_stats_free_list) {
+        free(pb_stats->feasible_blocks);
+        delete pb_stats;
     }
+    pb_stats_free_list.clear();
 }
 
 static bool primitive_feasible(const AtomBlockId blk_id, t_pb* cur_pb) {
@@ -1154,19 +1313,31 @@ static void alloc_and_load_pb_stats(t_pb* pb, const int feasible_block_array_siz
     /* Call this routine when starting to fill up a new cluster.  It resets *
      * the gain vector, etc.                                                */
 
-    pb->pb_stats = new t_pb_stats;
+    if (!pb_stats_free_list.empty()) {
+        pb->pb_stats = pb_stats_free_list.back();
+        pb_stats_free_list.pop_back();
+        ++pb_stats_alloc_stats.pb_stats_reuses;
+    } else {
+        pb->pb_stats = new t_pb_stats;
+        pb->pb_stats->feasible_blocks = nullptr;
+        ++pb_stats_alloc_stats.pb_stats_allocs;
+    }
 
     /* If statement below is for speed.  If nets are reasonably low-fanout,  *
      * only a relatively small number of blocks will be marked, and updating *
      * only those atom block structures will be fastest.  If almost all blocks    *
      * have been touched it should be faster to just run through them all    *
      * in order (less addressing and better cache locality).                 */
-    pb->pb_stats->input_pins_used = std::vector<std::unordered_map<size_t, AtomNetId>>(pb->pb_graph_node->num_input_pin_class);
-    pb->pb_stats->output_pins_used = std::vector<std::unordered_map<size_t, AtomNetId>>(pb->pb_graph_node->num_output_pin_class);
-    pb->pb_stats->lookahead_input_pins_used = std::vector<std::vector<AtomNetId>>(pb->pb_graph_node->num_input_pin_class);
-    pb->pb_stats->lookahead_output_pins_used = std::vector<std::vector<AtomNetId>>(pb->pb_graph_node->num_output_pin_class);
+    reset_pin_class_usage(pb->pb_stats->input_pins_used, pb->pb_graph_node->num_input_pin_class);
+    reset_pin_class_usage(pb->pb_stats->output_pins_used, pb->pb_graph_node->num_output_pin_class);
+    reset_pin_class_usage(pb->pb_stats->lookahead_input_pins_used, pb->pb_graph_node->num_input_pin_class);
+    reset_pin_class_usage(pb->pb_stats->lookahead_output_pins_used, pb->pb_graph_node->num_output_pin_class);
     pb->pb_stats->num_feasible_blocks = NOT_VALID;
-    pb->pb_stats->feasible_blocks = (t_pack_molecule**)vtr::calloc(feasible_block_array_size, sizeof(t_pack_molecule*));
+    if (pb->pb_stats->feasible_blocks == nullptr) {
+        pb->pb_stats->feasible_blocks = (t_pack_molecule**)vtr::calloc(feasible_block_array_size, sizeof(t_pack_molecule*));
+    } else {
+        std::fill(pb->pb_stats->feasible_blocks, pb->pb_stats->feasible_blocks + feasible_block_array_size, nullptr);
+    }
 
     pb->pb_stats->tie_break_high_fanout_net = AtomNetId::INVALID();
 
@@ -1183,6 +1354,15 @@ static void alloc_and_load_pb_stats(t_pb* pb, const int feasible_block_array_siz
 
     pb->pb_stats->explore_transitive_fanout = true;
 }
+
+/* Size pins_used to num_pin_classes empty entries, keeping the storage of recycled entries */
+template<typename T>
+static void reset_pin_class_usage(std::vector<T>& pins_used, int num_pin_classes) {
+    for (T& pin_class_used : pins_used) {
+        pin_class_used.clear();
+    }
+    pins_used.resize(num_pin_classes);
+}
 /*****************************************/
 
 /**
@@ -1525,6 +1705,7 @@ static void revert_place_atom_block(const AtomBlockId blk_id, t_lb_router_data*
 
         t_pb* next = pb->parent_pb;
         revalid_molecules(pb, atom_molecules);
+        free_pb_stats_recursive(pb);
         free_pb(pb);
         pb = next;
 
@@ -1542,6 +1723,7 @@ static void revert_place_atom_block(const AtomBlockId blk_id, t_lb_router_data*
                      * failed, don't free the actual complex block itself as the seed needs to find
                      * another placement */
                     revalid_molecules(pb, atom_molecules);
+                    free_pb_stats_recursive(pb);
                     free_pb(pb);
                 }
             }
@@ -2036,6 +2218,7 @@ static void start_new_cluster(t_cluster_placement_stats* cluster_placement_stats
             VTR_LOGV(verbosity > 2, "\tFAILED_SEED: Block Type %s\n", type->name);
             //Free failed clustering and try again
             free_router_data(*router_data);
+            free_pb_stats_recursive(pb);
             free_pb(pb);
             delete pb;
             *router_data = nullptr;
@@ -3519,3 +3702,46 @@ static void print_le_count(std::vector<int>& le_count, const t_pb_type* le_pb_ty
     VTR_LOG("  LEs used for logic only             : %d\n", le_count[1]);
     VTR_LOG("  LEs used for registers only         : %d\n\n", le_count[2]);
 }
+
+
+/**
+ * Print how many of the intra-logic block routes were answered by the route cache
+ */
+static void print_intra_lb_route_cache_stats() {
+    t_intra_lb_route_cache_stats stats = get_intra_lb_route_cache_stats();
+
+    VTR_LOG("Intra-logic block route cache: %zu lookups, %zu hits (%.1f%%), %zu cached routes\n",
+            stats.lookups, stats.hits,
+            stats.lookups > 0 ? 100. * stats.hits / stats.lookups : 0.,
+            stats.entries);
+    VTR_LOG("\n");
+}
+
+/* Start the end-of-cluster route of a pending cluster, in the background if possible */
+static void start_pending_cluster_route(t_pending_cluster& pending_cluster, int verbosity) {
+    //Illegal modes must not leak to the routes of other clusters running at the same time
+    pending_cluster.router_data->isolate_illegal_modes = true;
+
+    auto route = [&pending_cluster, verbosity]() {
+        t_mode_selection_status mode_status;
+        pending_cluster.is_routed = try_intra_lb_route(pending_cluster.router_data, verbosity, &mode_status);
+    };
+#if defined(VPR_USE_TBB)
+    pending_cluster.route_task = std::make_unique<tbb::task_group>();
+    pending_cluster.route_task->run(route);
+#else
+    route();
+#endif
+}
+
+/* Wait for the end-of-cluster route of a pending cluster to complete */
+static void finish_pending_cluster_route(t_pending_cluster& pending_cluster) {
+#if defined(VPR_USE_TBB)
+    if (pending_cluster.route_task) {
+        pending_cluster.route_task->wait();
+        pending_cluster.route_task.reset();
+    }
+#else
+    (void)pending_cluster;
+#endif
+}
@@ -18,9 +18,13 @@
 #include <map>
 #include <queue>
 #include <cmath>
+#include <mutex>
+#include <atomic>
+#include <unordered_map>
 
 #include "vtr_assert.h"
 #include "vtr_log.h"
+#include "vtr_hash.h"
 
 #include "vpr_error.h"
 #include "vpr_types.h"
@@ -69,11 +73,47 @@ class reservable_pq : public std::priority_queue<T, U, V> {
     size_type cur_cap;
 };
 
+/* Memoized intra-logic block routes.
+ *
+ * A route only depends on the cluster type, the modes forced on the lb rr nodes by the pbs in use and the
+ * terminals of each net (in routing order). Routes which neither consult nor record illegal modes (i.e. those
+ * not expanding all modes and ending without a mode issue) are therefore shared by every cluster, and every
+ * candidate packing, with the same key. */
+struct t_intra_lb_route_cache_key_hash {
+    size_t operator()(const std::vector<int>& key) const {
+        size_t seed = key.size();
+        for (int value : key) {
+            vtr::hash_combine(seed, value);
+        }
+        return seed;
+    }
+};
+
+struct t_cached_intra_lb_route {
+    bool is_routed = false;
+    std::vector<t_lb_trace> rt_trees; /* Route tree of each net, if routed */
+};
+
+/* Bound on the (approximate) memory used by the cache, beyond which new routes are no longer cached */
+constexpr size_t MAX_INTRA_LB_ROUTE_CACHE_BYTES = 64 * 1024 * 1024;
+
+static std::unordered_map<std::vector<int>, t_cached_intra_lb_route, t_intra_lb_route_cache_key_hash> intra_lb_route_cache;
+static size_t intra_lb_route_cache_bytes = 0;
+static t_intra_lb_route_cache_stats intra_lb_route_cache_stats;
+static std::mutex intra_lb_route_cache_mutex; /* Clusters may be routed concurrently (see --parallel_packing) */
+
+/* Route tree allocations, counted across all clusters */
+static std::atomic<size_t> num_lb_trace_allocs(0);
+static std::atomic<size_t> num_lb_trace_reuses(0);
+
 /*****************************************************************************************
  * Internal functions declarations
  ******************************************************************************************/
 static void free_lb_net_rt(t_lb_trace* lb_trace);
 static void free_lb_trace(t_lb_trace* lb_trace);
+static t_lb_trace* alloc_lb_net_rt(t_lb_router_data* router_data);
+static void recycle_lb_net_rt(t_lb_router_data* router_data, t_lb_trace* lb_trace);
+static void recycle_lb_trace_branches(t_lb_router_data* router_data, t_lb_trace* lb_trace);
 static void add_pin_to_rt_terminals(t_lb_router_data* router_data, const AtomPinId pin_id);
 static void remove_pin_from_rt_terminals(t_lb_router_data* router_data, const AtomPinId pin_id);
 
@@ -126,6 +166,11 @@ static void print_route(FILE* fp, t_lb_router_data* router_data);
 #endif
 static void print_trace(FILE* fp, t_lb_trace* trace, t_lb_router_data* router_data);
 
+static std::vector<int> get_intra_lb_route_cache_key(const t_lb_router_data* router_data);
+static bool load_cached_intra_lb_route(t_lb_router_data* router_data, const std::vector<int>& key, bool* is_routed);
+static void cache_intra_lb_route(const std::vector<int>& key, const t_lb_router_data* router_data, bool is_routed);
+static size_t count_lb_trace_nodes(const t_lb_trace& trace);
+
 /*****************************************************************************************
  * Constructor/Destructor functions
  ******************************************************************************************/
@@ -161,6 +206,9 @@ void free_router_data(t_lb_router_data* router_data) {
         free_intra_lb_nets(router_data->intra_lb_nets);
         free_intra_lb_nets(router_data->saved_lb_nets);
         router_data->intra_lb_nets = nullptr;
+        for (t_lb_trace* rt_head : router_data->free_rt_heads) {
+            delete rt_head;
+        }
         delete router_data;
     }
 }
@@ -184,8 +232,32 @@ static bool route_has_conflict(t_lb_trace* rt, t_lb_router_data* router_data) {
     return false;
 }
 
+// Is the mode illegal for the pb_graph_node, either globally or for this route only?
+static bool is_illegal_mode(const t_lb_router_data* router_data, const t_pb_graph_node* pb_graph_node, int mode) {
+    if (std::find(pb_graph_node->illegal_modes.begin(), pb_graph_node->illegal_modes.end(), mode) != pb_graph_node->illegal_modes.end()) {
+        return true;
+    }
+
+    auto iter = router_data->local_illegal_modes.find(pb_graph_node);
+    if (iter != router_data->local_illegal_modes.end()) {
+        return std::find(iter->second.begin(), iter->second.end(), mode) != iter->second.end();
+    }
+    return false;
+}
+
+static int num_illegal_modes(const t_lb_router_data* router_data, const t_pb_graph_node* pb_graph_node) {
+    int num_modes = pb_graph_node->illegal_modes.size();
+
+    auto iter = router_data->local_illegal_modes.find(pb_graph_node);
+    if (iter != router_data->local_illegal_modes.end()) {
+        num_modes += iter->second.size();
+    }
+    return num_modes;
+}
+
 // Check one edge for mode conflict.
-static bool check_edge_for_route_conflicts(std::unordered_map<const t_pb_graph_node*, const t_mode*>* mode_map,
+static bool check_edge_for_route_conflicts(t_lb_router_data* router_data,
+                                           std::unordered_map<const t_pb_graph_node*, const t_mode*>* mode_map,
                                            const t_pb_graph_pin* driver_pin,
                                            const t_pb_graph_pin* pin) {
     if (driver_pin == nullptr) {
@@ -217,13 +289,17 @@ static bool check_edge_for_route_conflicts(std::unordered_map<const t_pb_graph_n
 
             // The illegal mode is added to the pb_graph_node as it resulted in a conflict during atom-to-atom routing. This mode cannot be used in the consequent cluster
             // generation try.
-            if (std::find(pb_graph_node->illegal_modes.begin(), pb_graph_node->illegal_modes.end(), result.first->second->index) == pb_graph_node->illegal_modes.end()) {
-                pb_graph_node->illegal_modes.push_back(result.first->second->index);
+            if (!is_illegal_mode(router_data, pb_graph_node, result.first->second->index)) {
+                if (router_data->isolate_illegal_modes) {
+                    router_data->local_illegal_modes[pb_graph_node].push_back(result.first->second->index);
+                } else {
+                    pb_graph_node->illegal_modes.push_back(result.first->second->index);
+                }
             }
 
             // If the number of illegal modes equals the number of available mode for a specific pb_graph_node it means that no cluster can be generated. This resuts
             // in a fatal error.
-            if ((int)pb_graph_node->illegal_modes.size() >= pb_graph_node->pb_type->num_modes) {
+            if (num_illegal_modes(router_data, pb_graph_node) >= pb_graph_node->pb_type->num_modes) {
                 VPR_FATAL_ERROR(VPR_ERROR_PACK, "There are no more available modes to be used. Routing Failed!");
             }
 
@@ -402,6 +478,15 @@ bool try_intra_lb_route(t_lb_router_data* router_data,
     mode_status->is_mode_conflict = false;
     mode_status->try_expand_all_modes = false;
 
+    /* Routes expanding all modes depend on the illegal modes, which are not part of the cache key */
+    std::vector<int> cache_key;
+    if (!mode_status->expand_all_modes) {
+        cache_key = get_intra_lb_route_cache_key(router_data);
+        if (load_cached_intra_lb_route(router_data, cache_key, &is_routed)) {
+            return is_routed;
+        }
+    }
+
     t_expansion_node exp_node;
 
     /* Stores state info during route */
@@ -411,7 +496,7 @@ bool try_intra_lb_route(t_lb_router_data* router_data,
 
     /* Reset current routing */
     for (unsigned int inet = 0; inet < lb_nets.size(); inet++) {
-        free_lb_net_rt(lb_nets[inet].rt_tree);
+        recycle_lb_net_rt(router_data, lb_nets[inet].rt_tree);
         lb_nets[inet].rt_tree = nullptr;
     }
     for (unsigned int inode = 0; inode < lb_type_graph.size(); inode++) {
@@ -433,7 +518,7 @@ bool try_intra_lb_route(t_lb_router_data* router_data,
                 continue;
             }
             commit_remove_rt(lb_nets[idx].rt_tree, router_data, RT_REMOVE, &mode_map, mode_status);
-            free_lb_net_rt(lb_nets[idx].rt_tree);
+            recycle_lb_net_rt(router_data, lb_nets[idx].rt_tree);
             lb_nets[idx].rt_tree = nullptr;
             add_source_to_rt(router_data, idx);
 
@@ -504,6 +589,10 @@ bool try_intra_lb_route(t_lb_router_data* router_data,
         router_data->pres_con_fac *= router_data->params.pres_fac_mult;
     }
 
+    if (!cache_key.empty() && !mode_status->is_mode_issue()) {
+        cache_intra_lb_route(cache_key, router_data, is_routed);
+    }
+
     if (is_routed) {
         save_and_reset_lb_route(router_data);
     } else {
@@ -522,7 +611,7 @@ bool try_intra_lb_route(t_lb_router_data* router_data,
 
         //Clean-up
         for (unsigned int inet = 0; inet < lb_nets.size(); inet++) {
-            free_lb_net_rt(lb_nets[inet].rt_tree);
+            recycle_lb_net_rt(router_data, lb_nets[inet].rt_tree);
             lb_nets[inet].rt_tree = nullptr;
         }
     }
@@ -613,6 +702,41 @@ static void free_lb_trace(t_lb_trace* lb_trace) {
     }
 }
 
+/* Allocate a route tree head, recycling one freed by an earlier route of this cluster if possible */
+static t_lb_trace* alloc_lb_net_rt(t_lb_router_data* router_data) {
+    t_lb_trace* lb_trace;
+    if (!router_data->free_rt_heads.empty()) {
+        lb_trace = router_data->free_rt_heads.back();
+        router_data->free_rt_heads.pop_back();
+        ++num_lb_trace_reuses;
+    } else {
+        lb_trace = new t_lb_trace;
+        ++num_lb_trace_allocs;
+    }
+    VTR_ASSERT(lb_trace->next_nodes.empty());
+    return lb_trace;
+}
+
+/* Return a route tree to the free lists of its cluster */
+static void recycle_lb_net_rt(t_lb_router_data* router_data, t_lb_trace* lb_trace) {
+    if (lb_trace != nullptr) {
+        recycle_lb_trace_branches(router_data, lb_trace);
+        router_data->free_rt_heads.push_back(lb_trace);
+    }
+}
+
+/* Move the branch buffers of a trace (bottom-up) to the free list, leaving their capacity allocated */
+static void recycle_lb_trace_branches(t_lb_router_data* router_data, t_lb_trace* lb_trace) {
+    for (unsigned int i = 0; i < lb_trace->next_nodes.size(); i++) {
+        recycle_lb_trace_branches(router_data, &lb_trace->next_nodes[i]);
+    }
+    if (lb_trace->next_nodes.capacity() > 0) {
+        lb_trace->next_nodes.clear();
+        router_data->free_rt_branches.push_back(std::move(lb_trace->next_nodes));
+        lb_trace->next_nodes = std::vector<t_lb_trace>();
+    }
+}
+
 /* Given a pin of a net, assign route tree terminals for it
  * Assumes that pin is not already assigned
  */
@@ -1005,7 +1129,7 @@ static void commit_remove_rt(t_lb_trace* rt, t_lb_router_data* router_data, e_co
             auto& node = lb_type_graph[rt->next_nodes[i].current_node];
             auto* pin = node.pb_graph_pin;
 
-            if (check_edge_for_route_conflicts(mode_map, driver_pin, pin)) {
+            if (check_edge_for_route_conflicts(router_data, mode_map, driver_pin, pin)) {
                 mode_status->is_mode_conflict = true;
             }
         }
@@ -1048,7 +1172,7 @@ static bool is_skip_route_net(t_lb_trace* rt, t_lb_router_data* router_data) {
 /* At source mode as starting point to existing route tree */
 static void add_source_to_rt(t_lb_router_data* router_data, int inet) {
     VTR_ASSERT((*router_data->intra_lb_nets)[inet].rt_tree == nullptr);
-    (*router_data->intra_lb_nets)[inet].rt_tree = new t_lb_trace;
+    (*router_data->intra_lb_nets)[inet].rt_tree = alloc_lb_net_rt(router_data);
     (*router_data->intra_lb_nets)[inet].rt_tree->current_node = (*router_data->intra_lb_nets)[inet].terminals[0];
 }
 
@@ -1175,18 +1299,7 @@ static void expand_node_all_modes(t_lb_router_data* router_data, t_expansion_nod
         }
 
         /* Check whether a mode is illegal. If it is then the node will not be expanded */
-        bool is_illegal = false;
-        if (pin != nullptr) {
-            auto* pb_graph_node = pin->parent_node;
-            for (auto illegal_mode : pb_graph_node->illegal_modes) {
-                if (mode == illegal_mode) {
-                    is_illegal = true;
-                    break;
-                }
-            }
-        }
-
-        if (is_illegal == true) {
+        if (pin != nullptr && is_illegal_mode(router_data, pin->parent_node, mode)) {
             continue;
         }
 
@@ -1221,6 +1334,13 @@ static bool add_to_rt(t_lb_trace* rt, int node_index, t_lb_router_data* router_d
     while (!trace_forward.empty()) {
         trace_index = trace_forward.back();
         curr_node.current_node = trace_index;
+        if (link_node->next_nodes.capacity() == 0 && !router_data->free_rt_branches.empty()) {
+            link_node->next_nodes = std::move(router_data->free_rt_branches.back());
+            router_data->free_rt_branches.pop_back();
+            ++num_lb_trace_reuses;
+        } else if (link_node->next_nodes.size() == link_node->next_nodes.capacity()) {
+            ++num_lb_trace_allocs;
+        }
         link_node->next_nodes.push_back(curr_node);
         link_node = &link_node->next_nodes.back();
         trace_forward.pop_back();
@@ -1325,6 +1445,10 @@ static void save_and_reset_lb_route(t_lb_router_data* router_data) {
 
     /* Free old saved lb nets if exist */
     if (router_data->saved_lb_nets != nullptr) {
+        for (t_intra_lb_net& saved_lb_net : *router_data->saved_lb_nets) {
+            recycle_lb_net_rt(router_data, saved_lb_net.rt_tree);
+            saved_lb_net.rt_tree = nullptr;
+        }
         free_intra_lb_nets(router_data->saved_lb_nets);
         router_data->saved_lb_nets = nullptr;
     }
@@ -1493,4 +1617,125 @@ void reset_intra_lb_route(t_lb_router_data* router_data) {
         VTR_ASSERT(pin->parent_node != nullptr);
         pin->parent_node->illegal_modes.clear();
     }
+    router_data->local_illegal_modes.clear();
+}
+
+/*****************************************************************************************
+ * Route Cache Functions
+ ******************************************************************************************/
+
+void clear_intra_lb_route_cache() {
+    std::lock_guard<std::mutex> lock(intra_lb_route_cache_mutex);
+    intra_lb_route_cache.clear();
+    intra_lb_route_cache_bytes = 0;
+    intra_lb_route_cache_stats = t_intra_lb_route_cache_stats();
+}
+
+t_intra_lb_route_cache_stats get_intra_lb_route_cache_stats() {
+    std::lock_guard<std::mutex> lock(intra_lb_route_cache_mutex);
+    t_intra_lb_route_cache_stats stats = intra_lb_route_cache_stats;
+    stats.entries = intra_lb_route_cache.size();
+    return stats;
+}
+
+/* The key is the cluster type, the (node, mode) pairs of the lb rr nodes with a forced mode, and the terminals of each net */
+static std::vector<int> get_intra_lb_route_cache_key(const t_lb_router_data* router_data) {
+    const std::vector<t_lb_type_rr_node>& lb_type_graph = *router_data->lb_type_graph;
+    const std::vector<t_intra_lb_net>& lb_nets = *router_data->intra_lb_nets;
+
+    std::vector<int> key;
+    key.push_back(router_data->lb_type->index);
+
+    for (int inode = 0; inode < (int)lb_type_graph.size(); inode++) {
+        int mode = router_data->lb_rr_node_stats[inode].mode;
+        if (mode != -1) {
+            key.push_back(inode);
+            key.push_back(mode);
+        }
+    }
+    key.push_back(OPEN);
+
+    for (const t_intra_lb_net& lb_net : lb_nets) {
+        key.push_back(lb_net.terminals.size());
+        key.insert(key.end(), lb_net.terminals.begin(), lb_net.terminals.end());
+    }
+
+    return key;
+}
+
+/* Loads the cached route for key (if any) as try_intra_lb_route() would have left it, returning whether it was found */
+static bool load_cached_intra_lb_route(t_lb_router_data* router_data, const std::vector<int>& key, bool* is_routed) {
+    std::vector<t_intra_lb_net>& lb_nets = *router_data->intra_lb_nets;
+
+    {
+        std::lock_guard<std::mutex> lock(intra_lb_route_cache_mutex);
+        ++intra_lb_route_cache_stats.lookups;
+
+        auto iter = intra_lb_route_cache.find(key);
+        if (iter == intra_lb_route_cache.end()) {
+            return false;
+        }
+        ++intra_lb_route_cache_stats.hits;
+
+        const t_cached_intra_lb_route& cached_route = iter->second;
+        *is_routed = cached_route.is_routed;
+        for (unsigned int inet = 0; inet < lb_nets.size(); inet++) {
+            recycle_lb_net_rt(router_data, lb_nets[inet].rt_tree);
+            lb_nets[inet].rt_tree = nullptr;
+            if (cached_route.is_routed) {
+                lb_nets[inet].rt_tree = alloc_lb_net_rt(router_data);
+                *lb_nets[inet].rt_tree = cached_route.rt_trees[inet];
+            }
+        }
+    }
+
+    if (*is_routed) {
+        save_and_reset_lb_route(router_data);
+    }
+    return true;
+}
+
+static void cache_intra_lb_route(const std::vector<int>& key, const t_lb_router_data* router_data, bool is_routed) {
+    const std::vector<t_intra_lb_net>& lb_nets = *router_data->intra_lb_nets;
+
+    t_cached_intra_lb_route cached_route;
+    cached_route.is_routed = is_routed;
+    size_t num_bytes = key.size() * sizeof(int);
+    if (is_routed) {
+        for (const t_intra_lb_net& lb_net : lb_nets) {
+            VTR_ASSERT(lb_net.rt_tree != nullptr);
+            cached_route.rt_trees.push_back(*lb_net.rt_tree);
+            num_bytes += count_lb_trace_nodes(*lb_net.rt_tree) * sizeof(t_lb_trace);
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(intra_lb_route_cache_mutex);
+    if (intra_lb_route_cache_bytes + num_bytes > MAX_INTRA_LB_ROUTE_CACHE_BYTES) {
+        return;
+    }
+    if (intra_lb_route_cache.emplace(key, std::move(cached_route)).second) {
+        intra_lb_route_cache_bytes += num_bytes;
+    }
+}
+
+static size_t count_lb_trace_nodes(const t_lb_trace& trace) {
+    size_t num_nodes = 1;
+    for (const t_lb_trace& next_node : trace.next_nodes) {
+        num_nodes += count_lb_trace_nodes(next_node);
+    }
+    return num_nodes;
+}
+
+/*****************************************************************************************
+ * Allocation Statistics
+ ******************************************************************************************/
+
+void clear_lb_trace_alloc_stats() {
+    num_lb_trace_allocs = 0;
+    num_lb_trace_reuses = 0;
+}
+
+void get_lb_trace_alloc_stats(t_pack_alloc_stats* stats) {
+    stats->lb_trace_allocs = num_lb_trace_allocs;
+    stats->lb_trace_reuses = num_lb_trace_reuses;
 }
@@ -22,6 +22,19 @@ void set_reset_pb_modes(t_lb_router_data* router_data, const t_pb* pb, const boo
 bool try_intra_lb_route(t_lb_router_data* router_data, int verbosity, t_mode_selection_status* mode_status);
 void reset_intra_lb_route(t_lb_router_data* router_data);
 
+/* Route Cache Functions */
+struct t_intra_lb_route_cache_stats {
+    size_t lookups = 0; //Number of routes which were looked up in the cache
+    size_t hits = 0;    //Number of routes answered from the cache
+    size_t entries = 0; //Number of cached routes
+};
+void clear_intra_lb_route_cache();
+t_intra_lb_route_cache_stats get_intra_lb_route_cache_stats();
+
+/* Allocation Statistics */
+void clear_lb_trace_alloc_stats();
+void get_lb_trace_alloc_stats(t_pack_alloc_stats* stats);
+
 /* Accessor Functions */
 t_pb_routes alloc_and_load_pb_route(const std::vector<t_intra_lb_net>* intra_lb_nets, t_pb_graph_node* pb_graph_head);
 void free_pb_route(t_pb_route* free_pb_route);
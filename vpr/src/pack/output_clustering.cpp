@@ -24,6 +24,7 @@
 #include "cluster_router.h"
 #include "pb_type_graph.h"
 #include "output_clustering.h"
+#include "clustered_netlist_binary.h"
 #include "read_xml_arch_file.h"
 #include "vpr_utils.h"
 
@@ -539,6 +540,13 @@ void output_clustering(const vtr::vector<ClusterBlockId, std::vector<t_intra_lb_
     auto& atom_ctx = g_vpr_ctx.atom();
     auto& cluster_ctx = g_vpr_ctx.mutable_clustering();
 
+    if (is_binary_netlist_file(out_fname)) {
+        //The packer only writes .net files, the binary form is written from the loaded netlist
+        VPR_FATAL_ERROR(VPR_ERROR_PACK,
+                        "Packed netlist output file '%s' names a binary packed netlist: pack to a .net file and use --write_binary_net_file to also write it in binary form.\n",
+                        out_fname);
+    }
+
     if (!intra_lb_routing.empty()) {
         VTR_ASSERT(intra_lb_routing.size() == cluster_ctx.clb_nlist.blocks().size());
         for (auto blk_id : cluster_ctx.clb_nlist.blocks()) {
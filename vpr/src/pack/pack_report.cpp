@@ -1,6 +1,7 @@
 #include "pack_report.h"
 
 #include "vtr_ostream_guard.h"
+#include "vtr_log.h"
 
 #include "vpr_types.h"
 #include "vpr_utils.h"
@@ -90,3 +91,17 @@ void report_packing_pin_usage(std::ostream& os, const VprContext& ctx) {
         os << "\n";
     }
 }
+
+static void print_pack_alloc_count(const char* name, size_t allocs, size_t reuses) {
+    size_t total = allocs + reuses;
+    VTR_LOG("  %-12s: %zu requested, %zu from the heap, %zu recycled (%.1f%%)\n",
+            name, total, allocs, reuses,
+            total > 0 ? 100. * reuses / total : 0.);
+}
+
+void print_pack_alloc_stats(const t_pack_alloc_stats& stats, float clustering_time) {
+    VTR_LOG("Packer allocations (clustering took %g seconds):\n", clustering_time);
+    print_pack_alloc_count("t_pb_stats", stats.pb_stats_allocs, stats.pb_stats_reuses);
+    print_pack_alloc_count("t_lb_trace", stats.lb_trace_allocs, stats.lb_trace_reuses);
+    VTR_LOG("\n");
+}
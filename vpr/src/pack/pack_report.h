@@ -3,7 +3,10 @@
 
 #include <iosfwd>
 #include "vpr_context.h"
+#include "pack_types.h"
 
 void report_packing_pin_usage(std::ostream& os, const VprContext& ctx);
 
+void print_pack_alloc_stats(const t_pack_alloc_stats& stats, float clustering_time);
+
 #endif
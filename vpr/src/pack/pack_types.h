@@ -81,6 +81,15 @@ struct t_pb_stats {
     int num_feasible_blocks; /* [0..num_marked_models-1] */
 };
 
+/* Counts of the packer's allocations of per-cluster data structures, split into those
+ * which went to the heap and those recycled from a free list */
+struct t_pack_alloc_stats {
+    size_t pb_stats_allocs = 0;
+    size_t pb_stats_reuses = 0;
+    size_t lb_trace_allocs = 0; /* Route tree heads and branch buffers */
+    size_t lb_trace_reuses = 0;
+};
+
 /**************************************************************************
  * Intra-Logic Block Routing Data Structures (by type)
  ***************************************************************************/
@@ -249,6 +258,16 @@ struct t_lb_router_data {
     /* current congestion factor */
     float pres_con_fac;
 
+    /* When set, the modes found to be illegal during routing are recorded in local_illegal_modes instead of in the
+     * (shared) pb_graph_nodes, so that this route can run concurrently with other packing work */
+    bool isolate_illegal_modes;
+    std::unordered_map<const t_pb_graph_node*, std::vector<int>> local_illegal_modes;
+
+    /* Route tree heads and branch (next_nodes) buffers freed by earlier routes of this cluster. They are recycled
+     * by later routes, so re-routing a cluster does not go back to the heap for every route tree node */
+    std::vector<t_lb_trace*> free_rt_heads;
+    std::vector<std::vector<t_lb_trace>> free_rt_branches;
+
     t_lb_router_data() {
         lb_type_graph = nullptr;
         lb_rr_node_stats = nullptr;
@@ -266,6 +285,8 @@ struct t_lb_router_data {
         params.hist_fac = 0.3;
 
         pres_con_fac = 1;
+
+        isolate_illegal_modes = false;
     }
 };
 
@@ -99,3 +99,16 @@ int grid_to_compressed(const std::vector<int>& coords, int point) {
 
     return std::distance(coords.begin(), itr);
 }
+
+int grid_to_compressed_approx(const std::vector<int>& coords, int point) {
+    VTR_ASSERT(!coords.empty());
+
+    auto itr = std::lower_bound(coords.begin(), coords.end(), point);
+    if (itr == coords.end()) {
+        --itr;
+    } else if (itr != coords.begin() && point - *(itr - 1) < *itr - point) {
+        --itr;
+    }
+
+    return std::distance(coords.begin(), itr);
+}
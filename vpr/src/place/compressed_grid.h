@@ -44,4 +44,7 @@ std::vector<t_compressed_block_grid> create_compressed_block_grids();
 t_compressed_block_grid create_compressed_block_grid(const std::vector<vtr::Point<int>>& locations);
 
 int grid_to_compressed(const std::vector<int>& coords, int point);
+
+//Like grid_to_compressed(), but returns the index of the nearest coordinate if point is not in coords
+int grid_to_compressed_approx(const std::vector<int>& coords, int point);
 #endif
@@ -0,0 +1,125 @@
+#include <cmath>
+
+#include "critical_move_generator.h"
+#include "timing_place.h"
+#include "globals.h"
+
+#include "vtr_random.h"
+
+//Weight given to a connection regardless of its criticality, so non-critical
+//connections still pull (weakly) on the moved block
+constexpr float MIN_CONNECTION_WEIGHT = 0.01;
+
+CriticalMoveGenerator::CriticalMoveGenerator(float crit_threshold, int max_tries)
+    : crit_threshold_(crit_threshold)
+    , max_tries_(max_tries) {}
+
+e_create_move CriticalMoveGenerator::propose_move(t_pl_blocks_to_be_moved& blocks_affected, float rlim) {
+    ClusterBlockId b_from = pick_critical_block();
+    if (!b_from) {
+        b_from = pick_from_block();
+        if (!b_from) {
+            return e_create_move::ABORT; //No movable block found
+        }
+    }
+
+    auto& place_ctx = g_vpr_ctx.placement();
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+
+    t_pl_loc from = place_ctx.block_locs[b_from].loc;
+    auto cluster_from_type = cluster_ctx.clb_nlist.block_type(b_from);
+
+    vtr::Point<int> centre(from.x, from.y);
+    critical_centroid(b_from, centre); //Falls back to a uniform move around 'from' if unconnected
+
+    t_pl_loc to;
+    if (!find_to_loc_centered(cluster_from_type, rlim, from, centre, to)) {
+        return e_create_move::ABORT;
+    }
+
+    return ::create_move(blocks_affected, b_from, to);
+}
+
+ClusterBlockId CriticalMoveGenerator::pick_critical_block() const {
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+    auto& place_ctx = g_vpr_ctx.placement();
+
+    int num_nets = cluster_ctx.clb_nlist.nets().size();
+    if (num_nets == 0) {
+        return ClusterBlockId::INVALID();
+    }
+
+    for (int itry = 0; itry < max_tries_; ++itry) {
+        ClusterNetId net_id = ClusterNetId(vtr::irand(num_nets - 1));
+        if (cluster_ctx.clb_nlist.net_is_ignored(net_id)) {
+            continue;
+        }
+
+        int num_sinks = cluster_ctx.clb_nlist.net_sinks(net_id).size();
+        if (num_sinks == 0) {
+            continue;
+        }
+
+        int ipin = 1 + vtr::irand(num_sinks - 1);
+        if (get_timing_place_crit(net_id, ipin) < crit_threshold_) {
+            continue;
+        }
+
+        //Prefer moving the sink, but move the driver if the sink is fixed
+        ClusterBlockId sink_blk = cluster_ctx.clb_nlist.net_pin_block(net_id, ipin);
+        if (!place_ctx.block_locs[sink_blk].is_fixed) {
+            return sink_blk;
+        }
+        ClusterBlockId driver_blk = cluster_ctx.clb_nlist.net_driver_block(net_id);
+        if (!place_ctx.block_locs[driver_blk].is_fixed) {
+            return driver_blk;
+        }
+    }
+
+    return ClusterBlockId::INVALID();
+}
+
+bool CriticalMoveGenerator::critical_centroid(ClusterBlockId blk, vtr::Point<int>& centroid) const {
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+    auto& place_ctx = g_vpr_ctx.placement();
+
+    float x_sum = 0.;
+    float y_sum = 0.;
+    float weight_sum = 0.;
+
+    auto add_connection = [&](ClusterBlockId other_blk, float crit) {
+        if (other_blk == blk) return;
+        float weight = crit + MIN_CONNECTION_WEIGHT;
+        const t_pl_loc& loc = place_ctx.block_locs[other_blk].loc;
+        x_sum += weight * loc.x;
+        y_sum += weight * loc.y;
+        weight_sum += weight;
+    };
+
+    for (ClusterPinId blk_pin : cluster_ctx.clb_nlist.block_pins(blk)) {
+        ClusterNetId net_id = cluster_ctx.clb_nlist.pin_net(blk_pin);
+        if (cluster_ctx.clb_nlist.net_is_ignored(net_id)) {
+            continue;
+        }
+
+        if (cluster_ctx.clb_nlist.pin_type(blk_pin) == PinType::DRIVER) {
+            //Pulled towards each of the net's sinks
+            int ipin = 1;
+            for (ClusterPinId sink_pin : cluster_ctx.clb_nlist.net_sinks(net_id)) {
+                add_connection(cluster_ctx.clb_nlist.pin_block(sink_pin), get_timing_place_crit(net_id, ipin));
+                ++ipin;
+            }
+        } else {
+            //Pulled towards the net's driver
+            int ipin = cluster_ctx.clb_nlist.pin_net_index(blk_pin);
+            add_connection(cluster_ctx.clb_nlist.net_driver_block(net_id), get_timing_place_crit(net_id, ipin));
+        }
+    }
+
+    if (weight_sum == 0.) {
+        return false;
+    }
+
+    centroid = vtr::Point<int>(std::lround(x_sum / weight_sum), std::lround(y_sum / weight_sum));
+    return true;
+}
@@ -0,0 +1,31 @@
+#ifndef VPR_CRITICAL_MOVE_GEN_H
+#define VPR_CRITICAL_MOVE_GEN_H
+#include "move_generator.h"
+
+//Picks an endpoint of a timing critical connection and moves it towards the
+//criticality-weighted centroid of the blocks it connects to, shortening its
+//most critical connections.
+//
+//Requires timing-driven placement (uses the criticalities from get_timing_place_crit()).
+//If no sufficiently critical connection is found a random block is moved instead.
+class CriticalMoveGenerator : public MoveGenerator {
+  public:
+    CriticalMoveGenerator(float crit_threshold = 0.5, int max_tries = 10);
+
+    e_create_move propose_move(t_pl_blocks_to_be_moved& affected_blocks, float rlim) override;
+
+  private:
+    //Returns a movable endpoint of a randomly sampled critical connection,
+    //or an invalid id if none was found within max_tries_ samples
+    ClusterBlockId pick_critical_block() const;
+
+    //Returns the criticality-weighted centroid of the blocks connected to blk.
+    //Returns false if blk has no (non-ignored) connections
+    bool critical_centroid(ClusterBlockId blk, vtr::Point<int>& centroid) const;
+
+  private:
+    float crit_threshold_;
+    int max_tries_;
+};
+
+#endif
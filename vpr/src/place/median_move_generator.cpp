@@ -0,0 +1,81 @@
+#include <algorithm>
+#include <limits>
+
+#include "median_move_generator.h"
+#include "globals.h"
+
+//Nets with more pins than this are ignored when computing the median location:
+//they are expensive to scan and moving one of their blocks barely changes their bounding box
+constexpr size_t MAX_MEDIAN_NET_PINS = 64;
+
+e_create_move MedianMoveGenerator::propose_move(t_pl_blocks_to_be_moved& blocks_affected, float rlim) {
+    ClusterBlockId b_from = pick_from_block();
+    if (!b_from) {
+        return e_create_move::ABORT; //No movable block found
+    }
+
+    auto& place_ctx = g_vpr_ctx.placement();
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+
+    t_pl_loc from = place_ctx.block_locs[b_from].loc;
+    auto cluster_from_type = cluster_ctx.clb_nlist.block_type(b_from);
+
+    //Collect the edges of the bounding box of each of the block's nets, without the block's own pins
+    xs_.clear();
+    ys_.clear();
+    for (ClusterPinId blk_pin : cluster_ctx.clb_nlist.block_pins(b_from)) {
+        ClusterNetId net_id = cluster_ctx.clb_nlist.pin_net(blk_pin);
+        if (cluster_ctx.clb_nlist.net_is_ignored(net_id)
+            || cluster_ctx.clb_nlist.net_pins(net_id).size() > MAX_MEDIAN_NET_PINS) {
+            continue;
+        }
+
+        int xmin = std::numeric_limits<int>::max();
+        int xmax = std::numeric_limits<int>::min();
+        int ymin = std::numeric_limits<int>::max();
+        int ymax = std::numeric_limits<int>::min();
+        for (ClusterPinId net_pin : cluster_ctx.clb_nlist.net_pins(net_id)) {
+            ClusterBlockId blk = cluster_ctx.clb_nlist.pin_block(net_pin);
+            if (blk == b_from) {
+                continue;
+            }
+            const t_pl_loc& loc = place_ctx.block_locs[blk].loc;
+            xmin = std::min(xmin, loc.x);
+            xmax = std::max(xmax, loc.x);
+            ymin = std::min(ymin, loc.y);
+            ymax = std::max(ymax, loc.y);
+        }
+
+        if (xmin > xmax) {
+            continue; //All of the net's pins are on the moved block
+        }
+
+        xs_.push_back(xmin);
+        xs_.push_back(xmax);
+        ys_.push_back(ymin);
+        ys_.push_back(ymax);
+    }
+
+    if (xs_.empty()) {
+        log_move_abort("no connections for median move");
+        return e_create_move::ABORT;
+    }
+
+    //The median of the bounding box edges (there are always an even number of them)
+    size_t mid = xs_.size() / 2;
+    std::nth_element(xs_.begin(), xs_.begin() + mid, xs_.end());
+    int x_hi = xs_[mid];
+    int x_lo = *std::max_element(xs_.begin(), xs_.begin() + mid);
+    std::nth_element(ys_.begin(), ys_.begin() + mid, ys_.end());
+    int y_hi = ys_[mid];
+    int y_lo = *std::max_element(ys_.begin(), ys_.begin() + mid);
+
+    vtr::Point<int> median((x_lo + x_hi) / 2, (y_lo + y_hi) / 2);
+
+    t_pl_loc to;
+    if (!find_to_loc_centered(cluster_from_type, rlim, from, median, to)) {
+        return e_create_move::ABORT;
+    }
+
+    return ::create_move(blocks_affected, b_from, to);
+}
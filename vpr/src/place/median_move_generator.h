@@ -0,0 +1,18 @@
+#ifndef VPR_MEDIAN_MOVE_GEN_H
+#define VPR_MEDIAN_MOVE_GEN_H
+#include "move_generator.h"
+
+//Moves a random block towards the median of the bounding boxes of its nets
+//(computed without the block itself), the location which minimizes the
+//half-perimeter wirelength of those nets if the rest of the placement is fixed.
+class MedianMoveGenerator : public MoveGenerator {
+  public:
+    e_create_move propose_move(t_pl_blocks_to_be_moved& affected_blocks, float rlim) override;
+
+  private:
+    //Scratch space for the bounding box edges of the moved block's nets
+    std::vector<int> xs_;
+    std::vector<int> ys_;
+};
+
+#endif
@@ -24,8 +24,13 @@ class MoveGenerator {
     //Updates affected_blocks with the proposed move, while respecting the current rlim
     virtual e_create_move propose_move(t_pl_blocks_to_be_moved& affected_blocks, float rlim) = 0;
 
-    //Recieves feedback about the outcome of the previously proposed move
+    //Recieves feedback about the outcome of a proposed move.
+    //Outcomes are reported in the same order the moves were proposed, but several moves
+    //may be proposed before the first outcome is reported (see try_swap_batch())
     virtual void process_outcome(const MoveOutcomeStats& /*move_outcome*/) {}
+
+    //Prints a summary of the moves proposed by this generator
+    virtual void print_stats() const {}
 };
 
 #endif
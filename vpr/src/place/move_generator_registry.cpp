@@ -0,0 +1,101 @@
+#include <functional>
+
+#include "move_generator_registry.h"
+#include "uniform_move_generator.h"
+#include "median_move_generator.h"
+#include "critical_move_generator.h"
+#include "weighted_move_generator.h"
+
+#include "vtr_util.h"
+#include "vpr_error.h"
+
+namespace {
+
+struct t_move_generator_entry {
+    const char* name;
+    bool requires_timing; //Only usable with timing-driven placement
+    std::function<std::unique_ptr<MoveGenerator>()> create;
+};
+
+//All the move generators which can be selected with --place_move_generators.
+//New move generators should be added here.
+const std::vector<t_move_generator_entry>& move_generator_entries() {
+    static const std::vector<t_move_generator_entry> entries = {
+        {"uniform", false, []() { return std::unique_ptr<MoveGenerator>(new UniformMoveGenerator()); }},
+        {"median", false, []() { return std::unique_ptr<MoveGenerator>(new MedianMoveGenerator()); }},
+        {"critical", true, []() { return std::unique_ptr<MoveGenerator>(new CriticalMoveGenerator()); }},
+    };
+    return entries;
+}
+
+const t_move_generator_entry* find_move_generator_entry(const std::string& name) {
+    for (const t_move_generator_entry& entry : move_generator_entries()) {
+        if (name == entry.name) {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+} // namespace
+
+std::vector<t_move_generator_spec> parse_move_generator_specs(const std::string& spec) {
+    std::vector<t_move_generator_spec> specs;
+
+    for (const std::string& item : vtr::split(spec, ",")) {
+        std::vector<std::string> tokens = vtr::split(item, ": \t");
+        if (tokens.empty()) {
+            continue;
+        }
+        if (tokens.size() > 2) {
+            VPR_FATAL_ERROR(VPR_ERROR_PLACE, "Invalid move generator '%s' (expected <name>[:<weight>])", item.c_str());
+        }
+
+        t_move_generator_spec gen_spec;
+        gen_spec.name = tokens[0];
+        if (!find_move_generator_entry(gen_spec.name)) {
+            std::string valid_names;
+            for (const t_move_generator_entry& entry : move_generator_entries()) {
+                if (!valid_names.empty()) valid_names += ", ";
+                valid_names += entry.name;
+            }
+            VPR_FATAL_ERROR(VPR_ERROR_PLACE, "Unknown move generator '%s' (expected one of: %s)",
+                            gen_spec.name.c_str(), valid_names.c_str());
+        }
+
+        if (tokens.size() == 2) {
+            gen_spec.weight = vtr::atof(tokens[1]);
+            if (!(gen_spec.weight > 0.)) {
+                VPR_FATAL_ERROR(VPR_ERROR_PLACE, "Move generator '%s' must have a positive weight (was '%s')",
+                                gen_spec.name.c_str(), tokens[1].c_str());
+            }
+        }
+
+        specs.push_back(gen_spec);
+    }
+
+    if (specs.empty()) {
+        VPR_FATAL_ERROR(VPR_ERROR_PLACE, "No move generators specified");
+    }
+
+    return specs;
+}
+
+std::unique_ptr<MoveGenerator> create_move_generator(const t_placer_opts& placer_opts) {
+    WeightedMoveGenerator* weighted_generator = new WeightedMoveGenerator(placer_opts.adaptive_move_mix);
+    std::unique_ptr<MoveGenerator> move_generator(weighted_generator);
+
+    for (const t_move_generator_spec& gen_spec : parse_move_generator_specs(placer_opts.move_generators)) {
+        const t_move_generator_entry* entry = find_move_generator_entry(gen_spec.name);
+        VTR_ASSERT(entry);
+
+        if (entry->requires_timing && placer_opts.place_algorithm != PATH_TIMING_DRIVEN_PLACE) {
+            VPR_FATAL_ERROR(VPR_ERROR_PLACE, "Move generator '%s' requires timing-driven placement",
+                            gen_spec.name.c_str());
+        }
+
+        weighted_generator->add_generator(gen_spec.name, entry->create(), gen_spec.weight);
+    }
+
+    return move_generator;
+}
@@ -0,0 +1,25 @@
+#ifndef VPR_MOVE_GENERATOR_REGISTRY_H
+#define VPR_MOVE_GENERATOR_REGISTRY_H
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "vpr_types.h"
+#include "move_generator.h"
+
+//A move generator and its relative weight, as requested with --place_move_generators
+struct t_move_generator_spec {
+    std::string name;
+    float weight = 1.;
+};
+
+//Parses a comma separated list of move generator names, each optionally followed by
+//':<weight>' (e.g. "uniform:2,median:1,critical"). Unknown names and non-positive
+//weights are fatal errors.
+std::vector<t_move_generator_spec> parse_move_generator_specs(const std::string& spec);
+
+//Creates the move generator used by the annealer, as specified by
+//placer_opts.move_generators and placer_opts.adaptive_move_mix
+std::unique_ptr<MoveGenerator> create_move_generator(const t_placer_opts& placer_opts);
+
+#endif
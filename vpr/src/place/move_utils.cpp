@@ -505,6 +505,15 @@ bool find_to_loc_uniform(t_logical_block_type_ptr type,
                          const t_pl_loc from,
                          t_pl_loc& to) {
     //Finds a legal swap to location for the given type, starting from 'from.x' and 'from.y'
+    return find_to_loc_centered(type, rlim, from, vtr::Point<int>(from.x, from.y), to);
+}
+
+bool find_to_loc_centered(t_logical_block_type_ptr type,
+                          float rlim,
+                          const t_pl_loc from,
+                          const vtr::Point<int> centre,
+                          t_pl_loc& to) {
+    //Finds a legal swap to location for the given type within rlim of 'centre', other than 'from'
     //
     //Note that the range limit (rlim) is applied in a logical sense (i.e. 'compressed' grid space consisting
     //of the same block types, and not the physical grid space). This means, for example, that columns of 'rare'
@@ -525,13 +534,17 @@ bool find_to_loc_uniform(t_logical_block_type_ptr type,
     int cx_from = grid_to_compressed(compressed_block_grid.compressed_to_grid_x, from.x);
     int cy_from = grid_to_compressed(compressed_block_grid.compressed_to_grid_y, from.y);
 
+    //The centre need not be a location of this type, so use the nearest compressed coordinates
+    int cx_centre = grid_to_compressed_approx(compressed_block_grid.compressed_to_grid_x, centre.x());
+    int cy_centre = grid_to_compressed_approx(compressed_block_grid.compressed_to_grid_y, centre.y());
+
     //Determine the valid compressed grid location ranges
-    int min_cx = std::max(0, cx_from - rlim_x);
-    int max_cx = std::min<int>(compressed_block_grid.compressed_to_grid_x.size() - 1, cx_from + rlim_x);
+    int min_cx = std::max(0, cx_centre - rlim_x);
+    int max_cx = std::min<int>(compressed_block_grid.compressed_to_grid_x.size() - 1, cx_centre + rlim_x);
     int delta_cx = max_cx - min_cx;
 
-    int min_cy = std::max(0, cy_from - rlim_y);
-    int max_cy = std::min<int>(compressed_block_grid.compressed_to_grid_y.size() - 1, cy_from + rlim_y);
+    int min_cy = std::max(0, cy_centre - rlim_y);
+    int max_cy = std::min<int>(compressed_block_grid.compressed_to_grid_y.size() - 1, cy_centre + rlim_y);
 
     int cx_to = OPEN;
     int cy_to = OPEN;
@@ -50,4 +50,12 @@ bool find_to_loc_uniform(t_logical_block_type_ptr type,
                          float rlim,
                          const t_pl_loc from,
                          t_pl_loc& to);
+
+//Like find_to_loc_uniform(), but picks a location within rlim of 'centre' (rather than of 'from').
+//Used by the directed move generators to move a block towards a preferred location
+bool find_to_loc_centered(t_logical_block_type_ptr type,
+                          float rlim,
+                          const t_pl_loc from,
+                          const vtr::Point<int> centre,
+                          t_pl_loc& to);
 #endif
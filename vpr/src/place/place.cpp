@@ -1,13 +1,16 @@
 #include <cstdio>
+#include <cstring>
 #include <cmath>
 #include <memory>
 #include <fstream>
+#include <unordered_set>
 
 #include "vtr_assert.h"
 #include "vtr_log.h"
 #include "vtr_util.h"
 #include "vtr_random.h"
 #include "vtr_geometry.h"
+#include "vtr_time.h"
 
 #include "vpr_types.h"
 #include "vpr_error.h"
@@ -32,7 +35,7 @@
 #include "move_transactions.h"
 #include "move_utils.h"
 
-#include "uniform_move_generator.h"
+#include "move_generator_registry.h"
 
 #include "PlacementDelayCalculator.h"
 #include "VprTimingGraphResolver.h"
@@ -41,6 +44,11 @@
 #include "tatum/echo_writer.hpp"
 #include "tatum/TimingReporter.hpp"
 
+#if defined(VPR_USE_TBB)
+#    include <tbb/parallel_for.h>
+#    include <tbb/task_arena.h>
+#endif
+
 using std::max;
 using std::min;
 
@@ -96,6 +104,19 @@ struct t_placer_prev_inverse_costs {
     double timing_cost;
 };
 
+//A move proposed as part of a batch of independent moves (see try_swap_batch())
+struct t_batch_move {
+    t_batch_move()
+        : blocks_affected(0) {}
+
+    t_pl_blocks_to_be_moved blocks_affected;
+    bool aborted = false; //The move generator could not propose a legal move
+    std::vector<ClusterNetId> nets_to_update;
+    int num_nets_affected = 0;
+    double bb_delta_c = 0.;
+    double timing_delta_c = 0.;
+};
+
 constexpr float INVALID_DELAY = std::numeric_limits<float>::quiet_NaN();
 
 constexpr double MAX_INV_TIMING_COST = 1.e9;
@@ -163,6 +184,16 @@ static float** chany_place_cost_fac; //[0...device_ctx.grid.height()-2]
 static vtr::vector<ClusterNetId, t_bb> ts_bb_coord_new, ts_bb_edge_new;
 static std::vector<ClusterNetId> ts_nets_to_update;
 
+/* Used by try_swap_batch() to keep the moves of a batch independent.     *
+ * Each proposed move gets a new stamp, which it writes to the blocks and *
+ * nets it touches; a block or net with a stamp at or after the batch's   *
+ * first stamp is already used by another move in the batch.             */
+static vtr::vector<ClusterBlockId, size_t> f_block_move_stamp;
+static vtr::vector<ClusterNetId, size_t> f_net_move_stamp;
+static size_t f_move_stamp = 0;
+static std::unordered_set<t_pl_loc> f_batch_moved_to;
+static std::vector<t_batch_move> f_batch_moves;
+
 /* These file-scoped variables keep track of the number of swaps       *
  * rejected, accepted or aborted. The total number of swap attempts    *
  * is the sum of the three number.                                     */
@@ -280,8 +311,8 @@ static void free_fast_cost_update();
 
 static double comp_bb_cost(e_cost_methods method);
 
-static void update_move_nets(int num_nets_affected);
-static void reset_move_nets(int num_nets_affected);
+static void update_move_nets(const std::vector<ClusterNetId>& nets_to_update, int num_nets_affected);
+static void reset_move_nets(const std::vector<ClusterNetId>& nets_to_update, int num_nets_affected);
 
 static e_move_result try_swap(float t,
                               t_placer_costs* costs,
@@ -294,6 +325,35 @@ static e_move_result try_swap(float t,
                               enum e_place_algorithm place_algorithm,
                               float timing_tradeoff);
 
+static e_move_result accept_or_reject_swap(float t,
+                                           t_placer_costs* costs,
+                                           const t_placer_prev_inverse_costs* prev_inverse_costs,
+                                           t_pl_blocks_to_be_moved& blocks_affected,
+                                           const std::vector<ClusterNetId>& nets_to_update,
+                                           int num_nets_affected,
+                                           double bb_delta_c,
+                                           double timing_delta_c,
+                                           enum e_place_algorithm place_algorithm,
+                                           float timing_tradeoff,
+                                           MoveOutcomeStats& move_outcome_stats);
+
+static int try_swap_batch(float t,
+                          t_placer_costs* costs,
+                          t_placer_prev_inverse_costs* prev_inverse_costs,
+                          float rlim,
+                          MoveGenerator& move_generator,
+                          t_pl_blocks_to_be_moved& blocks_affected,
+                          const PlaceDelayModel* delay_model,
+                          const t_placer_opts& placer_opts,
+                          int max_moves,
+                          t_placer_statistics* stats);
+
+static bool claim_batch_move(const t_pl_blocks_to_be_moved& blocks_affected, size_t batch_first_stamp, int& num_nets);
+
+static int get_move_batch_size(const t_placer_opts& placer_opts);
+
+static void record_swap_outcome(e_move_result swap_result, const t_placer_costs& costs, t_placer_statistics* stats);
+
 static void check_place(const t_placer_costs& costs,
                         const PlaceDelayModel* delay_model,
                         enum e_place_algorithm place_algorithm);
@@ -346,10 +406,11 @@ static void update_bb(ClusterNetId net_id, t_bb* bb_coord_new, t_bb* bb_edge_new
 static int find_affected_nets_and_update_costs(e_place_algorithm place_algorithm,
                                                const t_pl_blocks_to_be_moved& blocks_affected,
                                                const PlaceDelayModel* delay_model,
+                                               std::vector<ClusterNetId>& nets_to_update,
                                                double& bb_delta_c,
                                                double& timing_delta_c);
 
-static void record_affected_net(const ClusterNetId net, int& num_affected_nets);
+static void record_affected_net(const ClusterNetId net, std::vector<ClusterNetId>& nets_to_update, int& num_affected_nets);
 
 static void update_net_bb(const ClusterNetId net,
                           const t_pl_blocks_to_be_moved& blocks_affected,
@@ -412,7 +473,8 @@ static void print_place_status(const float t,
                                const float std_dev,
                                const float rlim,
                                const float crit_exponent,
-                               size_t tot_moves);
+                               size_t tot_moves,
+                               const float moves_per_sec);
 static void print_resources_utilization();
 
 /*****************************************************************************/
@@ -476,7 +538,7 @@ void try_place(const t_placer_opts& placer_opts,
         }
     }
 
-    move_generator = std::make_unique<UniformMoveGenerator>();
+    move_generator = create_move_generator(placer_opts);
 
     width_fac = placer_opts.place_chan_width;
 
@@ -518,7 +580,7 @@ void try_place(const t_placer_opts& placer_opts,
         placement_delay_calc = std::make_shared<PlacementDelayCalculator>(atom_ctx.nlist, atom_ctx.lookup, point_to_point_delay);
         placement_delay_calc->set_tsu_margin_relative(placer_opts.tsu_rel_margin);
         placement_delay_calc->set_tsu_margin_absolute(placer_opts.tsu_abs_margin);
-        timing_info = make_setup_timing_info(placement_delay_calc);
+        timing_info = make_setup_timing_info(placement_delay_calc, placer_opts.timing_update_type);
 
         timing_info->update();
         timing_info->set_warn_unconstrained(false); //Don't warn again about unconstrained nodes again during placement
@@ -641,6 +703,7 @@ void try_place(const t_placer_opts& placer_opts,
                                            place_delay_model.get(),
                                            *timing_info);
 
+        vtr::Timer inner_loop_timer;
         placement_inner_loop(t, rlim, placer_opts,
                              move_lim, crit_exponent, inner_recompute_limit, &stats,
                              &costs,
@@ -651,6 +714,7 @@ void try_place(const t_placer_opts& placer_opts,
                              *move_generator,
                              blocks_affected,
                              *timing_info);
+        float moves_per_sec = move_lim / inner_loop_timer.elapsed_sec();
 
         tot_iter += move_lim;
 
@@ -669,7 +733,7 @@ void try_place(const t_placer_opts& placer_opts,
         print_place_status(t, oldt,
                            stats,
                            critical_path.delay(), sTNS, sWNS,
-                           success_rat, std_dev, rlim, crit_exponent, tot_iter);
+                           success_rat, std_dev, rlim, crit_exponent, tot_iter, moves_per_sec);
 
         sprintf(msg, "Cost: %g  BB Cost %g  TD Cost %g  Temperature: %g",
                 costs.cost, costs.bb_cost, costs.timing_cost, t);
@@ -703,6 +767,7 @@ void try_place(const t_placer_opts& placer_opts,
 
     /* Run inner loop again with temperature = 0 so as to accept only swaps
      * which reduce the cost of the placement */
+    vtr::Timer inner_loop_timer;
     placement_inner_loop(t, rlim, placer_opts,
                          move_lim, crit_exponent, inner_recompute_limit, &stats,
                          &costs,
@@ -713,6 +778,7 @@ void try_place(const t_placer_opts& placer_opts,
                          *move_generator,
                          blocks_affected,
                          *timing_info);
+    float moves_per_sec = move_lim / inner_loop_timer.elapsed_sec();
 
     tot_iter += move_lim;
     ++num_temps;
@@ -727,7 +793,7 @@ void try_place(const t_placer_opts& placer_opts,
 
     print_place_status(t, oldt, stats,
                        critical_path.delay(), sTNS, sWNS,
-                       success_rat, std_dev, rlim, crit_exponent, tot_iter);
+                       success_rat, std_dev, rlim, crit_exponent, tot_iter, moves_per_sec);
 
     // TODO:
     // 1. add some subroutine hierarchy!  Too big!
@@ -743,6 +809,7 @@ void try_place(const t_placer_opts& placer_opts,
     //Some stats
     VTR_LOG("\n");
     VTR_LOG("Swaps called: %d\n", num_ts_called);
+    move_generator->print_stats();
 
     if (placer_opts.enable_timing_computations
         && placer_opts.place_algorithm == BOUNDING_BOX_PLACE) {
@@ -879,7 +946,7 @@ static void placement_inner_loop(float t,
                                  MoveGenerator& move_generator,
                                  t_pl_blocks_to_be_moved& blocks_affected,
                                  SetupTimingInfo& timing_info) {
-    int inner_crit_iter_count, inner_iter;
+    int inner_crit_iter_count, inner_iter, num_moves;
 
     stats->av_cost = 0.;
     stats->av_bb_cost = 0.;
@@ -889,28 +956,28 @@ static void placement_inner_loop(float t,
 
     inner_crit_iter_count = 1;
 
-    /* Inner loop begins */
-    for (inner_iter = 0; inner_iter < move_lim; inner_iter++) {
-        e_move_result swap_result = try_swap(t, costs, prev_inverse_costs, rlim,
-                                             move_generator,
-                                             blocks_affected,
-                                             delay_model,
-                                             placer_opts.rlim_escape_fraction,
-                                             placer_opts.place_algorithm,
-                                             placer_opts.timing_tradeoff);
+    int move_batch_size = get_move_batch_size(placer_opts);
 
-        if (swap_result == ACCEPTED) {
-            /* Move was accepted.  Update statistics that are useful for the annealing schedule. */
-            stats->success_sum++;
-            stats->av_cost += costs->cost;
-            stats->av_bb_cost += costs->bb_cost;
-            stats->av_timing_cost += costs->timing_cost;
-            stats->sum_of_squares += (costs->cost) * (costs->cost);
-            num_swap_accepted++;
-        } else if (swap_result == ABORTED) {
-            num_swap_aborted++;
-        } else { // swap_result == REJECTED
-            num_swap_rejected++;
+    /* Inner loop begins */
+    for (inner_iter = 0; inner_iter < move_lim; inner_iter += num_moves) {
+        if (move_batch_size > 1) {
+            num_moves = try_swap_batch(t, costs, prev_inverse_costs, rlim,
+                                       move_generator,
+                                       blocks_affected,
+                                       delay_model,
+                                       placer_opts,
+                                       std::min(move_batch_size, move_lim - inner_iter),
+                                       stats);
+        } else {
+            e_move_result swap_result = try_swap(t, costs, prev_inverse_costs, rlim,
+                                                 move_generator,
+                                                 blocks_affected,
+                                                 delay_model,
+                                                 placer_opts.rlim_escape_fraction,
+                                                 placer_opts.place_algorithm,
+                                                 placer_opts.timing_tradeoff);
+            record_swap_outcome(swap_result, *costs, stats);
+            num_moves = 1;
         }
 
         if (placer_opts.place_algorithm == PATH_TIMING_DRIVEN_PLACE) {
@@ -918,7 +985,7 @@ static void placement_inner_loop(float t,
              * We do this only once in a while, since it is expensive.
              */
             if (inner_crit_iter_count >= inner_recompute_limit
-                && inner_iter != move_lim - 1) { /*on last iteration don't recompute */
+                && inner_iter + num_moves < move_lim) { /*on last iteration don't recompute */
 
                 inner_crit_iter_count = 0;
 #ifdef VERBOSE
@@ -933,7 +1000,7 @@ static void placement_inner_loop(float t,
 
                 comp_td_costs(delay_model, &costs->timing_cost);
             }
-            inner_crit_iter_count++;
+            inner_crit_iter_count += num_moves;
         }
 #ifdef VERBOSE
         VTR_LOG("t = %g  cost = %g   bb_cost = %g timing_cost = %g move = %d\n",
@@ -948,7 +1015,7 @@ static void placement_inner_loop(float t,
          * This round-off can lead to  error checks failing because the cost
          * is different from what you get when you recompute from scratch.
          */
-        ++(*moves_since_cost_recompute);
+        *moves_since_cost_recompute += num_moves;
         if (*moves_since_cost_recompute > MAX_MOVES_BEFORE_RECOMPUTE) {
             recompute_costs_from_scratch(placer_opts, delay_model, costs);
             *moves_since_cost_recompute = 0;
@@ -1143,11 +1210,11 @@ static float starting_t(t_placer_costs* costs,
     return (20. * std_dev);
 }
 
-static void update_move_nets(int num_nets_affected) {
+static void update_move_nets(const std::vector<ClusterNetId>& nets_to_update, int num_nets_affected) {
     /* update net cost functions and reset flags. */
     auto& cluster_ctx = g_vpr_ctx.clustering();
     for (int inet_affected = 0; inet_affected < num_nets_affected; inet_affected++) {
-        ClusterNetId net_id = ts_nets_to_update[inet_affected];
+        ClusterNetId net_id = nets_to_update[inet_affected];
 
         bb_coords[net_id] = ts_bb_coord_new[net_id];
         if (cluster_ctx.clb_nlist.net_sinks(net_id).size() >= SMALL_NET)
@@ -1161,10 +1228,10 @@ static void update_move_nets(int num_nets_affected) {
     }
 }
 
-static void reset_move_nets(int num_nets_affected) {
+static void reset_move_nets(const std::vector<ClusterNetId>& nets_to_update, int num_nets_affected) {
     /* Reset the net cost function flags first. */
     for (int inet_affected = 0; inet_affected < num_nets_affected; inet_affected++) {
-        ClusterNetId net_id = ts_nets_to_update[inet_affected];
+        ClusterNetId net_id = nets_to_update[inet_affected];
         temp_net_cost[net_id] = -1;
         bb_updated_before[net_id] = NOT_UPDATED_YET;
     }
@@ -1193,10 +1260,6 @@ static e_move_result try_swap(float t,
     /* I'm using negative values of temp_net_cost as a flag, so DO NOT   *
      * use cost functions that can go negative.                          */
 
-    double delta_c = 0; /* Change in cost due to this swap. */
-    double bb_delta_c = 0;
-    double timing_delta_c = 0;
-
     //Allow some fraction of moves to not be restricted by rlim,
     //in the hopes of better escaping local minima
     if (rlim_escape_fraction > 0. && vtr::frand() < rlim_escape_fraction) {
@@ -1240,71 +1303,324 @@ static e_move_result try_swap(float t,
         apply_move_blocks(blocks_affected);
 
         // Find all the nets affected by this swap and update their costs
-        int num_nets_affected = find_affected_nets_and_update_costs(place_algorithm, blocks_affected, delay_model, bb_delta_c, timing_delta_c);
-        if (place_algorithm == PATH_TIMING_DRIVEN_PLACE) {
-            /*in this case we redefine delta_c as a combination of timing and bb.  *
-             *additionally, we normalize all values, therefore delta_c is in       *
-             *relation to 1*/
+        double bb_delta_c = 0;
+        double timing_delta_c = 0;
+        int num_nets_affected = find_affected_nets_and_update_costs(place_algorithm, blocks_affected, delay_model, ts_nets_to_update, bb_delta_c, timing_delta_c);
 
-            delta_c = (1 - timing_tradeoff) * bb_delta_c * prev_inverse_costs->bb_cost
-                      + timing_tradeoff * timing_delta_c * prev_inverse_costs->timing_cost;
-        } else {
-            delta_c = bb_delta_c;
+        move_outcome = accept_or_reject_swap(t, costs, prev_inverse_costs,
+                                             blocks_affected,
+                                             ts_nets_to_update, num_nets_affected,
+                                             bb_delta_c, timing_delta_c,
+                                             place_algorithm, timing_tradeoff,
+                                             move_outcome_stats);
+    }
+
+    move_outcome_stats.outcome = move_outcome;
+
+    move_generator.process_outcome(move_outcome_stats);
+
+    clear_move_blocks(blocks_affected);
+
+    //VTR_ASSERT(check_macro_placement_consistency() == 0);
+#if 0
+    //Check that each accepted swap yields a valid placement
+    check_place(*costs, delay_model, place_algorithm);
+#endif
+
+    return (move_outcome);
+}
+
+//Proposes up to max_moves moves which share no blocks, nets or target locations,
+//computes their changes in cost concurrently, and then accepts or rejects them
+//one at a time in the order they were proposed.
+//
+//Since the moves of a batch are independent, each move's change in cost is exactly
+//what try_swap() would compute after the earlier moves of the batch were accepted or
+//rejected. All random numbers are drawn serially, so the placement depends only on the
+//seed and the batch size, not on the number of workers.
+//
+//A proposed move which conflicts with an earlier move of the batch ends the batch, and
+//is dropped without counting as an attempted move (the move generator sees it as aborted).
+//
+//The move generator receives the outcomes of the batch's moves in the order they were proposed.
+//
+//Returns the number of moves attempted (at least one).
+static int try_swap_batch(float t,
+                          t_placer_costs* costs,
+                          t_placer_prev_inverse_costs* prev_inverse_costs,
+                          float rlim,
+                          MoveGenerator& move_generator,
+                          t_pl_blocks_to_be_moved& blocks_affected,
+                          const PlaceDelayModel* delay_model,
+                          const t_placer_opts& placer_opts,
+                          int max_moves,
+                          t_placer_statistics* stats) {
+    if (f_batch_moves.size() < size_t(max_moves)) {
+        f_batch_moves.resize(max_moves);
+    }
+    f_batch_moved_to.clear();
+    size_t batch_first_stamp = f_move_stamp + 1;
+
+    /* Propose the moves serially (the move generator and random number generator are not thread safe) */
+    int num_moves = 0;
+    int num_batch_moves = 0;
+    bool dropped_move = false;
+    while (num_moves < max_moves) {
+        float move_rlim = rlim;
+        if (placer_opts.rlim_escape_fraction > 0. && vtr::frand() < placer_opts.rlim_escape_fraction) {
+            move_rlim = std::numeric_limits<float>::infinity();
         }
 
-        /* 1 -> move accepted, 0 -> rejected. */
-        move_outcome = assess_swap(delta_c, t);
+        e_create_move create_move_outcome = move_generator.propose_move(blocks_affected, move_rlim);
 
-        if (move_outcome == ACCEPTED) {
-            costs->cost += delta_c;
-            costs->bb_cost += bb_delta_c;
+        t_batch_move& move = f_batch_moves[num_batch_moves];
 
-            if (place_algorithm == PATH_TIMING_DRIVEN_PLACE) {
-                /*update the point_to_point_timing_cost and point_to_point_delay
-                 * values from the temporary values */
-                costs->timing_cost += timing_delta_c;
+        if (create_move_outcome == e_create_move::ABORT) {
+            //Kept in the batch (with no blocks) so its outcome is reported in order
+            clear_move_blocks(blocks_affected);
+            move.blocks_affected.num_moved_blocks = 0;
+            move.aborted = true;
 
-                update_td_cost(blocks_affected);
-            }
+            ++num_batch_moves;
+            ++num_moves;
+            continue;
+        }
 
-            /* update net cost functions and reset flags. */
-            update_move_nets(num_nets_affected);
+        int num_nets = 0;
+        if (!claim_batch_move(blocks_affected, batch_first_stamp, num_nets)) {
+            //Depends on an earlier move of the batch, drop it and evaluate the batch so far
+            VTR_ASSERT(num_moves > 0);
+            clear_move_blocks(blocks_affected);
+            dropped_move = true;
+            break;
+        }
 
-            /* Update clb data structures since we kept the move. */
-            commit_move_blocks(blocks_affected);
+        move.aborted = false;
+        move.blocks_affected.moved_blocks.assign(blocks_affected.moved_blocks.begin(),
+                                                 blocks_affected.moved_blocks.begin() + blocks_affected.num_moved_blocks);
+        move.blocks_affected.num_moved_blocks = blocks_affected.num_moved_blocks;
+        if (move.nets_to_update.size() < size_t(num_nets)) {
+            move.nets_to_update.resize(num_nets);
+        }
+        clear_move_blocks(blocks_affected);
 
-        } else { /* Move was rejected.  */
-                 /* Reset the net cost function flags first. */
-            reset_move_nets(num_nets_affected);
+        ++num_batch_moves;
+        ++num_moves;
+    }
+
+    /* Apply all the moves and compute their changes in cost concurrently.  *
+     * The moves touch disjoint sets of blocks and nets, so each evaluation *
+     * only reads and writes the (per-net) state of its own nets.           */
+    for (int imove = 0; imove < num_batch_moves; ++imove) {
+        apply_move_blocks(f_batch_moves[imove].blocks_affected);
+    }
+
+    auto evaluate_move = [&](size_t imove) {
+        t_batch_move& move = f_batch_moves[imove];
+        if (move.aborted) return;
+        move.bb_delta_c = 0.;
+        move.timing_delta_c = 0.;
+        move.num_nets_affected = find_affected_nets_and_update_costs(placer_opts.place_algorithm,
+                                                                     move.blocks_affected,
+                                                                     delay_model,
+                                                                     move.nets_to_update,
+                                                                     move.bb_delta_c,
+                                                                     move.timing_delta_c);
+    };
+#if defined(VPR_USE_TBB)
+    tbb::parallel_for(size_t(0), size_t(num_batch_moves), evaluate_move);
+#else
+    for (int imove = 0; imove < num_batch_moves; ++imove) {
+        evaluate_move(imove);
+    }
+#endif
+
+    /* Accept or reject the moves in the order they were proposed */
+    for (int imove = 0; imove < num_batch_moves; ++imove) {
+        t_batch_move& move = f_batch_moves[imove];
+        num_ts_called++;
+
+        LOG_MOVE_STATS_PROPOSED(t, move.blocks_affected);
 
-            /* Restore the place_ctx.block_locs data structures to their state before the move. */
-            revert_move_blocks(blocks_affected);
+        MoveOutcomeStats move_outcome_stats;
+        if (move.aborted) {
+            LOG_MOVE_STATS_OUTCOME(std::numeric_limits<float>::quiet_NaN(),
+                                   std::numeric_limits<float>::quiet_NaN(),
+                                   std::numeric_limits<float>::quiet_NaN(),
+                                   "ABORTED", "illegal move");
+
+            move_outcome_stats.outcome = ABORTED;
+            move_generator.process_outcome(move_outcome_stats);
+
+            record_swap_outcome(ABORTED, *costs, stats);
+            continue;
         }
 
-        move_outcome_stats.delta_cost_norm = delta_c;
-        move_outcome_stats.delta_bb_cost_norm = bb_delta_c * prev_inverse_costs->bb_cost;
-        move_outcome_stats.delta_timing_cost_norm = timing_delta_c * prev_inverse_costs->timing_cost;
+        move_outcome_stats.outcome = accept_or_reject_swap(t, costs, prev_inverse_costs,
+                                                           move.blocks_affected,
+                                                           move.nets_to_update, move.num_nets_affected,
+                                                           move.bb_delta_c, move.timing_delta_c,
+                                                           placer_opts.place_algorithm, placer_opts.timing_tradeoff,
+                                                           move_outcome_stats);
+        move_generator.process_outcome(move_outcome_stats);
 
-        move_outcome_stats.delta_bb_cost_abs = bb_delta_c;
-        move_outcome_stats.delta_timing_cost_abs = timing_delta_c;
+        record_swap_outcome(move_outcome_stats.outcome, *costs, stats);
+    }
 
-        LOG_MOVE_STATS_OUTCOME(delta_c, bb_delta_c, timing_delta_c,
-                               (move_outcome ? "ACCEPTED" : "REJECTED"), "");
+    if (dropped_move) {
+        //The dropped move was proposed last, so its outcome comes last
+        MoveOutcomeStats move_outcome_stats;
+        move_outcome_stats.outcome = ABORTED;
+        move_generator.process_outcome(move_outcome_stats);
     }
 
-    move_outcome_stats.outcome = move_outcome;
+    return num_moves;
+}
 
-    move_generator.process_outcome(move_outcome_stats);
+//Marks the blocks, nets and target locations of a proposed move as used by the
+//current batch, and counts the (distinct) nets it affects in num_nets.
+//
+//Returns false if any of them is already used by an earlier move of the batch.
+static bool claim_batch_move(const t_pl_blocks_to_be_moved& blocks_affected, size_t batch_first_stamp, int& num_nets) {
+    auto& cluster_ctx = g_vpr_ctx.clustering();
 
-    clear_move_blocks(blocks_affected);
+    size_t stamp = ++f_move_stamp;
+    num_nets = 0;
 
-    //VTR_ASSERT(check_macro_placement_consistency() == 0);
-#if 0
-    //Check that each accepted swap yields a valid placement
-    check_place(*costs, delay_model, place_algorithm);
+    for (int iblk = 0; iblk < blocks_affected.num_moved_blocks; ++iblk) {
+        ClusterBlockId blk = blocks_affected.moved_blocks[iblk].block_num;
+        if (f_block_move_stamp[blk] >= batch_first_stamp) {
+            return false;
+        }
+        f_block_move_stamp[blk] = stamp;
+
+        //An empty target location is not covered by the block check
+        if (!f_batch_moved_to.insert(blocks_affected.moved_blocks[iblk].new_loc).second) {
+            return false;
+        }
+
+        for (ClusterPinId blk_pin : cluster_ctx.clb_nlist.block_pins(blk)) {
+            ClusterNetId net_id = cluster_ctx.clb_nlist.pin_net(blk_pin);
+            if (cluster_ctx.clb_nlist.net_is_ignored(net_id) || f_net_move_stamp[net_id] == stamp) {
+                continue;
+            }
+            if (f_net_move_stamp[net_id] >= batch_first_stamp) {
+                return false;
+            }
+            f_net_move_stamp[net_id] = stamp;
+            ++num_nets;
+        }
+    }
+    return true;
+}
+
+//Returns the number of moves evaluated together by try_swap_batch(), or 1 if
+//moves are evaluated one at a time by try_swap().
+//
+//In deterministic mode the batch size is fixed, so the placement is identical
+//for any number of workers. Otherwise it is sized to give every worker a few moves.
+static int get_move_batch_size(const t_placer_opts& placer_opts) {
+    constexpr int DETERMINISTIC_BATCH_SIZE = 32;
+    constexpr int MOVES_PER_WORKER = 8;
+
+    if (!placer_opts.parallel_placement) {
+        return 1;
+    }
+
+    if (placer_opts.parallel_placement_deterministic) {
+        return DETERMINISTIC_BATCH_SIZE;
+    }
+
+    size_t num_workers = 1;
+#if defined(VPR_USE_TBB)
+    num_workers = tbb::this_task_arena::max_concurrency();
 #endif
+    return std::max<int>(2, MOVES_PER_WORKER * num_workers);
+}
 
-    return (move_outcome);
+//Updates the annealing statistics with the outcome of a move
+static void record_swap_outcome(e_move_result swap_result, const t_placer_costs& costs, t_placer_statistics* stats) {
+    if (swap_result == ACCEPTED) {
+        /* Move was accepted.  Update statistics that are useful for the annealing schedule. */
+        stats->success_sum++;
+        stats->av_cost += costs.cost;
+        stats->av_bb_cost += costs.bb_cost;
+        stats->av_timing_cost += costs.timing_cost;
+        stats->sum_of_squares += (costs.cost) * (costs.cost);
+        num_swap_accepted++;
+    } else if (swap_result == ABORTED) {
+        num_swap_aborted++;
+    } else { // swap_result == REJECTED
+        num_swap_rejected++;
+    }
+}
+
+//Decides whether to keep a move which has been applied (to place_ctx.block_locs)
+//and whose change in cost has been computed, then commits or reverts it.
+static e_move_result accept_or_reject_swap(float t,
+                                           t_placer_costs* costs,
+                                           const t_placer_prev_inverse_costs* prev_inverse_costs,
+                                           t_pl_blocks_to_be_moved& blocks_affected,
+                                           const std::vector<ClusterNetId>& nets_to_update,
+                                           int num_nets_affected,
+                                           double bb_delta_c,
+                                           double timing_delta_c,
+                                           enum e_place_algorithm place_algorithm,
+                                           float timing_tradeoff,
+                                           MoveOutcomeStats& move_outcome_stats) {
+    double delta_c = 0; /* Change in cost due to this swap. */
+
+    if (place_algorithm == PATH_TIMING_DRIVEN_PLACE) {
+        /*in this case we redefine delta_c as a combination of timing and bb.  *
+         *additionally, we normalize all values, therefore delta_c is in       *
+         *relation to 1*/
+
+        delta_c = (1 - timing_tradeoff) * bb_delta_c * prev_inverse_costs->bb_cost
+                  + timing_tradeoff * timing_delta_c * prev_inverse_costs->timing_cost;
+    } else {
+        delta_c = bb_delta_c;
+    }
+
+    /* 1 -> move accepted, 0 -> rejected. */
+    e_move_result move_outcome = assess_swap(delta_c, t);
+
+    if (move_outcome == ACCEPTED) {
+        costs->cost += delta_c;
+        costs->bb_cost += bb_delta_c;
+
+        if (place_algorithm == PATH_TIMING_DRIVEN_PLACE) {
+            /*update the point_to_point_timing_cost and point_to_point_delay
+             * values from the temporary values */
+            costs->timing_cost += timing_delta_c;
+
+            update_td_cost(blocks_affected);
+        }
+
+        /* update net cost functions and reset flags. */
+        update_move_nets(nets_to_update, num_nets_affected);
+
+        /* Update clb data structures since we kept the move. */
+        commit_move_blocks(blocks_affected);
+
+    } else { /* Move was rejected.  */
+             /* Reset the net cost function flags first. */
+        reset_move_nets(nets_to_update, num_nets_affected);
+
+        /* Restore the place_ctx.block_locs data structures to their state before the move. */
+        revert_move_blocks(blocks_affected);
+    }
+
+    move_outcome_stats.delta_cost_norm = delta_c;
+    move_outcome_stats.delta_bb_cost_norm = bb_delta_c * prev_inverse_costs->bb_cost;
+    move_outcome_stats.delta_timing_cost_norm = timing_delta_c * prev_inverse_costs->timing_cost;
+
+    move_outcome_stats.delta_bb_cost_abs = bb_delta_c;
+    move_outcome_stats.delta_timing_cost_abs = timing_delta_c;
+
+    LOG_MOVE_STATS_OUTCOME(delta_c, bb_delta_c, timing_delta_c,
+                           (move_outcome ? "ACCEPTED" : "REJECTED"), "");
+
+    return move_outcome;
 }
 
 //Puts all the nets changed by the current swap into nets_to_update,
@@ -1314,6 +1630,7 @@ static e_move_result try_swap(float t,
 static int find_affected_nets_and_update_costs(e_place_algorithm place_algorithm,
                                                const t_pl_blocks_to_be_moved& blocks_affected,
                                                const PlaceDelayModel* delay_model,
+                                               std::vector<ClusterNetId>& nets_to_update,
                                                double& bb_delta_c,
                                                double& timing_delta_c) {
     VTR_ASSERT_SAFE(bb_delta_c == 0.);
@@ -1335,7 +1652,7 @@ static int find_affected_nets_and_update_costs(e_place_algorithm place_algorithm
                 continue; //TODO: do we require anyting special here for global nets. "Global nets are assumed to span the whole chip, and do not effect costs"
 
             //Record effected nets
-            record_affected_net(net_id, num_affected_nets);
+            record_affected_net(net_id, nets_to_update, num_affected_nets);
 
             //Update the net bounding boxes
             //
@@ -1354,7 +1671,7 @@ static int find_affected_nets_and_update_costs(e_place_algorithm place_algorithm
      * The cost is only updated once per net.
      */
     for (int inet_affected = 0; inet_affected < num_affected_nets; inet_affected++) {
-        ClusterNetId net_id = ts_nets_to_update[inet_affected];
+        ClusterNetId net_id = nets_to_update[inet_affected];
 
         temp_net_cost[net_id] = get_net_cost(net_id, &ts_bb_coord_new[net_id]);
         bb_delta_c += temp_net_cost[net_id] - net_cost[net_id];
@@ -1363,11 +1680,11 @@ static int find_affected_nets_and_update_costs(e_place_algorithm place_algorithm
     return num_affected_nets;
 }
 
-static void record_affected_net(const ClusterNetId net, int& num_affected_nets) {
+static void record_affected_net(const ClusterNetId net, std::vector<ClusterNetId>& nets_to_update, int& num_affected_nets) {
     //Record effected nets
     if (temp_net_cost[net] < 0.) {
         //Net not marked yet.
-        ts_nets_to_update[num_affected_nets] = net;
+        nets_to_update[num_affected_nets] = net;
         num_affected_nets++;
 
         //Flag to say we've marked this net.
@@ -1823,6 +2140,10 @@ static void alloc_and_load_try_swap_structs() {
     ts_bb_edge_new.resize(num_nets, t_bb());
     ts_nets_to_update.resize(num_nets, ClusterNetId::INVALID());
 
+    f_block_move_stamp.resize(cluster_ctx.clb_nlist.blocks().size(), 0);
+    f_net_move_stamp.resize(num_nets, 0);
+    f_move_stamp = 0;
+
     auto& place_ctx = g_vpr_ctx.mutable_placement();
     place_ctx.compressed_block_grids = create_compressed_block_grids();
 }
@@ -2491,6 +2812,11 @@ static void print_clb_placement(const char* fname) {
 
 static void free_try_swap_arrays() {
     g_vpr_ctx.mutable_placement().compressed_block_grids.clear();
+
+    f_block_move_stamp.clear();
+    f_net_move_stamp.clear();
+    f_batch_moved_to.clear();
+    f_batch_moves.clear();
 }
 
 static void calc_placer_stats(t_placer_statistics& stats, float& success_rat, double& std_dev, const t_placer_costs& costs, const int move_lim) {
@@ -2535,9 +2861,9 @@ static void update_screen_debug() {
 #endif
 
 static void print_place_status_header() {
-    VTR_LOG("------- ------- ---------- ---------- ------- ---------- -------- ------- ------- ------ -------- --------- ------\n");
-    VTR_LOG("      T Av Cost Av BB Cost Av TD Cost     CPD       sTNS     sWNS Ac Rate Std Dev  R lim Crit Exp Tot Moves  Alpha\n");
-    VTR_LOG("------- ------- ---------- ---------- ------- ---------- -------- ------- ------- ------ -------- --------- ------\n");
+    VTR_LOG("------- ------- ---------- ---------- ------- ---------- -------- ------- ------- ------ -------- --------- ------ ---------\n");
+    VTR_LOG("      T Av Cost Av BB Cost Av TD Cost     CPD       sTNS     sWNS Ac Rate Std Dev  R lim Crit Exp Tot Moves  Alpha   Moves/s\n");
+    VTR_LOG("------- ------- ---------- ---------- ------- ---------- -------- ------- ------- ------ -------- --------- ------ ---------\n");
 }
 
 static void print_place_status(const float t,
@@ -2550,7 +2876,8 @@ static void print_place_status(const float t,
                                const float std_dev,
                                const float rlim,
                                const float crit_exponent,
-                               size_t tot_moves) {
+                               size_t tot_moves,
+                               const float moves_per_sec) {
     VTR_LOG(
         "%7.1e "
         "%7.3f %10.2f %-10.5g "
@@ -2563,7 +2890,9 @@ static void print_place_status(const float t,
 
     pretty_print_uint(" ", tot_moves, 10, 3);
 
-    VTR_LOG(" %6.3f\n", t / oldt);
+    VTR_LOG(" %6.3f", t / oldt);
+
+    VTR_LOG(" %9.3g\n", moves_per_sec);
     fflush(stdout);
 }
 
@@ -0,0 +1,151 @@
+#include <algorithm>
+#include <numeric>
+
+#include "weighted_move_generator.h"
+
+#include "vtr_assert.h"
+#include "vtr_log.h"
+#include "vtr_random.h"
+
+//Number of move outcomes between adaptive weight updates
+constexpr size_t ADAPT_WEIGHTS_INTERVAL = 1000;
+
+//Weight of the latest window in the smoothed acceptance rates
+constexpr float ACCEPTANCE_RATE_SMOOTHING = 0.3;
+
+//Minimum probability of picking any generator with adaptive weighting, so
+//a generator can recover once its moves become useful again
+constexpr float MIN_GENERATOR_PROBABILITY = 0.05;
+
+WeightedMoveGenerator::WeightedMoveGenerator(bool adaptive)
+    : adaptive_(adaptive) {}
+
+void WeightedMoveGenerator::add_generator(std::string name, std::unique_ptr<MoveGenerator> generator, float weight) {
+    VTR_ASSERT(generator);
+    VTR_ASSERT(weight > 0.);
+
+    t_generator gen;
+    gen.name = name;
+    gen.generator = std::move(generator);
+    gen.base_weight = weight;
+    gen.weight = weight;
+    generators_.push_back(std::move(gen));
+}
+
+e_create_move WeightedMoveGenerator::propose_move(t_pl_blocks_to_be_moved& affected_blocks, float rlim) {
+    size_t igen = pick_generator();
+    t_generator& gen = generators_[igen];
+
+    pending_.push_back(igen);
+    ++gen.stats.num_proposed;
+
+    return gen.generator->propose_move(affected_blocks, rlim);
+}
+
+void WeightedMoveGenerator::process_outcome(const MoveOutcomeStats& move_outcome) {
+    VTR_ASSERT_MSG(!pending_.empty(), "Move outcome reported without a proposed move");
+    size_t igen = pending_.front();
+    pending_.pop_front();
+
+    t_generator& gen = generators_[igen];
+    if (move_outcome.outcome == ACCEPTED) {
+        ++gen.stats.num_accepted;
+        ++gen.stats.window_accepted;
+        gen.stats.delta_cost_sum += move_outcome.delta_cost_norm;
+    } else if (move_outcome.outcome == REJECTED) {
+        ++gen.stats.num_rejected;
+    } else {
+        VTR_ASSERT(move_outcome.outcome == ABORTED);
+        ++gen.stats.num_aborted;
+    }
+    ++gen.stats.window_proposed;
+
+    gen.generator->process_outcome(move_outcome);
+
+    if (adaptive_ && ++outcomes_since_update_ >= ADAPT_WEIGHTS_INTERVAL) {
+        update_weights();
+    }
+}
+
+float WeightedMoveGenerator::generator_probability(size_t igen) const {
+    float weight_sum = 0.;
+    for (const t_generator& gen : generators_) {
+        weight_sum += gen.weight;
+    }
+    return generators_[igen].weight / weight_sum;
+}
+
+size_t WeightedMoveGenerator::pick_generator() const {
+    VTR_ASSERT(!generators_.empty());
+
+    //Don't draw a random number if there is no choice to make, so a single
+    //generator produces exactly the same moves as it would on its own
+    if (generators_.size() == 1) {
+        return 0;
+    }
+
+    float weight_sum = 0.;
+    for (const t_generator& gen : generators_) {
+        weight_sum += gen.weight;
+    }
+
+    float pick = vtr::frand() * weight_sum;
+    for (size_t igen = 0; igen < generators_.size(); ++igen) {
+        pick -= generators_[igen].weight;
+        if (pick < 0.) {
+            return igen;
+        }
+    }
+    return generators_.size() - 1; //Round-off
+}
+
+void WeightedMoveGenerator::update_weights() {
+    outcomes_since_update_ = 0;
+
+    float weight_sum = 0.;
+    for (t_generator& gen : generators_) {
+        if (gen.stats.window_proposed > 0) {
+            float window_rate = float(gen.stats.window_accepted) / gen.stats.window_proposed;
+            gen.acceptance_rate = ACCEPTANCE_RATE_SMOOTHING * window_rate
+                                  + (1. - ACCEPTANCE_RATE_SMOOTHING) * gen.acceptance_rate;
+        }
+        gen.stats.window_proposed = 0;
+        gen.stats.window_accepted = 0;
+
+        gen.weight = gen.base_weight * gen.acceptance_rate;
+        weight_sum += gen.weight;
+    }
+
+    //Enforce the minimum probability
+    float min_weight = MIN_GENERATOR_PROBABILITY * weight_sum;
+    for (t_generator& gen : generators_) {
+        if (weight_sum == 0. || gen.weight < min_weight) {
+            gen.weight = std::max(min_weight, MIN_GENERATOR_PROBABILITY * gen.base_weight);
+        }
+    }
+}
+
+void WeightedMoveGenerator::print_stats() const {
+    VTR_LOG("\n");
+    VTR_LOG("Move generator statistics:\n");
+    VTR_LOG("  %-10s %6s %12s %9s %9s %9s %14s\n", "Generator", "Prob.", "Proposed", "Accept %", "Reject %", "Abort %", "Avg Accepted");
+    VTR_LOG("  %-10s %6s %12s %9s %9s %9s %14s\n", "", "", "", "", "", "", "Delta Cost");
+    VTR_LOG("  %-10s %6s %12s %9s %9s %9s %14s\n", "----------", "------", "------------", "---------", "---------", "---------", "--------------");
+    for (size_t igen = 0; igen < generators_.size(); ++igen) {
+        const t_generator& gen = generators_[igen];
+        const t_generator_stats& stats = gen.stats;
+
+        float num_proposed = std::max<size_t>(1, stats.num_proposed);
+        VTR_LOG("  %-10s %6.3f %12zu %9.2f %9.2f %9.2f %14.3g\n",
+                gen.name.c_str(),
+                generator_probability(igen),
+                stats.num_proposed,
+                100. * stats.num_accepted / num_proposed,
+                100. * stats.num_rejected / num_proposed,
+                100. * stats.num_aborted / num_proposed,
+                stats.num_accepted > 0 ? stats.delta_cost_sum / stats.num_accepted : 0.);
+
+        gen.generator->print_stats();
+    }
+    VTR_LOG("\n");
+}
@@ -0,0 +1,71 @@
+#ifndef VPR_WEIGHTED_MOVE_GEN_H
+#define VPR_WEIGHTED_MOVE_GEN_H
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "move_generator.h"
+
+//Proposes each move with one of several move generators, picked at random
+//according to their weights, and keeps per-generator statistics.
+//
+//If adaptive weighting is enabled, the weights are periodically re-scaled by each
+//generator's recent acceptance rate, so generators whose moves are rarely accepted
+//are used less often (but never less than a minimum probability).
+class WeightedMoveGenerator : public MoveGenerator {
+  public:
+    WeightedMoveGenerator(bool adaptive = false);
+
+    //Adds a move generator which is picked with probability proportional to weight
+    void add_generator(std::string name, std::unique_ptr<MoveGenerator> generator, float weight);
+
+    e_create_move propose_move(t_pl_blocks_to_be_moved& affected_blocks, float rlim) override;
+
+    void process_outcome(const MoveOutcomeStats& move_outcome) override;
+
+    void print_stats() const override;
+
+  public: //Accessors
+    size_t num_generators() const { return generators_.size(); }
+    const std::string& generator_name(size_t igen) const { return generators_[igen].name; }
+
+    //Current probability of picking the igen'th generator
+    float generator_probability(size_t igen) const;
+
+  private:
+    struct t_generator_stats {
+        size_t num_proposed = 0;
+        size_t num_accepted = 0;
+        size_t num_rejected = 0;
+        size_t num_aborted = 0;
+        double delta_cost_sum = 0.; //Sum of the normalized cost changes of accepted moves
+
+        //Outcomes since the last weight update
+        size_t window_proposed = 0;
+        size_t window_accepted = 0;
+    };
+
+    struct t_generator {
+        std::string name;
+        std::unique_ptr<MoveGenerator> generator;
+        float base_weight = 0.;
+        float weight = 0.;
+        float acceptance_rate = 1.; //Smoothed acceptance rate (adaptive weighting only)
+        t_generator_stats stats;
+    };
+
+    size_t pick_generator() const;
+    void update_weights();
+
+  private:
+    std::vector<t_generator> generators_;
+
+    //Generators of the moves proposed but whose outcome has not yet been reported
+    std::deque<size_t> pending_;
+
+    bool adaptive_;
+    size_t outcomes_since_update_ = 0;
+};
+
+#endif
@@ -30,8 +30,9 @@ PowerCallibInputs::~PowerCallibInputs() {
     }
 }
 
-void PowerCallibInputs::add_size(float transistor_size, float power) {
+void PowerCallibInputs::add_size(float transistor_size, float power, float factor) {
     PowerCallibSize* entry = new PowerCallibSize(transistor_size, power);
+    entry->factor = factor;
     entries.push_back(entry);
     sorted = false;
 }
@@ -55,6 +56,12 @@ void PowerCallibInputs::callibrate() {
         (*it)->factor = (*it)->power / est_power;
     }
 
+    set_callibrated();
+}
+
+void PowerCallibInputs::set_callibrated() {
+    VTR_ASSERT(entries.size() >= 2);
+
     /* Set min-value placeholder */
     entries[0]->factor = entries[1]->factor;
 
@@ -149,10 +156,10 @@ PowerCallibInputs* PowerSpicedComponent::get_entry_bound(bool lower,
     return nullptr;
 }
 
-void PowerSpicedComponent::add_data_point(int num_inputs, float transistor_size, float power) {
+void PowerSpicedComponent::add_data_point(int num_inputs, float transistor_size, float power, float factor) {
     VTR_ASSERT(!done_callibration);
     PowerCallibInputs* inputs_entry = get_entry(num_inputs);
-    inputs_entry->add_size(transistor_size, power);
+    inputs_entry->add_size(transistor_size, power, factor);
     sorted = false;
 }
 
@@ -245,6 +252,16 @@ void PowerSpicedComponent::callibrate() {
     done_callibration = true;
 }
 
+void PowerSpicedComponent::set_callibrated() {
+    sort_me();
+
+    for (std::vector<PowerCallibInputs*>::iterator it = entries.begin();
+         it != entries.end(); it++) {
+        (*it)->set_callibrated();
+    }
+    done_callibration = true;
+}
+
 bool PowerSpicedComponent::is_done_callibration() {
     return done_callibration;
 }
@@ -50,11 +50,12 @@ class PowerCallibInputs {
     PowerCallibInputs(PowerSpicedComponent* parent, float num_inputs);
     ~PowerCallibInputs();
 
-    void add_size(float transistor_size, float power = 0.);
+    void add_size(float transistor_size, float power = 0., float factor = 0.);
     PowerCallibSize* get_entry_bound(bool lower, float transistor_size);
     void sort_me();
     bool done_callibration;
     void callibrate();
+    void set_callibrated();
 };
 
 class PowerSpicedComponent {
@@ -76,12 +77,15 @@ class PowerSpicedComponent {
                          float (*usage_fn)(int num_inputs, float transistor_size));
     ~PowerSpicedComponent();
 
-    void add_data_point(int num_inputs, float transistor_size, float power);
+    void add_data_point(int num_inputs, float transistor_size, float power, float factor = 0.);
     float scale_factor(int num_inputs, float transistor_size);
     void sort_me();
 
     //	void update_scale_factor(float (*fn)(float size));
     void callibrate();
+    /* Marks the component callibrated with the factors given to add_data_point(),
+     * e.g. when loaded from a power characterization file */
+    void set_callibrated();
     bool is_done_callibration();
     void print(FILE* fp);
 };
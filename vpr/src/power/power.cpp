@@ -41,16 +41,24 @@
 #include "power_sizing.h"
 #include "power_callibrate.h"
 #include "power_cmos_tech.h"
+#include "power_characterization.h"
 
 #include "physical_types.h"
 #include "globals.h"
 #include "rr_graph.h"
 #include "vpr_utils.h"
 
+#if defined(VPR_USE_TBB)
+#    include <tbb/parallel_for.h>
+#endif
+
 /************************* DEFINES **********************************/
 #define CONVERT_NM_PER_M 1000000000
 #define CONVERT_UM_PER_M 1000000
 
+/* Number of rr nodes in each unit of work of the (parallel) routing power estimation */
+#define POWER_RR_NODES_PER_UNIT 4096
+
 /************************* ENUMS ************************************/
 typedef enum {
     POWER_BREAKDOWN_ENTRY_TYPE_TITLE = 0,
@@ -61,6 +69,15 @@ typedef enum {
     POWER_BREAKDOWN_ENTRY_TYPE_BUFS_WIRES
 } e_power_breakdown_entry_type;
 
+/************************* STRUCTS **********************************/
+/* Switch-box and connection-box buffer statistics (see t_power_commonly_used) */
+struct t_power_routing_buffers {
+    int num_sb_buffers = 0;
+    float total_sb_buffer_size = 0.;
+    int num_cb_buffers = 0;
+    float total_cb_buffer_size = 0.;
+};
+
 /************************* File Scope **********************************/
 static t_rr_node_power* rr_node_power;
 
@@ -69,9 +86,15 @@ static t_rr_node_power* rr_node_power;
 static void power_usage_routing(t_power_usage* power_usage,
                                 const t_det_routing_arch* routing_arch,
                                 const std::vector<t_segment_inf>& segment_inf);
+static void power_usage_routing_node(t_power_usage* power_usage,
+                                     t_power_routing_buffers* buffers,
+                                     size_t rr_node_idx,
+                                     const t_det_routing_arch* routing_arch,
+                                     const std::vector<t_segment_inf>& segment_inf);
 
 /* Tiles */
 static void power_usage_blocks(t_power_usage* power_usage);
+static void power_usage_blocks_column(t_power_usage* power_usage, size_t x);
 static void power_usage_pb(t_power_usage* power_usage, t_pb* pb, t_pb_graph_node* pb_node, ClusterBlockId iblk);
 static void power_usage_primitive(t_power_usage* power_usage, t_pb* pb, t_pb_graph_node* pb_graph_node, ClusterBlockId iblk);
 static void power_reset_tile_usage();
@@ -87,6 +110,12 @@ static void power_usage_clock(t_power_usage* power_usage,
 static void power_usage_clock_single(t_power_usage* power_usage,
                                      t_clock_network* clock_inf);
 
+/* Parallel evaluation */
+template<typename F>
+static std::vector<t_power_partial> power_usage_parallel(size_t num_units, F eval_unit);
+static void power_init_mux_archs();
+static int power_max_interc_mux_size(const t_pb_type* pb_type);
+
 /* Init/Uninit */
 static void dealloc_mux_graph(t_mux_node* node);
 static void dealloc_mux_graph_rec(t_mux_node* node);
@@ -487,8 +516,8 @@ static void power_usage_pb(t_power_usage* power_usage, t_pb* pb, t_pb_graph_node
                                                 pb_node, iblk);
             power_component_add_usage(&power_usage_bufs_wires,
                                       POWER_COMPONENT_PB_BUFS_WIRE);
-            power_add_usage(&pb_node->pb_type->pb_type_power->power_usage_bufs_wires,
-                            &power_usage_bufs_wires);
+            power_add_shared_usage(&pb_node->pb_type->pb_type_power->power_usage_bufs_wires,
+                                   &power_usage_bufs_wires);
             power_add_usage(power_usage, &power_usage_bufs_wires);
         }
 
@@ -510,8 +539,8 @@ static void power_usage_pb(t_power_usage* power_usage, t_pb* pb, t_pb_graph_node
                                       POWER_COMPONENT_PB_INTERC_MUXES);
 
             // Add to power of this mode
-            power_add_usage(&pb_node->pb_type->modes[pb_mode].mode_power->power_usage,
-                            &power_usage_local_muxes);
+            power_add_shared_usage(&pb_node->pb_type->modes[pb_mode].mode_power->power_usage,
+                                   &power_usage_local_muxes);
         }
 
         /* Add power for children */
@@ -543,12 +572,79 @@ static void power_usage_pb(t_power_usage* power_usage, t_pb* pb, t_pb_graph_node
             power_add_usage(power_usage, &power_usage_children);
 
             // Add to power of this mode
-            power_add_usage(&pb_node->pb_type->modes[pb_mode].mode_power->power_usage,
-                            &power_usage_children);
+            power_add_shared_usage(&pb_node->pb_type->modes[pb_mode].mode_power->power_usage,
+                                   &power_usage_children);
+        }
+    }
+
+    power_add_shared_usage(&pb_node->pb_type->pb_type_power->power_usage, power_usage);
+}
+
+/**
+ * Evaluates num_units independent units of work, in parallel when built with TBB.
+ * eval_unit(iunit, partial) is called for each unit, with the component and shared
+ * (per pb_type etc.) usages of the unit accumulating in partial.  The partials are
+ * returned in unit order, so the caller can reduce them deterministically.
+ */
+template<typename F>
+static std::vector<t_power_partial> power_usage_parallel(size_t num_units, F eval_unit) {
+    std::vector<t_power_partial> partials(num_units);
+
+    auto eval = [&](size_t iunit) {
+        power_set_thread_partial(&partials[iunit]);
+        eval_unit(iunit, partials[iunit]);
+        power_set_thread_partial(nullptr);
+    };
+
+#if defined(VPR_USE_TBB)
+    tbb::parallel_for(size_t(0), num_units, eval);
+#else
+    for (size_t iunit = 0; iunit < num_units; iunit++) {
+        eval(iunit);
+    }
+#endif
+
+    return partials;
+}
+
+/**
+ * Creates the multiplexer architectures of all sizes used by routing and local
+ * interconnect.  power_get_mux_arch() creates them on demand, which is not safe
+ * to do during parallel evaluation.
+ */
+static void power_init_mux_archs() {
+    auto& power_ctx = g_vpr_ctx.power();
+    auto& device_ctx = g_vpr_ctx.device();
+
+    int max_mux_size = power_ctx.commonly_used->max_routing_mux_size;
+    for (const auto& type : device_ctx.logical_block_types) {
+        if (type.pb_type) {
+            max_mux_size = std::max(max_mux_size, power_max_interc_mux_size(type.pb_type));
+        }
+    }
+
+    power_get_mux_arch(max_mux_size, power_ctx.arch->mux_transistor_size);
+}
+
+/* Returns the largest local interconnect multiplexer of a pb_type and its children */
+static int power_max_interc_mux_size(const t_pb_type* pb_type) {
+    int max_mux_size = 0;
+
+    for (int mode_idx = 0; mode_idx < pb_type->num_modes; mode_idx++) {
+        const t_mode* mode = &pb_type->modes[mode_idx];
+
+        for (int interc_idx = 0; interc_idx < mode->num_interconnect; interc_idx++) {
+            const t_interconnect_power* interc_power = mode->interconnect[interc_idx].interconnect_power;
+            if (interc_power) {
+                max_mux_size = std::max(max_mux_size, interc_power->num_input_ports);
+            }
+        }
+        for (int child_idx = 0; child_idx < mode->num_pb_type_children; child_idx++) {
+            max_mux_size = std::max(max_mux_size, power_max_interc_mux_size(&mode->pb_type_children[child_idx]));
         }
     }
 
-    power_add_usage(&pb_node->pb_type->pb_type_power->power_usage, power_usage);
+    return max_mux_size;
 }
 
 /* Resets the power stats for all physical blocks */
@@ -594,46 +690,62 @@ static void power_reset_tile_usage() {
  */
 static void power_usage_blocks(t_power_usage* power_usage) {
     auto& device_ctx = g_vpr_ctx.device();
-    auto& cluster_ctx = g_vpr_ctx.clustering();
-    auto& place_ctx = g_vpr_ctx.placement();
 
     power_zero_usage(power_usage);
 
     power_reset_tile_usage();
 
-    t_logical_block_type_ptr logical_block;
+    /* Each column of the grid is a unit of work */
+    std::vector<t_power_partial> partials = power_usage_parallel(device_ctx.grid.width(),
+                                                                 [](size_t x, t_power_partial& partial) {
+                                                                     power_usage_blocks_column(&partial.total, x);
+                                                                 });
 
-    /* Loop through all grid locations */
-    for (size_t x = 0; x < device_ctx.grid.width(); x++) {
-        for (size_t y = 0; y < device_ctx.grid.height(); y++) {
-            auto physical_tile = device_ctx.grid[x][y].type;
+    for (const t_power_partial& partial : partials) {
+        power_add_usage(power_usage, &partial.total);
+        power_reduce_partial(&partial);
+    }
+}
 
-            if ((device_ctx.grid[x][y].width_offset != 0)
-                || (device_ctx.grid[x][y].height_offset != 0)
-                || is_empty_type(physical_tile)) {
-                continue;
-            }
+/*
+ * Calculates the power usage of the tiles in column x of the FPGA
+ */
+static void power_usage_blocks_column(t_power_usage* power_usage, size_t x) {
+    auto& device_ctx = g_vpr_ctx.device();
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+    auto& place_ctx = g_vpr_ctx.placement();
 
-            for (int z = 0; z < physical_tile->capacity; z++) {
-                t_pb* pb = nullptr;
-                t_power_usage pb_power;
+    power_zero_usage(power_usage);
 
-                ClusterBlockId iblk = place_ctx.grid_blocks[x][y].blocks[z];
+    t_logical_block_type_ptr logical_block;
 
-                if (iblk != EMPTY_BLOCK_ID && iblk != INVALID_BLOCK_ID) {
-                    pb = cluster_ctx.clb_nlist.block_pb(iblk);
-                    logical_block = cluster_ctx.clb_nlist.block_type(iblk);
-                } else {
-                    logical_block = pick_best_logical_type(physical_tile);
-                }
+    for (size_t y = 0; y < device_ctx.grid.height(); y++) {
+        auto physical_tile = device_ctx.grid[x][y].type;
+
+        if ((device_ctx.grid[x][y].width_offset != 0)
+            || (device_ctx.grid[x][y].height_offset != 0)
+            || is_empty_type(physical_tile)) {
+            continue;
+        }
+
+        for (int z = 0; z < physical_tile->capacity; z++) {
+            t_pb* pb = nullptr;
+            t_power_usage pb_power;
 
-                /* Calculate power of this CLB */
-                power_usage_pb(&pb_power, pb, logical_block->pb_graph_head, iblk);
-                power_add_usage(power_usage, &pb_power);
+            ClusterBlockId iblk = place_ctx.grid_blocks[x][y].blocks[z];
+
+            if (iblk != EMPTY_BLOCK_ID && iblk != INVALID_BLOCK_ID) {
+                pb = cluster_ctx.clb_nlist.block_pb(iblk);
+                logical_block = cluster_ctx.clb_nlist.block_type(iblk);
+            } else {
+                logical_block = pick_best_logical_type(physical_tile);
             }
+
+            /* Calculate power of this CLB */
+            power_usage_pb(&pb_power, pb, logical_block->pb_graph_head, iblk);
+            power_add_usage(power_usage, &pb_power);
         }
     }
-    return;
 }
 
 /**
@@ -854,174 +966,211 @@ static void power_usage_routing(t_power_usage* power_usage,
         }
     }
 
-    /* Calculate power of all routing entities */
-    for (size_t rr_node_idx = 0; rr_node_idx < device_ctx.rr_nodes.size(); rr_node_idx++) {
-        t_power_usage sub_power_usage;
-        auto node = &device_ctx.rr_nodes[rr_node_idx];
-        t_rr_node_power* node_power = &rr_node_power[rr_node_idx];
-        float C_wire;
-        float buffer_size;
-        int connectionbox_fanout;
-        int switchbox_fanout;
-        //float C_per_seg_split;
-        int wire_length;
+    /* Calculate power of all routing entities, with each range of
+     * POWER_RR_NODES_PER_UNIT rr nodes as a unit of work */
+    size_t num_rr_nodes = device_ctx.rr_nodes.size();
+    size_t num_units = (num_rr_nodes + POWER_RR_NODES_PER_UNIT - 1) / POWER_RR_NODES_PER_UNIT;
+    std::vector<t_power_routing_buffers> unit_buffers(num_units);
+
+    std::vector<t_power_partial> partials = power_usage_parallel(num_units, [&](size_t iunit, t_power_partial& partial) {
+        size_t end_idx = std::min(num_rr_nodes, (iunit + 1) * POWER_RR_NODES_PER_UNIT);
+        for (size_t rr_node_idx = iunit * POWER_RR_NODES_PER_UNIT; rr_node_idx < end_idx; rr_node_idx++) {
+            t_power_usage node_power_usage;
+            power_usage_routing_node(&node_power_usage, &unit_buffers[iunit], rr_node_idx, routing_arch, segment_inf);
+            power_add_usage(&partial.total, &node_power_usage);
+        }
+    });
 
-        switch (node->type()) {
-            case SOURCE:
-            case SINK:
-            case OPIN:
-                /* No power usage for these types */
-                break;
-            case IPIN:
-                /* This is part of the connectionbox.  The connection box is comprised of:
-                 *  - Driver (accounted for at end of CHANX/Y - see below)
-                 *  - Multiplexor */
+    for (size_t iunit = 0; iunit < num_units; iunit++) {
+        power_add_usage(power_usage, &partials[iunit].total);
+        power_reduce_partial(&partials[iunit]);
 
-                if (node->fan_in()) {
-                    VTR_ASSERT(node_power->in_dens);
-                    VTR_ASSERT(node_power->in_prob);
-
-                    /* Multiplexor */
-                    power_usage_mux_multilevel(&sub_power_usage,
-                                               power_get_mux_arch(node->fan_in(),
-                                                                  power_ctx.arch->mux_transistor_size),
-                                               node_power->in_prob, node_power->in_dens,
-                                               node_power->selected_input, true,
-                                               power_ctx.solution_inf.T_crit);
-                    power_add_usage(power_usage, &sub_power_usage);
-                    power_component_add_usage(&sub_power_usage,
-                                              POWER_COMPONENT_ROUTE_CB);
-                }
-                break;
-            case CHANX:
-            case CHANY:
-                /* This is a wire driven by a switchbox, which includes:
-                 * 	- The Multiplexor at the beginning of the wire
-                 * 	- A buffer, after the mux to drive the wire
-                 * 	- The wire itself
-                 * 	- A buffer at the end of the wire, going to switchbox/connectionbox */
+        power_ctx.commonly_used->num_sb_buffers += unit_buffers[iunit].num_sb_buffers;
+        power_ctx.commonly_used->total_sb_buffer_size += unit_buffers[iunit].total_sb_buffer_size;
+        power_ctx.commonly_used->num_cb_buffers += unit_buffers[iunit].num_cb_buffers;
+        power_ctx.commonly_used->total_cb_buffer_size += unit_buffers[iunit].total_cb_buffer_size;
+    }
+}
+
+/**
+ * Calculates the power of a single routing resource
+ * - power_usage: (Return value) Power usage of the rr node
+ * - buffers: Switch/connection box buffer statistics, incremented by the buffers of the rr node
+ */
+static void power_usage_routing_node(t_power_usage* power_usage,
+                                     t_power_routing_buffers* buffers,
+                                     size_t rr_node_idx,
+                                     const t_det_routing_arch* routing_arch,
+                                     const std::vector<t_segment_inf>& segment_inf) {
+    t_power_usage sub_power_usage;
+    auto& power_ctx = g_vpr_ctx.power();
+    auto& device_ctx = g_vpr_ctx.device();
+    auto node = &device_ctx.rr_nodes[rr_node_idx];
+    t_rr_node_power* node_power = &rr_node_power[rr_node_idx];
+    float C_wire;
+    float buffer_size;
+    int connectionbox_fanout;
+    int switchbox_fanout;
+    //float C_per_seg_split;
+    int wire_length;
+
+    power_zero_usage(power_usage);
+
+    switch (node->type()) {
+        case SOURCE:
+        case SINK:
+        case OPIN:
+            /* No power usage for these types */
+            break;
+        case IPIN:
+            /* This is part of the connectionbox.  The connection box is comprised of:
+             *  - Driver (accounted for at end of CHANX/Y - see below)
+             *  - Multiplexor */
+
+            if (node->fan_in()) {
                 VTR_ASSERT(node_power->in_dens);
                 VTR_ASSERT(node_power->in_prob);
 
-                wire_length = 0;
-                if (node->type() == CHANX) {
-                    wire_length = node->xhigh() - node->xlow() + 1;
-                } else if (node->type() == CHANY) {
-                    wire_length = node->yhigh() - node->ylow() + 1;
-                }
-                C_wire = wire_length
-                         * segment_inf[device_ctx.rr_indexed_data[node->cost_index()].seg_index].Cmetal;
-                //(double)power_ctx.commonly_used->tile_length);
-                VTR_ASSERT(node_power->selected_input < node->fan_in());
-
                 /* Multiplexor */
                 power_usage_mux_multilevel(&sub_power_usage,
                                            power_get_mux_arch(node->fan_in(),
                                                               power_ctx.arch->mux_transistor_size),
                                            node_power->in_prob, node_power->in_dens,
-                                           node_power->selected_input, true, power_ctx.solution_inf.T_crit);
+                                           node_power->selected_input, true,
+                                           power_ctx.solution_inf.T_crit);
                 power_add_usage(power_usage, &sub_power_usage);
                 power_component_add_usage(&sub_power_usage,
-                                          POWER_COMPONENT_ROUTE_SB);
+                                          POWER_COMPONENT_ROUTE_CB);
+            }
+            break;
+        case CHANX:
+        case CHANY:
+            /* This is a wire driven by a switchbox, which includes:
+             * 	- The Multiplexor at the beginning of the wire
+             * 	- A buffer, after the mux to drive the wire
+             * 	- The wire itself
+             * 	- A buffer at the end of the wire, going to switchbox/connectionbox */
+            VTR_ASSERT(node_power->in_dens);
+            VTR_ASSERT(node_power->in_prob);
+
+            wire_length = 0;
+            if (node->type() == CHANX) {
+                wire_length = node->xhigh() - node->xlow() + 1;
+            } else if (node->type() == CHANY) {
+                wire_length = node->yhigh() - node->ylow() + 1;
+            }
+            C_wire = wire_length
+                     * segment_inf[device_ctx.rr_indexed_data[node->cost_index()].seg_index].Cmetal;
+            //(double)power_ctx.commonly_used->tile_length);
+            VTR_ASSERT(node_power->selected_input < node->fan_in());
+
+            /* Multiplexor */
+            power_usage_mux_multilevel(&sub_power_usage,
+                                       power_get_mux_arch(node->fan_in(),
+                                                          power_ctx.arch->mux_transistor_size),
+                                       node_power->in_prob, node_power->in_dens,
+                                       node_power->selected_input, true, power_ctx.solution_inf.T_crit);
+            power_add_usage(power_usage, &sub_power_usage);
+            power_component_add_usage(&sub_power_usage,
+                                      POWER_COMPONENT_ROUTE_SB);
+
+            /* Buffer Size */
+            switch (device_ctx.rr_switch_inf[node_power->driver_switch_type].power_buffer_type) {
+                case POWER_BUFFER_TYPE_AUTO:
+                    /*
+                     * C_per_seg_split = ((float) node->num_edges
+                     * power_ctx.commonly_used->INV_1X_C_in + C_wire);
+                     * // / (float) power_ctx.arch->seg_buffer_split;
+                     * buffer_size = power_buffer_size_from_logical_effort(
+                     * C_per_seg_split);
+                     * buffer_size = std::max(buffer_size, 1.0F);
+                     */
+                    buffer_size = power_calc_buffer_size_from_Cout(device_ctx.rr_switch_inf[node_power->driver_switch_type].Cout);
+                    break;
+                case POWER_BUFFER_TYPE_ABSOLUTE_SIZE:
+                    buffer_size = device_ctx.rr_switch_inf[node_power->driver_switch_type].power_buffer_size;
+                    buffer_size = std::max(buffer_size, 1.0F);
+                    break;
+                case POWER_BUFFER_TYPE_NONE:
+                    buffer_size = 0.;
+                    break;
+                default:
+                    buffer_size = 0.;
+                    VTR_ASSERT(0);
+                    break;
+            }
 
-                /* Buffer Size */
-                switch (device_ctx.rr_switch_inf[node_power->driver_switch_type].power_buffer_type) {
-                    case POWER_BUFFER_TYPE_AUTO:
-                        /*
-                         * C_per_seg_split = ((float) node->num_edges
-                         * power_ctx.commonly_used->INV_1X_C_in + C_wire);
-                         * // / (float) power_ctx.arch->seg_buffer_split;
-                         * buffer_size = power_buffer_size_from_logical_effort(
-                         * C_per_seg_split);
-                         * buffer_size = std::max(buffer_size, 1.0F);
-                         */
-                        buffer_size = power_calc_buffer_size_from_Cout(device_ctx.rr_switch_inf[node_power->driver_switch_type].Cout);
-                        break;
-                    case POWER_BUFFER_TYPE_ABSOLUTE_SIZE:
-                        buffer_size = device_ctx.rr_switch_inf[node_power->driver_switch_type].power_buffer_size;
-                        buffer_size = std::max(buffer_size, 1.0F);
-                        break;
-                    case POWER_BUFFER_TYPE_NONE:
-                        buffer_size = 0.;
-                        break;
-                    default:
-                        buffer_size = 0.;
-                        VTR_ASSERT(0);
-                        break;
-                }
+            buffers->num_sb_buffers++;
+            buffers->total_sb_buffer_size += buffer_size;
 
-                power_ctx.commonly_used->num_sb_buffers++;
-                power_ctx.commonly_used->total_sb_buffer_size += buffer_size;
+            /*
+             * power_ctx.commonly_used->num_sb_buffers +=
+             * power_ctx.arch->seg_buffer_split;
+             * power_ctx.commonly_used->total_sb_buffer_size += buffer_size
+             * power_ctx.arch->seg_buffer_split;
+             */
 
-                /*
-                 * power_ctx.commonly_used->num_sb_buffers +=
-                 * power_ctx.arch->seg_buffer_split;
-                 * power_ctx.commonly_used->total_sb_buffer_size += buffer_size
-                 * power_ctx.arch->seg_buffer_split;
-                 */
+            /* Buffer */
+            power_usage_buffer(&sub_power_usage, buffer_size,
+                               node_power->in_prob[node_power->selected_input],
+                               node_power->in_dens[node_power->selected_input], true,
+                               power_ctx.solution_inf.T_crit);
+            power_add_usage(power_usage, &sub_power_usage);
+            power_component_add_usage(&sub_power_usage,
+                                      POWER_COMPONENT_ROUTE_SB);
+
+            /* Wire Capacitance */
+            power_usage_wire(&sub_power_usage, C_wire,
+                             clb_net_density(node_power->net_num), power_ctx.solution_inf.T_crit);
+            power_add_usage(power_usage, &sub_power_usage);
+            power_component_add_usage(&sub_power_usage,
+                                      POWER_COMPONENT_ROUTE_GLB_WIRE);
+
+            /* Determine types of switches that this wire drives */
+            connectionbox_fanout = 0;
+            switchbox_fanout = 0;
+            for (t_edge_size iedge = 0; iedge < node->num_edges(); iedge++) {
+                if (node->edge_switch(iedge) == routing_arch->wire_to_rr_ipin_switch) {
+                    connectionbox_fanout++;
+                } else if (node->edge_switch(iedge) == routing_arch->delayless_switch) {
+                    /* Do nothing */
+                } else {
+                    switchbox_fanout++;
+                }
+            }
 
-                /* Buffer */
+            /* Buffer to next Switchbox */
+            if (switchbox_fanout) {
+                buffer_size = power_buffer_size_from_logical_effort(switchbox_fanout * power_ctx.commonly_used->NMOS_1X_C_d);
                 power_usage_buffer(&sub_power_usage, buffer_size,
-                                   node_power->in_prob[node_power->selected_input],
-                                   node_power->in_dens[node_power->selected_input], true,
+                                   1 - node_power->in_prob[node_power->selected_input],
+                                   node_power->in_dens[node_power->selected_input], false,
                                    power_ctx.solution_inf.T_crit);
                 power_add_usage(power_usage, &sub_power_usage);
                 power_component_add_usage(&sub_power_usage,
                                           POWER_COMPONENT_ROUTE_SB);
+            }
+
+            /* Driver for ConnectionBox */
+            if (connectionbox_fanout) {
+                buffer_size = power_buffer_size_from_logical_effort(connectionbox_fanout * power_ctx.commonly_used->NMOS_1X_C_d);
 
-                /* Wire Capacitance */
-                power_usage_wire(&sub_power_usage, C_wire,
-                                 clb_net_density(node_power->net_num), power_ctx.solution_inf.T_crit);
+                power_usage_buffer(&sub_power_usage, buffer_size,
+                                   1 - node_power->in_prob[node_power->selected_input],
+                                   node_power->in_dens[node_power->selected_input],
+                                   false, power_ctx.solution_inf.T_crit);
                 power_add_usage(power_usage, &sub_power_usage);
                 power_component_add_usage(&sub_power_usage,
-                                          POWER_COMPONENT_ROUTE_GLB_WIRE);
-
-                /* Determine types of switches that this wire drives */
-                connectionbox_fanout = 0;
-                switchbox_fanout = 0;
-                for (t_edge_size iedge = 0; iedge < node->num_edges(); iedge++) {
-                    if (node->edge_switch(iedge) == routing_arch->wire_to_rr_ipin_switch) {
-                        connectionbox_fanout++;
-                    } else if (node->edge_switch(iedge) == routing_arch->delayless_switch) {
-                        /* Do nothing */
-                    } else {
-                        switchbox_fanout++;
-                    }
-                }
-
-                /* Buffer to next Switchbox */
-                if (switchbox_fanout) {
-                    buffer_size = power_buffer_size_from_logical_effort(switchbox_fanout * power_ctx.commonly_used->NMOS_1X_C_d);
-                    power_usage_buffer(&sub_power_usage, buffer_size,
-                                       1 - node_power->in_prob[node_power->selected_input],
-                                       node_power->in_dens[node_power->selected_input], false,
-                                       power_ctx.solution_inf.T_crit);
-                    power_add_usage(power_usage, &sub_power_usage);
-                    power_component_add_usage(&sub_power_usage,
-                                              POWER_COMPONENT_ROUTE_SB);
-                }
-
-                /* Driver for ConnectionBox */
-                if (connectionbox_fanout) {
-                    buffer_size = power_buffer_size_from_logical_effort(connectionbox_fanout * power_ctx.commonly_used->NMOS_1X_C_d);
+                                          POWER_COMPONENT_ROUTE_CB);
 
-                    power_usage_buffer(&sub_power_usage, buffer_size,
-                                       1 - node_power->in_prob[node_power->selected_input],
-                                       node_power->in_dens[node_power->selected_input],
-                                       false, power_ctx.solution_inf.T_crit);
-                    power_add_usage(power_usage, &sub_power_usage);
-                    power_component_add_usage(&sub_power_usage,
-                                              POWER_COMPONENT_ROUTE_CB);
-
-                    power_ctx.commonly_used->num_cb_buffers++;
-                    power_ctx.commonly_used->total_cb_buffer_size += buffer_size;
-                }
-                break;
-            default:
-                power_log_msg(POWER_LOG_WARNING,
-                              "The global routing-resource graph contains an unknown node type.");
-                break;
-        }
+                buffers->num_cb_buffers++;
+                buffers->total_cb_buffer_size += buffer_size;
+            }
+            break;
+        default:
+            power_log_msg(POWER_LOG_WARNING,
+                          "The global routing-resource graph contains an unknown node type.");
+            break;
     }
 }
 
@@ -1293,7 +1442,8 @@ void power_routing_init(const t_det_routing_arch* routing_arch) {
 bool power_init(const char* power_out_filepath,
                 const char* cmos_tech_behavior_filepath,
                 const t_arch* arch,
-                const t_det_routing_arch* routing_arch) {
+                const t_det_routing_arch* routing_arch,
+                const t_power_opts& power_opts) {
     auto& power_ctx = g_vpr_ctx.mutable_power();
     bool error = false;
 
@@ -1319,8 +1469,17 @@ bool power_init(const char* power_out_filepath,
         }
     }
 
+    /* Load technology properties and callibration, if previously characterized */
+    bool characterization_read = false;
+    if (!power_opts.read_power_characterization.empty()) {
+        characterization_read = power_read_characterization(power_opts.read_power_characterization,
+                                                            cmos_tech_behavior_filepath, arch);
+    }
+
     /* Load technology properties */
-    power_tech_init(cmos_tech_behavior_filepath);
+    if (!characterization_read) {
+        power_tech_init(cmos_tech_behavior_filepath);
+    }
 
     /* Low-Level Initialization */
     power_lowlevel_init();
@@ -1329,7 +1488,14 @@ bool power_init(const char* power_out_filepath,
     power_components_init();
 
     /* Perform callibration */
-    power_callibrate();
+    if (!characterization_read) {
+        power_callibrate();
+    }
+
+    if (!power_opts.write_power_characterization.empty()) {
+        power_write_characterization(power_opts.write_power_characterization,
+                                     cmos_tech_behavior_filepath, arch);
+    }
 
     /* Initialize routing information */
     power_routing_init(routing_arch);
@@ -1727,6 +1893,8 @@ e_power_ret_code power_total(float* run_time_s, const t_vpr_setup& vpr_setup, co
         return POWER_RET_CODE_ERRORS;
     }
 
+    power_init_mux_archs();
+
     /* Calculate Power */
     /* Routing */
     power_usage_routing(&sub_power_usage, routing_arch, arch->Segments);
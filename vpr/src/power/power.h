@@ -307,7 +307,8 @@ struct t_mux_node {
 bool power_init(const char* power_out_filepath,
                 const char* cmos_tech_behavior_filepath,
                 const t_arch* arch,
-                const t_det_routing_arch* routing_arch);
+                const t_det_routing_arch* routing_arch,
+                const t_power_opts& power_opts);
 
 bool power_uninit();
 
@@ -0,0 +1,330 @@
+/**
+ * This file provides functions to save and load the power characterization.
+ * See power_characterization.capnp for the file format.
+ */
+
+/************************* INCLUDES *********************************/
+#include <sstream>
+
+#include "vtr_assert.h"
+#include "vtr_digest.h"
+#include "vtr_log.h"
+#include "vtr_memory.h"
+#include "vtr_time.h"
+#include "vtr_util.h"
+
+#include "vpr_error.h"
+#include "globals.h"
+#include "power.h"
+#include "power_callibrate.h"
+#include "power_characterization.h"
+#include "PowerSpicedComponent.h"
+
+#ifdef VTR_ENABLE_CAPNPROTO
+#    include "capnp/serialize.h"
+#    include "power_characterization.capnp.h"
+#    include "mmap_file.h"
+#    include "serdes_utils.h"
+#endif
+
+// When writing capnp targetted serialization, always allow compilation when
+// VTR_ENABLE_CAPNPROTO=OFF.  Generally this means throwing an exception
+// instead.
+//
+#ifndef VTR_ENABLE_CAPNPROTO
+
+#    define DISABLE_ERROR                               \
+        "is disable because VTR_ENABLE_CAPNPROTO=OFF." \
+        "Re-compile with CMake option VTR_ENABLE_CAPNPROTO=ON to enable."
+
+bool power_read_characterization(const std::string& /*file*/,
+                                 const char* /*cmos_tech_behavior_filepath*/,
+                                 const t_arch* /*arch*/) {
+    VPR_THROW(VPR_ERROR_POWER, "power_read_characterization " DISABLE_ERROR);
+}
+
+void power_write_characterization(const std::string& /*file*/,
+                                  const char* /*cmos_tech_behavior_filepath*/,
+                                  const t_arch* /*arch*/) {
+    VPR_THROW(VPR_ERROR_POWER, "power_write_characterization " DISABLE_ERROR);
+}
+
+#else /* VTR_ENABLE_CAPNPROTO */
+
+/************************* FILE SCOPE *******************************/
+
+/* The estimation function of each callibrated component [0..POWER_CALLIB_COMPONENT_MAX-1] */
+static float (*const f_callib_usage_fns[POWER_CALLIB_COMPONENT_MAX])(int num_inputs, float transistor_size) = {
+    power_usage_buf_for_callibration,      /* POWER_CALLIB_COMPONENT_BUFFER */
+    power_usage_buf_levr_for_callibration, /* POWER_CALLIB_COMPONENT_BUFFER_WITH_LEVR */
+    power_usage_ff_for_callibration,       /* POWER_CALLIB_COMPONENT_FF */
+    power_usage_mux_for_callibration,      /* POWER_CALLIB_COMPONENT_MUX */
+    power_usage_lut_for_callibration,      /* POWER_CALLIB_COMPONENT_LUT */
+};
+
+/************************* FUNCTION DECLARATIONS ********************/
+static std::string power_characterization_digest(const char* cmos_tech_behavior_filepath, const t_arch* arch);
+static bool power_load_characterization(const VprPowerCharacterization::Reader& characterization,
+                                        const std::string& file,
+                                        const char* cmos_tech_behavior_filepath,
+                                        const t_arch* arch);
+static void ToTransistorSize(t_transistor_size_inf* out, const CharTransistorSize::Reader& in);
+static void FromTransistorSize(CharTransistorSize::Builder out, const t_transistor_size_inf& in);
+static void ToTransistor(t_transistor_inf* out, const CharTransistor::Reader& in);
+static void FromTransistor(CharTransistor::Builder out, const t_transistor_inf& in);
+
+/************************* FUNCTION DEFINITIONS *********************/
+
+/* Returns a digest identifying the technology properties and architecture
+ * (everything the characterization is computed from) */
+static std::string power_characterization_digest(const char* cmos_tech_behavior_filepath, const t_arch* arch) {
+    std::stringstream key;
+    key << "tech: " << vtr::secure_digest_file(cmos_tech_behavior_filepath) << "\n";
+    key << "arch: " << ((arch && arch->architecture_id) ? arch->architecture_id : "") << "\n";
+
+    return vtr::secure_digest_stream(key);
+}
+
+static void ToTransistorSize(t_transistor_size_inf* out, const CharTransistorSize::Reader& in) {
+    out->size = in.getSize();
+    out->leakage_subthreshold = in.getLeakageSubthreshold();
+    out->leakage_gate = in.getLeakageGate();
+    out->C_g = in.getCG();
+    out->C_s = in.getCS();
+    out->C_d = in.getCD();
+}
+
+static void FromTransistorSize(CharTransistorSize::Builder out, const t_transistor_size_inf& in) {
+    out.setSize(in.size);
+    out.setLeakageSubthreshold(in.leakage_subthreshold);
+    out.setLeakageGate(in.leakage_gate);
+    out.setCG(in.C_g);
+    out.setCS(in.C_s);
+    out.setCD(in.C_d);
+}
+
+static void ToTransistor(t_transistor_inf* out, const CharTransistor::Reader& in) {
+    out->long_trans_inf = (t_transistor_size_inf*)vtr::malloc(sizeof(t_transistor_size_inf));
+    ToTransistorSize(out->long_trans_inf, in.getLongSize());
+
+    auto sizes = in.getSizes();
+    out->num_size_entries = sizes.size();
+    out->size_inf = (t_transistor_size_inf*)vtr::calloc(sizes.size(), sizeof(t_transistor_size_inf));
+    for (size_t i = 0; i < sizes.size(); i++) {
+        ToTransistorSize(&out->size_inf[i], sizes[i]);
+    }
+}
+
+static void FromTransistor(CharTransistor::Builder out, const t_transistor_inf& in) {
+    FromTransistorSize(out.initLongSize(), *in.long_trans_inf);
+
+    auto sizes = out.initSizes(in.num_size_entries);
+    for (int i = 0; i < in.num_size_entries; i++) {
+        FromTransistorSize(sizes[i], in.size_inf[i]);
+    }
+}
+
+bool power_read_characterization(const std::string& file,
+                                 const char* cmos_tech_behavior_filepath,
+                                 const t_arch* arch) {
+    if (!vtr::file_exists(file.c_str())) {
+        VTR_LOG("Power characterization file '%s' does not exist\n", file.c_str());
+        return false;
+    }
+
+    vtr::ScopedStartFinishTimer timer("Loading power characterization");
+
+    //capnp only validates the message as it is read, reporting truncated or
+    //corrupt files (or files which are not capnp messages at all) by throwing
+    try {
+        MmapFile f(file);
+        ::capnp::FlatArrayMessageReader reader(f.getData());
+
+        return power_load_characterization(reader.getRoot<VprPowerCharacterization>(), file, cmos_tech_behavior_filepath, arch);
+    } catch (const VprError&) {
+        throw;
+    } catch (const vtr::VtrError& e) { //Failed to map the file
+        VPR_FATAL_ERROR(VPR_ERROR_POWER,
+                        "Failed to read power characterization file '%s': %s\n", file.c_str(), e.what());
+    } catch (const kj::Exception& e) {
+        VPR_FATAL_ERROR(VPR_ERROR_POWER,
+                        "Failed to read power characterization file '%s' (truncated or not a power characterization file?): %s\n",
+                        file.c_str(), e.getDescription().cStr());
+    }
+}
+
+/* Loads the characterization from the message read from file, see
+ * power_read_characterization() */
+static bool power_load_characterization(const VprPowerCharacterization::Reader& characterization,
+                                        const std::string& file,
+                                        const char* cmos_tech_behavior_filepath,
+                                        const t_arch* arch) {
+    auto& power_ctx = g_vpr_ctx.power();
+
+    std::string digest = power_characterization_digest(cmos_tech_behavior_filepath, arch);
+    if (digest != characterization.getDigest().cStr()) {
+        VTR_LOG_WARN("Power characterization file '%s' was computed for a different technology properties file or architecture (digest %s, expected %s)\n",
+                     file.c_str(), characterization.getDigest().cStr(), digest.c_str());
+        return false;
+    }
+
+    /* Technology properties */
+    t_power_tech* tech = power_ctx.tech;
+    tech->tech_size = characterization.getTechSize();
+    tech->temperature = characterization.getTemperature();
+    tech->Vdd = characterization.getVdd();
+    tech->PN_ratio = characterization.getPnRatio();
+
+    ToTransistor(&tech->NMOS_inf, characterization.getNmos());
+    ToTransistor(&tech->PMOS_inf, characterization.getPmos());
+
+    auto nmos_muxes = characterization.getNmosMuxes();
+    tech->num_nmos_mux_info = nmos_muxes.size();
+    tech->nmos_mux_info = (t_power_nmos_mux_inf*)vtr::calloc(nmos_muxes.size(), sizeof(t_power_nmos_mux_inf));
+    for (size_t nmos_idx = 0; nmos_idx < nmos_muxes.size(); nmos_idx++) {
+        t_power_nmos_mux_inf* nmos_inf = &tech->nmos_mux_info[nmos_idx];
+        nmos_inf->nmos_size = nmos_muxes[nmos_idx].getNmosSize();
+
+        auto mux_sizes = nmos_muxes[nmos_idx].getMuxSizes();
+        if (mux_sizes.size() == 0) {
+            VPR_FATAL_ERROR(VPR_ERROR_POWER,
+                            "Power characterization file '%s' has no mux sizes for NMOS size %g\n",
+                            file.c_str(), nmos_inf->nmos_size);
+        }
+        nmos_inf->max_mux_sl_size = mux_sizes.size() - 1;
+        nmos_inf->mux_voltage_inf = (t_power_mux_volt_inf*)vtr::calloc(mux_sizes.size(), sizeof(t_power_mux_volt_inf));
+        for (size_t mux_size = 0; mux_size < mux_sizes.size(); mux_size++) {
+            auto voltages = mux_sizes[mux_size];
+            if (voltages.size() == 0) {
+                continue;
+            }
+
+            t_power_mux_volt_inf* volt_inf = &nmos_inf->mux_voltage_inf[mux_size];
+            volt_inf->num_voltage_pairs = voltages.size();
+            volt_inf->mux_voltage_pairs = (t_power_mux_volt_pair*)vtr::calloc(voltages.size(), sizeof(t_power_mux_volt_pair));
+            for (size_t i = 0; i < voltages.size(); i++) {
+                volt_inf->mux_voltage_pairs[i].v_in = voltages[i].getVIn();
+                volt_inf->mux_voltage_pairs[i].v_out_min = voltages[i].getVOutMin();
+                volt_inf->mux_voltage_pairs[i].v_out_max = voltages[i].getVOutMax();
+            }
+        }
+    }
+
+    auto nmos_leakages = characterization.getNmosLeakages();
+    tech->num_nmos_leakage_info = nmos_leakages.size();
+    tech->nmos_leakage_info = (t_power_nmos_leakage_inf*)vtr::calloc(nmos_leakages.size(), sizeof(t_power_nmos_leakage_inf));
+    for (size_t nmos_idx = 0; nmos_idx < nmos_leakages.size(); nmos_idx++) {
+        t_power_nmos_leakage_inf* nmos_info = &tech->nmos_leakage_info[nmos_idx];
+        nmos_info->nmos_size = nmos_leakages[nmos_idx].getNmosSize();
+
+        auto leakage_pairs = nmos_leakages[nmos_idx].getLeakagePairs();
+        nmos_info->num_leakage_pairs = leakage_pairs.size();
+        nmos_info->leakage_pairs = (t_power_nmos_leakage_pair*)vtr::calloc(leakage_pairs.size(), sizeof(t_power_nmos_leakage_pair));
+        for (size_t i = 0; i < leakage_pairs.size(); i++) {
+            nmos_info->leakage_pairs[i].v_ds = leakage_pairs[i].getVDs();
+            nmos_info->leakage_pairs[i].i_ds = leakage_pairs[i].getIDs();
+        }
+    }
+
+    /* Callibrated components */
+    auto components = characterization.getComponents();
+    if (components.size() != POWER_CALLIB_COMPONENT_MAX) {
+        VPR_FATAL_ERROR(VPR_ERROR_POWER,
+                        "Power characterization file '%s' has %u callibrated components, expected %d\n",
+                        file.c_str(), components.size(), POWER_CALLIB_COMPONENT_MAX);
+    }
+    power_ctx.commonly_used->component_callibration = (PowerSpicedComponent**)vtr::calloc(POWER_CALLIB_COMPONENT_MAX,
+                                                                                          sizeof(PowerSpicedComponent*));
+    for (int i = 0; i < POWER_CALLIB_COMPONENT_MAX; i++) {
+        PowerSpicedComponent* component = new PowerSpicedComponent(components[i].getName().cStr(), f_callib_usage_fns[i]);
+
+        for (auto inputs : components[i].getInputs()) {
+            for (auto size : inputs.getSizes()) {
+                component->add_data_point(inputs.getNumInputs(), size.getTransistorSize(), size.getPower(), size.getFactor());
+            }
+        }
+        component->set_callibrated();
+
+        power_ctx.commonly_used->component_callibration[i] = component;
+    }
+
+    return true;
+}
+
+void power_write_characterization(const std::string& file,
+                                  const char* cmos_tech_behavior_filepath,
+                                  const t_arch* arch) {
+    auto& power_ctx = g_vpr_ctx.power();
+    const t_power_tech* tech = power_ctx.tech;
+
+    ::capnp::MallocMessageBuilder builder;
+
+    auto characterization = builder.initRoot<VprPowerCharacterization>();
+    characterization.setDigest(power_characterization_digest(cmos_tech_behavior_filepath, arch).c_str());
+
+    /* Technology properties */
+    characterization.setTechSize(tech->tech_size);
+    characterization.setTemperature(tech->temperature);
+    characterization.setVdd(tech->Vdd);
+    characterization.setPnRatio(tech->PN_ratio);
+
+    FromTransistor(characterization.initNmos(), tech->NMOS_inf);
+    FromTransistor(characterization.initPmos(), tech->PMOS_inf);
+
+    auto nmos_muxes = characterization.initNmosMuxes(tech->num_nmos_mux_info);
+    for (int nmos_idx = 0; nmos_idx < tech->num_nmos_mux_info; nmos_idx++) {
+        const t_power_nmos_mux_inf* nmos_inf = &tech->nmos_mux_info[nmos_idx];
+        nmos_muxes[nmos_idx].setNmosSize(nmos_inf->nmos_size);
+
+        auto mux_sizes = nmos_muxes[nmos_idx].initMuxSizes(nmos_inf->max_mux_sl_size + 1);
+        for (int mux_size = 0; mux_size <= nmos_inf->max_mux_sl_size; mux_size++) {
+            const t_power_mux_volt_inf* volt_inf = &nmos_inf->mux_voltage_inf[mux_size];
+
+            auto voltages = mux_sizes.init(mux_size, volt_inf->num_voltage_pairs);
+            for (int i = 0; i < volt_inf->num_voltage_pairs; i++) {
+                voltages[i].setVIn(volt_inf->mux_voltage_pairs[i].v_in);
+                voltages[i].setVOutMin(volt_inf->mux_voltage_pairs[i].v_out_min);
+                voltages[i].setVOutMax(volt_inf->mux_voltage_pairs[i].v_out_max);
+            }
+        }
+    }
+
+    auto nmos_leakages = characterization.initNmosLeakages(tech->num_nmos_leakage_info);
+    for (int nmos_idx = 0; nmos_idx < tech->num_nmos_leakage_info; nmos_idx++) {
+        const t_power_nmos_leakage_inf* nmos_info = &tech->nmos_leakage_info[nmos_idx];
+        nmos_leakages[nmos_idx].setNmosSize(nmos_info->nmos_size);
+
+        auto leakage_pairs = nmos_leakages[nmos_idx].initLeakagePairs(nmos_info->num_leakage_pairs);
+        for (int i = 0; i < nmos_info->num_leakage_pairs; i++) {
+            leakage_pairs[i].setVDs(nmos_info->leakage_pairs[i].v_ds);
+            leakage_pairs[i].setIDs(nmos_info->leakage_pairs[i].i_ds);
+        }
+    }
+
+    /* Callibrated components, without their min/max bounding entries */
+    auto components = characterization.initComponents(POWER_CALLIB_COMPONENT_MAX);
+    for (int i = 0; i < POWER_CALLIB_COMPONENT_MAX; i++) {
+        const PowerSpicedComponent* component = power_ctx.commonly_used->component_callibration[i];
+        VTR_ASSERT(component->done_callibration);
+        components[i].setName(component->name.c_str());
+
+        auto inputs = components[i].initInputs(component->entries.size() - 2);
+        for (size_t inputs_idx = 1; inputs_idx + 1 < component->entries.size(); inputs_idx++) {
+            const PowerCallibInputs* inputs_entry = component->entries[inputs_idx];
+            auto inputs_out = inputs[inputs_idx - 1];
+            inputs_out.setNumInputs(inputs_entry->num_inputs);
+
+            auto sizes = inputs_out.initSizes(inputs_entry->entries.size() - 2);
+            for (size_t size_idx = 1; size_idx + 1 < inputs_entry->entries.size(); size_idx++) {
+                const PowerCallibSize* size_entry = inputs_entry->entries[size_idx];
+                sizes[size_idx - 1].setTransistorSize(size_entry->transistor_size);
+                sizes[size_idx - 1].setPower(size_entry->power);
+                sizes[size_idx - 1].setFactor(size_entry->factor);
+            }
+        }
+    }
+
+    writeMessageToFile(file, &builder);
+}
+
+#endif
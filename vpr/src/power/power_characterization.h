@@ -0,0 +1,30 @@
+/**
+ * This file provides functions to save and load the power characterization:
+ * the CMOS technology properties and the component callibration, which
+ * otherwise are read from the technology properties file and computed on
+ * every run.
+ */
+
+#ifndef __POWER_CHARACTERIZATION_H__
+#define __POWER_CHARACTERIZATION_H__
+
+/************************* INCLUDES *********************************/
+#include <string>
+
+#include "physical_types.h"
+
+/************************* FUNCTION DECLARATIONS ********************/
+
+/* Loads the technology properties and component callibration from file.
+ * Returns false (and loads nothing) if the file does not exist, or was written
+ * for a different technology properties file or architecture. */
+bool power_read_characterization(const std::string& file,
+                                 const char* cmos_tech_behavior_filepath,
+                                 const t_arch* arch);
+
+/* Writes the technology properties and component callibration to file */
+void power_write_characterization(const std::string& file,
+                                  const char* cmos_tech_behavior_filepath,
+                                  const t_arch* arch);
+
+#endif
@@ -36,6 +36,10 @@
 
 /************************* STRUCTS **********************************/
 
+/************************* File Scope **********************************/
+/* Partial usage the current thread accumulates into (nullptr if none) */
+static thread_local t_power_partial* f_thread_partial = nullptr;
+
 /************************* FUNCTION DECLARATIONS ********************/
 static void power_usage_mux_rec(t_power_usage* power_usage, float* out_prob, float* out_dens, float* v_out, t_mux_node* mux_node, t_mux_arch* mux_arch, int* selector_values, float* primary_input_prob, float* primary_input_dens, bool v_out_restored, float period);
 
@@ -69,11 +73,58 @@ void power_components_uninit() {
  */
 void power_component_add_usage(t_power_usage* power_usage,
                                e_power_component_type component_idx) {
+    if (f_thread_partial) {
+        power_add_usage(&f_thread_partial->components[component_idx], power_usage);
+        return;
+    }
+
     auto& power_ctx = g_vpr_ctx.power();
     power_add_usage(&power_ctx.by_component.components[component_idx],
                     power_usage);
 }
 
+/**
+ * Sets the partial usage that the calling thread accumulates into
+ * - partial: The partial usage, or nullptr to accumulate into the shared totals
+ */
+void power_set_thread_partial(t_power_partial* partial) {
+    f_thread_partial = partial;
+}
+
+/**
+ * Adds power usage to a usage shared between blocks (e.g. the usage of a pb_type,
+ * mode or interconnect), or to the thread's partial usage if it has one.
+ * - shared_usage: The shared power usage
+ * - power_usage: Power usage to add
+ */
+void power_add_shared_usage(t_power_usage* shared_usage, const t_power_usage* power_usage) {
+    if (f_thread_partial) {
+        auto result = f_thread_partial->shared.insert(std::make_pair(shared_usage, *power_usage));
+        if (!result.second) {
+            power_add_usage(&result.first->second, power_usage);
+        }
+        return;
+    }
+
+    power_add_usage(shared_usage, power_usage);
+}
+
+/**
+ * Adds a partial usage (excluding its total) to the shared totals
+ */
+void power_reduce_partial(const t_power_partial* partial) {
+    auto& power_ctx = g_vpr_ctx.power();
+
+    VTR_ASSERT(!f_thread_partial);
+
+    for (int i = 0; i < POWER_COMPONENT_MAX_NUM; i++) {
+        power_add_usage(&power_ctx.by_component.components[i], &partial->components[i]);
+    }
+    for (const auto& kv : partial->shared) {
+        power_add_usage(kv.first, &kv.second);
+    }
+}
+
 /**
  * Gets power usage for a component
  * - power_usage: (Return value) Power usage for the given component
@@ -506,8 +557,8 @@ void power_usage_local_interc_mux(t_power_usage* power_usage, t_pb* pb, t_interc
             VTR_ASSERT(0);
     }
 
-    power_add_usage(&interc_pins->interconnect->interconnect_power->power_usage,
-                    power_usage);
+    power_add_shared_usage(&interc_pins->interconnect->interconnect_power->power_usage,
+                           power_usage);
 }
 
 /**
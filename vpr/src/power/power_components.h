@@ -24,6 +24,8 @@
 #define __POWER_COMPONENTS_H__
 
 /************************* INCLUDES *********************************/
+#include <unordered_map>
+
 #include "power.h"
 #include "clustered_netlist.h"
 
@@ -71,6 +73,18 @@ struct t_power_breakdown {
 };
 
 typedef t_power_breakdown t_power_components;
+
+/* Power usage accumulated by one unit of work (e.g. a column of tiles) of a
+ * parallel power estimation.  While a thread has a partial set with
+ * power_set_thread_partial(), power_component_add_usage() and
+ * power_add_shared_usage() accumulate into it instead of the shared totals,
+ * which are updated afterwards (in unit order) by power_reduce_partial(). */
+struct t_power_partial {
+    t_power_usage total = {0., 0.};                            /* Caller-defined total of the unit */
+    t_power_usage components[POWER_COMPONENT_MAX_NUM] = {};    /* Per-component usage */
+    std::unordered_map<t_power_usage*, t_power_usage> shared; /* Additions to shared usages (e.g. per pb_type) */
+};
+
 /************************* FUNCTION DECLARATIONS ********************/
 
 void power_components_init();
@@ -81,6 +95,10 @@ void power_component_add_usage(t_power_usage* power_usage,
                                e_power_component_type component_idx);
 float power_component_get_usage_sum(e_power_component_type component_idx);
 
+void power_set_thread_partial(t_power_partial* partial);
+void power_add_shared_usage(t_power_usage* shared_usage, const t_power_usage* power_usage);
+void power_reduce_partial(const t_power_partial* partial);
+
 void power_usage_ff(t_power_usage* power_usage, float size, float D_prob, float D_dens, float Q_prob, float Q_dens, float clk_prob, float clk_dens, float period);
 void power_usage_lut(t_power_usage* power_usage, int LUT_size, float transistor_size, char* SRAM_values, float* input_densities, float* input_probabilities, float period);
 void power_usage_local_interc_mux(t_power_usage* power_usage, t_pb* pb, t_interconnect_pins* interc_pins, ClusterBlockId iblk);
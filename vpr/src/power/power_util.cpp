@@ -23,6 +23,7 @@
 #include <cstring>
 #include <cmath>
 #include <map>
+#include <mutex>
 
 #include "vtr_assert.h"
 #include "vtr_memory.h"
@@ -33,6 +34,8 @@
 #include "atom_netlist_utils.h"
 
 /************************* GLOBALS **********************************/
+/* Serializes logging from parallel power estimation */
+static std::mutex f_log_mutex;
 
 /************************* FUNCTION DECLARATIONS*********************/
 static void log_msg(t_log* log_ptr, const char* msg);
@@ -69,6 +72,7 @@ float power_perc_dynamic(t_power_usage* power_usage) {
 
 void power_log_msg(e_power_log_type log_type, const char* msg) {
     auto& power_ctx = g_vpr_ctx.power();
+    std::lock_guard<std::mutex> lock(f_log_mutex);
     log_msg(&power_ctx.output->logs[log_type], msg);
 }
 
@@ -4,6 +4,8 @@
 #include <algorithm>
 #include <vector>
 #include <iostream>
+#include <atomic>
+#include <mutex>
 
 #include "vtr_assert.h"
 #include "vtr_util.h"
@@ -36,30 +38,50 @@
 #include "timing_info.h"
 #include "tatum/echo_writer.hpp"
 
+#if defined(VPR_USE_TBB)
+#    include <tbb/enumerable_thread_specific.h>
+#endif
+
 /**************** Types local to route_common.c ******************/
 struct t_trace_branch {
     t_trace* head;
     t_trace* tail;
 };
 
-/**************** Static variables local to route_common.c ******************/
-
-static t_heap** heap; /* Indexed from [1..heap_size] */
-static int heap_size; /* Number of slots in the heap array */
-static int heap_tail; /* Index of first unused slot in the heap array */
+/* Routing state owned by each thread routing nets */
+struct t_thread_route_state {
+    RouterHeap heap;
+    t_trace* trace_free_head = nullptr; /* Free list of trace data structures */
+};
 
-/* For managing my own list of currently free heap data structures.     */
-static t_heap* heap_free_head = nullptr;
-/* For keeping track of the sudo malloc memory for the heap*/
-static vtr::t_chunk heap_ch;
+/**************** Static variables local to route_common.c ******************/
 
-/* For managing my own list of currently free trace data structures.    */
-static t_trace* trace_free_head = nullptr;
+/* The heap used by the heap functions below and the list of currently free *
+ * trace data structures.  Each thread has its own, so that nets in disjoint *
+ * routing regions can be routed concurrently (see try_timing_driven_route); *
+ * free_route_structs() releases those of every thread.  A RouterHeapScope   *
+ * substitutes another heap.  Worker threads pick up the heap type of the    *
+ * last init_heap() through init_thread_heap().                              */
+#if defined(VPR_USE_TBB)
+static tbb::enumerable_thread_specific<t_thread_route_state> thread_route_states;
+/* Bumped whenever thread_route_states is cleared, invalidating the cached *
+ * per-thread pointers into it (see get_thread_route_state)                */
+static std::atomic<unsigned> thread_route_states_generation{0};
+#else
+static t_thread_route_state thread_route_state;
+#endif
+static thread_local RouterHeap* active_heap = nullptr;
+static std::atomic<e_heap_type> router_heap_type{e_heap_type::BINARY_HEAP};
+
+/* The chunk memory backing the traces is shared by all threads (traces     *
+ * outlive the thread that routed them), so refilling from it is locked.    *
+ * Free traces of released thread states are kept on a shared list.         */
+static std::mutex trace_ch_mutex;
+static t_trace* trace_shared_free_head = nullptr;
 /* For keeping track of the sudo malloc memory for the trace*/
 static vtr::t_chunk trace_ch;
 
-static int num_trace_allocated = 0; /* To watch for memory leaks. */
-static int num_heap_allocated = 0;
+static std::atomic<int> num_trace_allocated{0}; /* To watch for memory leaks. */
 static int num_linked_f_pointer_allocated = 0;
 
 /*  The numbering relation between the channels and clbs is:				*
@@ -298,7 +320,7 @@ bool try_route(int width_fac,
     /* Allocate and load additional rr_graph information needed only by the router. */
     alloc_and_load_rr_node_route_structs();
 
-    init_route_structs(router_opts.bb_factor);
+    init_route_structs(router_opts.bb_factor, router_opts.router_heap);
 
     if (cluster_ctx.clb_nlist.nets().empty()) {
         VTR_LOG_WARN("No nets to route\n");
@@ -467,20 +489,44 @@ void pathfinder_update_cost(float pres_fac, float acc_fac) {
     }
 }
 
-void init_heap(const DeviceGrid& grid) {
-    if (heap != nullptr) {
-        vtr::free(heap + 1);
-        heap = nullptr;
+static t_thread_route_state& get_thread_route_state() {
+#if defined(VPR_USE_TBB)
+    //Looking up the thread's state is comparatively slow, so cache it
+    static thread_local t_thread_route_state* state = nullptr;
+    static thread_local unsigned state_generation = 0;
+    if (state == nullptr || state_generation != thread_route_states_generation) {
+        state = &thread_route_states.local();
+        state_generation = thread_route_states_generation;
+    }
+    return *state;
+#else
+    return thread_route_state;
+#endif
+}
+
+static RouterHeap& get_active_heap() {
+    return (active_heap != nullptr) ? *active_heap : get_thread_route_state().heap;
+}
+
+void init_heap(const DeviceGrid& grid, e_heap_type heap_type) {
+    router_heap_type = heap_type;
+
+    RouterHeap& heap = get_active_heap();
+    heap.init((grid.width() - 1) * (grid.height() - 1));
+    heap.set_type(heap_type);
+}
+
+/* Sets up the calling thread's heap if it was not set up by init_heap(). */
+void init_thread_heap(const DeviceGrid& grid) {
+    RouterHeap& heap = get_active_heap();
+    if (heap.type() != router_heap_type) {
+        init_heap(grid, router_heap_type);
     }
-    heap_size = (grid.width() - 1) * (grid.height() - 1);
-    heap = (t_heap**)vtr::malloc(heap_size * sizeof(t_heap*));
-    heap--; /* heap stores from [1..heap_size] */
-    heap_tail = 1;
 }
 
 /* Call this before you route any nets.  It frees any old traceback and   *
  * sets the list of rr_nodes touched to empty.                            */
-void init_route_structs(int bb_factor) {
+void init_route_structs(int bb_factor, e_heap_type heap_type) {
     auto& cluster_ctx = g_vpr_ctx.clustering();
     auto& device_ctx = g_vpr_ctx.device();
     auto& route_ctx = g_vpr_ctx.mutable_routing();
@@ -493,7 +539,7 @@ void init_route_structs(int bb_factor) {
     route_ctx.trace.resize(cluster_ctx.clb_nlist.nets().size());
     route_ctx.trace_nodes.resize(cluster_ctx.clb_nlist.nets().size());
 
-    init_heap(device_ctx.grid);
+    init_heap(device_ctx.grid, heap_type);
 
     //Various look-ups
     route_ctx.net_rr_terminals = load_net_rr_terminals(device_ctx.rr_node_indices);
@@ -505,7 +551,7 @@ void init_route_structs(int bb_factor) {
     /* Check that things that should have been emptied after the last routing *
      * really were.                                                           */
 
-    if (heap_tail != 1) {
+    if (!is_empty_heap()) {
         VPR_FATAL_ERROR(VPR_ERROR_ROUTE,
                         "in init_route_structs. Heap is not empty.\n");
     }
@@ -953,36 +999,27 @@ void free_route_structs() {
      * final routing result is not freed.                                */
     auto& route_ctx = g_vpr_ctx.mutable_routing();
 
-    if (heap != nullptr) {
-        //Free the individiaul heap elements (calls destructors)
-        for (int i = 1; i < num_heap_allocated; i++) {
-            VTR_LOG("Freeing %p\n", heap[i]);
-            vtr::chunk_delete(heap[i], &heap_ch);
-        }
-
-        // coverity[offset_free : Intentional]
-        free(heap + 1);
+    get_active_heap().free_all_memory();
 
-        heap = nullptr; /* Defensive coding:  crash hard if I use these. */
-    }
-
-    if (heap_free_head != nullptr) {
-        t_heap* curr = heap_free_head;
-        while (curr) {
-            t_heap* tmp = curr;
-            curr = curr->u.next;
-
-            vtr::chunk_delete(tmp, &heap_ch);
+#if defined(VPR_USE_TBB)
+    //Release the heaps of every thread, keeping their free traces for reuse
+    for (t_thread_route_state& state : thread_route_states) {
+        while (state.trace_free_head != nullptr) {
+            t_trace* tptr = state.trace_free_head;
+            state.trace_free_head = tptr->next;
+            tptr->next = trace_shared_free_head;
+            trace_shared_free_head = tptr;
         }
-
-        heap_free_head = nullptr;
     }
+    thread_route_states.clear();
+    ++thread_route_states_generation;
+#else
+    thread_route_state.heap.free_all_memory();
+#endif
+
     if (route_ctx.route_bb.size() != 0) {
         route_ctx.route_bb.clear();
     }
-
-    /*free the memory chunks that were used by heap and linked f pointer */
-    free_chunk_memory(&heap_ch);
 }
 
 /* Frees the data structures needed to save a routing.                     */
@@ -1201,67 +1238,13 @@ void add_to_mod_list(int inode, std::vector<int>& modified_rr_node_inf) {
 }
 
 namespace heap_ {
-size_t parent(size_t i);
-size_t left(size_t i);
-size_t right(size_t i);
-size_t size();
-void expand_heap_if_full();
-
-size_t parent(size_t i) { return i >> 1; }
-// child indices of a heap
-size_t left(size_t i) { return i << 1; }
-size_t right(size_t i) { return (i << 1) + 1; }
-size_t size() { return static_cast<size_t>(heap_tail - 1); } // heap[0] is not valid element
-
-// make a heap rooted at index i by **sifting down** in O(lgn) time
-void sift_down(size_t hole) {
-    t_heap* head{heap[hole]};
-    size_t child{left(hole)};
-    while ((int)child < heap_tail) {
-        if ((int)child + 1 < heap_tail && heap[child + 1]->cost < heap[child]->cost)
-            ++child;
-        if (heap[child]->cost < head->cost) {
-            heap[hole] = heap[child];
-            hole = child;
-            child = left(child);
-        } else
-            break;
-    }
-    heap[hole] = head;
-}
-
-// runs in O(n) time by sifting down; the least work is done on the most elements: 1 swap for bottom layer, 2 swap for 2nd, ... lgn swap for top
-// 1*(n/2) + 2*(n/4) + 3*(n/8) + ... + lgn*1 = 2n (sum of i/2^i)
 void build_heap() {
-    // second half of heap are leaves
-    for (size_t i = heap_tail >> 1; i != 0; --i)
-        sift_down(i);
+    get_active_heap().build_heap();
 }
 
-// O(lgn) sifting up to maintain heap property after insertion (should sift down when building heap)
-void sift_up(size_t leaf, t_heap* const node) {
-    while ((leaf > 1) && (node->cost < heap[parent(leaf)]->cost)) {
-        // sift hole up
-        heap[leaf] = heap[parent(leaf)];
-        leaf = parent(leaf);
-    }
-    heap[leaf] = node;
-}
-
-void expand_heap_if_full() {
-    if (heap_tail > heap_size) { /* Heap is full */
-        heap_size *= 2;
-        heap = (t_heap**)vtr::realloc((void*)(heap + 1),
-                                      heap_size * sizeof(t_heap*));
-        heap--; /* heap goes from [1..heap_size] */
-    }
-}
-
-// adds an element to the back of heap and expand if necessary, but does not maintain heap property
+// adds an element to the back of heap, but does not maintain heap property
 void push_back(t_heap* const hptr) {
-    expand_heap_if_full();
-    heap[heap_tail] = hptr;
-    ++heap_tail;
+    get_active_heap().push_back(hptr);
 }
 
 void push_back_node(int inode, float total_cost, int prev_node, int prev_edge, float backward_path_cost, float R_upstream) {
@@ -1284,11 +1267,7 @@ void push_back_node(int inode, float total_cost, int prev_node, int prev_edge, f
 }
 
 bool is_valid() {
-    for (size_t i = 1; (int)i <= heap_tail >> 1; ++i) {
-        if ((int)left(i) < heap_tail && heap[left(i)]->cost < heap[i]->cost) return false;
-        if ((int)right(i) < heap_tail && heap[right(i)]->cost < heap[i]->cost) return false;
-    }
-    return true;
+    return get_active_heap().is_valid();
 }
 // extract every element and print it
 void pop_heap() {
@@ -1298,48 +1277,17 @@ void pop_heap() {
 }
 // print every element; not necessarily in order for minheap
 void print_heap() {
-    for (int i = 1; i<heap_tail>> 1; ++i)
-        VTR_LOG("(%e %e %e) ", heap[i]->cost, heap[left(i)]->cost, heap[right(i)]->cost);
-    VTR_LOG("\n");
-}
-// verify correctness of extract top by making a copy, sorting it, and iterating it at the same time as extraction
-void verify_extract_top() {
-    constexpr float float_epsilon = 1e-20;
-    std::cout << "copying heap\n";
-    std::vector<t_heap*> heap_copy{heap + 1, heap + heap_tail};
-    // sort based on cost with cheapest first
-    VTR_ASSERT(heap_copy.size() == size());
-    std::sort(begin(heap_copy), end(heap_copy),
-              [](const t_heap* a, const t_heap* b) {
-                  return a->cost < b->cost;
-              });
-    std::cout << "starting to compare top elements\n";
-    size_t i = 0;
-    while (!is_empty_heap()) {
-        while (heap_copy[i]->index == OPEN)
-            ++i; // skip the ones that won't be extracted
-        auto top = get_heap_head();
-        if (abs(top->cost - heap_copy[i]->cost) > float_epsilon)
-            std::cout << "mismatch with sorted " << top << '(' << top->cost << ") " << heap_copy[i] << '(' << heap_copy[i]->cost << ")\n";
-        ++i;
-    }
-    if (i != heap_copy.size())
-        std::cout << "did not finish extracting: " << i << " vs " << heap_copy.size() << std::endl;
-    else
-        std::cout << "extract top working as intended\n";
+    get_active_heap().print_heap();
 }
 } // namespace heap_
 // adds to heap and maintains heap quality
 void add_to_heap(t_heap* hptr) {
-    heap_::expand_heap_if_full();
-    // start with undefined hole
-    ++heap_tail;
-    heap_::sift_up(heap_tail - 1, hptr);
+    get_active_heap().add_to_heap(hptr);
 }
 
 /*WMF: peeking accessor :) */
 bool is_empty_heap() {
-    return (bool)(heap_tail == 1);
+    return get_active_heap().is_empty_heap();
 }
 
 t_heap*
@@ -1347,93 +1295,52 @@ get_heap_head() {
     /* Returns a pointer to the smallest element on the heap, or NULL if the     *
      * heap is empty.  Invalid (index == OPEN) entries on the heap are never     *
      * returned -- they are just skipped over.                                   */
-
-    t_heap* cheapest;
-    size_t hole, child;
-
-    do {
-        if (heap_tail == 1) { /* Empty heap. */
-            VTR_LOG_WARN("Empty heap occurred in get_heap_head.\n");
-            return (nullptr);
-        }
-
-        cheapest = heap[1];
-
-        hole = 1;
-        child = 2;
-        --heap_tail;
-        while ((int)child < heap_tail) {
-            if (heap[child + 1]->cost < heap[child]->cost)
-                ++child; // become right child
-            heap[hole] = heap[child];
-            hole = child;
-            child = heap_::left(child);
-        }
-        heap_::sift_up(hole, heap[heap_tail]);
-
-    } while (cheapest->index == OPEN); /* Get another one if invalid entry. */
-
-    return (cheapest);
+    return get_active_heap().get_heap_head();
 }
 
 void empty_heap() {
-    for (int i = 1; i < heap_tail; i++)
-        free_heap_data(heap[i]);
-
-    heap_tail = 1;
+    get_active_heap().empty_heap();
 }
 
 t_heap*
 alloc_heap_data() {
-    if (heap_free_head == nullptr) { /* No elements on the free list */
-        heap_free_head = vtr::chunk_new<t_heap>(&heap_ch);
-    }
-
-    //Extract the head
-    t_heap* temp_ptr = heap_free_head;
-    heap_free_head = heap_free_head->u.next;
-
-    num_heap_allocated++;
-
-    //Reset
-    temp_ptr->u.next = nullptr;
-    temp_ptr->cost = 0.;
-    temp_ptr->backward_path_cost = 0.;
-    temp_ptr->R_upstream = 0.;
-    temp_ptr->index = OPEN;
-    temp_ptr->u.prev.node = NO_PREVIOUS;
-    temp_ptr->u.prev.edge = NO_PREVIOUS;
-    return (temp_ptr);
+    return get_active_heap().alloc();
 }
 
 void free_heap_data(t_heap* hptr) {
-    hptr->u.next = heap_free_head;
-    heap_free_head = hptr;
-    num_heap_allocated--;
+    get_active_heap().free(hptr);
 }
 
 void invalidate_heap_entries(int sink_node, int ipin_node) {
     /* Marks all the heap entries consisting of sink_node, where it was reached *
      * via ipin_node, as invalid (OPEN).  Used only by the breadth_first router *
      * and even then only in rare circumstances.                                */
+    get_active_heap().invalidate_heap_entries(sink_node, ipin_node);
+}
 
-    for (int i = 1; i < heap_tail; i++) {
-        if (heap[i]->index == sink_node) {
-            if (heap[i]->u.prev.node == ipin_node) {
-                heap[i]->index = OPEN; /* Invalid. */
-                break;
-            }
-        }
-    }
+RouterHeapScope::RouterHeapScope(RouterHeap& heap)
+    : prev_heap_(active_heap) {
+    active_heap = &heap;
+}
+
+RouterHeapScope::~RouterHeapScope() {
+    active_heap = prev_heap_;
 }
 
 t_trace*
 alloc_trace_data() {
     t_trace* temp_ptr;
+    t_trace*& trace_free_head = get_thread_route_state().trace_free_head;
 
     if (trace_free_head == nullptr) { /* No elements on the free list */
-        trace_free_head = (t_trace*)vtr::chunk_malloc(sizeof(t_trace), &trace_ch);
-        trace_free_head->next = nullptr;
+        std::lock_guard<std::mutex> lock(trace_ch_mutex);
+        if (trace_shared_free_head != nullptr) { /* Take over the shared free list */
+            trace_free_head = trace_shared_free_head;
+            trace_shared_free_head = nullptr;
+        } else {
+            trace_free_head = (t_trace*)vtr::chunk_malloc(sizeof(t_trace), &trace_ch);
+            trace_free_head->next = nullptr;
+        }
     }
     temp_ptr = trace_free_head;
     trace_free_head = trace_free_head->next;
@@ -1443,6 +1350,7 @@ alloc_trace_data() {
 
 void free_trace_data(t_trace* tptr) {
     /* Puts the traceback structure pointed to by tptr on the free list. */
+    t_trace*& trace_free_head = get_thread_route_state().trace_free_head;
 
     tptr->next = trace_free_head;
     trace_free_head = tptr;
@@ -1572,8 +1480,8 @@ void print_route(const char* placement_file, const char* route_file) {
 
     if (getEchoEnabled() && isEchoFileEnabled(E_ECHO_MEM)) {
         fp = vtr::fopen(getEchoFileName(E_ECHO_MEM), "w");
-        fprintf(fp, "\nNum_heap_allocated: %d   Num_trace_allocated: %d\n",
-                num_heap_allocated, num_trace_allocated);
+        fprintf(fp, "\nNum_heap_allocated: %zu   Num_trace_allocated: %d\n",
+                get_active_heap().num_allocated(), num_trace_allocated.load());
         fprintf(fp, "Num_linked_f_pointer_allocated: %d\n",
                 num_linked_f_pointer_allocated);
         fclose(fp);
@@ -1696,7 +1604,16 @@ void free_chunk_memory_trace() {
     if (trace_ch.chunk_ptr_head != nullptr) {
         free_chunk_memory(&trace_ch);
         trace_ch.chunk_ptr_head = nullptr;
-        trace_free_head = nullptr;
+
+        //The free lists point into the released chunks
+        trace_shared_free_head = nullptr;
+#if defined(VPR_USE_TBB)
+        for (t_thread_route_state& state : thread_route_states) {
+            state.trace_free_head = nullptr;
+        }
+#else
+        thread_route_state.trace_free_head = nullptr;
+#endif
     }
 }
 
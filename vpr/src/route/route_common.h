@@ -3,52 +3,7 @@
 #include <vector>
 #include "clustered_netlist.h"
 #include "vtr_vector.h"
-
-/* Used by the heap as its fundamental data structure.
- * Each heap element represents a partial route.
- *
- * cost:    The cost used to sort heap.
- *          For the timing-driven router this is the backward_path_cost +
- *          expected cost to the target.
- *          For the breadth-first router it is the node cost to reach this
- *          point.
- *
- * backward_path_cost:  Used only by the timing-driven router.  The "known"
- *                      cost of the path up to and including this node.
- *                      In this case, the .cost member contains not only
- *                      the known backward cost but also an expected cost
- *                      to the target.
- *
- * R_upstream: Used only by the timing-driven router.  Stores the upstream 
- *             resistance to ground from this node, including the
- *             resistance of the node itself (device_ctx.rr_nodes[index].R).
- *
- * index: The RR node index associated with the costs/R_upstream values
- *
- * u.prev.node: The previous node used to reach the current 'index' node
- * u.prev.next: The edge from u.prev.node used to reach the current 'index' node
- *
- * u.next:  pointer to the next s_heap structure in the free
- *          linked list.  Not used when on the heap.
- *
- */
-struct t_heap {
-    float cost = 0.;
-    float backward_path_cost = 0.;
-    float R_upstream = 0.;
-
-    int index = OPEN;
-
-    struct t_prev {
-        int node;
-        int edge;
-    };
-
-    union {
-        t_heap* next;
-        t_prev prev;
-    } u;
-};
+#include "router_heap.h"
 
 /******* Subroutines in route_common used only by other router modules ******/
 
@@ -86,14 +41,11 @@ void add_to_mod_list(int inode, std::vector<int>& modified_rr_node_inf);
 
 namespace heap_ {
 void build_heap();
-void sift_down(size_t hole);
-void sift_up(size_t tail, t_heap* const hptr);
 void push_back(t_heap* const hptr);
 void push_back_node(int inode, float total_cost, int prev_node, int prev_edge, float backward_path_cost, float R_upstream);
 bool is_valid();
 void pop_heap();
 void print_heap();
-void verify_extract_top();
 } // namespace heap_
 
 t_heap* get_heap_head();
@@ -104,7 +56,21 @@ void free_heap_data(t_heap* hptr);
 
 void invalidate_heap_entries(int sink_node, int ipin_node);
 
-void init_route_structs(int bb_factor);
+//Makes the heap functions above (and the routers built on them) operate on
+//heap, within the calling thread, for the lifetime of the scope object
+class RouterHeapScope {
+  public:
+    explicit RouterHeapScope(RouterHeap& heap);
+    ~RouterHeapScope();
+
+    RouterHeapScope(const RouterHeapScope&) = delete;
+    RouterHeapScope& operator=(const RouterHeapScope&) = delete;
+
+  private:
+    RouterHeap* prev_heap_;
+};
+
+void init_route_structs(int bb_factor, e_heap_type heap_type);
 
 void alloc_and_load_rr_node_route_structs();
 
@@ -112,7 +78,8 @@ void reset_rr_node_route_structs();
 
 void free_trace_structs();
 
-void init_heap(const DeviceGrid& grid);
+void init_heap(const DeviceGrid& grid, e_heap_type heap_type);
+void init_thread_heap(const DeviceGrid& grid);
 void reserve_locally_used_opins(float pres_fac, float acc_fac, bool rip_up_local_opins);
 
 void free_chunk_memory_trace();
@@ -0,0 +1,142 @@
+#include <algorithm>
+
+#include "route_net_partition.h"
+
+#if defined(VPR_USE_TBB)
+#    include <tbb/task_group.h>
+#endif
+
+//Region of the device grid the calling thread's net routing is confined to
+//(nullptr if unconfined). Set while routing the nets of a partition that
+//runs concurrently with other partitions, see route_net_partition()
+static thread_local const t_bb* f_routing_region = nullptr;
+
+std::unique_ptr<t_net_partition> build_net_partition(const t_bb& region,
+                                                     std::vector<ClusterNetId> nets,
+                                                     const vtr::vector<ClusterNetId, t_bb>& footprints,
+                                                     int depth) {
+    auto partition = std::make_unique<t_net_partition>();
+    partition->region = region;
+
+    int width = region.xmax - region.xmin + 1;
+    int height = region.ymax - region.ymin + 1;
+    if (depth == 0 || nets.size() < 2 || std::max(width, height) < 2) {
+        partition->nets = std::move(nets);
+        return partition;
+    }
+
+    //Cut across the longer dimension, at the median net centre so both
+    //halves get a similar amount of routing work
+    bool cut_x = (width >= height);
+    std::vector<int> centres;
+    centres.reserve(nets.size());
+    for (auto net_id : nets) {
+        const t_bb& footprint = footprints[net_id];
+        centres.push_back(cut_x ? (footprint.xmin + footprint.xmax) / 2 : (footprint.ymin + footprint.ymax) / 2);
+    }
+    std::nth_element(centres.begin(), centres.begin() + centres.size() / 2, centres.end());
+
+    int lo = cut_x ? region.xmin : region.ymin;
+    int hi = cut_x ? region.xmax : region.ymax;
+    int cut = std::max(lo, std::min(centres[centres.size() / 2], hi - 1)); //Lower half is [lo..cut], upper [cut+1..hi]
+
+    t_bb lower_region = region;
+    t_bb upper_region = region;
+    if (cut_x) {
+        lower_region.xmax = cut;
+        upper_region.xmin = cut + 1;
+    } else {
+        lower_region.ymax = cut;
+        upper_region.ymin = cut + 1;
+    }
+
+    std::vector<ClusterNetId> lower_nets;
+    std::vector<ClusterNetId> upper_nets;
+    for (auto net_id : nets) {
+        const t_bb& footprint = footprints[net_id];
+        int net_lo = cut_x ? footprint.xmin : footprint.ymin;
+        int net_hi = cut_x ? footprint.xmax : footprint.ymax;
+
+        if (net_hi <= cut) {
+            lower_nets.push_back(net_id);
+        } else if (net_lo > cut) {
+            upper_nets.push_back(net_id);
+        } else {
+            partition->nets.push_back(net_id); //Crosses the cut line
+        }
+    }
+
+    partition->children[0] = build_net_partition(lower_region, std::move(lower_nets), footprints, depth - 1);
+    partition->children[1] = build_net_partition(upper_region, std::move(upper_nets), footprints, depth - 1);
+    return partition;
+}
+
+void route_net_partition(t_net_partition& partition, bool confine_to_region, int max_pins_per_net, const t_net_router& route_net) {
+    //The nets the children could not route within their regions may need
+    //routing outside of them, so are retried first (in the children's
+    //routing order) within this, larger, region
+    std::vector<ClusterNetId> nets;
+    if (partition.children[0]) {
+#if defined(VPR_USE_TBB)
+        tbb::task_group g;
+        g.run([&] { route_net_partition(*partition.children[0], true, max_pins_per_net, route_net); });
+        route_net_partition(*partition.children[1], true, max_pins_per_net, route_net);
+        g.wait();
+#else
+        route_net_partition(*partition.children[0], true, max_pins_per_net, route_net);
+        route_net_partition(*partition.children[1], true, max_pins_per_net, route_net);
+#endif
+
+        for (const auto& child : partition.children) {
+            nets.insert(nets.end(), child->failed_nets.begin(), child->failed_nets.end());
+        }
+    }
+    nets.insert(nets.end(), partition.nets.begin(), partition.nets.end());
+
+    if (nets.empty()) {
+        return;
+    }
+
+    //Indexed by net pin (first sink is pin #1)
+    std::vector<float> pin_criticality(max_pins_per_net);
+    std::vector<t_rt_node*> rt_node_of_sink(max_pins_per_net);
+
+    f_routing_region = (confine_to_region) ? &partition.region : nullptr;
+    for (auto net_id : nets) {
+        bool was_rerouted = false;
+        if (!route_net(net_id, pin_criticality.data(), rt_node_of_sink.data(), partition.stats, was_rerouted)) {
+            if (confine_to_region) {
+                partition.failed_nets.push_back(net_id); //Retried by the enclosing partition
+                continue;
+            }
+            partition.routable = false; //Failed unconfined: impossible to route
+            break;
+        }
+
+        if (was_rerouted) {
+            partition.rerouted_nets.push_back(net_id);
+        }
+    }
+    f_routing_region = nullptr;
+}
+
+bool collect_net_partition_results(const t_net_partition& partition,
+                                   RouterStats& router_stats,
+                                   std::vector<ClusterNetId>& rerouted_nets,
+                                   size_t& nets_routed_concurrently) {
+    bool routable = partition.routable;
+    for (const auto& child : partition.children) {
+        if (child) {
+            routable &= collect_net_partition_results(*child, router_stats, rerouted_nets, nets_routed_concurrently);
+            nets_routed_concurrently += child->stats.nets_routed;
+        }
+    }
+
+    add_router_stats(router_stats, partition.stats);
+    rerouted_nets.insert(rerouted_nets.end(), partition.rerouted_nets.begin(), partition.rerouted_nets.end());
+    return routable;
+}
+
+const t_bb* get_net_routing_region() {
+    return f_routing_region;
+}
@@ -0,0 +1,69 @@
+#ifndef VPR_ROUTE_NET_PARTITION_H
+#define VPR_ROUTE_NET_PARTITION_H
+/*
+ * Spatial net partition used by the parallel router.
+ *
+ * The device grid is recursively bisected and each net is stored in the
+ * deepest cell whose region contains the net's routing footprint (its routing
+ * bounding box plus any routing it currently holds). The nets of a cell are
+ * routed after both of its children, and the two children are routed
+ * concurrently, each confined to its own region. As sibling regions are
+ * disjoint the concurrently routed nets never touch the same RR node, and the
+ * nets crossing a cut line are routed only once the nets on both sides are done.
+ *
+ * A net which can not be routed within its cell's region (e.g. it needs to
+ * detour around congestion) is retried by the enclosing cell, and finally
+ * unconfined by the root; only if that fails is the routing impossible.
+ */
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "vtr_vector.h"
+
+#include "vpr_types.h"
+#include "route_tree_type.h"
+#include "router_stats.h"
+
+//A cell of the spatial net partition
+struct t_net_partition {
+    t_bb region;
+    std::vector<ClusterNetId> nets; //Nets stored in this cell, in routing order
+    std::unique_ptr<t_net_partition> children[2];
+
+    //Results of routing the nets stored in this cell
+    RouterStats stats;
+    std::vector<ClusterNetId> rerouted_nets;
+    std::vector<ClusterNetId> failed_nets; //Nets which could not be routed within region, retried by the parent
+    bool routable = true;
+};
+
+//Routes a single net with the given (thread-owned) scratch arrays, returning
+//false if it could not be routed. A net which fails must leave no partial
+//routing behind, so it can be retried.
+typedef std::function<bool(ClusterNetId net_id, float* pin_criticality, t_rt_node** rt_node_of_sink, RouterStats& router_stats, bool& was_rerouted)> t_net_router;
+
+//Recursively bisects region (depth times), storing each of nets (in order) in
+//the deepest cell which contains its footprint
+std::unique_ptr<t_net_partition> build_net_partition(const t_bb& region,
+                                                     std::vector<ClusterNetId> nets,
+                                                     const vtr::vector<ClusterNetId, t_bb>& footprints,
+                                                     int depth);
+
+//Routes the nets of a partition: both children concurrently (confined to their
+//regions), then the nets the children failed to route and the nets stored in
+//the partition itself
+void route_net_partition(t_net_partition& partition, bool confine_to_region, int max_pins_per_net, const t_net_router& route_net);
+
+//Accumulates the routing results of a partition (in routing order).
+//Returns false if any of its nets could not be routed.
+bool collect_net_partition_results(const t_net_partition& partition,
+                                   RouterStats& router_stats,
+                                   std::vector<ClusterNetId>& rerouted_nets,
+                                   size_t& nets_routed_concurrently);
+
+//Returns the region of the device grid the calling thread's net routing is
+//confined to (nullptr if unconfined)
+const t_bb* get_net_routing_region();
+
+#endif
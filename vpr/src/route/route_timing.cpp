@@ -4,6 +4,8 @@
 #include <vector>
 #include <unordered_map>
 #include <algorithm>
+#include <functional>
+#include <memory>
 
 #include "vtr_assert.h"
 #include "vtr_log.h"
@@ -18,6 +20,7 @@
 #include "route_common.h"
 #include "route_tree_timing.h"
 #include "route_timing.h"
+#include "route_net_partition.h"
 #include "net_delay.h"
 #include "stats.h"
 #include "echo_files.h"
@@ -37,6 +40,10 @@
 
 #include "tatum/TimingReporter.hpp"
 
+#if defined(VPR_USE_TBB)
+#    include <tbb/task_arena.h>
+#endif
+
 #define CONGESTED_SLOPE_VAL -0.04
 
 enum class RouterCongestionMode {
@@ -130,7 +137,7 @@ struct RoutingMetrics {
 
 //Run-time flag to control when router debug information is printed
 //Note only enables debug output if compiled with VTR_ENABLE_DEBUG_LOGGING defined
-bool f_router_debug = false;
+thread_local bool f_router_debug = false;
 
 /******************** Subroutines local to route_timing.c ********************/
 
@@ -229,6 +236,10 @@ static void timing_driven_expand_neighbour(t_heap* current,
                                            const t_bb target_bb,
                                            RouterStats& router_stats);
 
+static bool parallel_routing_is_safe(const t_router_opts& router_opts);
+static int get_net_partition_depth(const t_router_opts& router_opts);
+static t_bb get_net_routing_footprint(ClusterNetId net_id);
+
 static void timing_driven_add_to_heap(const t_conn_cost_params cost_params,
                                       const RouterLookahead& router_lookahead,
                                       const t_heap* current,
@@ -328,6 +339,9 @@ bool try_timing_driven_route(const t_router_opts& router_opts,
     auto& cluster_ctx = g_vpr_ctx.clustering();
     auto& route_ctx = g_vpr_ctx.mutable_routing();
 
+    //The router's expansion reads the rr graph through the frozen view built by create_rr_graph()
+    VTR_ASSERT(g_vpr_ctx.device().frozen_rr_graph.num_nodes() == g_vpr_ctx.device().rr_nodes.size());
+
     //Initially, the router runs normally trying to reduce congestion while
     //balancing other metrics (timing, wirelength, run-time etc.)
     RouterCongestionMode router_congestion_mode = RouterCongestionMode::NORMAL;
@@ -414,6 +428,22 @@ bool try_timing_driven_route(const t_router_opts& router_opts,
      *
      * Subsequent iterations use the net delays from the previous iteration.
      */
+    /*
+     * Parallel routing: nets are partitioned spatially each iteration and
+     * nets in disjoint regions are routed concurrently
+     */
+    bool parallel_routing = router_opts.parallel_routing && parallel_routing_is_safe(router_opts);
+    int net_partition_depth = 0;
+    size_t nets_routed_concurrently = 0;
+    if (parallel_routing) {
+        net_partition_depth = get_net_partition_depth(router_opts);
+        VTR_LOG("Parallel routing with net partition depth %d (%s)\n", net_partition_depth,
+                router_opts.parallel_routing_deterministic ? "deterministic" : "sized for workers");
+
+        //Settle the (fanout independent) base costs so routing nets never writes them
+        update_rr_base_costs(1);
+    }
+
     RouterStats router_stats;
     print_route_status_header();
     timing_driven_route_structs route_structs;
@@ -452,28 +482,69 @@ bool try_timing_driven_route(const t_router_opts& router_opts,
         /*
          * Route each net
          */
-        for (auto net_id : sorted_nets) {
-            bool was_rerouted = false;
-            bool is_routable = try_timing_driven_route_net(net_id,
-                                                           itry,
-                                                           pres_fac,
-                                                           router_opts,
-                                                           connections_inf,
-                                                           router_iteration_stats,
-                                                           route_structs.pin_criticality,
-                                                           route_structs.rt_node_of_sink,
-                                                           net_delay,
-                                                           *router_lookahead,
-                                                           netlist_pin_lookup,
-                                                           route_timing_info,
-                                                           budgeting_inf,
-                                                           was_rerouted);
-            if (!is_routable) {
+        if (parallel_routing) {
+            auto& device_ctx = g_vpr_ctx.device();
+
+            vtr::vector<ClusterNetId, t_bb> footprints(cluster_ctx.clb_nlist.nets().size());
+            for (auto net_id : cluster_ctx.clb_nlist.nets()) {
+                footprints[net_id] = get_net_routing_footprint(net_id);
+            }
+
+            t_bb device_region;
+            device_region.xmin = 0;
+            device_region.ymin = 0;
+            device_region.xmax = device_ctx.grid.width() - 1;
+            device_region.ymax = device_ctx.grid.height() - 1;
+            auto partition = build_net_partition(device_region, sorted_nets, footprints, net_partition_depth);
+
+            auto route_net = [&](ClusterNetId net_id, float* pin_criticality, t_rt_node** rt_node_of_sink, RouterStats& stats, bool& was_rerouted) {
+                init_thread_heap(device_ctx.grid);
+                return try_timing_driven_route_net(net_id,
+                                                   itry,
+                                                   pres_fac,
+                                                   router_opts,
+                                                   connections_inf,
+                                                   stats,
+                                                   pin_criticality,
+                                                   rt_node_of_sink,
+                                                   net_delay,
+                                                   *router_lookahead,
+                                                   netlist_pin_lookup,
+                                                   route_timing_info,
+                                                   budgeting_inf,
+                                                   was_rerouted);
+            };
+            //The root's nets cross the first cut line and are routed alone, so need no confinement;
+            //nets which failed confined to a smaller region are retried there unconfined
+            route_net_partition(*partition, /*confine_to_region=*/false, get_max_pins_per_net(), route_net);
+
+            if (!collect_net_partition_results(*partition, router_iteration_stats, rerouted_nets, nets_routed_concurrently)) {
                 return (false); //Impossible to route
             }
+        } else {
+            for (auto net_id : sorted_nets) {
+                bool was_rerouted = false;
+                bool is_routable = try_timing_driven_route_net(net_id,
+                                                               itry,
+                                                               pres_fac,
+                                                               router_opts,
+                                                               connections_inf,
+                                                               router_iteration_stats,
+                                                               route_structs.pin_criticality,
+                                                               route_structs.rt_node_of_sink,
+                                                               net_delay,
+                                                               *router_lookahead,
+                                                               netlist_pin_lookup,
+                                                               route_timing_info,
+                                                               budgeting_inf,
+                                                               was_rerouted);
+                if (!is_routable) {
+                    return (false); //Impossible to route
+                }
 
-            if (was_rerouted) {
-                rerouted_nets.push_back(net_id);
+                if (was_rerouted) {
+                    rerouted_nets.push_back(net_id);
+                }
             }
         }
 
@@ -527,10 +598,7 @@ bool try_timing_driven_route(const t_router_opts& router_opts,
         }
 
         //Update router stats (total)
-        router_stats.connections_routed += router_iteration_stats.connections_routed;
-        router_stats.nets_routed += router_iteration_stats.nets_routed;
-        router_stats.heap_pushes += router_iteration_stats.heap_pushes;
-        router_stats.heap_pops += router_iteration_stats.heap_pops;
+        add_router_stats(router_stats, router_iteration_stats);
 
         /*
          * Are we finished?
@@ -764,8 +832,14 @@ bool try_timing_driven_route(const t_router_opts& router_opts,
 #endif
     }
 
-    VTR_LOG("Router Stats: total_nets_routed: %zu total_connections_routed: %zu total_heap_pushes: %zu total_heap_pops: %zu\n",
-            router_stats.nets_routed, router_stats.connections_routed, router_stats.heap_pushes, router_stats.heap_pops);
+    float route_time = iteration_timer.elapsed_sec();
+    VTR_LOG("Router Stats: total_nets_routed: %zu total_connections_routed: %zu total_heap_pushes: %zu total_heap_pops: %zu heap pushes per second: %.3g\n",
+            router_stats.nets_routed, router_stats.connections_routed, router_stats.heap_pushes, router_stats.heap_pops,
+            (route_time > 0.) ? router_stats.heap_pushes / route_time : 0.);
+    if (parallel_routing) {
+        VTR_LOG("Parallel routing: %zu of %zu net routes were in concurrently routed regions\n",
+                nets_routed_concurrently, router_stats.nets_routed);
+    }
 
     return routing_is_successful;
 }
@@ -822,6 +896,12 @@ bool try_timing_driven_route_net(ClusterNetId net_id,
             route_ctx.net_status[net_id].is_routed = true;
         } else {
             VTR_LOG("Routing failed.\n");
+
+            //Rip up the partial routing, so the net can be retried from scratch
+            //(e.g. without the region confinement of parallel routing)
+            pathfinder_update_path_cost(route_ctx.trace[net_id].head, -1, pres_fac);
+            free_traceback(net_id);
+            route_ctx.net_status[net_id].is_routed = false;
         }
 
         was_rerouted = true; //Flag to record whether routing was actually changed
@@ -829,6 +909,91 @@ bool try_timing_driven_route_net(ClusterNetId net_id,
     return (is_routed);
 }
 
+//Returns true if nets in disjoint regions can be routed concurrently.
+//
+//Routing a net updates only the RR nodes within its region, except in the
+//cases below which touch shared state; parallel routing falls back to the
+//serial router (with a warning) for them.
+static bool parallel_routing_is_safe(const t_router_opts& router_opts) {
+    auto& device_ctx = g_vpr_ctx.device();
+
+    std::string reason;
+    if (router_opts.router_debug_net >= -1 || router_opts.router_debug_sink_rr >= 0) {
+        reason = "router debug output requested";
+    } else if (!device_ctx.rr_non_config_node_sets.empty()) {
+        //Non-configurable edges may join nodes of different regions into one route
+        reason = "RR graph has non-configurable edges";
+    } else {
+        for (size_t index = CHANX_COST_INDEX_START; index < device_ctx.rr_indexed_data.size(); index++) {
+            if (device_ctx.rr_indexed_data[index].T_quadratic > 0.) {
+                //update_rr_base_costs() would rewrite the base costs for every net
+                reason = "base costs depend on net fanout (pass-transistor wires)";
+                break;
+            }
+        }
+    }
+
+    if (!reason.empty()) {
+        VTR_LOG_WARN("Parallel routing disabled: %s\n", reason.c_str());
+        return false;
+    }
+    return true;
+}
+
+//Returns the depth of the recursive bisection used to partition nets.
+//
+//In deterministic mode the depth is fixed, so the routing is identical for
+//any number of workers. Otherwise it is sized so every worker has a few
+//regions to route (for load balance) while keeping the number of nets
+//crossing a cut line, which are routed with less concurrency, low.
+static int get_net_partition_depth(const t_router_opts& router_opts) {
+    constexpr int DETERMINISTIC_PARTITION_DEPTH = 5;
+    constexpr int REGIONS_PER_WORKER_LOG2 = 2;
+
+    if (router_opts.parallel_routing_deterministic) {
+        return DETERMINISTIC_PARTITION_DEPTH;
+    }
+
+    size_t num_workers = 1;
+#if defined(VPR_USE_TBB)
+    num_workers = tbb::this_task_arena::max_concurrency();
+#endif
+    int depth = 0;
+    while ((size_t(1) << depth) < num_workers) {
+        ++depth;
+    }
+    return depth + REGIONS_PER_WORKER_LOG2;
+}
+
+//Returns the region of the device grid a net may use while being routed:
+//its routing bounding box, extended to cover the routing it currently holds
+//(which may be ripped up or kept by incremental rerouting)
+static t_bb get_net_routing_footprint(ClusterNetId net_id) {
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+    auto& device_ctx = g_vpr_ctx.device();
+    auto& route_ctx = g_vpr_ctx.routing();
+
+    t_bb footprint;
+    if (cluster_ctx.clb_nlist.net_is_global(net_id) || cluster_ctx.clb_nlist.net_is_ignored(net_id)) {
+        //Global nets may use dedicated (e.g. clock) networks spanning the device
+        footprint.xmin = 0;
+        footprint.ymin = 0;
+        footprint.xmax = device_ctx.grid.width() - 1;
+        footprint.ymax = device_ctx.grid.height() - 1;
+        return footprint;
+    }
+
+    footprint = route_ctx.route_bb[net_id];
+    for (const t_trace* tptr = route_ctx.trace[net_id].head; tptr != nullptr; tptr = tptr->next) {
+        const t_rr_node& node = device_ctx.rr_nodes[tptr->index];
+        footprint.xmin = std::min<int>(footprint.xmin, node.xlow());
+        footprint.ymin = std::min<int>(footprint.ymin, node.ylow());
+        footprint.xmax = std::max<int>(footprint.xmax, node.xhigh());
+        footprint.ymax = std::max<int>(footprint.ymax, node.yhigh());
+    }
+    return footprint;
+}
+
 /*
  * NOTE:
  * Suggest using a timing_driven_route_structs struct. Memory is managed for you
@@ -1128,6 +1293,8 @@ static bool timing_driven_pre_route_to_clock_root(
         if (f_router_debug) {
             update_screen(ScreenUpdatePriority::MAJOR, "Unable to route connection.", ROUTING, nullptr);
         }
+        //Leave the path costs clean for the routing of other (or retried) nets
+        reset_path_costs(modified_rr_node_inf);
         return false;
     } else {
         //Record final link to target
@@ -1246,6 +1413,8 @@ static bool timing_driven_route_sink(ClusterNetId net_id,
         if (f_router_debug) {
             update_screen(ScreenUpdatePriority::MAJOR, "Unable to route connection.", ROUTING, nullptr);
         }
+        //Leave the path costs clean for the routing of other (or retried) nets
+        reset_path_costs(modified_rr_node_inf);
         return false;
     } else {
         //Record final link to target
@@ -1430,20 +1599,14 @@ static t_heap* timing_driven_route_connection_from_route_tree_high_fanout(t_rt_n
         reset_path_costs(modified_rr_node_inf);
         modified_rr_node_inf.clear();
 
-        cheapest = timing_driven_route_connection_from_route_tree(rt_root,
-                                                                  sink_node,
-                                                                  cost_params,
-                                                                  net_bounding_box,
-                                                                  router_lookahead,
-                                                                  modified_rr_node_inf,
-                                                                  router_stats);
-    }
-
-    if (cheapest == nullptr) {
-        VTR_LOG("%s\n", describe_unrouteable_connection(source_node, sink_node).c_str());
-
-        free_route_tree(rt_root);
-        return nullptr;
+        //Frees the route tree itself if no path is found
+        return timing_driven_route_connection_from_route_tree(rt_root,
+                                                              sink_node,
+                                                              cost_params,
+                                                              net_bounding_box,
+                                                              router_lookahead,
+                                                              modified_rr_node_inf,
+                                                              router_stats);
     }
 
     return cheapest;
@@ -1660,7 +1823,8 @@ static t_rt_node* setup_routing_resources(int itry,
     // for nets below a certain size (min_incremental_reroute_fanout), rip up any old routing
     // otherwise, we incrementally reroute by reusing legal parts of the previous iteration
     // convert the previous iteration's traceback into the starting route tree for this iteration
-    if ((int)num_sinks < min_incremental_reroute_fanout || itry == 1) {
+    // (or if the net holds no routing, e.g. it was ripped up after failing to route)
+    if ((int)num_sinks < min_incremental_reroute_fanout || itry == 1 || route_ctx.trace[net_id].head == nullptr) {
         profiling::net_rerouted();
 
         // rip up the whole net
@@ -1970,20 +2134,24 @@ static void timing_driven_expand_neighbours(t_heap* current,
     /* Puts all the rr_nodes adjacent to current on the heap.
      */
 
-    auto& device_ctx = g_vpr_ctx.device();
+    //The expansion reads the rr graph through its compact frozen view,
+    //which keeps each node's edges and the data needed to cost them together
+    const auto& rr_graph = g_vpr_ctx.device().frozen_rr_graph;
 
     t_bb target_bb;
     if (target_node != OPEN) {
-        target_bb.xmin = device_ctx.rr_nodes[target_node].xlow();
-        target_bb.ymin = device_ctx.rr_nodes[target_node].ylow();
-        target_bb.xmax = device_ctx.rr_nodes[target_node].xhigh();
-        target_bb.ymax = device_ctx.rr_nodes[target_node].yhigh();
+        RRNodeId target(target_node);
+        target_bb.xmin = rr_graph.node_xlow(target);
+        target_bb.ymin = rr_graph.node_ylow(target);
+        target_bb.xmax = rr_graph.node_xhigh(target);
+        target_bb.ymax = rr_graph.node_yhigh(target);
     }
 
     //For each node associated with the current heap element, expand all of it's neighbours
-    int num_edges = device_ctx.rr_nodes[current->index].num_edges();
-    for (int iconn = 0; iconn < num_edges; iconn++) {
-        int to_node = device_ctx.rr_nodes[current->index].edge_sink_node(iconn);
+    RRNodeId from_node(current->index);
+    t_edge_size num_edges = rr_graph.node_num_edges(from_node);
+    for (t_edge_size iconn = 0; iconn < num_edges; iconn++) {
+        int to_node = size_t(rr_graph.edge_sink_node(rr_graph.node_edge(from_node, iconn)));
         timing_driven_expand_neighbour(current,
                                        current->index, iconn, to_node,
                                        cost_params,
@@ -2008,12 +2176,13 @@ static void timing_driven_expand_neighbour(t_heap* current,
                                            int target_node,
                                            const t_bb target_bb,
                                            RouterStats& router_stats) {
-    auto& device_ctx = g_vpr_ctx.device();
+    const auto& rr_graph = g_vpr_ctx.device().frozen_rr_graph;
 
-    int to_xlow = device_ctx.rr_nodes[to_node].xlow();
-    int to_ylow = device_ctx.rr_nodes[to_node].ylow();
-    int to_xhigh = device_ctx.rr_nodes[to_node].xhigh();
-    int to_yhigh = device_ctx.rr_nodes[to_node].yhigh();
+    RRNodeId to(to_node);
+    int to_xlow = rr_graph.node_xlow(to);
+    int to_ylow = rr_graph.node_ylow(to);
+    int to_xhigh = rr_graph.node_xhigh(to);
+    int to_yhigh = rr_graph.node_yhigh(to);
 
     if (to_xhigh < bounding_box.xmin      //Strictly left of BB left-edge
         || to_xlow > bounding_box.xmax    //Strictly right of BB right-edge
@@ -2029,12 +2198,21 @@ static void timing_driven_expand_neighbour(t_heap* current,
         return; /* Node is outside (expanded) bounding box. */
     }
 
+    const t_bb* routing_region = get_net_routing_region();
+    if (routing_region
+        && (to_xlow < routing_region->xmin
+            || to_xhigh > routing_region->xmax
+            || to_ylow < routing_region->ymin
+            || to_yhigh > routing_region->ymax)) {
+        return; /* Node is not owned by the region this thread is routing in. */
+    }
+
     /* Prune away IPINs that lead to blocks other than the target one.  Avoids  *
      * the issue of how to cost them properly so they don't get expanded before *
      * more promising routes, but makes route-throughs (via CLBs) impossible.   *
      * Change this if you want to investigate route-throughs.                   */
     if (target_node != OPEN) {
-        t_rr_type to_type = device_ctx.rr_nodes[to_node].type();
+        t_rr_type to_type = rr_graph.node_type(to);
         if (to_type == IPIN) {
             //Check if this IPIN leads to the target block
             // IPIN's of the target block should be contained within it's bounding box
@@ -2143,21 +2321,25 @@ static void evaluate_timing_driven_node_costs(t_heap* to,
      *
      * new_costs.R_upstream: is the upstream resistance at the end of this node
      */
-    auto& device_ctx = g_vpr_ctx.device();
+    const auto& rr_graph = g_vpr_ctx.device().frozen_rr_graph;
+
+    RRNodeId from(from_node);
+    RRNodeId to_id(to_node);
+    RREdgeId edge = rr_graph.node_edge(from, iconn);
 
     //Info for the switch connecting from_node to_node
-    int iswitch = device_ctx.rr_nodes[from_node].edge_switch(iconn);
-    bool switch_buffered = device_ctx.rr_switch_inf[iswitch].buffered();
-    float switch_R = device_ctx.rr_switch_inf[iswitch].R;
-    float switch_Tdel = device_ctx.rr_switch_inf[iswitch].Tdel;
-    float switch_Cinternal = device_ctx.rr_switch_inf[iswitch].Cinternal;
+    RRSwitchId iswitch = rr_graph.edge_switch(edge);
+    bool switch_buffered = rr_graph.switch_buffered(iswitch);
+    float switch_R = rr_graph.switch_R(iswitch);
+    float switch_Tdel = rr_graph.switch_Tdel(iswitch);
+    float switch_Cinternal = rr_graph.switch_Cinternal(iswitch);
 
     //To node info
-    float node_C = device_ctx.rr_nodes[to_node].C();
-    float node_R = device_ctx.rr_nodes[to_node].R();
+    float node_C = rr_graph.node_C(to_id);
+    float node_R = rr_graph.node_R(to_id);
 
     //From node info
-    float from_node_R = device_ctx.rr_nodes[from_node].R();
+    float from_node_R = rr_graph.node_R(from);
 
     //Update R_upstream
     if (switch_buffered) {
@@ -2189,7 +2371,7 @@ static void evaluate_timing_driven_node_costs(t_heap* to,
     //Second, we adjust the Tdel to account for the delay caused by the internal capacitance.
     Tdel += Rdel_adjust * switch_Cinternal;
 
-    bool reached_configurably = device_ctx.rr_nodes[from_node].edge_is_configurable(iconn);
+    bool reached_configurably = rr_graph.edge_is_configurable(edge);
 
     float cong_cost = 0.;
     if (reached_configurably) {
@@ -2211,8 +2393,8 @@ static void evaluate_timing_driven_node_costs(t_heap* to,
     to->backward_path_cost += cost_params.criticality * Tdel;             //Delay cost
 
     if (cost_params.bend_cost != 0.) {
-        t_rr_type from_type = device_ctx.rr_nodes[from_node].type();
-        t_rr_type to_type = device_ctx.rr_nodes[to_node].type();
+        t_rr_type from_type = rr_graph.node_type(from);
+        t_rr_type to_type = rr_graph.node_type(to_id);
         if ((from_type == CHANX && to_type == CHANY) || (from_type == CHANY && to_type == CHANX)) {
             to->backward_path_cost += cost_params.bend_cost; //Bend cost
         }
@@ -2256,10 +2438,15 @@ void update_rr_base_costs(int fanout) {
     factor = sqrt(fanout);
 
     for (index = CHANX_COST_INDEX_START; index < device_ctx.rr_indexed_data.size(); index++) {
+        float base_cost = device_ctx.rr_indexed_data[index].saved_base_cost;
         if (device_ctx.rr_indexed_data[index].T_quadratic > 0.) { /* pass transistor */
-            device_ctx.rr_indexed_data[index].base_cost = device_ctx.rr_indexed_data[index].saved_base_cost * factor;
-        } else {
-            device_ctx.rr_indexed_data[index].base_cost = device_ctx.rr_indexed_data[index].saved_base_cost;
+            base_cost *= factor;
+        }
+
+        //Only store changed costs, so that routing a net never writes the
+        //(shared) indexed data when no cost depends on fanout
+        if (device_ctx.rr_indexed_data[index].base_cost != base_cost) {
+            device_ctx.rr_indexed_data[index].base_cost = base_cost;
         }
     }
 }
@@ -2360,10 +2547,12 @@ static bool early_exit_heuristic(const t_router_opts& router_opts, const Wirelen
 }
 
 // incremental rerouting resources class definitions
+thread_local std::vector<int> Connection_based_routing_resources::remaining_targets;
+thread_local std::vector<t_rt_node*> Connection_based_routing_resources::reached_rt_sinks;
+thread_local ClusterNetId Connection_based_routing_resources::current_inet;
+
 Connection_based_routing_resources::Connection_based_routing_resources()
-    : current_inet(NO_PREVIOUS)
-    , // not routing to a specific net yet (note that NO_PREVIOUS is not unsigned, so will be largest unsigned)
-    last_stable_critical_path_delay{0.0f}
+    : last_stable_critical_path_delay{0.0f}
     , critical_path_growth_tolerance{1.001f}
     , connection_criticality_tolerance{0.9f}
     , connection_delay_optimality_tolerance{1.1f} {
@@ -2377,6 +2566,9 @@ Connection_based_routing_resources::Connection_based_routing_resources()
      * reached_rt_sinks will also reserve enough space, but instead of
      * indices, it will store the pointers to route tree nodes */
 
+    // not routing to a specific net yet (note that NO_PREVIOUS is not unsigned, so will be largest unsigned)
+    current_inet = ClusterNetId(NO_PREVIOUS);
+
     auto& cluster_ctx = g_vpr_ctx.clustering();
     auto& route_ctx = g_vpr_ctx.routing();
 
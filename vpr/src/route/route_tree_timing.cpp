@@ -29,10 +29,13 @@
 
 static std::vector<t_rt_node*> rr_node_to_rt_node; /* [0..device_ctx.rr_nodes.size()-1] */
 
-/* Frees lists for fast addition and deletion of nodes and edges. */
+/* Frees lists for fast addition and deletion of nodes and edges.  They are
+ * thread-local since route trees of nets in disjoint routing regions may be
+ * built concurrently; the nodes themselves are malloc'd individually, so a
+ * node may be freed onto a different thread's list than it came from.      */
 
-static t_rt_node* rt_node_free_list = nullptr;
-static t_linked_rt_edge* rt_edge_free_list = nullptr;
+static thread_local t_rt_node* rt_node_free_list = nullptr;
+static thread_local t_linked_rt_edge* rt_edge_free_list = nullptr;
 
 /********************** Subroutines local to this module *********************/
 
@@ -41,7 +41,8 @@ bool RouterDelayProfiler::calculate_delay(int source_node, int sink_node, const
 
     route_budgets budgeting_inf;
 
-    init_heap(device_ctx.grid);
+    RouterHeapScope heap_scope(heap_);
+    init_heap(device_ctx.grid, router_opts.router_heap);
 
     std::vector<int> modified_rr_node_inf;
     RouterStats router_stats;
@@ -92,7 +93,9 @@ std::vector<float> calculate_all_path_delays_from_rr_node(int src_rr_node, const
     std::vector<int> modified_rr_node_inf;
     RouterStats router_stats;
 
-    init_heap(device_ctx.grid);
+    RouterHeap heap;
+    RouterHeapScope heap_scope(heap);
+    init_heap(device_ctx.grid, router_opts.router_heap);
 
     std::vector<t_heap> shortest_paths = timing_driven_find_all_shortest_paths_from_route_tree(rt_root,
                                                                                                cost_params,
@@ -3,6 +3,7 @@
 
 #include "vpr_types.h"
 #include "router_lookahead.h"
+#include "router_heap.h"
 
 #include <vector>
 
@@ -13,6 +14,7 @@ class RouterDelayProfiler {
 
   private:
     const RouterLookahead* router_lookahead_;
+    mutable RouterHeap heap_; //Scratch heap owned by this profiler
 };
 
 std::vector<float> calculate_all_path_delays_from_rr_node(int src_rr_node, const t_router_opts& router_opts);
@@ -0,0 +1,234 @@
+#include <algorithm>
+
+#include "vtr_assert.h"
+#include "vtr_log.h"
+
+#include "router_heap.h"
+
+//Number of elements allocated at once when the element pool is exhausted
+static constexpr size_t HEAP_BLOCK_SIZE = 1024;
+
+RouterHeap::RouterHeap(e_heap_type type) {
+    set_type(type);
+}
+
+RouterHeap::~RouterHeap() {
+    free_all_memory();
+}
+
+void RouterHeap::set_type(e_heap_type type) {
+    VTR_ASSERT(heap_.empty());
+    if (type == e_heap_type::FOUR_ARY_HEAP) {
+        arity_log2_ = 2;
+    } else {
+        VTR_ASSERT(type == e_heap_type::BINARY_HEAP);
+        arity_log2_ = 1;
+    }
+}
+
+e_heap_type RouterHeap::type() const {
+    return (arity_log2_ == 2) ? e_heap_type::FOUR_ARY_HEAP : e_heap_type::BINARY_HEAP;
+}
+
+void RouterHeap::init(size_t capacity) {
+    empty_heap();
+    heap_.reserve(capacity);
+}
+
+t_heap* RouterHeap::alloc() {
+    if (free_head_ == nullptr) { /* No elements on the free list */
+        alloc_block();
+    }
+
+    //Extract the head
+    t_heap* hptr = free_head_;
+    free_head_ = free_head_->u.next;
+
+    num_allocated_++;
+
+    //Reset
+    hptr->cost = 0.;
+    hptr->backward_path_cost = 0.;
+    hptr->R_upstream = 0.;
+    hptr->index = OPEN;
+    hptr->u.prev.node = NO_PREVIOUS;
+    hptr->u.prev.edge = NO_PREVIOUS;
+    return hptr;
+}
+
+void RouterHeap::free(t_heap* hptr) {
+    hptr->u.next = free_head_;
+    free_head_ = hptr;
+    num_allocated_--;
+}
+
+void RouterHeap::add_to_heap(t_heap* hptr) {
+    // start with undefined hole
+    heap_.push_back(nullptr);
+    sift_up(heap_.size() - 1, hptr);
+    ++num_pushes_;
+}
+
+void RouterHeap::push_back(t_heap* hptr) {
+    heap_.push_back(hptr);
+    ++num_pushes_;
+}
+
+// runs in O(n) time by sifting down; the least work is done on the most elements
+void RouterHeap::build_heap() {
+    if (heap_.size() < 2) return;
+
+    // elements after the parent of the last element are leaves
+    for (size_t i = parent(heap_.size() - 1) + 1; i != 0; --i) {
+        sift_down(i - 1);
+    }
+}
+
+t_heap* RouterHeap::get_heap_head() {
+    t_heap* cheapest;
+    do {
+        if (heap_.empty()) { /* Empty heap. */
+            VTR_LOG_WARN("Empty heap occurred in get_heap_head.\n");
+            return nullptr;
+        }
+
+        cheapest = heap_[0];
+
+        //Move the hole left by the root down along the cheapest children to a
+        //leaf, then fill it with the last element
+        t_heap* last = heap_.back();
+        heap_.pop_back();
+
+        size_t num_elements = heap_.size();
+        if (num_elements != 0) {
+            size_t arity = size_t(1) << arity_log2_;
+            size_t hole = 0;
+            size_t child = first_child(0);
+            while (child < num_elements) {
+                size_t best = child;
+                size_t end = std::min(child + arity, num_elements);
+                for (size_t i = child + 1; i < end; ++i) {
+                    if (heap_[i]->cost < heap_[best]->cost) best = i;
+                }
+                heap_[hole] = heap_[best];
+                hole = best;
+                child = first_child(best);
+            }
+            sift_up(hole, last);
+        }
+
+        if (cheapest->index == OPEN) { /* Get another one if invalid entry. */
+            free(cheapest);
+            cheapest = nullptr;
+        }
+    } while (cheapest == nullptr);
+
+    return cheapest;
+}
+
+bool RouterHeap::is_empty_heap() const {
+    return heap_.empty();
+}
+
+size_t RouterHeap::size() const {
+    return heap_.size();
+}
+
+void RouterHeap::empty_heap() {
+    for (t_heap* hptr : heap_) {
+        free(hptr);
+    }
+    heap_.clear();
+}
+
+void RouterHeap::invalidate_heap_entries(int sink_node, int ipin_node) {
+    /* Used only by the breadth_first router and even then only in rare circumstances. */
+    for (t_heap* hptr : heap_) {
+        if (hptr->index == sink_node && hptr->u.prev.node == ipin_node) {
+            hptr->index = OPEN; /* Invalid. */
+            break;
+        }
+    }
+}
+
+bool RouterHeap::is_valid() const {
+    for (size_t i = 1; i < heap_.size(); ++i) {
+        if (heap_[i]->cost < heap_[parent(i)]->cost) return false;
+    }
+    return true;
+}
+
+void RouterHeap::print_heap() const {
+    for (const t_heap* hptr : heap_) {
+        VTR_LOG("(%d %e) ", hptr->index, hptr->cost);
+    }
+    VTR_LOG("\n");
+}
+
+void RouterHeap::free_all_memory() {
+    heap_.clear();
+    heap_.shrink_to_fit();
+
+    blocks_.clear();
+    free_head_ = nullptr;
+    num_allocated_ = 0;
+}
+
+size_t RouterHeap::num_pushes() const {
+    return num_pushes_;
+}
+
+size_t RouterHeap::num_allocated() const {
+    return num_allocated_;
+}
+
+size_t RouterHeap::parent(size_t i) const {
+    return (i - 1) >> arity_log2_;
+}
+
+size_t RouterHeap::first_child(size_t i) const {
+    return (i << arity_log2_) + 1;
+}
+
+// O(log n) sifting up of node from the hole at leaf
+void RouterHeap::sift_up(size_t leaf, t_heap* node) {
+    while (leaf > 0 && node->cost < heap_[parent(leaf)]->cost) {
+        // sift hole up
+        heap_[leaf] = heap_[parent(leaf)];
+        leaf = parent(leaf);
+    }
+    heap_[leaf] = node;
+}
+
+// O(log n) sifting down of the element at hole
+void RouterHeap::sift_down(size_t hole) {
+    size_t arity = size_t(1) << arity_log2_;
+    size_t num_elements = heap_.size();
+
+    t_heap* node = heap_[hole];
+    size_t child = first_child(hole);
+    while (child < num_elements) {
+        size_t best = child;
+        size_t end = std::min(child + arity, num_elements);
+        for (size_t i = child + 1; i < end; ++i) {
+            if (heap_[i]->cost < heap_[best]->cost) best = i;
+        }
+        if (!(heap_[best]->cost < node->cost)) break;
+
+        heap_[hole] = heap_[best];
+        hole = best;
+        child = first_child(best);
+    }
+    heap_[hole] = node;
+}
+
+void RouterHeap::alloc_block() {
+    blocks_.emplace_back(new t_heap[HEAP_BLOCK_SIZE]);
+    t_heap* block = blocks_.back().get();
+
+    //Thread the new elements onto the free list
+    for (size_t i = 0; i < HEAP_BLOCK_SIZE; ++i) {
+        block[i].u.next = (i + 1 < HEAP_BLOCK_SIZE) ? &block[i + 1] : free_head_;
+    }
+    free_head_ = block;
+}
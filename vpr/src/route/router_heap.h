@@ -0,0 +1,146 @@
+#ifndef VPR_ROUTER_HEAP_H
+#define VPR_ROUTER_HEAP_H
+#include <memory>
+#include <vector>
+#include "vpr_types.h"
+
+/* Used by the heap as its fundamental data structure.
+ * Each heap element represents a partial route.
+ *
+ * cost:    The cost used to sort heap.
+ *          For the timing-driven router this is the backward_path_cost +
+ *          expected cost to the target.
+ *          For the breadth-first router it is the node cost to reach this
+ *          point.
+ *
+ * backward_path_cost:  Used only by the timing-driven router.  The "known"
+ *                      cost of the path up to and including this node.
+ *                      In this case, the .cost member contains not only
+ *                      the known backward cost but also an expected cost
+ *                      to the target.
+ *
+ * R_upstream: Used only by the timing-driven router.  Stores the upstream
+ *             resistance to ground from this node, including the
+ *             resistance of the node itself (device_ctx.rr_nodes[index].R).
+ *
+ * index: The RR node index associated with the costs/R_upstream values
+ *
+ * u.prev.node: The previous node used to reach the current 'index' node
+ * u.prev.next: The edge from u.prev.node used to reach the current 'index' node
+ *
+ * u.next:  pointer to the next s_heap structure in the free
+ *          linked list.  Not used when on the heap.
+ *
+ */
+struct t_heap {
+    float cost = 0.;
+    float backward_path_cost = 0.;
+    float R_upstream = 0.;
+
+    int index = OPEN;
+
+    struct t_prev {
+        int node;
+        int edge;
+    };
+
+    union {
+        t_heap* next;
+        t_prev prev;
+    } u;
+};
+
+// A min-priority queue of t_heap elements (keyed on t_heap::cost), together
+// with the pool the elements are allocated from.
+//
+// Elements are carved out of fixed-size blocks owned by the heap and recycled
+// through a free list, so once the pool has grown to the peak number of live
+// elements pushing and popping never allocates. All elements are released
+// when the heap is destroyed (or free_all_memory() is called).
+//
+// Each router (and each thread routing nets) owns its own RouterHeap, so
+// independent searches never share heap state.
+class RouterHeap {
+  public:
+    explicit RouterHeap(e_heap_type type = e_heap_type::BINARY_HEAP);
+    ~RouterHeap();
+
+    RouterHeap(const RouterHeap&) = delete;
+    RouterHeap& operator=(const RouterHeap&) = delete;
+
+    // Selects the heap arity. The heap must be empty.
+    void set_type(e_heap_type type);
+    e_heap_type type() const;
+
+    // Empties the heap and reserves space for the given number of elements
+    void init(size_t capacity);
+
+    // Returns a reset element from the pool
+    t_heap* alloc();
+
+    // Returns an element (which is not on the heap) to the pool
+    void free(t_heap* hptr);
+
+    // Adds an element and restores the heap property
+    void add_to_heap(t_heap* hptr);
+
+    // Adds an element without restoring the heap property; call build_heap()
+    // once all elements have been pushed
+    void push_back(t_heap* hptr);
+
+    // Restores the heap property over all elements in O(n)
+    void build_heap();
+
+    // Removes and returns the cheapest element, or nullptr if the heap is
+    // empty. Invalid (index == OPEN) elements are never returned -- they
+    // are just skipped over (and returned to the pool).
+    t_heap* get_heap_head();
+
+    bool is_empty_heap() const;
+    size_t size() const;
+
+    // Returns all elements on the heap to the pool
+    void empty_heap();
+
+    // Marks the element for sink_node reached via ipin_node as invalid (OPEN)
+    void invalidate_heap_entries(int sink_node, int ipin_node);
+
+    // Returns true if the heap property holds for all elements
+    bool is_valid() const;
+
+    // Prints every element (not necessarily in order)
+    void print_heap() const;
+
+    // Releases the heap storage and all pooled elements. Any outstanding
+    // elements become invalid.
+    void free_all_memory();
+
+    // Number of elements added to the heap since construction
+    size_t num_pushes() const;
+    // Number of elements currently allocated from the pool
+    size_t num_allocated() const;
+
+  private:
+    size_t parent(size_t i) const;
+    size_t first_child(size_t i) const;
+
+    void sift_up(size_t leaf, t_heap* node);
+    void sift_down(size_t hole);
+
+    void alloc_block();
+
+  private:
+    std::vector<t_heap*> heap_; //Heap ordered elements, rooted at index 0
+
+    //log2 of the number of children of each heap node
+    size_t arity_log2_ = 1;
+
+    //Element pool
+    std::vector<std::unique_ptr<t_heap[]>> blocks_;
+    t_heap* free_head_ = nullptr;
+
+    size_t num_pushes_ = 0;
+    size_t num_allocated_ = 0;
+};
+
+#endif /* VPR_ROUTER_HEAP_H */
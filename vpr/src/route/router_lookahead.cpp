@@ -28,10 +28,13 @@ std::unique_ptr<RouterLookahead> make_router_lookahead(
     const std::vector<t_segment_inf>& segment_inf) {
     std::unique_ptr<RouterLookahead> router_lookahead = make_router_lookahead_object(router_lookahead_type);
 
-    if (read_lookahead.empty()) {
+    bool lookahead_read = false;
+    if (!read_lookahead.empty()) {
+        lookahead_read = router_lookahead->read(read_lookahead);
+    }
+
+    if (!lookahead_read) {
         router_lookahead->compute(segment_inf);
-    } else {
-        router_lookahead->read(read_lookahead);
     }
 
     if (!write_lookahead.empty()) {
@@ -105,6 +108,14 @@ void MapLookahead::compute(const std::vector<t_segment_inf>& segment_inf) {
     compute_router_lookahead(segment_inf.size());
 }
 
+bool MapLookahead::read(const std::string& file) {
+    return read_router_lookahead(file);
+}
+
+void MapLookahead::write(const std::string& file) const {
+    write_router_lookahead(file);
+}
+
 float NoOpLookahead::get_expected_cost(int /*current_node*/, int /*target_node*/, const t_conn_cost_params& /*params*/, float /*R_upstream*/) const {
     return 0.;
 }
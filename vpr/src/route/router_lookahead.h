@@ -18,8 +18,10 @@ class RouterLookahead {
     virtual void compute(const std::vector<t_segment_inf>& segment_inf) = 0;
 
     // Read router lookahead data (if any) from specified file.
+    // Returns false if the file holds no lookahead for the current RR graph
+    // (e.g. it does not exist yet), in which case compute must be invoked.
     // May be unimplemented, in which case method should throw an exception.
-    virtual void read(const std::string& file) = 0;
+    virtual bool read(const std::string& file) = 0;
 
     // Write router lookahead data (if any) to specified file.
     // May be unimplemented, in which case method should throw an exception.
@@ -57,7 +59,7 @@ class ClassicLookahead : public RouterLookahead {
     void compute(const std::vector<t_segment_inf>& /*segment_inf*/) override {
     }
 
-    void read(const std::string& /*file*/) override {
+    bool read(const std::string& /*file*/) override {
         VPR_THROW(VPR_ERROR_ROUTE, "ClassicLookahead::read unimplemented");
     }
     void write(const std::string& /*file*/) const override {
@@ -72,12 +74,8 @@ class MapLookahead : public RouterLookahead {
   protected:
     float get_expected_cost(int node, int target_node, const t_conn_cost_params& params, float R_upstream) const override;
     void compute(const std::vector<t_segment_inf>& segment_inf) override;
-    void read(const std::string& /*file*/) override {
-        VPR_THROW(VPR_ERROR_ROUTE, "MapLookahead::read unimplemented");
-    }
-    void write(const std::string& /*file*/) const override {
-        VPR_THROW(VPR_ERROR_ROUTE, "MapLookahead::write unimplemented");
-    }
+    bool read(const std::string& file) override;
+    void write(const std::string& file) const override;
 };
 
 class NoOpLookahead : public RouterLookahead {
@@ -85,7 +83,7 @@ class NoOpLookahead : public RouterLookahead {
     float get_expected_cost(int node, int target_node, const t_conn_cost_params& params, float R_upstream) const override;
     void compute(const std::vector<t_segment_inf>& /*segment_inf*/) override {
     }
-    void read(const std::string& /*file*/) override {
+    bool read(const std::string& /*file*/) override {
         VPR_THROW(VPR_ERROR_ROUTE, "Read not supported for NoOpLookahead");
     }
     void write(const std::string& /*file*/) const override {
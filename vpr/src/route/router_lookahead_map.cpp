@@ -15,8 +15,9 @@
 
 #include <cmath>
 #include <vector>
-#include <queue>
 #include <ctime>
+#include <sstream>
+#include <limits>
 #include "vpr_types.h"
 #include "vpr_error.h"
 #include "vpr_utils.h"
@@ -25,7 +26,24 @@
 #include "vtr_log.h"
 #include "vtr_assert.h"
 #include "vtr_time.h"
+#include "vtr_hash.h"
+#include "vtr_digest.h"
+#include "vtr_util.h"
 #include "router_lookahead_map.h"
+#include "router_heap.h"
+
+#ifdef VTR_ENABLE_CAPNPROTO
+#    include "capnp/serialize.h"
+#    include "map_lookahead.capnp.h"
+#    include "ndmatrix_serdes.h"
+#    include "mmap_file.h"
+#    include "serdes_utils.h"
+#endif /* VTR_ENABLE_CAPNPROTO */
+
+#if defined(VPR_USE_TBB)
+#    include <tbb/enumerable_thread_specific.h>
+#    include <tbb/parallel_for.h>
+#endif
 
 /* the cost map is computed by running a Dijkstra search from channel segment rr nodes at the specified reference coordinate */
 #define REF_X 3
@@ -96,6 +114,12 @@ class Expansion_Cost_Entry {
             this->cost_vector.push_back(cost_entry);
         }
     }
+    /* adds all the cost entries of other (in the order they were added to it) */
+    void add_cost_entries(const Expansion_Cost_Entry& other) {
+        for (const Cost_Entry& cost_entry : other.cost_vector) {
+            this->add_cost_entry(cost_entry.delay, cost_entry.congestion);
+        }
+    }
     void clear_cost_entries() {
         this->cost_vector.clear();
     }
@@ -168,9 +192,23 @@ class PQ_Entry {
         this->cost = this->delay;
     }
 
-    bool operator<(const PQ_Entry& obj) const {
-        /* inserted into max priority queue so want queue entries with a lower cost to be greater */
-        return (this->cost > obj.cost);
+    /* entries are queued as router heap elements, with the delay as the cost and
+     * the upstream congestion as the backward path cost */
+    explicit PQ_Entry(const t_heap& elem) {
+        this->rr_node_ind = elem.index;
+        this->cost = elem.cost;
+        this->delay = elem.cost;
+        this->R_upstream = elem.R_upstream;
+        this->congestion_upstream = elem.backward_path_cost;
+    }
+
+    void push(RouterHeap& heap) const {
+        t_heap* elem = heap.alloc();
+        elem->index = this->rr_node_ind;
+        elem->cost = this->delay;
+        elem->R_upstream = this->R_upstream;
+        elem->backward_path_cost = this->congestion_upstream;
+        heap.add_to_heap(elem);
     }
 };
 
@@ -183,6 +221,49 @@ typedef vtr::NdMatrix<Cost_Entry, 4> t_cost_map; //[0..1][[0..num_seg_types-1]0.
  * the list at each coordinate is later boiled down to a single representative cost entry to be stored in the final cost map */
 typedef vtr::Matrix<Expansion_Cost_Entry> t_routing_cost_map; //[0..device_ctx.grid.width()-1][0..device_ctx.grid.height()-1]
 
+/* a Dijkstra run from one sample start node */
+struct t_dijkstra_run {
+    int start_node_ind;
+    int start_x;
+    int start_y;
+};
+
+/* scratch state of the Dijkstra runs, owned by one thread and reused across its runs. a node's visited cost and
+ * expanded flag are only valid if stamped with the epoch of the current run, so starting a run does not have to
+ * reset per-node state for the whole rr graph */
+class Dijkstra_Scratch {
+  public:
+    /* starts a new run, invalidating the state of all nodes */
+    void new_run(size_t num_nodes) {
+        if (visited_epoch.size() != num_nodes || epoch == std::numeric_limits<unsigned>::max()) {
+            visited_epoch.assign(num_nodes, 0);
+            expanded_epoch.assign(num_nodes, 0);
+            node_visited_costs.resize(num_nodes);
+            epoch = 0;
+        }
+        ++epoch;
+    }
+
+    bool is_expanded(int inode) const { return expanded_epoch[inode] == epoch; }
+    void set_expanded(int inode) { expanded_epoch[inode] = epoch; }
+
+    /* returns the cost with which the node has been visited in this run, or a negative value if it has not been */
+    float visited_cost(int inode) const { return (visited_epoch[inode] == epoch) ? node_visited_costs[inode] : -1.0; }
+    void set_visited_cost(int inode, float cost) {
+        visited_epoch[inode] = epoch;
+        node_visited_costs[inode] = cost;
+    }
+
+    /* a priority queue for expansion */
+    RouterHeap heap;
+
+  private:
+    unsigned epoch = 0;
+    std::vector<unsigned> visited_epoch;
+    std::vector<unsigned> expanded_epoch;
+    std::vector<float> node_visited_costs;
+};
+
 /******** File-Scope Variables ********/
 /* The cost map */
 t_cost_map f_cost_map;
@@ -194,9 +275,12 @@ static void free_cost_map();
 static int get_start_node_ind(int start_x, int start_y, int target_x, int target_y, t_rr_type rr_type, int seg_index, int track_offset);
 /* runs Dijkstra's algorithm from specified node until all nodes have been visited. Each time a pin is visited, the delay/congestion information
  * to that pin is stored is added to an entry in the routing_cost_map */
-static void run_dijkstra(int start_node_ind, int start_x, int start_y, t_routing_cost_map& routing_cost_map);
+static void run_dijkstra(int start_node_ind, int start_x, int start_y, t_routing_cost_map& routing_cost_map, Dijkstra_Scratch& scratch);
+/* runs Dijkstra's algorithm from each of the sample start nodes (concurrently if possible), merging their delay/congestion
+ * information into routing_cost_map in the order of runs */
+static void run_dijkstras(const std::vector<t_dijkstra_run>& runs, t_routing_cost_map& routing_cost_map);
 /* iterates over the children of the specified node and selectively pushes them onto the priority queue */
-static void expand_dijkstra_neighbours(PQ_Entry parent_entry, std::vector<float>& node_visited_costs, std::vector<bool>& node_expanded, std::priority_queue<PQ_Entry>& pq);
+static void expand_dijkstra_neighbours(PQ_Entry parent_entry, Dijkstra_Scratch& scratch);
 /* sets the lookahead cost map entries based on representative cost entries from routing_cost_map */
 static void set_lookahead_map_costs(int segment_index, e_rr_type chan_type, t_routing_cost_map& routing_cost_map);
 /* fills in missing lookahead map entries by copying the cost of the closest valid entry */
@@ -208,6 +292,9 @@ static void get_xy_deltas(int from_node_ind, int to_node_ind, int* delta_x, int*
 
 static void print_cost_map();
 
+/* returns a digest identifying the architecture and rr graph (everything the cost map is computed from) */
+static std::string get_lookahead_digest();
+
 /******** Function Definitions ********/
 /* queries the lookahead_map (should have been computed prior to routing) to get the expected cost
  * from the specified source to the specified target */
@@ -259,6 +346,7 @@ void compute_router_lookahead(int num_segments) {
             /* allocate the cost map for this iseg/chan_type */
             t_routing_cost_map routing_cost_map({device_ctx.grid.width(), device_ctx.grid.height()});
 
+            std::vector<t_dijkstra_run> runs;
             for (int ref_inc = 0; ref_inc < 3; ref_inc++) {
                 for (int track_offset = 0; track_offset < MAX_TRACK_OFFSET; track_offset += 2) {
                     /* get the rr node index from which to start routing */
@@ -270,11 +358,13 @@ void compute_router_lookahead(int num_segments) {
                         continue;
                     }
 
-                    /* run Dijkstra's algorithm */
-                    run_dijkstra(start_node_ind, REF_X + ref_inc, REF_Y + ref_inc, routing_cost_map);
+                    runs.push_back({start_node_ind, REF_X + ref_inc, REF_Y + ref_inc});
                 }
             }
 
+            /* run Dijkstra's algorithm */
+            run_dijkstras(runs, routing_cost_map);
+
             /* boil down the cost list in routing_cost_map at each coordinate to a representative cost entry and store it in the lookahead
              * cost map */
             set_lookahead_map_costs(iseg, chan_type, routing_cost_map);
@@ -341,33 +431,65 @@ static void free_cost_map() {
     f_cost_map.clear();
 }
 
+/* runs Dijkstra's algorithm from each of the sample start nodes (concurrently if possible), merging their delay/congestion
+ * information into routing_cost_map in the order of runs */
+static void run_dijkstras(const std::vector<t_dijkstra_run>& runs, t_routing_cost_map& routing_cost_map) {
+    /* each run records its costs in a private map, which are merged in run order below so that the result does not
+     * depend on how the runs were scheduled */
+    std::vector<t_routing_cost_map> run_cost_maps(runs.size());
+
+#if defined(VPR_USE_TBB)
+    tbb::enumerable_thread_specific<Dijkstra_Scratch> thread_scratch;
+    tbb::parallel_for(size_t(0), runs.size(), [&](size_t irun) {
+        const t_dijkstra_run& run = runs[irun];
+        run_cost_maps[irun] = t_routing_cost_map({routing_cost_map.dim_size(0), routing_cost_map.dim_size(1)});
+        run_dijkstra(run.start_node_ind, run.start_x, run.start_y, run_cost_maps[irun], thread_scratch.local());
+    });
+#else
+    Dijkstra_Scratch scratch;
+    for (size_t irun = 0; irun < runs.size(); irun++) {
+        const t_dijkstra_run& run = runs[irun];
+        run_cost_maps[irun] = t_routing_cost_map({routing_cost_map.dim_size(0), routing_cost_map.dim_size(1)});
+        run_dijkstra(run.start_node_ind, run.start_x, run.start_y, run_cost_maps[irun], scratch);
+    }
+#endif
+
+    for (t_routing_cost_map& run_cost_map : run_cost_maps) {
+        for (size_t ix = 0; ix < routing_cost_map.dim_size(0); ix++) {
+            for (size_t iy = 0; iy < routing_cost_map.dim_size(1); iy++) {
+                routing_cost_map[ix][iy].add_cost_entries(run_cost_map[ix][iy]);
+            }
+        }
+        run_cost_map.clear();
+    }
+}
+
 /* runs Dijkstra's algorithm from specified node until all nodes have been visited. Each time a pin is visited, the delay/congestion information
  * to that pin is stored is added to an entry in the routing_cost_map */
-static void run_dijkstra(int start_node_ind, int start_x, int start_y, t_routing_cost_map& routing_cost_map) {
+static void run_dijkstra(int start_node_ind, int start_x, int start_y, t_routing_cost_map& routing_cost_map, Dijkstra_Scratch& scratch) {
     auto& device_ctx = g_vpr_ctx.device();
 
-    /* a list of boolean flags (one for each rr node) to figure out if a certain node has already been expanded */
-    std::vector<bool> node_expanded(device_ctx.rr_nodes.size(), false);
-    /* for each node keep a list of the cost with which that node has been visited (used to determine whether to push
-     * a candidate node onto the expansion queue */
-    std::vector<float> node_visited_costs(device_ctx.rr_nodes.size(), -1.0);
-    /* a priority queue for expansion */
-    std::priority_queue<PQ_Entry> pq;
+    /* forget which nodes were expanded/visited (and with what cost) by the previous run */
+    scratch.new_run(device_ctx.rr_nodes.size());
+
+    RouterHeap& heap = scratch.heap;
+    VTR_ASSERT(heap.is_empty_heap());
 
     /* first entry has no upstream delay or congestion */
     PQ_Entry first_entry(start_node_ind, UNDEFINED, 0, 0, 0, true);
 
-    pq.push(first_entry);
+    first_entry.push(heap);
 
     /* now do routing */
-    while (!pq.empty()) {
-        PQ_Entry current = pq.top();
-        pq.pop();
+    while (!heap.is_empty_heap()) {
+        t_heap* top = heap.get_heap_head();
+        PQ_Entry current(*top);
+        heap.free(top);
 
         int node_ind = current.rr_node_ind;
 
         /* check that we haven't already expanded from this node */
-        if (node_expanded[node_ind]) {
+        if (scratch.is_expanded(node_ind)) {
             continue;
         }
 
@@ -384,13 +506,13 @@ static void run_dijkstra(int start_node_ind, int start_x, int start_y, t_routing
             }
         }
 
-        expand_dijkstra_neighbours(current, node_visited_costs, node_expanded, pq);
-        node_expanded[node_ind] = true;
+        expand_dijkstra_neighbours(current, scratch);
+        scratch.set_expanded(node_ind);
     }
 }
 
 /* iterates over the children of the specified node and selectively pushes them onto the priority queue */
-static void expand_dijkstra_neighbours(PQ_Entry parent_entry, std::vector<float>& node_visited_costs, std::vector<bool>& node_expanded, std::priority_queue<PQ_Entry>& pq) {
+static void expand_dijkstra_neighbours(PQ_Entry parent_entry, Dijkstra_Scratch& scratch) {
     auto& device_ctx = g_vpr_ctx.device();
 
     int parent_ind = parent_entry.rr_node_ind;
@@ -402,7 +524,7 @@ static void expand_dijkstra_neighbours(PQ_Entry parent_entry, std::vector<float>
         int switch_ind = parent_node.edge_switch(iedge);
 
         /* skip this child if it has already been expanded from */
-        if (node_expanded[child_node_ind]) {
+        if (scratch.is_expanded(child_node_ind)) {
             continue;
         }
 
@@ -412,13 +534,14 @@ static void expand_dijkstra_neighbours(PQ_Entry parent_entry, std::vector<float>
         //VTR_ASSERT(child_entry.cost >= 0); //Asertion fails in practise. TODO: debug
 
         /* skip this child if it has been visited with smaller cost */
-        if (node_visited_costs[child_node_ind] >= 0 && node_visited_costs[child_node_ind] < child_entry.cost) {
+        float visited_cost = scratch.visited_cost(child_node_ind);
+        if (visited_cost >= 0 && visited_cost < child_entry.cost) {
             continue;
         }
 
         /* finally, record the cost with which the child was visited and put the child entry on the queue */
-        node_visited_costs[child_node_ind] = child_entry.cost;
-        pq.push(child_entry);
+        scratch.set_visited_cost(child_node_ind, child_entry.cost);
+        child_entry.push(scratch.heap);
     }
 }
 
@@ -677,3 +800,117 @@ static void print_cost_map() {
         }
     }
 }
+
+/* returns a digest identifying the architecture and rr graph (everything the cost map is computed from) */
+static std::string get_lookahead_digest() {
+    auto& device_ctx = g_vpr_ctx.device();
+
+    std::stringstream key;
+    key.precision(std::numeric_limits<float>::max_digits10);
+    key << "arch: " << ((device_ctx.arch && device_ctx.arch->architecture_id) ? device_ctx.arch->architecture_id : "") << "\n";
+    key << "grid: " << device_ctx.grid.width() << " " << device_ctx.grid.height() << "\n";
+    key << "chan_width: " << device_ctx.chan_width.max << " " << device_ctx.chan_width.x_max << " " << device_ctx.chan_width.y_max << "\n";
+
+    /* the delay and congestion of each wire type */
+    for (const auto& indexed_data : device_ctx.rr_indexed_data) {
+        key << "cost_index: " << indexed_data.seg_index << " " << indexed_data.T_linear << " " << indexed_data.base_cost << "\n";
+    }
+
+    /* the timing of each switch */
+    for (const auto& rr_switch : device_ctx.rr_switch_inf) {
+        key << "switch: " << int(rr_switch.type()) << " " << rr_switch.R << " " << rr_switch.Tdel
+            << " " << rr_switch.Cin << " " << rr_switch.Cout << " " << rr_switch.Cinternal << "\n";
+    }
+
+    /* the rr graph connectivity and RC, hashed rather than written out as it may be large */
+    size_t rr_graph_hash = device_ctx.rr_nodes.size();
+    for (const auto& node : device_ctx.rr_nodes) {
+        vtr::hash_combine(rr_graph_hash, int(node.type()));
+        vtr::hash_combine(rr_graph_hash, node.xlow());
+        vtr::hash_combine(rr_graph_hash, node.ylow());
+        vtr::hash_combine(rr_graph_hash, node.xhigh());
+        vtr::hash_combine(rr_graph_hash, node.yhigh());
+        vtr::hash_combine(rr_graph_hash, node.cost_index());
+        vtr::hash_combine(rr_graph_hash, node.R());
+        vtr::hash_combine(rr_graph_hash, node.C());
+        if (node.type() == CHANX || node.type() == CHANY) {
+            vtr::hash_combine(rr_graph_hash, int(node.direction()));
+        }
+        for (t_edge_size iedge = 0; iedge < node.num_edges(); iedge++) {
+            vtr::hash_combine(rr_graph_hash, node.edge_sink_node(iedge));
+            vtr::hash_combine(rr_graph_hash, node.edge_switch(iedge));
+        }
+    }
+    key << "rr_graph: " << device_ctx.rr_nodes.size() << " " << rr_graph_hash << "\n";
+
+    return vtr::secure_digest_stream(key);
+}
+
+// When writing capnp targetted serialization, always allow compilation when
+// VTR_ENABLE_CAPNPROTO=OFF.  Generally this means throwing an exception
+// instead.
+//
+#ifndef VTR_ENABLE_CAPNPROTO
+
+#    define DISABLE_ERROR                               \
+        "is disable because VTR_ENABLE_CAPNPROTO=OFF." \
+        "Re-compile with CMake option VTR_ENABLE_CAPNPROTO=ON to enable."
+
+bool read_router_lookahead(const std::string& /*file*/) {
+    VPR_THROW(VPR_ERROR_ROUTE, "MapLookahead::read " DISABLE_ERROR);
+}
+
+void write_router_lookahead(const std::string& /*file*/) {
+    VPR_THROW(VPR_ERROR_ROUTE, "MapLookahead::write " DISABLE_ERROR);
+}
+
+#else /* VTR_ENABLE_CAPNPROTO */
+
+static void ToCostEntry(Cost_Entry* out, const VprMapCostEntry::Reader& in) {
+    out->delay = in.getDelay();
+    out->congestion = in.getCongestion();
+}
+
+static void FromCostEntry(VprMapCostEntry::Builder* out, const Cost_Entry& in) {
+    out->setDelay(in.delay);
+    out->setCongestion(in.congestion);
+}
+
+bool read_router_lookahead(const std::string& file) {
+    if (!vtr::file_exists(file.c_str())) {
+        VTR_LOG("Router lookahead file '%s' does not exist\n", file.c_str());
+        return false;
+    }
+
+    vtr::ScopedStartFinishTimer timer("Loading router lookahead map");
+
+    /* the map is mmap'd, so only the entries are copied */
+    MmapFile f(file);
+    ::capnp::FlatArrayMessageReader reader(f.getData());
+
+    auto map = reader.getRoot<VprMapLookahead>();
+
+    std::string digest = get_lookahead_digest();
+    if (digest != map.getDigest().cStr()) {
+        VTR_LOG_WARN("Router lookahead file '%s' was computed for a different architecture or rr graph (digest %s, expected %s)\n",
+                     file.c_str(), map.getDigest().cStr(), digest.c_str());
+        return false;
+    }
+
+    ToNdMatrix<4, VprMapCostEntry, Cost_Entry>(&f_cost_map, map.getCostMap(), ToCostEntry);
+    return true;
+}
+
+void write_router_lookahead(const std::string& file) {
+    ::capnp::MallocMessageBuilder builder;
+
+    auto map = builder.initRoot<VprMapLookahead>();
+    map.setDigest(get_lookahead_digest().c_str());
+
+    auto cost_map = map.getCostMap();
+    FromNdMatrix<4, VprMapCostEntry, Cost_Entry>(&cost_map, f_cost_map, FromCostEntry);
+
+    writeMessageToFile(file, &builder);
+}
+
+#endif
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <string>
+
 /* Computes the lookahead map to be used by the router. If a map was computed prior to this, a new one will not be computed again.
  * The rr graph must have been built before calling this function. */
 void compute_router_lookahead(int num_segments);
@@ -7,3 +9,10 @@ void compute_router_lookahead(int num_segments);
 /* queries the lookahead_map (should have been computed prior to routing) to get the expected cost
  * from the specified source to the specified target */
 float get_lookahead_map_cost(int from_node_ind, int to_node_ind, float criticality_fac);
+
+/* Reads the lookahead map from the specified file. Returns false, leaving the current map untouched, if the file
+ * does not exist or holds a map computed for a different architecture or rr graph */
+bool read_router_lookahead(const std::string& file);
+
+/* Writes the lookahead map, keyed by a digest of the current architecture and rr graph, to the specified file */
+void write_router_lookahead(const std::string& file);
@@ -6,3 +6,10 @@ struct RouterStats {
     size_t heap_pushes = 0;
     size_t heap_pops = 0;
 };
+
+inline void add_router_stats(RouterStats& total, const RouterStats& stats) {
+    total.connections_routed += stats.connections_routed;
+    total.nets_routed += stats.nets_routed;
+    total.heap_pushes += stats.heap_pushes;
+    total.heap_pops += stats.heap_pops;
+}
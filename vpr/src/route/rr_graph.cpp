@@ -373,11 +373,18 @@ void create_rr_graph(const t_graph_type graph_type,
 
     process_non_config_sets();
 
+    //Rebuild the router's compact view of the (possibly new) rr graph
+    {
+        auto& mutable_device_ctx = g_vpr_ctx.mutable_device();
+        mutable_device_ctx.frozen_rr_graph.build(mutable_device_ctx.rr_nodes, mutable_device_ctx.rr_switch_inf);
+    }
+
     print_rr_graph_stats();
 
     //Write out rr graph file if needed
     if (!det_routing_arch->write_rr_graph_filename.empty()) {
-        write_rr_graph(det_routing_arch->write_rr_graph_filename.c_str(), segment_inf);
+        write_rr_graph(det_routing_arch->write_rr_graph_filename.c_str(), segment_inf,
+                       det_routing_arch->write_rr_graph_nodes_and_edges_only);
     }
 }
 
@@ -1384,6 +1391,8 @@ void free_rr_graph() {
 
     device_ctx.rr_switch_inf.clear();
 
+    device_ctx.frozen_rr_graph.clear();
+
     device_ctx.switch_fanin_remap.clear();
 
     device_ctx.rr_node_metadata.clear();
@@ -0,0 +1,935 @@
+/*
+ * Binary (capnproto) routing resource graph reader and writer.
+ *
+ * The reader performs the same steps as the XML reader (verify the grid,
+ * block types and segments against the architecture, then load channels,
+ * nodes, switches, edges and metadata), but reads each field directly out of
+ * the mmap'd file. The rr node look-up (rr_node_indices) is stored in the
+ * file, so unlike the XML reader it is not rebuilt from the nodes.
+ */
+
+#include <cstring>
+#include <limits>
+
+#include "vtr_assert.h"
+#include "vtr_log.h"
+#include "vtr_time.h"
+#include "vtr_util.h"
+#include "vtr_version.h"
+
+#include "vpr_error.h"
+#include "globals.h"
+#include "read_xml_arch_file.h"
+#include "rr_graph.h"
+#include "rr_graph2.h"
+#include "rr_metadata.h"
+#include "rr_graph_indexed_data.h"
+#include "check_rr_graph.h"
+#include "vpr_utils.h"
+
+#include "rr_graph_binary.h"
+
+#ifdef VTR_ENABLE_CAPNPROTO
+#    include "capnp/serialize.h"
+#    include "rr_graph.capnp.h"
+#    include "mmap_file.h"
+#    include "serdes_utils.h"
+#endif /* VTR_ENABLE_CAPNPROTO */
+
+bool is_binary_rr_graph_file(const char* file_name) {
+    return vtr::check_file_name_extension(file_name, ".bin");
+}
+
+// When writing capnp targetted serialization, always allow compilation when
+// VTR_ENABLE_CAPNPROTO=OFF.  Generally this means throwing an exception
+// instead.
+//
+#ifndef VTR_ENABLE_CAPNPROTO
+
+#    define DISABLE_ERROR                               \
+        "is disable because VTR_ENABLE_CAPNPROTO=OFF." \
+        "Re-compile with CMake option VTR_ENABLE_CAPNPROTO=ON to enable."
+
+void load_rr_binary_file(const t_graph_type /*graph_type*/,
+                         const DeviceGrid& /*grid*/,
+                         const std::vector<t_segment_inf>& /*segment_inf*/,
+                         const enum e_base_cost_type /*base_cost_type*/,
+                         int* /*wire_to_rr_ipin_switch*/,
+                         const char* /*read_rr_graph_name*/) {
+    VPR_THROW(VPR_ERROR_ROUTE, "Reading a binary RR graph " DISABLE_ERROR);
+}
+
+void write_rr_graph_binary(const char* /*file_name*/, const std::vector<t_segment_inf>& /*segment_inf*/) {
+    VPR_THROW(VPR_ERROR_ROUTE, "Writing a binary RR graph " DISABLE_ERROR);
+}
+
+#else /* VTR_ENABLE_CAPNPROTO */
+
+/*********************** Subroutines local to this module *******************/
+static void verify_bin_grid(const capnp::List<RrGridLoc>::Reader& grid_locs, const DeviceGrid& grid);
+static void verify_bin_block_types(const capnp::List<RrBlockType>::Reader& block_types);
+static void verify_bin_segments(const capnp::List<RrSegment>::Reader& segments, const std::vector<t_segment_inf>& segment_inf);
+static void load_bin_channels(t_chan_width& chan_width, const DeviceGrid& grid, const RrChannels::Reader& channels);
+static void load_bin_nodes(const capnp::List<RrNode>::Reader& nodes);
+static void load_bin_switches(const capnp::List<RrSwitch>::Reader& switches);
+static void load_bin_edges(const capnp::List<RrEdge>::Reader& edges, int* wire_to_rr_ipin_switch);
+static void load_bin_metadata(const capnp::List<RrMeta>::Reader& metadata);
+static void load_bin_node_indices(const RrNodeIndices::Reader& node_indices);
+static void load_bin_cost_indices(const capnp::List<RrNode>::Reader& nodes, const bool is_global_graph, const int num_seg_types);
+static void load_bin_seg_ids(const capnp::List<RrNode>::Reader& nodes);
+
+static void write_bin_channels(RrChannels::Builder channels);
+static void write_bin_switches(VprRrGraph::Builder& rr_graph);
+static void write_bin_segments(VprRrGraph::Builder& rr_graph, const std::vector<t_segment_inf>& segment_inf);
+static void write_bin_block_types(VprRrGraph::Builder& rr_graph);
+static void write_bin_grid(VprRrGraph::Builder& rr_graph);
+static void write_bin_nodes(VprRrGraph::Builder& rr_graph);
+static void write_bin_edges(VprRrGraph::Builder& rr_graph);
+static void write_bin_metadata(VprRrGraph::Builder& rr_graph);
+static void write_bin_node_indices(RrNodeIndices::Builder node_indices);
+
+/************************ Subroutine definitions ****************************/
+
+void load_rr_binary_file(const t_graph_type graph_type,
+                         const DeviceGrid& grid,
+                         const std::vector<t_segment_inf>& segment_inf,
+                         const enum e_base_cost_type base_cost_type,
+                         int* wire_to_rr_ipin_switch,
+                         const char* read_rr_graph_name) {
+    vtr::ScopedStartFinishTimer timer("Loading binary routing resource graph");
+
+    /* The file is mmap'd and read in place, only VPR's own data structures are built */
+    MmapFile f(read_rr_graph_name);
+
+    //The rr graphs of large devices are well past capnp's default traversal
+    //limit (which guards against malicious messages, not large ones)
+    ::capnp::ReaderOptions options;
+    options.traversalLimitInWords = std::numeric_limits<uint64_t>::max();
+    ::capnp::FlatArrayMessageReader reader(f.getData(), options);
+
+    auto rr_graph = reader.getRoot<VprRrGraph>();
+
+    auto& device_ctx = g_vpr_ctx.mutable_device();
+
+    //Check for errors
+    if (rr_graph.hasToolVersion() && strcmp(rr_graph.getToolVersion().cStr(), vtr::VERSION) != 0) {
+        VTR_LOG("\n");
+        VTR_LOG_WARN("This architecture version is for VPR %s while your current VPR version is %s compatability issues may arise\n",
+                     vtr::VERSION, rr_graph.getToolVersion().cStr());
+        VTR_LOG("\n");
+    }
+    std::string correct_string = "Generated from arch file ";
+    correct_string += get_arch_file_name();
+    if (rr_graph.hasToolComment() && correct_string != rr_graph.getToolComment().cStr()) {
+        VTR_LOG("\n");
+        VTR_LOG_WARN("This RR graph file is based on %s while your input architecture file is %s compatability issues may arise\n",
+                     get_arch_file_name(), rr_graph.getToolComment().cStr());
+        VTR_LOG("\n");
+    }
+
+    //Compare with the architecture file to ensure consistency
+    verify_bin_grid(rr_graph.getGrid(), grid);
+    verify_bin_block_types(rr_graph.getBlockTypes());
+    verify_bin_segments(rr_graph.getSegments(), segment_inf);
+
+    VTR_LOG("Starting build routing resource graph...\n");
+
+    t_chan_width nodes_per_chan;
+    load_bin_channels(nodes_per_chan, grid, rr_graph.getChannels());
+
+    /* Decode the graph_type */
+    bool is_global_graph = (GRAPH_GLOBAL == graph_type ? true : false);
+
+    /* Global routing uses a single longwire track */
+    int max_chan_width = (is_global_graph ? 1 : nodes_per_chan.max);
+    VTR_ASSERT(max_chan_width > 0);
+
+    auto nodes = rr_graph.getNodes();
+    load_bin_nodes(nodes);
+
+    /* Loads edges, switches, and node look up tables*/
+    load_bin_switches(rr_graph.getSwitches());
+    load_bin_edges(rr_graph.getEdges(), wire_to_rr_ipin_switch);
+    load_bin_metadata(rr_graph.getMetadata());
+
+    //Partition the rr graph edges for efficient access to configurable/non-configurable
+    //edge subsets. Must be done after RR switches have been allocated
+    partition_rr_graph_edges(device_ctx);
+
+    load_bin_node_indices(rr_graph.getNodeIndices());
+
+    init_fan_in(device_ctx.rr_nodes, device_ctx.rr_nodes.size());
+
+    //sets the cost index and seg id information
+    load_bin_cost_indices(nodes, is_global_graph, segment_inf.size());
+
+    alloc_and_load_rr_indexed_data(segment_inf, device_ctx.rr_node_indices,
+                                   max_chan_width, *wire_to_rr_ipin_switch, base_cost_type);
+
+    load_bin_seg_ids(nodes);
+
+    device_ctx.chan_width = nodes_per_chan;
+    device_ctx.read_rr_graph_filename = std::string(read_rr_graph_name);
+
+    check_rr_graph(graph_type, grid, device_ctx.physical_tile_types);
+}
+
+/* Grid was initialized from the architecture file. This function checks
+ * if it corresponds to the RR graph. Errors out if it doesn't correspond*/
+static void verify_bin_grid(const capnp::List<RrGridLoc>::Reader& grid_locs, const DeviceGrid& grid) {
+    for (const auto& grid_loc : grid_locs) {
+        size_t x = grid_loc.getX();
+        size_t y = grid_loc.getY();
+        if (x >= grid.width() || y >= grid.height()) {
+            VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                            "RR graph grid location (%zu, %zu) is outside the %zux%zu device grid", x, y, grid.width(), grid.height());
+        }
+
+        const t_grid_tile& grid_tile = grid[x][y];
+
+        if (grid_tile.type->index != grid_loc.getBlockTypeId()) {
+            VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                            "Architecture file does not match RR graph's block_type_id at (%zu, %zu): arch used ID %d, RR graph used ID %d.", x, y,
+                            grid_tile.type->index, grid_loc.getBlockTypeId());
+        }
+        if (grid_tile.width_offset != grid_loc.getWidthOffset()) {
+            VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                            "Architecture file does not match RR graph's width_offset at (%zu, %zu)", x, y);
+        }
+        if (grid_tile.height_offset != grid_loc.getHeightOffset()) {
+            VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                            "Architecture file does not match RR graph's height_offset at (%zu, %zu)", x, y);
+        }
+    }
+}
+
+/* Blocks were initialized from the architecture file. This function checks
+ * if they correspond to the RR graph. Errors out if they don't correspond*/
+static void verify_bin_block_types(const capnp::List<RrBlockType>::Reader& block_types) {
+    auto& device_ctx = g_vpr_ctx.device();
+    for (const auto& block_type : block_types) {
+        int id = block_type.getId();
+        if (id < 0 || id >= (int)device_ctx.physical_tile_types.size()) {
+            VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                            "RR graph block type id %d does not exist in the architecture", id);
+        }
+        const auto& block_info = device_ctx.physical_tile_types[id];
+
+        if (strcmp(block_info.name, block_type.getName().cStr()) != 0) {
+            VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                            "Architecture file does not match RR graph's block name: arch uses name %s, RR graph uses name %s", block_info.name, block_type.getName().cStr());
+        }
+        if (block_info.width != block_type.getWidth()) {
+            VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                            "Architecture file does not match RR graph's block width");
+        }
+        if (block_info.height != block_type.getHeight()) {
+            VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                            "Architecture file does not match RR graph's block height");
+        }
+        if (block_info.num_class != block_type.getNumClass()) {
+            VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                            "Architecture file does not match RR graph's number of pin classes in block %s", block_info.name);
+        }
+    }
+}
+
+/* Segments was initialized already. This function checks
+ * if it corresponds to the RR graph. Errors out if it doesn't correspond*/
+static void verify_bin_segments(const capnp::List<RrSegment>::Reader& segments, const std::vector<t_segment_inf>& segment_inf) {
+    if (segments.size() != segment_inf.size()) {
+        VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                        "Architecture file does not match RR graph's number of segments: arch has %zu, RR graph has %u", segment_inf.size(), segments.size());
+    }
+
+    for (size_t iseg = 0; iseg < segment_inf.size(); ++iseg) {
+        const auto& segment = segments[iseg];
+        if (segment_inf[iseg].name != segment.getName().cStr()) {
+            VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                            "Architecture file does not match RR graph's segment name: arch uses %s, RR graph uses %s", segment_inf[iseg].name.c_str(), segment.getName().cStr());
+        }
+        if (segment_inf[iseg].Rmetal != segment.getRPerMeter()) {
+            VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                            "Architecture file does not match RR graph's segment R_per_meter");
+        }
+        if (segment_inf[iseg].Cmetal != segment.getCPerMeter()) {
+            VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                            "Architecture file does not match RR graph's segment C_per_meter");
+        }
+    }
+}
+
+/* All channel info is read in and loaded into device_ctx.chan_width*/
+static void load_bin_channels(t_chan_width& chan_width, const DeviceGrid& grid, const RrChannels::Reader& channels) {
+    chan_width.max = channels.getChanWidthMax();
+    chan_width.x_min = channels.getXMin();
+    chan_width.y_min = channels.getYMin();
+    chan_width.x_max = channels.getXMax();
+    chan_width.y_max = channels.getYMax();
+    chan_width.x_list.resize(grid.height());
+    chan_width.y_list.resize(grid.width());
+
+    auto x_list = channels.getXList();
+    if (x_list.size() > chan_width.x_list.size()) {
+        VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                        "x_list size %u exceeds grid height %zu", x_list.size(), chan_width.x_list.size());
+    }
+    for (size_t i = 0; i < x_list.size(); ++i) {
+        chan_width.x_list[i] = x_list[i];
+    }
+
+    auto y_list = channels.getYList();
+    if (y_list.size() > chan_width.y_list.size()) {
+        VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                        "y_list size %u exceeds grid width %zu", y_list.size(), chan_width.y_list.size());
+    }
+    for (size_t i = 0; i < y_list.size(); ++i) {
+        chan_width.y_list[i] = y_list[i];
+    }
+}
+
+static t_rr_type to_rr_type(RrType type) {
+    switch (type) {
+        case RrType::SOURCE:
+            return SOURCE;
+        case RrType::SINK:
+            return SINK;
+        case RrType::IPIN:
+            return IPIN;
+        case RrType::OPIN:
+            return OPIN;
+        case RrType::CHANX:
+            return CHANX;
+        case RrType::CHANY:
+            return CHANY;
+        default:
+            VPR_FATAL_ERROR(VPR_ERROR_OTHER, "Invalid rr node type %d\n", (int)type);
+    }
+}
+
+static RrType from_rr_type(t_rr_type type) {
+    switch (type) {
+        case SOURCE:
+            return RrType::SOURCE;
+        case SINK:
+            return RrType::SINK;
+        case IPIN:
+            return RrType::IPIN;
+        case OPIN:
+            return RrType::OPIN;
+        case CHANX:
+            return RrType::CHANX;
+        case CHANY:
+            return RrType::CHANY;
+        default:
+            VPR_FATAL_ERROR(VPR_ERROR_OTHER, "Invalid rr node type %d\n", (int)type);
+    }
+}
+
+static e_direction to_direction(RrDirection direction) {
+    switch (direction) {
+        case RrDirection::INC_DIR:
+            return INC_DIRECTION;
+        case RrDirection::DEC_DIR:
+            return DEC_DIRECTION;
+        case RrDirection::BI_DIR:
+            return BI_DIRECTION;
+        default:
+            VTR_ASSERT(direction == RrDirection::NO_DIR);
+            return NO_DIRECTION;
+    }
+}
+
+static RrDirection from_direction(e_direction direction) {
+    switch (direction) {
+        case INC_DIRECTION:
+            return RrDirection::INC_DIR;
+        case DEC_DIRECTION:
+            return RrDirection::DEC_DIR;
+        case BI_DIRECTION:
+            return RrDirection::BI_DIR;
+        default:
+            VTR_ASSERT(direction == NO_DIRECTION);
+            return RrDirection::NO_DIR;
+    }
+}
+
+static e_side to_side(RrSide side) {
+    switch (side) {
+        case RrSide::TOP:
+            return TOP;
+        case RrSide::RIGHT:
+            return RIGHT;
+        case RrSide::BOTTOM:
+            return BOTTOM;
+        default:
+            VTR_ASSERT(side == RrSide::LEFT);
+            return LEFT;
+    }
+}
+
+static RrSide from_side(e_side side) {
+    switch (side) {
+        case TOP:
+            return RrSide::TOP;
+        case RIGHT:
+            return RrSide::RIGHT;
+        case BOTTOM:
+            return RrSide::BOTTOM;
+        default:
+            VTR_ASSERT(side == LEFT);
+            return RrSide::LEFT;
+    }
+}
+
+static SwitchType to_switch_type(RrSwitchType type) {
+    switch (type) {
+        case RrSwitchType::MUX:
+            return SwitchType::MUX;
+        case RrSwitchType::TRISTATE:
+            return SwitchType::TRISTATE;
+        case RrSwitchType::PASS_GATE:
+            return SwitchType::PASS_GATE;
+        case RrSwitchType::SHORT:
+            return SwitchType::SHORT;
+        case RrSwitchType::BUFFER:
+            return SwitchType::BUFFER;
+        default:
+            VPR_FATAL_ERROR(VPR_ERROR_ROUTE, "Invalid switch type %d\n", (int)type);
+    }
+}
+
+static RrSwitchType from_switch_type(SwitchType type) {
+    switch (type) {
+        case SwitchType::MUX:
+            return RrSwitchType::MUX;
+        case SwitchType::TRISTATE:
+            return RrSwitchType::TRISTATE;
+        case SwitchType::PASS_GATE:
+            return RrSwitchType::PASS_GATE;
+        case SwitchType::SHORT:
+            return RrSwitchType::SHORT;
+        case SwitchType::BUFFER:
+            return RrSwitchType::BUFFER;
+        default:
+            VPR_FATAL_ERROR(VPR_ERROR_ROUTE, "Invalid switch type %d\n", (int)type);
+    }
+}
+
+/* Node info are processed. Seg_id of nodes are processed separately when rr_index_data is allocated*/
+static void load_bin_nodes(const capnp::List<RrNode>::Reader& nodes) {
+    auto& device_ctx = g_vpr_ctx.mutable_device();
+
+    device_ctx.rr_nodes.resize(nodes.size());
+
+    for (size_t inode = 0; inode < nodes.size(); ++inode) {
+        const auto& rr_node = nodes[inode];
+        auto& node = device_ctx.rr_nodes[inode];
+
+        node.set_type(to_rr_type(rr_node.getType()));
+        if (node.type() == CHANX || node.type() == CHANY) {
+            node.set_direction(to_direction(rr_node.getDirection()));
+        }
+        if (node.type() == IPIN || node.type() == OPIN) {
+            node.set_side(to_side(rr_node.getSide()));
+        }
+
+        node.set_capacity(rr_node.getCapacity());
+        node.set_coordinates(rr_node.getXlow(), rr_node.getYlow(), rr_node.getXhigh(), rr_node.getYhigh());
+        node.set_ptc_num(rr_node.getPtc());
+        node.set_rc_index(find_create_rr_rc_data(rr_node.getR(), rr_node.getC()));
+
+        //clear each node edge
+        node.set_num_edges(0);
+    }
+}
+
+/* Reads in the switch information and adds it to device_ctx.rr_switch_inf as specified*/
+static void load_bin_switches(const capnp::List<RrSwitch>::Reader& switches) {
+    auto& device_ctx = g_vpr_ctx.mutable_device();
+
+    device_ctx.rr_switch_inf.resize(switches.size());
+
+    for (size_t iswitch = 0; iswitch < switches.size(); ++iswitch) {
+        const auto& bin_switch = switches[iswitch];
+        auto& rr_switch = device_ctx.rr_switch_inf[iswitch];
+
+        //Switch names must refer to the (persistent) architecture switch names
+        const char* name = nullptr;
+        if (bin_switch.getName().size() > 0) {
+            for (int i = 0; i < device_ctx.num_arch_switches; ++i) {
+                if (strcmp(bin_switch.getName().cStr(), device_ctx.arch_switch_inf[i].name) == 0) {
+                    name = device_ctx.arch_switch_inf[i].name;
+                    break;
+                }
+            }
+            if (name == nullptr) {
+                VPR_FATAL_ERROR(VPR_ERROR_ROUTE, "Switch name '%s' not found in architecture\n", bin_switch.getName().cStr());
+            }
+        }
+        rr_switch.name = name;
+
+        rr_switch.set_type(to_switch_type(bin_switch.getType()));
+        rr_switch.R = bin_switch.getR();
+        rr_switch.Cin = bin_switch.getCin();
+        rr_switch.Cout = bin_switch.getCout();
+        rr_switch.Cinternal = bin_switch.getCinternal();
+        rr_switch.Tdel = bin_switch.getTdel();
+        rr_switch.mux_trans_size = bin_switch.getMuxTransSize();
+        rr_switch.buf_size = bin_switch.getBufSize();
+    }
+}
+
+/*Loads the edges information from file into vpr. Nodes and switches must be loaded
+ * before calling this function*/
+static void load_bin_edges(const capnp::List<RrEdge>::Reader& edges, int* wire_to_rr_ipin_switch) {
+    auto& device_ctx = g_vpr_ctx.mutable_device();
+    size_t num_rr_nodes = device_ctx.rr_nodes.size();
+    size_t num_rr_switches = device_ctx.rr_switch_inf.size();
+
+    //count the number of edges and store it in a vector
+    std::vector<size_t> num_edges_for_node(num_rr_nodes, 0);
+    for (const auto& edge : edges) {
+        size_t source_node = edge.getSrcNode();
+        if (source_node >= num_rr_nodes) {
+            VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                            "source_node %zu is larger than rr_nodes.size() %zu",
+                            source_node, num_rr_nodes);
+        }
+        num_edges_for_node[source_node]++;
+    }
+
+    //reset this vector in order to start count for num edges again
+    for (size_t inode = 0; inode < num_rr_nodes; inode++) {
+        if (num_edges_for_node[inode] > std::numeric_limits<t_edge_size>::max()) {
+            VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                            "source node %zu edge count %zu is too high",
+                            inode, num_edges_for_node[inode]);
+        }
+        device_ctx.rr_nodes[inode].set_num_edges(num_edges_for_node[inode]);
+        num_edges_for_node[inode] = 0;
+    }
+
+    /* Keeps track of the number of each switch type that connects a wire to an ipin.
+     * There should be only one wire to ipin switch; in case there are more, use the
+     * most frequent one */
+    std::vector<int> count_for_wire_to_ipin_switches(num_rr_switches, 0);
+    //first is index, second is count
+    std::pair<int, int> most_frequent_switch(-1, 0);
+
+    for (const auto& edge : edges) {
+        size_t source_node = edge.getSrcNode();
+        size_t sink_node = edge.getSinkNode();
+        size_t switch_id = edge.getSwitchId();
+
+        if (sink_node >= num_rr_nodes) {
+            VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                            "sink_node %zu is larger than rr_nodes.size() %zu",
+                            sink_node, num_rr_nodes);
+        }
+
+        if (switch_id >= num_rr_switches) {
+            VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                            "switch_id %zu is larger than num_rr_switches %zu",
+                            switch_id, num_rr_switches);
+        }
+
+        auto& src = device_ctx.rr_nodes[source_node];
+        if ((src.type() == CHANX || src.type() == CHANY) && device_ctx.rr_nodes[sink_node].type() == IPIN) {
+            count_for_wire_to_ipin_switches[switch_id]++;
+            if (count_for_wire_to_ipin_switches[switch_id] > most_frequent_switch.second) {
+                most_frequent_switch.first = switch_id;
+                most_frequent_switch.second = count_for_wire_to_ipin_switches[switch_id];
+            }
+        }
+
+        //set edge in correct rr_node data structure
+        src.set_edge_sink_node(num_edges_for_node[source_node], sink_node);
+        src.set_edge_switch(num_edges_for_node[source_node], switch_id);
+        num_edges_for_node[source_node]++;
+    }
+    *wire_to_rr_ipin_switch = most_frequent_switch.first;
+}
+
+static void load_bin_metadata(const capnp::List<RrMeta>::Reader& metadata) {
+    for (const auto& meta : metadata) {
+        if (meta.getSinkNode() == OPEN) {
+            vpr::add_rr_node_metadata(meta.getSrcNode(), meta.getName().cStr(), meta.getValue().cStr());
+        } else {
+            vpr::add_rr_edge_metadata(meta.getSrcNode(), meta.getSinkNode(), meta.getSwitchId(),
+                                      meta.getName().cStr(), meta.getValue().cStr());
+        }
+    }
+}
+
+//Sums a list of nested vector sizes
+static size_t sum_sizes(const capnp::List<uint32_t>::Reader& sizes) {
+    size_t total = 0;
+    for (uint32_t size : sizes) {
+        total += size;
+    }
+    return total;
+}
+
+/* Loads the rr node look up table. Each nesting level is stored as the list
+ * of the sizes of every vector at that level, in traversal order */
+static void load_bin_node_indices(const RrNodeIndices::Reader& node_indices) {
+    auto type_sizes = node_indices.getTypeSizes();
+    auto x_sizes = node_indices.getXSizes();
+    auto y_sizes = node_indices.getYSizes();
+    auto side_sizes = node_indices.getSideSizes();
+    auto nodes = node_indices.getNodes();
+
+    //Each level must hold exactly the elements counted by the level above it
+    if (type_sizes.size() != NUM_RR_TYPES
+        || sum_sizes(type_sizes) != x_sizes.size()
+        || sum_sizes(x_sizes) != y_sizes.size()
+        || sum_sizes(y_sizes) != side_sizes.size()
+        || sum_sizes(side_sizes) != nodes.size()) {
+        VPR_FATAL_ERROR(VPR_ERROR_OTHER, "Inconsistent rr node look-up in binary RR graph");
+    }
+
+    auto& device_ctx = g_vpr_ctx.mutable_device();
+    auto& indices = device_ctx.rr_node_indices;
+
+    indices.clear();
+    indices.resize(NUM_RR_TYPES);
+
+    size_t ix = 0, iy = 0, iside = 0, inode = 0;
+    for (size_t itype = 0; itype < NUM_RR_TYPES; ++itype) {
+        indices[itype].resize(type_sizes[itype]);
+        for (auto& x_indices : indices[itype]) {
+            x_indices.resize(x_sizes[ix++]);
+            for (auto& y_indices : x_indices) {
+                y_indices.resize(y_sizes[iy++]);
+                for (auto& side_indices : y_indices) {
+                    side_indices.resize(side_sizes[iside++]);
+                    for (int& node : side_indices) {
+                        node = nodes[inode++];
+                        if (node >= (int)device_ctx.rr_nodes.size()) {
+                            VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                                            "rr node look-up index %d is larger than rr_nodes.size() %zu",
+                                            node, device_ctx.rr_nodes.size());
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+/* This function sets the Source pins, sink pins, ipin, and opin
+ * to their unique cost index identifier. CHANX and CHANY cost indicies are set
+ * from their segment ids*/
+static void load_bin_cost_indices(const capnp::List<RrNode>::Reader& nodes, const bool is_global_graph, const int num_seg_types) {
+    auto& device_ctx = g_vpr_ctx.mutable_device();
+
+    for (size_t inode = 0; inode < device_ctx.rr_nodes.size(); inode++) {
+        auto& node = device_ctx.rr_nodes[inode];
+        if (node.type() == SOURCE) {
+            node.set_cost_index(SOURCE_COST_INDEX);
+        } else if (node.type() == SINK) {
+            node.set_cost_index(SINK_COST_INDEX);
+        } else if (node.type() == IPIN) {
+            node.set_cost_index(IPIN_COST_INDEX);
+        } else if (node.type() == OPIN) {
+            node.set_cost_index(OPIN_COST_INDEX);
+        }
+
+        /*CHANX and CHANY cost index is dependent on the segment id*/
+        int seg_id = nodes[inode].getSegmentId();
+        if (seg_id != OPEN) {
+            if (is_global_graph) {
+                node.set_cost_index(0);
+            } else if (node.type() == CHANX) {
+                node.set_cost_index(CHANX_COST_INDEX_START + seg_id);
+            } else if (node.type() == CHANY) {
+                node.set_cost_index(CHANX_COST_INDEX_START + num_seg_types + seg_id);
+            }
+        }
+    }
+}
+
+/*Only CHANX and CHANY components have a segment id. This function
+ *reads in the segment id of each node*/
+static void load_bin_seg_ids(const capnp::List<RrNode>::Reader& nodes) {
+    auto& device_ctx = g_vpr_ctx.mutable_device();
+
+    for (size_t inode = 0; inode < device_ctx.rr_nodes.size(); inode++) {
+        int seg_id = nodes[inode].getSegmentId();
+        if (seg_id != OPEN) {
+            device_ctx.rr_indexed_data[device_ctx.rr_nodes[inode].cost_index()].seg_index = seg_id;
+        }
+    }
+}
+
+/* This function is used to write the rr_graph in binary format into a file with name: file_name */
+void write_rr_graph_binary(const char* file_name, const std::vector<t_segment_inf>& segment_inf) {
+    vtr::ScopedStartFinishTimer timer("Writing binary RR graph");
+
+    ::capnp::MallocMessageBuilder builder;
+
+    auto rr_graph = builder.initRoot<VprRrGraph>();
+
+    /* General info for easy error checking*/
+    rr_graph.setToolVersion(vtr::VERSION);
+    std::string tool_comment = std::string("Generated from arch file ") + get_arch_file_name();
+    rr_graph.setToolComment(tool_comment.c_str());
+
+    /* Write out each individual component*/
+    write_bin_channels(rr_graph.initChannels());
+    write_bin_switches(rr_graph);
+    write_bin_segments(rr_graph, segment_inf);
+    write_bin_block_types(rr_graph);
+    write_bin_grid(rr_graph);
+    write_bin_nodes(rr_graph);
+    write_bin_edges(rr_graph);
+    write_bin_metadata(rr_graph);
+    write_bin_node_indices(rr_graph.initNodeIndices());
+
+    writeMessageToFile(file_name, &builder);
+
+    VTR_LOG("Finished generating binary RR graph file named %s\n", file_name);
+}
+
+static void write_bin_channels(RrChannels::Builder channels) {
+    auto& device_ctx = g_vpr_ctx.device();
+    const auto& chan_width = device_ctx.chan_width;
+
+    channels.setChanWidthMax(chan_width.max);
+    channels.setXMin(chan_width.x_min);
+    channels.setYMin(chan_width.y_min);
+    channels.setXMax(chan_width.x_max);
+    channels.setYMax(chan_width.y_max);
+
+    size_t num_x = device_ctx.grid.height() - 1;
+    auto x_list = channels.initXList(num_x);
+    for (size_t i = 0; i < num_x; i++) {
+        x_list.set(i, chan_width.x_list[i]);
+    }
+
+    size_t num_y = device_ctx.grid.width() - 1;
+    auto y_list = channels.initYList(num_y);
+    for (size_t i = 0; i < num_y; i++) {
+        y_list.set(i, chan_width.y_list[i]);
+    }
+}
+
+static void write_bin_switches(VprRrGraph::Builder& rr_graph) {
+    auto& device_ctx = g_vpr_ctx.device();
+
+    auto switches = rr_graph.initSwitches(device_ctx.rr_switch_inf.size());
+    for (size_t iswitch = 0; iswitch < device_ctx.rr_switch_inf.size(); iswitch++) {
+        const t_rr_switch_inf& rr_switch = device_ctx.rr_switch_inf[iswitch];
+        auto bin_switch = switches[iswitch];
+
+        if (rr_switch.name) {
+            bin_switch.setName(rr_switch.name);
+        }
+        bin_switch.setType(from_switch_type(rr_switch.type()));
+        bin_switch.setR(rr_switch.R);
+        bin_switch.setCin(rr_switch.Cin);
+        bin_switch.setCout(rr_switch.Cout);
+        bin_switch.setCinternal(rr_switch.Cinternal);
+        bin_switch.setTdel(rr_switch.Tdel);
+        bin_switch.setMuxTransSize(rr_switch.mux_trans_size);
+        bin_switch.setBufSize(rr_switch.buf_size);
+    }
+}
+
+static void write_bin_segments(VprRrGraph::Builder& rr_graph, const std::vector<t_segment_inf>& segment_inf) {
+    auto segments = rr_graph.initSegments(segment_inf.size());
+    for (size_t iseg = 0; iseg < segment_inf.size(); iseg++) {
+        auto segment = segments[iseg];
+        segment.setName(segment_inf[iseg].name.c_str());
+        segment.setRPerMeter(segment_inf[iseg].Rmetal);
+        segment.setCPerMeter(segment_inf[iseg].Cmetal);
+    }
+}
+
+static void write_bin_block_types(VprRrGraph::Builder& rr_graph) {
+    auto& device_ctx = g_vpr_ctx.device();
+
+    auto block_types = rr_graph.initBlockTypes(device_ctx.physical_tile_types.size());
+    for (size_t itype = 0; itype < device_ctx.physical_tile_types.size(); itype++) {
+        const auto& btype = device_ctx.physical_tile_types[itype];
+        auto block_type = block_types[itype];
+
+        VTR_ASSERT(btype.name);
+        block_type.setId(btype.index);
+        block_type.setName(btype.name);
+        block_type.setWidth(btype.width);
+        block_type.setHeight(btype.height);
+        block_type.setNumClass(btype.num_class);
+    }
+}
+
+static void write_bin_grid(VprRrGraph::Builder& rr_graph) {
+    auto& device_ctx = g_vpr_ctx.device();
+
+    auto grid_locs = rr_graph.initGrid(device_ctx.grid.width() * device_ctx.grid.height());
+    size_t iloc = 0;
+    for (size_t x = 0; x < device_ctx.grid.width(); x++) {
+        for (size_t y = 0; y < device_ctx.grid.height(); y++) {
+            const t_grid_tile& grid_tile = device_ctx.grid[x][y];
+            auto grid_loc = grid_locs[iloc++];
+
+            grid_loc.setX(x);
+            grid_loc.setY(y);
+            grid_loc.setBlockTypeId(grid_tile.type->index);
+            grid_loc.setWidthOffset(grid_tile.width_offset);
+            grid_loc.setHeightOffset(grid_tile.height_offset);
+        }
+    }
+}
+
+static void write_bin_nodes(VprRrGraph::Builder& rr_graph) {
+    auto& device_ctx = g_vpr_ctx.device();
+
+    auto nodes = rr_graph.initNodes(device_ctx.rr_nodes.size());
+    for (size_t inode = 0; inode < device_ctx.rr_nodes.size(); inode++) {
+        const auto& node = device_ctx.rr_nodes[inode];
+        auto bin_node = nodes[inode];
+
+        bin_node.setType(from_rr_type(node.type()));
+        if (node.type() == CHANX || node.type() == CHANY) {
+            bin_node.setDirection(from_direction(node.direction()));
+        }
+        if (node.type() == IPIN || node.type() == OPIN) {
+            bin_node.setSide(from_side(node.side()));
+        }
+        bin_node.setCapacity(node.capacity());
+        bin_node.setXlow(node.xlow());
+        bin_node.setYlow(node.ylow());
+        bin_node.setXhigh(node.xhigh());
+        bin_node.setYhigh(node.yhigh());
+        bin_node.setPtc(node.ptc_num());
+        bin_node.setR(node.R());
+        bin_node.setC(node.C());
+        bin_node.setSegmentId(device_ctx.rr_indexed_data[node.cost_index()].seg_index);
+    }
+}
+
+static void write_bin_edges(VprRrGraph::Builder& rr_graph) {
+    auto& device_ctx = g_vpr_ctx.device();
+
+    size_t num_edges = 0;
+    for (const auto& node : device_ctx.rr_nodes) {
+        num_edges += node.num_edges();
+    }
+
+    auto edges = rr_graph.initEdges(num_edges);
+    size_t iedge_total = 0;
+    for (size_t inode = 0; inode < device_ctx.rr_nodes.size(); inode++) {
+        const auto& node = device_ctx.rr_nodes[inode];
+        for (t_edge_size iedge = 0; iedge < node.num_edges(); iedge++) {
+            auto edge = edges[iedge_total++];
+            edge.setSrcNode(inode);
+            edge.setSinkNode(node.edge_sink_node(iedge));
+            edge.setSwitchId(node.edge_switch(iedge));
+        }
+    }
+}
+
+static size_t count_metadata(const t_metadata_dict& meta) {
+    size_t num_meta = 0;
+    for (const auto& meta_elem : meta) {
+        num_meta += meta_elem.second.size();
+    }
+    return num_meta;
+}
+
+static void write_metadata(capnp::List<RrMeta>::Builder& bin_meta, size_t& imeta, int src_node, int sink_node, short switch_id, const t_metadata_dict& meta) {
+    for (const auto& meta_elem : meta) {
+        for (const auto& value : meta_elem.second) {
+            auto entry = bin_meta[imeta++];
+            entry.setSrcNode(src_node);
+            entry.setSinkNode(sink_node);
+            entry.setSwitchId(switch_id);
+            entry.setName(meta_elem.first.c_str());
+            entry.setValue(value.as_string().c_str());
+        }
+    }
+}
+
+/* Node and edge metadata are written in node (then edge) order, so the
+ * output does not depend on the hash map iteration order */
+static void write_bin_metadata(VprRrGraph::Builder& rr_graph) {
+    auto& device_ctx = g_vpr_ctx.device();
+
+    size_t num_meta = 0;
+    for (const auto& node_meta : device_ctx.rr_node_metadata) {
+        num_meta += count_metadata(node_meta.second);
+    }
+    for (const auto& edge_meta : device_ctx.rr_edge_metadata) {
+        num_meta += count_metadata(edge_meta.second);
+    }
+
+    auto bin_meta = rr_graph.initMetadata(num_meta);
+    if (num_meta == 0) return;
+
+    size_t imeta = 0;
+    for (size_t inode = 0; inode < device_ctx.rr_nodes.size(); inode++) {
+        const auto iter = device_ctx.rr_node_metadata.find(inode);
+        if (iter != device_ctx.rr_node_metadata.end()) {
+            write_metadata(bin_meta, imeta, inode, OPEN, OPEN, iter->second);
+        }
+    }
+    for (size_t inode = 0; inode < device_ctx.rr_nodes.size(); inode++) {
+        const auto& node = device_ctx.rr_nodes[inode];
+        for (t_edge_size iedge = 0; iedge < node.num_edges(); iedge++) {
+            const auto iter = device_ctx.rr_edge_metadata.find(std::make_tuple(inode, node.edge_sink_node(iedge), node.edge_switch(iedge)));
+            if (iter != device_ctx.rr_edge_metadata.end()) {
+                write_metadata(bin_meta, imeta, inode, node.edge_sink_node(iedge), node.edge_switch(iedge), iter->second);
+            }
+        }
+    }
+    VTR_ASSERT(imeta == num_meta);
+}
+
+/* The rr node look up is written one nesting level at a time: first the size of
+ * every vector at that level (in traversal order), and finally the node ids */
+static void write_bin_node_indices(RrNodeIndices::Builder node_indices) {
+    auto& device_ctx = g_vpr_ctx.device();
+    const auto& indices = device_ctx.rr_node_indices;
+    VTR_ASSERT(indices.size() == NUM_RR_TYPES);
+
+    size_t num_x = 0, num_y = 0, num_sides = 0, num_nodes = 0;
+    for (const auto& type_indices : indices) {
+        num_x += type_indices.size();
+        for (const auto& x_indices : type_indices) {
+            num_y += x_indices.size();
+            for (const auto& y_indices : x_indices) {
+                num_sides += y_indices.size();
+                for (const auto& side_indices : y_indices) {
+                    num_nodes += side_indices.size();
+                }
+            }
+        }
+    }
+
+    auto type_sizes = node_indices.initTypeSizes(indices.size());
+    auto x_sizes = node_indices.initXSizes(num_x);
+    auto y_sizes = node_indices.initYSizes(num_y);
+    auto side_sizes = node_indices.initSideSizes(num_sides);
+    auto nodes = node_indices.initNodes(num_nodes);
+
+    size_t ix = 0, iy = 0, iside = 0, inode = 0;
+    for (size_t itype = 0; itype < indices.size(); ++itype) {
+        type_sizes.set(itype, indices[itype].size());
+        for (const auto& x_indices : indices[itype]) {
+            x_sizes.set(ix++, x_indices.size());
+            for (const auto& y_indices : x_indices) {
+                y_sizes.set(iy++, y_indices.size());
+                for (const auto& side_indices : y_indices) {
+                    side_sizes.set(iside++, side_indices.size());
+                    for (int node : side_indices) {
+                        nodes.set(inode++, node);
+                    }
+                }
+            }
+        }
+    }
+}
+
+#endif /* VTR_ENABLE_CAPNPROTO */
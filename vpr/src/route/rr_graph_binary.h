@@ -0,0 +1,33 @@
+/*
+ * Reads and writes the routing resource graph in a capnproto binary format
+ * (libs/libvtrcapnproto/rr_graph.capnp). The binary format holds the same
+ * information as the XML format, but loads without parsing: the file is
+ * mmap'd and the rr nodes, switches, edges and node look-up are copied
+ * straight out of it.
+ *
+ * load_rr_file() and write_rr_graph() use the binary format for file names
+ * ending in '.bin', so an rr graph is converted between the two formats by
+ * reading it in one and writing it out in the other.
+ */
+
+#ifndef RR_GRAPH_BINARY_H
+#define RR_GRAPH_BINARY_H
+
+#include <vector>
+#include "device_grid.h"
+#include "vpr_types.h"
+#include "rr_graph.h"
+
+//Returns true if the rr graph file name selects the binary format
+bool is_binary_rr_graph_file(const char* file_name);
+
+void load_rr_binary_file(const t_graph_type graph_type,
+                         const DeviceGrid& grid,
+                         const std::vector<t_segment_inf>& segment_inf,
+                         const enum e_base_cost_type base_cost_type,
+                         int* wire_to_rr_ipin_switch,
+                         const char* read_rr_graph_name);
+
+void write_rr_graph_binary(const char* file_name, const std::vector<t_segment_inf>& segment_inf);
+
+#endif /* RR_GRAPH_BINARY_H */
@@ -37,6 +37,7 @@
 #include "rr_metadata.h"
 #include "rr_graph_indexed_data.h"
 #include "rr_graph_writer.h"
+#include "rr_graph_binary.h"
 #include "check_rr_graph.h"
 #include "echo_files.h"
 
@@ -70,6 +71,12 @@ void load_rr_file(const t_graph_type graph_type,
                   const enum e_base_cost_type base_cost_type,
                   int* wire_to_rr_ipin_switch,
                   const char* read_rr_graph_name) {
+    if (is_binary_rr_graph_file(read_rr_graph_name)) {
+        load_rr_binary_file(graph_type, grid, segment_inf, base_cost_type,
+                            wire_to_rr_ipin_switch, read_rr_graph_name);
+        return;
+    }
+
     vtr::ScopedStartFinishTimer timer("Loading routing resource graph");
 
     const char* Prop;
@@ -81,7 +88,7 @@ void load_rr_file(const t_graph_type graph_type,
     if (vtr::check_file_name_extension(read_rr_graph_name, ".xml") == false) {
         VTR_LOG_WARN(
             "RR graph file '%s' may be in incorrect format. "
-            "Expecting .xml format\n",
+            "Expecting .xml (or binary .bin) format\n",
             read_rr_graph_name);
     }
     try {
@@ -1,4 +1,5 @@
-/* Defines the function used to load an rr graph written in xml format into vpr*/
+/* Defines the function used to load an rr graph written in xml format into vpr.
+ * Files ending in '.bin' are loaded from the binary format (see rr_graph_binary.h)*/
 
 #ifndef RR_GRAPH_READER_H
 #define RR_GRAPH_READER_H
@@ -5,53 +5,266 @@
  * children tags such as timing, location, or some general
  * details. Each tag has attributes to describe them */
 
-#include <fstream>
+#include <cmath>
+#include <cstdio>
 #include <iostream>
 #include <string.h>
-#include <iomanip>
 #include <limits>
+#include <memory>
 #include "vpr_error.h"
 #include "globals.h"
 #include "read_xml_arch_file.h"
 #include "vtr_version.h"
+#include "vtr_util.h"
 #include "rr_graph_writer.h"
+#include "rr_graph_binary.h"
+
+#ifdef VPR_USE_ZLIB
+#    include <zlib.h>
+#endif
 
 /* All values are printed with this precision value. The higher the
  * value, the more accurate the read in rr graph is. Using numeric_limits
  * max_digits10 guarentees that no values change during a sequence of
  * float -> string -> float conversions */
 constexpr int FLOAT_PRECISION = std::numeric_limits<float>::max_digits10;
+
+/* Size of the output buffer. The writer's memory use is independent of the
+ * size of the rr graph */
+constexpr size_t OUTPUT_BUFFER_SIZE = 1 << 20;
+
+/* Buffered output for the rr graph writer.
+ *
+ * Values are formatted by hand straight into a large buffer, which is written
+ * to the file whenever it fills up. This avoids the per-element formatting
+ * overhead (locales, sentries, virtual calls) of iostreams, which dominates
+ * the time to write large rr graphs. The output is identical to that of an
+ * iostream using std::setprecision(FLOAT_PRECISION).
+ *
+ * Files whose name ends in '.gz' are gzip compressed (requires VPR to be
+ * built with zlib). */
+class RrGraphOutput {
+  public:
+    explicit RrGraphOutput(const char* file_name)
+        : file_name_(file_name)
+        , buffer_(new char[OUTPUT_BUFFER_SIZE]) {
+        if (vtr::check_file_name_extension(file_name, ".gz")) {
+#ifdef VPR_USE_ZLIB
+            //Favour speed over compression ratio: level 1 compresses rr graphs
+            //nearly as well as the default level, in a fraction of the time
+            gz_file_ = gzopen(file_name, "wb1");
+            if (gz_file_ == nullptr) {
+                VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                                "couldn't open file \"%s\" for generating RR graph file\n", file_name);
+            }
+#else
+            VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                            "Writing gzip compressed RR graph file \"%s\" requires VPR to be built with zlib\n", file_name);
+#endif
+        } else {
+            file_ = std::fopen(file_name, "w");
+            if (file_ == nullptr) {
+                VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                                "couldn't open file \"%s\" for generating RR graph file\n", file_name);
+            }
+        }
+    }
+
+    //Destructors must not throw, so only releases the file handles: any
+    //buffered output is discarded. The writer calls close() once done, so
+    //this is only reached with the file still open if writing failed (and
+    //the error is already being reported).
+    ~RrGraphOutput() {
+        if (file_) {
+            std::fclose(file_);
+        }
+#ifdef VPR_USE_ZLIB
+        if (gz_file_) {
+            gzclose(gz_file_);
+        }
+#endif
+    }
+
+    RrGraphOutput(const RrGraphOutput&) = delete;
+    RrGraphOutput& operator=(const RrGraphOutput&) = delete;
+
+    //Flushes any buffered output and closes the file, reporting any write
+    //errors. Must be called once all output is written.
+    void close() {
+        flush();
+        if (file_) {
+            if (std::fclose(file_) != 0) {
+                file_ = nullptr;
+                VPR_FATAL_ERROR(VPR_ERROR_OTHER, "Failed to write RR graph file \"%s\"\n", file_name_.c_str());
+            }
+            file_ = nullptr;
+        }
+#ifdef VPR_USE_ZLIB
+        if (gz_file_) {
+            if (gzclose(gz_file_) != Z_OK) {
+                gz_file_ = nullptr;
+                VPR_FATAL_ERROR(VPR_ERROR_OTHER, "Failed to write RR graph file \"%s\"\n", file_name_.c_str());
+            }
+            gz_file_ = nullptr;
+        }
+#endif
+    }
+
+    RrGraphOutput& operator<<(const char* str) {
+        write(str, strlen(str));
+        return *this;
+    }
+
+    RrGraphOutput& operator<<(const std::string& str) {
+        write(str.data(), str.size());
+        return *this;
+    }
+
+    RrGraphOutput& operator<<(char c) {
+        reserve(1);
+        buffer_[size_++] = c;
+        return *this;
+    }
+
+    RrGraphOutput& operator<<(short value) { return write_signed(value); }
+    RrGraphOutput& operator<<(int value) { return write_signed(value); }
+    RrGraphOutput& operator<<(long value) { return write_signed(value); }
+    RrGraphOutput& operator<<(long long value) { return write_signed(value); }
+    RrGraphOutput& operator<<(unsigned short value) { return write_unsigned(value); }
+    RrGraphOutput& operator<<(unsigned int value) { return write_unsigned(value); }
+    RrGraphOutput& operator<<(unsigned long value) { return write_unsigned(value); }
+    RrGraphOutput& operator<<(unsigned long long value) { return write_unsigned(value); }
+
+    RrGraphOutput& operator<<(float value) {
+        //Most values written (zero resistances, capacitances and sizes) are
+        //integral, print those without going through printf.
+        //Below 1e9, %g prints integral values exactly as integers (negative
+        //zero is left to printf, which keeps its sign).
+        if (value > -1e9 && value < 1e9 && value == (long long)value && !std::signbit(value)) {
+            return write_signed((long long)value);
+        }
+
+        constexpr size_t MAX_FLOAT_CHARS = 32;
+        reserve(MAX_FLOAT_CHARS);
+        size_ += snprintf(buffer_.get() + size_, MAX_FLOAT_CHARS, "%.*g", FLOAT_PRECISION, value);
+        return *this;
+    }
+
+  private:
+    void write(const char* data, size_t len) {
+        if (len > OUTPUT_BUFFER_SIZE - size_) {
+            flush();
+            if (len > OUTPUT_BUFFER_SIZE) {
+                write_to_file(data, len);
+                return;
+            }
+        }
+        memcpy(buffer_.get() + size_, data, len);
+        size_ += len;
+    }
+
+    template<typename T>
+    RrGraphOutput& write_signed(T value) {
+        unsigned long long magnitude = value;
+        if (value < 0) {
+            *this << '-';
+            magnitude = 0ull - magnitude;
+        }
+        return write_unsigned(magnitude);
+    }
+
+    RrGraphOutput& write_unsigned(unsigned long long value) {
+        //Digits are generated least significant first
+        char digits[std::numeric_limits<unsigned long long>::digits10 + 1];
+        size_t num_digits = 0;
+        do {
+            digits[num_digits++] = '0' + (value % 10);
+            value /= 10;
+        } while (value != 0);
+
+        reserve(num_digits);
+        while (num_digits != 0) {
+            buffer_[size_++] = digits[--num_digits];
+        }
+        return *this;
+    }
+
+    //Ensures at least len characters can be appended to the buffer
+    void reserve(size_t len) {
+        if (len > OUTPUT_BUFFER_SIZE - size_) {
+            flush();
+        }
+    }
+
+    void flush() {
+        write_to_file(buffer_.get(), size_);
+        size_ = 0;
+    }
+
+    void write_to_file(const char* data, size_t len) {
+        if (len == 0) return;
+
+        bool ok = false;
+        if (file_) {
+            ok = std::fwrite(data, 1, len, file_) == len;
+        }
+#ifdef VPR_USE_ZLIB
+        if (gz_file_) {
+            ok = gzwrite(gz_file_, data, len) == (int)len;
+        }
+#endif
+        if (!ok) {
+            VPR_FATAL_ERROR(VPR_ERROR_OTHER, "Failed to write RR graph file \"%s\"\n", file_name_.c_str());
+        }
+    }
+
+  private:
+    std::string file_name_;
+    std::FILE* file_ = nullptr;
+#ifdef VPR_USE_ZLIB
+    gzFile gz_file_ = nullptr;
+#endif
+
+    std::unique_ptr<char[]> buffer_;
+    size_t size_ = 0;
+};
+
 /*********************** Subroutines local to this module *******************/
-void write_rr_channel(std::fstream& fp);
-void write_rr_node(std::fstream& fp);
-void write_rr_switches(std::fstream& fp);
-void write_rr_grid(std::fstream& fp);
-void write_rr_edges(std::fstream& fp);
-void write_rr_block_types(std::fstream& fp);
-void write_rr_segments(std::fstream& fp, const std::vector<t_segment_inf>& segment_inf);
+void write_rr_channel(RrGraphOutput& fp);
+void write_rr_node(RrGraphOutput& fp);
+void write_rr_switches(RrGraphOutput& fp);
+void write_rr_grid(RrGraphOutput& fp);
+void write_rr_edges(RrGraphOutput& fp);
+void write_rr_block_types(RrGraphOutput& fp);
+void write_rr_segments(RrGraphOutput& fp, const std::vector<t_segment_inf>& segment_inf);
 
 /************************ Subroutine definitions ****************************/
 
-/* This function is used to write the rr_graph into xml format into a a file with name: file_name */
-void write_rr_graph(const char* file_name, const std::vector<t_segment_inf>& segment_inf) {
-    std::fstream fp;
-    fp.open(file_name, std::fstream::out | std::fstream::trunc);
+/* This function is used to write the rr_graph into xml format into a a file with name: file_name.
+ * File names ending in '.bin' are written in the binary format instead.
+ * If nodes_and_edges_only is set only the rr_nodes and rr_edges sections are written
+ * (the result can not be read back with --read_rr_graph) */
+void write_rr_graph(const char* file_name, const std::vector<t_segment_inf>& segment_inf, bool nodes_and_edges_only) {
+    if (is_binary_rr_graph_file(file_name)) {
+        write_rr_graph_binary(file_name, segment_inf);
+        return;
+    }
+
+    RrGraphOutput fp(file_name);
 
     /* Prints out general info for easy error checking*/
-    if (!fp.is_open() || !fp.good()) {
-        VPR_FATAL_ERROR(VPR_ERROR_OTHER,
-                        "couldn't open file \"%s\" for generating RR graph file\n", file_name);
-    }
     std::cout << "Writing RR graph" << std::endl;
     fp << "<rr_graph tool_name=\"vpr\" tool_version=\"" << vtr::VERSION << "\" tool_comment=\"Generated from arch file "
-       << get_arch_file_name() << "\">" << std::endl;
+       << get_arch_file_name() << "\">\n";
 
     /* Write out each individual component*/
-    write_rr_channel(fp);
-    write_rr_switches(fp);
-    write_rr_segments(fp, segment_inf);
-    write_rr_block_types(fp);
-    write_rr_grid(fp);
+    if (!nodes_and_edges_only) {
+        write_rr_channel(fp);
+        write_rr_switches(fp);
+        write_rr_segments(fp, segment_inf);
+        write_rr_block_types(fp);
+        write_rr_grid(fp);
+    }
     write_rr_node(fp);
     write_rr_edges(fp);
     fp << "</rr_graph>";
@@ -62,45 +275,45 @@ void write_rr_graph(const char* file_name, const std::vector<t_segment_inf>& seg
               << std::endl;
 }
 
-static void add_metadata_to_xml(std::fstream& fp, const char* tab_prefix, const t_metadata_dict& meta) {
-    fp << tab_prefix << "<metadata>" << std::endl;
+static void add_metadata_to_xml(RrGraphOutput& fp, const char* tab_prefix, const t_metadata_dict& meta) {
+    fp << tab_prefix << "<metadata>" << "\n";
 
     for (const auto& meta_elem : meta) {
         const std::string& key = meta_elem.first;
         const std::vector<t_metadata_value>& values = meta_elem.second;
         for (const auto& value : values) {
             fp << tab_prefix << "\t<meta name=\"" << key << "\"";
-            fp << ">" << value.as_string() << "</meta>" << std::endl;
+            fp << ">" << value.as_string() << "</meta>" << "\n";
         }
     }
-    fp << tab_prefix << "</metadata>" << std::endl;
+    fp << tab_prefix << "</metadata>" << "\n";
 }
 
 /* Channel info in device_ctx.chan_width is written in xml format.
  * A general summary of the min and max values of the channels are first printed. Every
  * x and y channel list is printed out in its own attribute*/
-void write_rr_channel(std::fstream& fp) {
+void write_rr_channel(RrGraphOutput& fp) {
     auto& device_ctx = g_vpr_ctx.device();
-    fp << "\t<channels>" << std::endl;
-    fp << "\t\t<channel chan_width_max =\"" << device_ctx.chan_width.max << "\" x_min=\"" << device_ctx.chan_width.x_min << "\" y_min=\"" << device_ctx.chan_width.y_min << "\" x_max=\"" << device_ctx.chan_width.x_max << "\" y_max=\"" << device_ctx.chan_width.y_max << "\"/>" << std::endl;
+    fp << "\t<channels>" << "\n";
+    fp << "\t\t<channel chan_width_max =\"" << device_ctx.chan_width.max << "\" x_min=\"" << device_ctx.chan_width.x_min << "\" y_min=\"" << device_ctx.chan_width.y_min << "\" x_max=\"" << device_ctx.chan_width.x_max << "\" y_max=\"" << device_ctx.chan_width.y_max << "\"/>" << "\n";
 
     auto& list = device_ctx.chan_width.x_list;
     for (size_t i = 0; i < device_ctx.grid.height() - 1; i++) {
-        fp << "\t\t<x_list index =\"" << i << "\" info=\"" << list[i] << "\"/>" << std::endl;
+        fp << "\t\t<x_list index =\"" << i << "\" info=\"" << list[i] << "\"/>" << "\n";
     }
     auto& list2 = device_ctx.chan_width.y_list;
     for (size_t i = 0; i < device_ctx.grid.width() - 1; i++) {
-        fp << "\t\t<y_list index =\"" << i << "\" info=\"" << list2[i] << "\"/>" << std::endl;
+        fp << "\t\t<y_list index =\"" << i << "\" info=\"" << list2[i] << "\"/>" << "\n";
     }
-    fp << "\t</channels>" << std::endl;
+    fp << "\t</channels>" << "\n";
 }
 
 /* All relevant rr node info is written out to the graph.
  * This includes location, timing, and segment info*/
-void write_rr_node(std::fstream& fp) {
+void write_rr_node(RrGraphOutput& fp) {
     auto& device_ctx = g_vpr_ctx.device();
 
-    fp << "\t<rr_nodes>" << std::endl;
+    fp << "\t<rr_nodes>" << "\n";
 
     for (size_t inode = 0; inode < device_ctx.rr_nodes.size(); inode++) {
         auto& node = device_ctx.rr_nodes[inode];
@@ -111,7 +324,7 @@ void write_rr_node(std::fstream& fp) {
             fp << "\" direction=\"" << node.direction_string();
         }
         fp << "\" capacity=\"" << node.capacity();
-        fp << "\">" << std::endl;
+        fp << "\">" << "\n";
         fp << "\t\t\t<loc";
         fp << " xlow=\"" << node.xlow();
         fp << "\" ylow=\"" << node.ylow();
@@ -121,12 +334,12 @@ void write_rr_node(std::fstream& fp) {
             fp << "\" side=\"" << node.side_string();
         }
         fp << "\" ptc=\"" << node.ptc_num();
-        fp << "\"/>" << std::endl;
-        fp << "\t\t\t<timing R=\"" << std::setprecision(FLOAT_PRECISION) << node.R()
-           << "\" C=\"" << std::setprecision(FLOAT_PRECISION) << node.C() << "\"/>" << std::endl;
+        fp << "\"/>" << "\n";
+        fp << "\t\t\t<timing R=\"" << node.R()
+           << "\" C=\"" << node.C() << "\"/>" << "\n";
 
         if (device_ctx.rr_indexed_data[node.cost_index()].seg_index != -1) {
-            fp << "\t\t\t<segment segment_id=\"" << device_ctx.rr_indexed_data[node.cost_index()].seg_index << "\"/>" << std::endl;
+            fp << "\t\t\t<segment segment_id=\"" << device_ctx.rr_indexed_data[node.cost_index()].seg_index << "\"/>" << "\n";
         }
 
         const auto iter = device_ctx.rr_node_metadata.find(inode);
@@ -135,32 +348,30 @@ void write_rr_node(std::fstream& fp) {
             add_metadata_to_xml(fp, "\t\t\t", meta);
         }
 
-        fp << "\t\t</node>" << std::endl;
+        fp << "\t\t</node>" << "\n";
     }
 
-    fp << "\t</rr_nodes>" << std::endl
-       << std::endl;
+    fp << "\t</rr_nodes>" << "\n\n";
 }
 
 /* Segment information in the t_segment_inf data structure is written out.
  * Information includes segment id, name, and optional timing parameters*/
-void write_rr_segments(std::fstream& fp, const std::vector<t_segment_inf>& segment_inf) {
-    fp << "\t<segments>" << std::endl;
+void write_rr_segments(RrGraphOutput& fp, const std::vector<t_segment_inf>& segment_inf) {
+    fp << "\t<segments>" << "\n";
 
     for (size_t iseg = 0; iseg < segment_inf.size(); iseg++) {
-        fp << "\t\t<segment id=\"" << iseg << "\" name=\"" << segment_inf[iseg].name << "\">" << std::endl;
-        fp << "\t\t\t<timing R_per_meter=\"" << std::setprecision(FLOAT_PRECISION) << segment_inf[iseg].Rmetal << "\" C_per_meter=\"" << std::setprecision(FLOAT_PRECISION) << segment_inf[iseg].Cmetal << "\"/>" << std::endl;
-        fp << "\t\t</segment>" << std::endl;
+        fp << "\t\t<segment id=\"" << iseg << "\" name=\"" << segment_inf[iseg].name << "\">" << "\n";
+        fp << "\t\t\t<timing R_per_meter=\"" << segment_inf[iseg].Rmetal << "\" C_per_meter=\"" << segment_inf[iseg].Cmetal << "\"/>" << "\n";
+        fp << "\t\t</segment>" << "\n";
     }
-    fp << "\t</segments>" << std::endl
-       << std::endl;
+    fp << "\t</segments>" << "\n\n";
 }
 
 /* Switch info is written out into xml format. This includes
  * general, sizing, and optional timing information*/
-void write_rr_switches(std::fstream& fp) {
+void write_rr_switches(RrGraphOutput& fp) {
     auto& device_ctx = g_vpr_ctx.device();
-    fp << "\t<switches>" << std::endl;
+    fp << "\t<switches>" << "\n";
 
     for (size_t iSwitch = 0; iSwitch < device_ctx.rr_switch_inf.size(); iSwitch++) {
         t_rr_switch_inf rr_switch = device_ctx.rr_switch_inf[iSwitch];
@@ -185,21 +396,20 @@ void write_rr_switches(std::fstream& fp) {
         if (rr_switch.name) {
             fp << " name=\"" << rr_switch.name << "\"";
         }
-        fp << ">" << std::endl;
+        fp << ">" << "\n";
 
-        fp << "\t\t\t<timing R=\"" << std::setprecision(FLOAT_PRECISION) << rr_switch.R << "\" Cin=\"" << std::setprecision(FLOAT_PRECISION) << rr_switch.Cin << "\" Cout=\"" << std::setprecision(FLOAT_PRECISION) << rr_switch.Cout << "\" Cinternal=\"" << std::setprecision(FLOAT_PRECISION) << rr_switch.Cinternal << "\" Tdel=\"" << std::setprecision(FLOAT_PRECISION) << rr_switch.Tdel << "\"/>" << std::endl;
-        fp << "\t\t\t<sizing mux_trans_size=\"" << std::setprecision(FLOAT_PRECISION) << rr_switch.mux_trans_size << "\" buf_size=\"" << std::setprecision(FLOAT_PRECISION) << rr_switch.buf_size << "\"/>" << std::endl;
-        fp << "\t\t</switch>" << std::endl;
+        fp << "\t\t\t<timing R=\"" << rr_switch.R << "\" Cin=\"" << rr_switch.Cin << "\" Cout=\"" << rr_switch.Cout << "\" Cinternal=\"" << rr_switch.Cinternal << "\" Tdel=\"" << rr_switch.Tdel << "\"/>" << "\n";
+        fp << "\t\t\t<sizing mux_trans_size=\"" << rr_switch.mux_trans_size << "\" buf_size=\"" << rr_switch.buf_size << "\"/>" << "\n";
+        fp << "\t\t</switch>" << "\n";
     }
-    fp << "\t</switches>" << std::endl
-       << std::endl;
+    fp << "\t</switches>" << "\n\n";
 }
 
 /* Block information is printed out in xml format. This includes general,
  * pin class, and pins */
-void write_rr_block_types(std::fstream& fp) {
+void write_rr_block_types(RrGraphOutput& fp) {
     auto& device_ctx = g_vpr_ctx.device();
-    fp << "\t<block_types>" << std::endl;
+    fp << "\t<block_types>" << "\n";
 
     for (const auto& btype : device_ctx.physical_tile_types) {
         fp << "\t\t<block_type id=\"" << btype.index;
@@ -207,7 +417,7 @@ void write_rr_block_types(std::fstream& fp) {
         VTR_ASSERT(btype.name);
         fp << "\" name=\"" << btype.name;
 
-        fp << "\" width=\"" << btype.width << "\" height=\"" << btype.height << "\">" << std::endl;
+        fp << "\" width=\"" << btype.width << "\" height=\"" << btype.height << "\">" << "\n";
 
         for (int iClass = 0; iClass < btype.num_class; iClass++) {
             auto& class_inf = btype.class_inf[iClass];
@@ -235,37 +445,35 @@ void write_rr_block_types(std::fstream& fp) {
                 fp << vtr::string_fmt("\t\t\t\t<pin ptc=\"%d\">%s</pin>\n",
                                       pin, block_type_pin_index_to_name(&btype, pin).c_str());
             }
-            fp << "\t\t\t</pin_class>" << std::endl;
+            fp << "\t\t\t</pin_class>" << "\n";
         }
-        fp << "\t\t</block_type>" << std::endl;
+        fp << "\t\t</block_type>" << "\n";
     }
-    fp << "\t</block_types>" << std::endl
-       << std::endl;
+    fp << "\t</block_types>" << "\n\n";
 }
 
 /* Grid information is printed out in xml format. Each grid location
  * and its relevant information is included*/
-void write_rr_grid(std::fstream& fp) {
+void write_rr_grid(RrGraphOutput& fp) {
     auto& device_ctx = g_vpr_ctx.device();
 
-    fp << "\t<grid>" << std::endl;
+    fp << "\t<grid>" << "\n";
 
     for (size_t x = 0; x < device_ctx.grid.width(); x++) {
         for (size_t y = 0; y < device_ctx.grid.height(); y++) {
             t_grid_tile grid_tile = device_ctx.grid[x][y];
 
-            fp << "\t\t<grid_loc x=\"" << x << "\" y=\"" << y << "\" block_type_id=\"" << grid_tile.type->index << "\" width_offset=\"" << grid_tile.width_offset << "\" height_offset=\"" << grid_tile.height_offset << "\"/>" << std::endl;
+            fp << "\t\t<grid_loc x=\"" << x << "\" y=\"" << y << "\" block_type_id=\"" << grid_tile.type->index << "\" width_offset=\"" << grid_tile.width_offset << "\" height_offset=\"" << grid_tile.height_offset << "\"/>" << "\n";
         }
     }
-    fp << "\t</grid>" << std::endl
-       << std::endl;
+    fp << "\t</grid>" << "\n\n";
 }
 
 /* Edges connecting to each rr node is printed out. The two nodes
  * it connects to are also printed*/
-void write_rr_edges(std::fstream& fp) {
+void write_rr_edges(RrGraphOutput& fp) {
     auto& device_ctx = g_vpr_ctx.device();
-    fp << "\t<rr_edges>" << std::endl;
+    fp << "\t<rr_edges>" << "\n";
 
     for (size_t inode = 0; inode < device_ctx.rr_nodes.size(); inode++) {
         auto& node = device_ctx.rr_nodes[inode];
@@ -275,7 +483,7 @@ void write_rr_edges(std::fstream& fp) {
             bool wrote_edge_metadata = false;
             const auto iter = device_ctx.rr_edge_metadata.find(std::make_tuple(inode, node.edge_sink_node(iedge), node.edge_switch(iedge)));
             if (iter != device_ctx.rr_edge_metadata.end()) {
-                fp << ">" << std::endl;
+                fp << ">" << "\n";
 
                 const t_metadata_dict& meta = iter->second;
                 add_metadata_to_xml(fp, "\t\t\t", meta);
@@ -283,12 +491,11 @@ void write_rr_edges(std::fstream& fp) {
             }
 
             if (wrote_edge_metadata == false) {
-                fp << "/>" << std::endl;
+                fp << "/>" << "\n";
             } else {
-                fp << "\t\t</edge>" << std::endl;
+                fp << "\t\t</edge>" << "\n";
             }
         }
     }
-    fp << "\t</rr_edges>" << std::endl
-       << std::endl;
+    fp << "\t</rr_edges>" << "\n\n";
 }
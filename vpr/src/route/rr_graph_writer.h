@@ -1,11 +1,15 @@
 /*
  * This function writes the RR_graph generated by VPR into a file in XML format
  * Information included in the file includes rr nodes, rr switches, the grid, block info, node indices
+ *
+ * File names ending in '.gz' are gzip compressed, and those ending in '.bin' are
+ * written in the binary format (see rr_graph_binary.h).
+ * With nodes_and_edges_only only the rr_nodes and rr_edges sections are written.
  */
 
 #ifndef RR_GRAPH_WRITER_H
 #define RR_GRAPH_WRITER_H
 
-void write_rr_graph(const char* file_name, const std::vector<t_segment_inf>& segment_inf);
+void write_rr_graph(const char* file_name, const std::vector<t_segment_inf>& segment_inf, bool nodes_and_edges_only = false);
 
 #endif
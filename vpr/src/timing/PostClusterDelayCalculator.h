@@ -27,6 +27,14 @@ class PostClusterDelayCalculator : public tatum::DelayCalculator {
 
     void clear_cache();
 
+    //Appends to changed_edges the timing edges whose inter-cluster net delays have
+    //changed since the previous call (on the first call, all inter-cluster edges
+    //whose delays have been calculated are reported).
+    //
+    //Since only the net delays change during placement and routing, these are the
+    //edges which must be invalidated for an incremental timing update.
+    void find_changed_edges(const tatum::TimingGraph& tg, std::vector<tatum::EdgeId>& changed_edges);
+
     void set_tsu_margin_relative(float val);
     void set_tsu_margin_absolute(float val);
 
@@ -82,6 +90,9 @@ class PostClusterDelayCalculator : public tatum::DelayCalculator {
     mutable vtr::vector<tatum::EdgeId, tatum::Time> sink_clb_max_delay_cache_;
     mutable vtr::vector<tatum::EdgeId, std::pair<ClusterPinId, ClusterPinId>> pin_cache_min_;
     mutable vtr::vector<tatum::EdgeId, std::pair<ClusterPinId, ClusterPinId>> pin_cache_max_;
+
+    //Net delay of each inter-cluster edge when find_changed_edges() was last called
+    vtr::vector<tatum::EdgeId, float> prev_edge_net_delays_;
 };
 
 #include "PostClusterDelayCalculator.tpp"
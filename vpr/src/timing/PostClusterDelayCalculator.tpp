@@ -24,7 +24,8 @@ inline PostClusterDelayCalculator::PostClusterDelayCalculator(const AtomNetlist&
     , sink_clb_min_delay_cache_(g_vpr_ctx.timing().graph->edges().size(), tatum::Time(NAN))
     , sink_clb_max_delay_cache_(g_vpr_ctx.timing().graph->edges().size(), tatum::Time(NAN))
     , pin_cache_min_(g_vpr_ctx.timing().graph->edges().size(), std::pair<ClusterPinId, ClusterPinId>(ClusterPinId::INVALID(), ClusterPinId::INVALID()))
-    , pin_cache_max_(g_vpr_ctx.timing().graph->edges().size(), std::pair<ClusterPinId, ClusterPinId>(ClusterPinId::INVALID(), ClusterPinId::INVALID())) {
+    , pin_cache_max_(g_vpr_ctx.timing().graph->edges().size(), std::pair<ClusterPinId, ClusterPinId>(ClusterPinId::INVALID(), ClusterPinId::INVALID()))
+    , prev_edge_net_delays_(g_vpr_ctx.timing().graph->edges().size(), NAN) {
     net_delay_ = net_delay;
 }
 
@@ -39,6 +40,29 @@ inline void PostClusterDelayCalculator::clear_cache() {
     std::fill(pin_cache_max_.begin(), pin_cache_max_.end(), std::pair<ClusterPinId, ClusterPinId>(ClusterPinId::INVALID(), ClusterPinId::INVALID()));
 }
 
+inline void PostClusterDelayCalculator::find_changed_edges(const tatum::TimingGraph& tg, std::vector<tatum::EdgeId>& changed_edges) {
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+
+    for (tatum::EdgeId edge : tg.edges()) {
+        //The cluster pins of an inter-cluster edge are cached once its delay has been calculated.
+        //Other edges (e.g. within clusters) have fixed delays.
+        ClusterPinId sink_pin = pin_cache_max_[edge].second;
+        if (sink_pin == ClusterPinId::INVALID()) {
+            sink_pin = pin_cache_min_[edge].second;
+        }
+        if (sink_pin == ClusterPinId::INVALID()) continue;
+
+        float net_delay = inter_cluster_delay(cluster_ctx.clb_nlist.pin_net(sink_pin),
+                                              0,
+                                              cluster_ctx.clb_nlist.pin_net_index(sink_pin));
+
+        if (net_delay != prev_edge_net_delays_[edge]) { //Note: always true for NaN (i.e. on the first call)
+            prev_edge_net_delays_[edge] = net_delay;
+            changed_edges.push_back(edge);
+        }
+    }
+}
+
 inline void PostClusterDelayCalculator::set_tsu_margin_relative(float new_margin) {
     tsu_margin_rel_ = new_margin;
 }
@@ -2,6 +2,7 @@
 
 #include "timing_info.h"
 #include "concrete_timing_info.h"
+#include "PostClusterDelayCalculator.h"
 
 void warn_unconstrained(std::shared_ptr<const tatum::TimingAnalyzer> analyzer) {
     if (analyzer->num_unconstrained_startpoints() > 0) {
@@ -13,3 +14,8 @@ void warn_unconstrained(std::shared_ptr<const tatum::TimingAnalyzer> analyzer) {
                      analyzer->num_unconstrained_endpoints());
     }
 }
+
+bool find_changed_timing_edges(const tatum::TimingGraph& tg, PostClusterDelayCalculator& delay_calc, std::vector<tatum::EdgeId>& changed_edges) {
+    delay_calc.find_changed_edges(tg, changed_edges);
+    return true;
+}
@@ -11,6 +11,75 @@
 
 void warn_unconstrained(std::shared_ptr<const tatum::TimingAnalyzer> analyzer);
 
+class PostClusterDelayCalculator;
+
+//Finds the timing graph edges whose delays have changed since the previous call.
+//Returns false if the delay calculator can not tell which edges changed.
+template<class DelayCalc>
+bool find_changed_timing_edges(const tatum::TimingGraph& /*tg*/, DelayCalc& /*delay_calc*/, std::vector<tatum::EdgeId>& /*changed_edges*/) {
+    return false;
+}
+
+bool find_changed_timing_edges(const tatum::TimingGraph& tg, PostClusterDelayCalculator& delay_calc, std::vector<tatum::EdgeId>& changed_edges);
+
+//Decides how each timing update is performed (see e_timing_update_type), invalidating
+//the edges whose delays have changed before an incremental update
+template<class DelayCalc>
+class TimingUpdateTracker {
+  public:
+    TimingUpdateTracker(e_timing_update_type update_type)
+        : update_type_(update_type) {}
+
+    //Prepares analyzer for the next update.
+    //Returns false if no delays have changed since the previous update (so it can be skipped)
+    bool prepare_update(const tatum::TimingGraph& tg, DelayCalc& delay_calc, tatum::TimingAnalyzer& analyzer) {
+        incremental_ = false;
+        if (update_type_ == e_timing_update_type::FULL || !analyzed_) return true;
+
+        changed_edges_.clear();
+        if (!find_changed_timing_edges(tg, delay_calc, changed_edges_)) return true; //Unknown changes, full update
+
+        if (changed_edges_.empty()) return false;
+
+        if (update_type_ == e_timing_update_type::AUTO
+            && changed_edges_.size() > AUTO_MAX_INCR_EDGE_FRAC * tg.edges().size()) {
+            //Too many changes for an incremental update to pay off
+            return true;
+        }
+
+        for (tatum::EdgeId edge : changed_edges_) {
+            analyzer.invalidate_edge(edge);
+        }
+        incremental_ = true;
+        return true;
+    }
+
+    //Records that an update has completed
+    void finish_update(const tatum::TimingGraph& tg, DelayCalc& delay_calc) {
+        if (update_type_ != e_timing_update_type::FULL && !analyzed_) {
+            //Record the delays later updates are compared against
+            changed_edges_.clear();
+            find_changed_timing_edges(tg, delay_calc, changed_edges_);
+        }
+        analyzed_ = true;
+    }
+
+    //Forces the next update to be a full update
+    void invalidate() { analyzed_ = false; }
+
+    //Returns true if the last prepared update was incremental
+    bool incremental() const { return incremental_; }
+
+  private:
+    //With AUTO, full updates are used if more than this fraction of the edges changed
+    static constexpr float AUTO_MAX_INCR_EDGE_FRAC = 0.1;
+
+    e_timing_update_type update_type_;
+    bool analyzed_ = false;
+    bool incremental_ = false;
+    std::vector<tatum::EdgeId> changed_edges_;
+};
+
 //NOTE: These classes should not be used directly but created with the
 //      make_*_timing_info() functions in timing_info.h, and used through
 //      their abstract interfaces (SetupTimingInfo, HoldTimingInfo etc.)
@@ -22,12 +91,14 @@ class ConcreteSetupTimingInfo : public SetupTimingInfo {
     ConcreteSetupTimingInfo(std::shared_ptr<const tatum::TimingGraph> timing_graph_v,
                             std::shared_ptr<const tatum::TimingConstraints> timing_constraints_v,
                             std::shared_ptr<DelayCalc> delay_calc,
-                            std::shared_ptr<tatum::SetupTimingAnalyzer> analyzer_v)
+                            std::shared_ptr<tatum::SetupTimingAnalyzer> analyzer_v,
+                            e_timing_update_type update_type = e_timing_update_type::FULL)
         : timing_graph_(timing_graph_v)
         , timing_constraints_(timing_constraints_v)
         , delay_calc_(delay_calc)
         , setup_analyzer_(analyzer_v)
-        , slack_crit_(g_vpr_ctx.atom().nlist, g_vpr_ctx.atom().lookup) {
+        , slack_crit_(g_vpr_ctx.atom().nlist, g_vpr_ctx.atom().lookup)
+        , update_tracker_(update_type) {
         //pass
     }
 
@@ -105,7 +176,12 @@ class ConcreteSetupTimingInfo : public SetupTimingInfo {
         {
             auto start_time = Clock::now();
 
+            if (!update_tracker_.prepare_update(*timing_graph_, *delay_calc_, *setup_analyzer_)) {
+                return; //No delays changed
+            }
+
             setup_analyzer_->update_setup_timing();
+            update_tracker_.finish_update(*timing_graph_, *delay_calc_);
 
             sta_wallclock_time = std::chrono::duration_cast<dsec>(Clock::now() - start_time).count();
         }
@@ -123,7 +199,11 @@ class ConcreteSetupTimingInfo : public SetupTimingInfo {
         auto& timing_ctx = g_vpr_ctx.mutable_timing();
         timing_ctx.stats.sta_wallclock_time += sta_wallclock_time;
         timing_ctx.stats.slack_wallclock_time += slack_wallclock_time;
-        timing_ctx.stats.num_full_setup_updates += 1;
+        if (update_tracker_.incremental()) {
+            timing_ctx.stats.num_incr_updates += 1;
+        } else {
+            timing_ctx.stats.num_full_setup_updates += 1;
+        }
 
         clear_cache();
     }
@@ -144,6 +224,8 @@ class ConcreteSetupTimingInfo : public SetupTimingInfo {
 
     SetupSlackCrit slack_crit_;
 
+    TimingUpdateTracker<DelayCalc> update_tracker_;
+
     //Cached values
     mutable float sTNS_ = std::numeric_limits<float>::quiet_NaN();
     mutable float sWNS_ = std::numeric_limits<float>::quiet_NaN();
@@ -171,12 +253,14 @@ class ConcreteHoldTimingInfo : public HoldTimingInfo {
     ConcreteHoldTimingInfo(std::shared_ptr<const tatum::TimingGraph> timing_graph_v,
                            std::shared_ptr<const tatum::TimingConstraints> timing_constraints_v,
                            std::shared_ptr<DelayCalc> delay_calc,
-                           std::shared_ptr<tatum::HoldTimingAnalyzer> analyzer_v)
+                           std::shared_ptr<tatum::HoldTimingAnalyzer> analyzer_v,
+                           e_timing_update_type update_type = e_timing_update_type::FULL)
         : timing_graph_(timing_graph_v)
         , timing_constraints_(timing_constraints_v)
         , delay_calc_(delay_calc)
         , hold_analyzer_(analyzer_v)
-        , slack_crit_(g_vpr_ctx.atom().nlist, g_vpr_ctx.atom().lookup) {
+        , slack_crit_(g_vpr_ctx.atom().nlist, g_vpr_ctx.atom().lookup)
+        , update_tracker_(update_type) {
         //pass
     }
 
@@ -218,7 +302,12 @@ class ConcreteHoldTimingInfo : public HoldTimingInfo {
         {
             auto start_time = Clock::now();
 
+            if (!update_tracker_.prepare_update(*timing_graph_, *delay_calc_, *hold_analyzer_)) {
+                return; //No delays changed
+            }
+
             hold_analyzer_->update_hold_timing();
+            update_tracker_.finish_update(*timing_graph_, *delay_calc_);
 
             sta_wallclock_time = std::chrono::duration_cast<dsec>(Clock::now() - start_time).count();
         }
@@ -236,7 +325,11 @@ class ConcreteHoldTimingInfo : public HoldTimingInfo {
         auto& timing_ctx = g_vpr_ctx.mutable_timing();
         timing_ctx.stats.sta_wallclock_time += sta_wallclock_time;
         timing_ctx.stats.slack_wallclock_time += slack_wallclock_time;
-        timing_ctx.stats.num_full_hold_updates += 1;
+        if (update_tracker_.incremental()) {
+            timing_ctx.stats.num_incr_updates += 1;
+        } else {
+            timing_ctx.stats.num_full_hold_updates += 1;
+        }
     }
 
     void update_hold_slacks() {
@@ -254,6 +347,8 @@ class ConcreteHoldTimingInfo : public HoldTimingInfo {
 
     HoldSlackCrit slack_crit_;
 
+    TimingUpdateTracker<DelayCalc> update_tracker_;
+
     bool warn_unconstrained_ = true;
 
     typedef std::chrono::duration<double> dsec;
@@ -267,10 +362,13 @@ class ConcreteSetupHoldTimingInfo : public SetupHoldTimingInfo {
     ConcreteSetupHoldTimingInfo(std::shared_ptr<const tatum::TimingGraph> timing_graph_v,
                                 std::shared_ptr<const tatum::TimingConstraints> timing_constraints_v,
                                 std::shared_ptr<DelayCalc> delay_calc,
-                                std::shared_ptr<tatum::SetupHoldTimingAnalyzer> analyzer_v)
+                                std::shared_ptr<tatum::SetupHoldTimingAnalyzer> analyzer_v,
+                                e_timing_update_type update_type = e_timing_update_type::FULL)
         : setup_timing_(timing_graph_v, timing_constraints_v, delay_calc, analyzer_v)
         , hold_timing_(timing_graph_v, timing_constraints_v, delay_calc, analyzer_v)
-        , setup_hold_analyzer_(analyzer_v) {
+        , setup_hold_analyzer_(analyzer_v)
+        , delay_calc_(delay_calc)
+        , update_tracker_(update_type) {
         //pass
     }
 
@@ -322,7 +420,12 @@ class ConcreteSetupHoldTimingInfo : public SetupHoldTimingInfo {
         {
             auto start_time = Clock::now();
 
+            if (!update_tracker_.prepare_update(*timing_graph(), *delay_calc_, *setup_hold_analyzer_)) {
+                return; //No delays changed
+            }
+
             setup_hold_analyzer_->update_timing();
+            update_tracker_.finish_update(*timing_graph(), *delay_calc_);
 
             sta_wallclock_time = std::chrono::duration_cast<dsec>(Clock::now() - start_time).count();
         }
@@ -345,14 +448,25 @@ class ConcreteSetupHoldTimingInfo : public SetupHoldTimingInfo {
         auto& timing_ctx = g_vpr_ctx.mutable_timing();
         timing_ctx.stats.sta_wallclock_time += sta_wallclock_time;
         timing_ctx.stats.slack_wallclock_time += slack_wallclock_time;
-        timing_ctx.stats.num_full_setup_hold_updates += 1;
+        if (update_tracker_.incremental()) {
+            timing_ctx.stats.num_incr_updates += 1;
+        } else {
+            timing_ctx.stats.num_full_setup_hold_updates += 1;
+        }
     }
 
     //Update hold only
-    void update_hold() override { hold_timing_.update_hold(); }
+    //  Note that the (combined) analyzer then requires the next combined update to be a full update
+    void update_hold() override {
+        hold_timing_.update_hold();
+        update_tracker_.invalidate();
+    }
 
     //Update setup only
-    void update_setup() override { setup_timing_.update_setup(); }
+    void update_setup() override {
+        setup_timing_.update_setup();
+        update_tracker_.invalidate();
+    }
 
     void set_warn_unconstrained(bool val) override { warn_unconstrained_ = val; }
 
@@ -360,6 +474,9 @@ class ConcreteSetupHoldTimingInfo : public SetupHoldTimingInfo {
     ConcreteSetupTimingInfo<DelayCalc> setup_timing_;
     ConcreteHoldTimingInfo<DelayCalc> hold_timing_;
     std::shared_ptr<tatum::SetupHoldTimingAnalyzer> setup_hold_analyzer_;
+    std::shared_ptr<DelayCalc> delay_calc_;
+
+    TimingUpdateTracker<DelayCalc> update_tracker_;
 
     bool warn_unconstrained_ = true;
 
@@ -0,0 +1,137 @@
+#include "catch.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "blifparse.hpp"
+#include "blif_parallel_parse.h"
+
+namespace {
+
+//Records every callback (except line numbers, which the parsers report at different
+//points of a statement) as a line of text
+class RecordingBlifCallback : public blifparse::Callback {
+  public:
+    void start_parse() override { record("start"); }
+    void filename(std::string /*fname*/) override {}
+    void lineno(int /*line_num*/) override {}
+    void begin_model(std::string model_name) override { record("model " + model_name); }
+    void inputs(std::vector<std::string> inputs) override { record("inputs" + join(inputs)); }
+    void outputs(std::vector<std::string> outputs) override { record("outputs" + join(outputs)); }
+    void names(std::vector<std::string> nets, std::vector<std::vector<blifparse::LogicValue>> so_cover) override {
+        std::string cover;
+        for (const auto& row : so_cover) {
+            cover += " ";
+            for (auto val : row) cover += std::to_string(int(val));
+        }
+        record("names" + join(nets) + " :" + cover);
+    }
+    void latch(std::string input, std::string output, blifparse::LatchType type, std::string control, blifparse::LogicValue init) override {
+        record("latch " + input + " " + output + " " + std::to_string(int(type)) + " '" + control + "' " + std::to_string(int(init)));
+    }
+    void subckt(std::string model, std::vector<std::string> ports, std::vector<std::string> nets) override {
+        record("subckt " + model + join(ports) + " :" + join(nets));
+    }
+    void blackbox() override { record("blackbox"); }
+    void end_model() override { record("end"); }
+    void conn(std::string src, std::string dst) override { record("conn " + src + " " + dst); }
+    void cname(std::string cell_name) override { record("cname " + cell_name); }
+    void attr(std::string name, std::string value) override { record("attr " + name + " '" + value + "'"); }
+    void param(std::string name, std::string value) override { record("param " + name + " '" + value + "'"); }
+    void finish_parse() override { record("finish"); }
+    void parse_error(const int /*curr_lineno*/, const std::string& near_text, const std::string& msg) override {
+        record("error near '" + near_text + "': " + msg);
+    }
+
+    std::vector<std::string> records;
+
+  private:
+    static std::string join(const std::vector<std::string>& strs) {
+        std::string joined;
+        for (const auto& str : strs) joined += " " + str;
+        return joined;
+    }
+
+    void record(std::string str) { records.push_back(std::move(str)); }
+};
+
+void write_file(const char* filename, const std::string& text) {
+    std::ofstream os(filename, std::ios::binary);
+    os << text;
+}
+
+void require_same_callbacks(const char* filename) {
+    RecordingBlifCallback serial;
+    blifparse::blif_parse_filename(filename, serial);
+
+    RecordingBlifCallback parallel;
+    blif_parse_filename_parallel(filename, parallel);
+
+    REQUIRE(serial.records.size() > 2);
+    REQUIRE(parallel.records == serial.records);
+}
+
+TEST_CASE("blif_parallel_parse_matches_blifparse", "[vpr]") {
+    const char* filename = "test_blif_parallel_parse.eblif";
+    write_file(filename,
+               "# A comment\n"
+               ".model top\n"
+               ".inputs a b \\\n"
+               "  clk\n"
+               ".outputs o1 o2\n"
+               "\n"
+               ".names a b n1 # trailing comment\n"
+               "1- 1\n"
+               "-1 1\r\n"
+               ".names n0\n"
+               ".names a\\b n2\n"
+               "0 1\n"
+               ".latch n1 q1 re clk 0\n"
+               ".latch n2 q2 1\n"
+               ".latch n2 q3\n"
+               ".latch n2 q4 fe NIL\n"
+               ".subckt adder a=a b = b \\\n"
+               "    cout=o1\n"
+               ".cname add0\n"
+               ".attr src \"top.v:3\"\n"
+               ".param WIDTH 0101\n"
+               ".param FLAG\n"
+               ".conn q1 o2\n"
+               ".end\n"
+               "\n"
+               ".model adder\n"
+               ".inputs a b\n"
+               ".outputs cout\n"
+               ".blackbox\n"
+               ".end");
+
+    require_same_callbacks(filename);
+
+    std::remove(filename);
+}
+
+TEST_CASE("blif_parallel_parse_matches_blifparse_across_chunks", "[vpr]") {
+    //Large enough to be split into several chunks
+    const char* filename = "test_blif_parallel_parse_large.blif";
+
+    std::stringstream ss;
+    ss << ".model top\n.inputs clk i0\n.outputs o\n";
+    for (int i = 0; i < 60000; ++i) {
+        ss << ".names i" << i << " n" << i << " \\\n  i" << (i + 1) << "\n";
+        ss << "11 1\n0- 1\n";
+        ss << ".latch i" << i << " q" << i << " re clk " << (i % 4) << "\n";
+        ss << ".subckt sub a=n" << i << " b=q" << i << "\n";
+    }
+    ss << ".names i60000 o\n1 1\n.end\n";
+    ss << ".model sub\n.inputs a b\n.outputs\n.blackbox\n.end\n";
+    write_file(filename, ss.str());
+
+    require_same_callbacks(filename);
+
+    std::remove(filename);
+}
+
+} // namespace
@@ -0,0 +1,324 @@
+#include "catch.hpp"
+
+#include <chrono>
+#include <functional>
+#include <queue>
+#include <random>
+#include <vector>
+
+#include "vtr_log.h"
+
+#include "globals.h"
+#include "rr_graph_obj.h"
+#include "frozen_rr_graph.h"
+
+namespace {
+
+static std::vector<t_rr_switch_inf> make_switches() {
+    std::vector<t_rr_switch_inf> switches(3);
+
+    switches[0].set_type(SwitchType::MUX);
+    switches[0].R = 100.;
+    switches[0].Tdel = 50e-12;
+    switches[0].Cinternal = 1e-15;
+
+    switches[1].set_type(SwitchType::PASS_GATE);
+    switches[1].R = 200.;
+    switches[1].Tdel = 20e-12;
+
+    switches[2].set_type(SwitchType::SHORT);
+
+    return switches;
+}
+
+//Builds a synthetic island-style rr graph of wires on a width x height grid.
+//Each wire connects to wires_per_tile random wires within a few tiles of it,
+//and the first edge of every fourth wire is a non-configurable short.
+static void make_grid_rr_nodes(std::vector<t_rr_node>& rr_nodes, int width, int height, int wires_per_tile, int fanout) {
+    std::mt19937 rng(1);
+    std::uniform_int_distribution<int> offset(-3, 3);
+    std::uniform_int_distribution<int> track(0, wires_per_tile - 1);
+    std::uniform_int_distribution<int> iswitch(0, 1);
+
+    short rc_index = find_create_rr_rc_data(50., 20e-15);
+
+    rr_nodes.clear();
+    rr_nodes.resize(size_t(width) * height * wires_per_tile);
+    for (int x = 0; x < width; ++x) {
+        for (int y = 0; y < height; ++y) {
+            for (int itrack = 0; itrack < wires_per_tile; ++itrack) {
+                int inode = (x * height + y) * wires_per_tile + itrack;
+                t_rr_node& node = rr_nodes[inode];
+                node.set_type(itrack % 2 ? CHANY : CHANX);
+                node.set_coordinates(x, y, x, y);
+                node.set_cost_index(CHANX_COST_INDEX_START);
+                node.set_rc_index(rc_index);
+
+                for (int iedge = 0; iedge < fanout; ++iedge) {
+                    int sink_x = std::min(std::max(x + offset(rng), 0), width - 1);
+                    int sink_y = std::min(std::max(y + offset(rng), 0), height - 1);
+                    int sink = (sink_x * height + sink_y) * wires_per_tile + track(rng);
+                    int edge_switch = (iedge == 0 && inode % 4 == 0) ? 2 : iswitch(rng);
+                    node.add_edge(sink, edge_switch);
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("frozen_rr_graph_matches_rr_nodes", "[vpr]") {
+    std::vector<t_rr_switch_inf> rr_switch_inf = make_switches();
+    std::vector<t_rr_node> rr_nodes;
+    make_grid_rr_nodes(rr_nodes, 10, 10, 8, 6);
+
+    FrozenRRGraph frozen;
+    frozen.build(rr_nodes, rr_switch_inf);
+
+    REQUIRE(frozen.num_nodes() == rr_nodes.size());
+    REQUIRE(frozen.num_switches() == rr_switch_inf.size());
+
+    size_t num_edges = 0;
+    for (size_t inode = 0; inode < rr_nodes.size(); ++inode) {
+        const t_rr_node& rr_node = rr_nodes[inode];
+        RRNodeId node(inode);
+
+        CHECK(frozen.node_type(node) == rr_node.type());
+        CHECK(frozen.node_xlow(node) == rr_node.xlow());
+        CHECK(frozen.node_ylow(node) == rr_node.ylow());
+        CHECK(frozen.node_xhigh(node) == rr_node.xhigh());
+        CHECK(frozen.node_yhigh(node) == rr_node.yhigh());
+        CHECK(frozen.node_cost_index(node) == rr_node.cost_index());
+        CHECK(frozen.node_R(node) == rr_node.R());
+        CHECK(frozen.node_C(node) == rr_node.C());
+
+        REQUIRE(frozen.node_num_edges(node) == rr_node.num_edges());
+        for (t_edge_size iedge = 0; iedge < rr_node.num_edges(); ++iedge) {
+            RREdgeId edge = frozen.node_edge(node, iedge);
+            CHECK(size_t(frozen.edge_sink_node(edge)) == size_t(rr_node.edge_sink_node(iedge)));
+            CHECK(size_t(frozen.edge_switch(edge)) == size_t(rr_node.edge_switch(iedge)));
+            CHECK(frozen.edge_is_configurable(edge) == rr_switch_inf[rr_node.edge_switch(iedge)].configurable());
+        }
+        num_edges += rr_node.num_edges();
+    }
+    CHECK(frozen.num_edges() == num_edges);
+
+    for (size_t iswitch = 0; iswitch < rr_switch_inf.size(); ++iswitch) {
+        RRSwitchId switch_id(iswitch);
+        CHECK(frozen.switch_R(switch_id) == rr_switch_inf[iswitch].R);
+        CHECK(frozen.switch_Tdel(switch_id) == rr_switch_inf[iswitch].Tdel);
+        CHECK(frozen.switch_Cinternal(switch_id) == rr_switch_inf[iswitch].Cinternal);
+        CHECK(frozen.switch_buffered(switch_id) == rr_switch_inf[iswitch].buffered());
+        CHECK(frozen.switch_configurable(switch_id) == rr_switch_inf[iswitch].configurable());
+    }
+
+    frozen.clear();
+    CHECK(frozen.empty());
+    CHECK(frozen.num_edges() == 0);
+}
+
+TEST_CASE("frozen_rr_graph_from_rr_graph_obj", "[vpr]") {
+    std::vector<t_rr_switch_inf> rr_switch_inf = make_switches();
+
+    RRGraph rr_graph;
+    std::vector<RRSwitchId> switches;
+    for (const auto& switch_inf : rr_switch_inf) {
+        switches.push_back(rr_graph.create_switch(switch_inf));
+    }
+
+    std::vector<RRNodeId> nodes;
+    for (int i = 0; i < 4; ++i) {
+        RRNodeId node = rr_graph.create_node(CHANX);
+        rr_graph.set_node_bounding_box(node, vtr::Rect<short>(i, 0, i + 1, 0));
+        rr_graph.set_node_R(node, 10. * i);
+        rr_graph.set_node_C(node, 1e-15 * i);
+        rr_graph.set_node_cost_index(node, CHANX_COST_INDEX_START);
+        nodes.push_back(node);
+    }
+    rr_graph.create_edge(nodes[0], nodes[1], switches[0]);
+    rr_graph.create_edge(nodes[0], nodes[2], switches[1]);
+    rr_graph.create_edge(nodes[1], nodes[3], switches[0]);
+    rr_graph.create_edge(nodes[3], nodes[0], switches[2]);
+    REQUIRE(!rr_graph.is_dirty());
+
+    FrozenRRGraph frozen;
+    frozen.build(rr_graph);
+
+    REQUIRE(frozen.num_nodes() == 4);
+    REQUIRE(frozen.num_edges() == 4);
+    CHECK(frozen.node_num_edges(nodes[0]) == 2);
+    CHECK(frozen.node_num_edges(nodes[1]) == 1);
+    CHECK(frozen.node_num_edges(nodes[2]) == 0);
+    CHECK(frozen.node_num_edges(nodes[3]) == 1);
+
+    CHECK(frozen.edge_sink_node(frozen.node_edge(nodes[0], 0)) == nodes[1]);
+    CHECK(frozen.edge_sink_node(frozen.node_edge(nodes[0], 1)) == nodes[2]);
+    CHECK(frozen.edge_switch(frozen.node_edge(nodes[0], 1)) == switches[1]);
+    CHECK(frozen.edge_sink_node(frozen.node_edge(nodes[3], 0)) == nodes[0]);
+    CHECK(!frozen.edge_is_configurable(frozen.node_edge(nodes[3], 0)));
+
+    CHECK(frozen.node_xlow(nodes[2]) == 2);
+    CHECK(frozen.node_xhigh(nodes[2]) == 3);
+    CHECK(frozen.node_R(nodes[3]) == rr_graph.node_R(nodes[3]));
+    CHECK(frozen.node_C(nodes[3]) == rr_graph.node_C(nodes[3]));
+}
+
+//Cost of expanding one edge, with the same inputs as evaluate_timing_driven_node_costs()
+struct t_expansion_cost {
+    float R_upstream;
+    float Tdel;
+};
+
+static t_expansion_cost cost_edge(float R_upstream, bool buffered, float switch_R, float switch_Tdel, float switch_Cinternal, float from_R, float to_R, float to_C) {
+    if (buffered) {
+        R_upstream = 0.;
+    }
+    R_upstream += switch_R + to_R;
+    float Tdel = switch_Tdel + (R_upstream - 0.5 * to_R) * to_C;
+    Tdel += (R_upstream - 0.5 * from_R) * switch_Cinternal;
+    return {R_upstream, Tdel};
+}
+
+struct t_bench_heap_elem {
+    float cost;
+    float R_upstream;
+    int node;
+    bool operator>(const t_bench_heap_elem& other) const { return cost > other.cost; }
+};
+
+using t_bench_heap = std::priority_queue<t_bench_heap_elem, std::vector<t_bench_heap_elem>, std::greater<t_bench_heap_elem>>;
+
+//Runs a delay-driven wavefront expansion from source, pruned to a bounding box,
+//reading the graph through t_rr_node and rr_switch_inf as the router used to
+static float expand_rr_nodes(const std::vector<t_rr_node>& rr_nodes,
+                             const std::vector<t_rr_switch_inf>& rr_switch_inf,
+                             int source,
+                             int bb_radius,
+                             std::vector<float>& best_cost) {
+    std::fill(best_cost.begin(), best_cost.end(), std::numeric_limits<float>::infinity());
+    int xmin = rr_nodes[source].xlow() - bb_radius, xmax = rr_nodes[source].xhigh() + bb_radius;
+    int ymin = rr_nodes[source].ylow() - bb_radius, ymax = rr_nodes[source].yhigh() + bb_radius;
+
+    t_bench_heap heap;
+    heap.push({0., 0., source});
+    best_cost[source] = 0.;
+    float total = 0.;
+    while (!heap.empty()) {
+        t_bench_heap_elem current = heap.top();
+        heap.pop();
+        if (current.cost > best_cost[current.node]) continue;
+        total += current.cost;
+
+        const t_rr_node& from = rr_nodes[current.node];
+        for (t_edge_size iedge = 0; iedge < from.num_edges(); ++iedge) {
+            int to = from.edge_sink_node(iedge);
+            if (rr_nodes[to].xhigh() < xmin || rr_nodes[to].xlow() > xmax
+                || rr_nodes[to].yhigh() < ymin || rr_nodes[to].ylow() > ymax) {
+                continue;
+            }
+            const t_rr_switch_inf& sw = rr_switch_inf[from.edge_switch(iedge)];
+            t_expansion_cost cost = cost_edge(current.R_upstream, sw.buffered(), sw.R, sw.Tdel, sw.Cinternal,
+                                              from.R(), rr_nodes[to].R(), rr_nodes[to].C());
+            float new_cost = current.cost + cost.Tdel;
+            if (new_cost < best_cost[to]) {
+                best_cost[to] = new_cost;
+                heap.push({new_cost, cost.R_upstream, to});
+            }
+        }
+    }
+    return total;
+}
+
+//Same expansion as expand_rr_nodes(), reading the graph through FrozenRRGraph
+static float expand_frozen(const FrozenRRGraph& rr_graph,
+                           int source,
+                           int bb_radius,
+                           std::vector<float>& best_cost) {
+    std::fill(best_cost.begin(), best_cost.end(), std::numeric_limits<float>::infinity());
+    RRNodeId source_id(source);
+    int xmin = rr_graph.node_xlow(source_id) - bb_radius, xmax = rr_graph.node_xhigh(source_id) + bb_radius;
+    int ymin = rr_graph.node_ylow(source_id) - bb_radius, ymax = rr_graph.node_yhigh(source_id) + bb_radius;
+
+    t_bench_heap heap;
+    heap.push({0., 0., source});
+    best_cost[source] = 0.;
+    float total = 0.;
+    while (!heap.empty()) {
+        t_bench_heap_elem current = heap.top();
+        heap.pop();
+        if (current.cost > best_cost[current.node]) continue;
+        total += current.cost;
+
+        RRNodeId from(current.node);
+        for (t_edge_size iedge = 0; iedge < rr_graph.node_num_edges(from); ++iedge) {
+            RREdgeId edge = rr_graph.node_edge(from, iedge);
+            RRNodeId to = rr_graph.edge_sink_node(edge);
+            if (rr_graph.node_xhigh(to) < xmin || rr_graph.node_xlow(to) > xmax
+                || rr_graph.node_yhigh(to) < ymin || rr_graph.node_ylow(to) > ymax) {
+                continue;
+            }
+            RRSwitchId sw = rr_graph.edge_switch(edge);
+            t_expansion_cost cost = cost_edge(current.R_upstream, rr_graph.switch_buffered(sw), rr_graph.switch_R(sw),
+                                              rr_graph.switch_Tdel(sw), rr_graph.switch_Cinternal(sw),
+                                              rr_graph.node_R(from), rr_graph.node_R(to), rr_graph.node_C(to));
+            float new_cost = current.cost + cost.Tdel;
+            if (new_cost < best_cost[size_t(to)]) {
+                best_cost[size_t(to)] = new_cost;
+                heap.push({new_cost, cost.R_upstream, int(size_t(to))});
+            }
+        }
+    }
+    return total;
+}
+
+//Compares router-style expansion over t_rr_node against FrozenRRGraph on a
+//large synthetic graph. Run on its own to measure cache behaviour, e.g.:
+//
+//    perf stat -e cache-references,cache-misses ./test_vpr "frozen_rr_graph_expansion_benchmark"
+//
+//Routing runtime on real architectures is reported by VPR's own
+//'Routing took' line (e.g. on the titan benchmarks).
+TEST_CASE("frozen_rr_graph_expansion_benchmark", "[.][benchmark]") {
+    constexpr int kGridSize = 200;
+    constexpr int kWiresPerTile = 60;
+    constexpr int kFanout = 10;
+    constexpr int kNumSearches = 200;
+    constexpr int kBBRadius = 12;
+
+    std::vector<t_rr_switch_inf> rr_switch_inf = make_switches();
+    std::vector<t_rr_node> rr_nodes;
+    make_grid_rr_nodes(rr_nodes, kGridSize, kGridSize, kWiresPerTile, kFanout);
+
+    FrozenRRGraph frozen;
+    frozen.build(rr_nodes, rr_switch_inf);
+
+    std::mt19937 rng(2);
+    std::uniform_int_distribution<int> node_dist(0, rr_nodes.size() - 1);
+    std::vector<int> sources;
+    for (int i = 0; i < kNumSearches; ++i) {
+        sources.push_back(node_dist(rng));
+    }
+
+    std::vector<float> best_cost(rr_nodes.size());
+
+    auto start = std::chrono::steady_clock::now();
+    float rr_nodes_total = 0.;
+    for (int source : sources) {
+        rr_nodes_total += expand_rr_nodes(rr_nodes, rr_switch_inf, source, kBBRadius, best_cost);
+    }
+    auto rr_nodes_time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    start = std::chrono::steady_clock::now();
+    float frozen_total = 0.;
+    for (int source : sources) {
+        frozen_total += expand_frozen(frozen, source, kBBRadius, best_cost);
+    }
+    auto frozen_time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    CHECK(frozen_total == rr_nodes_total);
+
+    VTR_LOG("Expansion benchmark (%zu nodes, %zu edges, %d searches): t_rr_node %.3f sec, FrozenRRGraph %.3f sec (%.2fx)\n",
+            frozen.num_nodes(), frozen.num_edges(), kNumSearches,
+            rr_nodes_time, frozen_time, rr_nodes_time / frozen_time);
+}
+
+} // namespace
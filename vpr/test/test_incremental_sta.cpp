@@ -0,0 +1,211 @@
+#include "catch.hpp"
+
+#include <memory>
+#include <vector>
+
+#include "vtr_random.h"
+
+#include "tatum/TimingGraph.hpp"
+#include "tatum/TimingConstraints.hpp"
+#include "tatum/analyzer_factory.hpp"
+#include "tatum/graph_walkers.hpp"
+#include "tatum/delay_calc/DelayCalculator.hpp"
+
+namespace {
+
+using tatum::DomainId;
+using tatum::EdgeId;
+using tatum::EdgeType;
+using tatum::NodeId;
+using tatum::NodeType;
+using tatum::Time;
+
+//Delay calculator whose delays can be modified between timing updates
+class MutableDelayCalculator : public tatum::DelayCalculator {
+  public:
+    MutableDelayCalculator(size_t num_edges)
+        : max_delays(num_edges, Time(0.))
+        , min_delays(num_edges, Time(0.))
+        , setup_times(num_edges, Time(0.))
+        , hold_times(num_edges, Time(0.)) {}
+
+    Time max_edge_delay(const tatum::TimingGraph& /*tg*/, EdgeId edge) const override { return max_delays[edge]; }
+    Time min_edge_delay(const tatum::TimingGraph& /*tg*/, EdgeId edge) const override { return min_delays[edge]; }
+    Time setup_time(const tatum::TimingGraph& /*tg*/, EdgeId edge) const override { return setup_times[edge]; }
+    Time hold_time(const tatum::TimingGraph& /*tg*/, EdgeId edge) const override { return hold_times[edge]; }
+
+    tatum::util::linear_map<EdgeId, Time> max_delays;
+    tatum::util::linear_map<EdgeId, Time> min_delays;
+    tatum::util::linear_map<EdgeId, Time> setup_times;
+    tatum::util::linear_map<EdgeId, Time> hold_times;
+};
+
+//A small circuit of registers and multi-input logic, with reconvergent paths, a
+//primary input and a primary output:
+//
+//      pi ---> lut0 --------> lut2 ---> ff2 ---> lut3 ---> ff0
+//      ff0 --> lut0              ^               |
+//      ff0 --> lut1 ---> ff1 ----+               +-------> po
+//      ff1 -------------------------------------> lut3
+struct TestCircuit {
+    TestCircuit() {
+        NodeId clk = tg.add_node(NodeType::SOURCE);
+
+        std::vector<NodeId> ff_q;
+        std::vector<NodeId> ff_d;
+        for (int iff = 0; iff < 3; ++iff) {
+            NodeId cpin_launch = tg.add_node(NodeType::CPIN);
+            NodeId cpin_capture = tg.add_node(NodeType::CPIN);
+            NodeId q = tg.add_node(NodeType::SOURCE);
+            NodeId d = tg.add_node(NodeType::SINK);
+
+            tg.add_edge(EdgeType::INTERCONNECT, clk, cpin_launch);
+            tg.add_edge(EdgeType::INTERCONNECT, clk, cpin_capture);
+            tg.add_edge(EdgeType::PRIMITIVE_CLOCK_LAUNCH, cpin_launch, q);
+            tg.add_edge(EdgeType::PRIMITIVE_CLOCK_CAPTURE, cpin_capture, d);
+
+            ff_q.push_back(q);
+            ff_d.push_back(d);
+        }
+
+        NodeId pi = tg.add_node(NodeType::SOURCE);
+        NodeId po = tg.add_node(NodeType::SINK);
+
+        NodeId lut0 = add_lut({pi, ff_q[0]});
+        NodeId lut1 = add_lut({ff_q[0]});
+        tg.add_edge(EdgeType::INTERCONNECT, lut1, ff_d[1]);
+        NodeId lut2 = add_lut({lut0, ff_q[1]});
+        tg.add_edge(EdgeType::INTERCONNECT, lut2, ff_d[2]);
+        NodeId lut3 = add_lut({ff_q[2], ff_q[1]});
+        tg.add_edge(EdgeType::INTERCONNECT, lut3, ff_d[0]);
+        tg.add_edge(EdgeType::INTERCONNECT, lut3, po);
+
+        tg.levelize();
+        REQUIRE(tg.validate());
+
+        DomainId domain = tc.create_clock_domain("clk");
+        tc.set_clock_domain_source(clk, domain);
+        tc.set_setup_constraint(domain, domain, Time(10.));
+        tc.set_hold_constraint(domain, domain, Time(0.));
+        for (auto delay_type : {tatum::DelayType::MAX, tatum::DelayType::MIN}) {
+            tc.set_input_constraint(pi, domain, delay_type, Time(0.5));
+            tc.set_output_constraint(po, domain, delay_type, Time(0.5));
+        }
+
+        delay_calc = std::make_unique<MutableDelayCalculator>(tg.edges().size());
+        for (EdgeId edge : tg.edges()) {
+            randomize_delay(edge);
+        }
+    }
+
+    //Adds a LUT driven by the given nodes, returning its output pin
+    NodeId add_lut(std::vector<NodeId> drivers) {
+        NodeId opin = tg.add_node(NodeType::OPIN);
+        for (NodeId driver : drivers) {
+            NodeId ipin = tg.add_node(NodeType::IPIN);
+            tg.add_edge(EdgeType::INTERCONNECT, driver, ipin);
+            tg.add_edge(EdgeType::PRIMITIVE_COMBINATIONAL, ipin, opin);
+        }
+        return opin;
+    }
+
+    void randomize_delay(EdgeId edge) {
+        float max_delay = 0.1 + vtr::irand(40) * 0.1;
+        delay_calc->max_delays[edge] = Time(max_delay);
+        delay_calc->min_delays[edge] = Time(max_delay * 0.5);
+        delay_calc->setup_times[edge] = Time(0.1 * vtr::irand(3));
+        delay_calc->hold_times[edge] = Time(0.1 * vtr::irand(2));
+    }
+
+    tatum::TimingGraph tg;
+    tatum::TimingConstraints tc;
+    std::unique_ptr<MutableDelayCalculator> delay_calc;
+};
+
+void check_same_tags(tatum::TimingTags::tag_range lhs, tatum::TimingTags::tag_range rhs) {
+    REQUIRE(lhs.size() == rhs.size());
+
+    auto rhs_iter = rhs.begin();
+    for (const tatum::TimingTag& lhs_tag : lhs) {
+        const tatum::TimingTag& rhs_tag = *rhs_iter++;
+        REQUIRE(lhs_tag.type() == rhs_tag.type());
+        REQUIRE(lhs_tag.launch_clock_domain() == rhs_tag.launch_clock_domain());
+        REQUIRE(lhs_tag.capture_clock_domain() == rhs_tag.capture_clock_domain());
+        REQUIRE(lhs_tag.time().value() == Approx(rhs_tag.time().value()));
+    }
+}
+
+//Checks an incrementally updated analyzer against a full analysis of the same delays
+void check_matches_full_analysis(const TestCircuit& circuit, const tatum::SetupHoldTimingAnalyzer& incr_analyzer) {
+    auto full_analyzer = tatum::AnalyzerFactory<tatum::SetupHoldAnalysis>::make(circuit.tg, circuit.tc, *circuit.delay_calc);
+    full_analyzer->update_timing();
+
+    for (NodeId node : circuit.tg.nodes()) {
+        check_same_tags(incr_analyzer.setup_tags(node), full_analyzer->setup_tags(node));
+        check_same_tags(incr_analyzer.hold_tags(node), full_analyzer->hold_tags(node));
+        check_same_tags(incr_analyzer.setup_slacks(node), full_analyzer->setup_slacks(node));
+        check_same_tags(incr_analyzer.hold_slacks(node), full_analyzer->hold_slacks(node));
+    }
+
+    for (EdgeId edge : circuit.tg.edges()) {
+        check_same_tags(incr_analyzer.setup_slacks(edge), full_analyzer->setup_slacks(edge));
+        check_same_tags(incr_analyzer.hold_slacks(edge), full_analyzer->hold_slacks(edge));
+    }
+}
+
+template<class GraphWalker>
+void check_incremental_updates() {
+    vtr::srandom(1);
+    TestCircuit circuit;
+
+    auto analyzer = tatum::AnalyzerFactory<tatum::SetupHoldAnalysis, GraphWalker>::make(circuit.tg, circuit.tc, *circuit.delay_calc);
+    analyzer->update_timing();
+    check_matches_full_analysis(circuit, *analyzer);
+
+    std::vector<EdgeId> edges(circuit.tg.edges().begin(), circuit.tg.edges().end());
+    for (int iupdate = 0; iupdate < 50; ++iupdate) {
+        //Change a few delays (including clock network and sequential edges)
+        int num_changes = 1 + vtr::irand(2);
+        for (int ichange = 0; ichange < num_changes; ++ichange) {
+            EdgeId edge = edges[vtr::irand(edges.size() - 1)];
+            circuit.randomize_delay(edge);
+            analyzer->invalidate_edge(edge);
+        }
+
+        analyzer->update_timing();
+        check_matches_full_analysis(circuit, *analyzer);
+    }
+
+    REQUIRE(analyzer->get_profiling_data("num_full_updates") == 1);
+    REQUIRE(analyzer->get_profiling_data("num_incr_updates") == 50);
+}
+
+TEST_CASE("incremental_sta_serial", "[vpr]") {
+    check_incremental_updates<tatum::SerialWalker>();
+}
+
+TEST_CASE("incremental_sta_parallel", "[vpr]") {
+    check_incremental_updates<tatum::ParallelWalker>();
+}
+
+TEST_CASE("incremental_sta_after_partial_update", "[vpr]") {
+    vtr::srandom(2);
+    TestCircuit circuit;
+
+    auto analyzer = tatum::AnalyzerFactory<tatum::SetupHoldAnalysis>::make(circuit.tg, circuit.tc, *circuit.delay_calc);
+    analyzer->update_timing();
+
+    //A setup-only update leaves the hold results stale, so the next update must be full
+    EdgeId edge = *circuit.tg.edges().begin();
+    circuit.randomize_delay(edge);
+    analyzer->update_setup_timing();
+
+    circuit.randomize_delay(edge);
+    analyzer->invalidate_edge(edge);
+    analyzer->update_timing();
+
+    check_matches_full_analysis(circuit, *analyzer);
+    REQUIRE(analyzer->get_profiling_data("num_incr_updates") == 0);
+}
+
+} // namespace
@@ -0,0 +1,120 @@
+#include "catch.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "vtr_random.h"
+
+#include "move_generator_registry.h"
+#include "weighted_move_generator.h"
+#include "vpr_error.h"
+
+namespace {
+
+//Proposes no moves, but records the outcomes it is sent
+class FakeMoveGenerator : public MoveGenerator {
+  public:
+    FakeMoveGenerator(std::vector<e_move_result>& outcomes)
+        : outcomes_(outcomes) {}
+
+    e_create_move propose_move(t_pl_blocks_to_be_moved& /*affected_blocks*/, float /*rlim*/) override {
+        ++num_proposed;
+        return e_create_move::ABORT;
+    }
+
+    void process_outcome(const MoveOutcomeStats& move_outcome) override {
+        outcomes_.push_back(move_outcome.outcome);
+    }
+
+    size_t num_proposed = 0;
+
+  private:
+    std::vector<e_move_result>& outcomes_;
+};
+
+static MoveOutcomeStats outcome_stats(e_move_result outcome) {
+    MoveOutcomeStats stats;
+    stats.outcome = outcome;
+    stats.delta_cost_norm = 0.;
+    return stats;
+}
+
+TEST_CASE("move_generator_specs_parse", "[vpr]") {
+    auto specs = parse_move_generator_specs("uniform:2, median,critical:0.5");
+    REQUIRE(specs.size() == 3);
+    CHECK(specs[0].name == "uniform");
+    CHECK(specs[0].weight == 2.);
+    CHECK(specs[1].name == "median");
+    CHECK(specs[1].weight == 1.);
+    CHECK(specs[2].name == "critical");
+    CHECK(specs[2].weight == 0.5);
+
+    CHECK_THROWS_AS(parse_move_generator_specs("uniform,bogus"), const VprError&);
+    CHECK_THROWS_AS(parse_move_generator_specs("uniform:0"), const VprError&);
+    CHECK_THROWS_AS(parse_move_generator_specs(""), const VprError&);
+}
+
+TEST_CASE("weighted_move_generator_routes_outcomes", "[vpr]") {
+    std::vector<e_move_result> outcomes_a;
+    std::vector<e_move_result> outcomes_b;
+
+    WeightedMoveGenerator generator;
+    auto gen_a = new FakeMoveGenerator(outcomes_a);
+    auto gen_b = new FakeMoveGenerator(outcomes_b);
+    generator.add_generator("a", std::unique_ptr<MoveGenerator>(gen_a), 3.);
+    generator.add_generator("b", std::unique_ptr<MoveGenerator>(gen_b), 1.);
+    CHECK(generator.generator_probability(0) == Approx(0.75));
+
+    vtr::srandom(1);
+    t_pl_blocks_to_be_moved blocks_affected(0);
+
+    //Propose several moves before reporting any outcome (as batched placement does),
+    //and check each outcome reaches the generator which proposed the move
+    constexpr size_t kNumMoves = 1000;
+    std::vector<size_t> proposer;
+    for (size_t imove = 0; imove < kNumMoves; ++imove) {
+        size_t a_before = gen_a->num_proposed;
+        generator.propose_move(blocks_affected, 1.);
+        proposer.push_back(gen_a->num_proposed > a_before ? 0 : 1);
+    }
+    for (size_t imove = 0; imove < kNumMoves; ++imove) {
+        //Outcome encodes the proposer: a's moves are accepted, b's rejected
+        generator.process_outcome(outcome_stats(proposer[imove] == 0 ? ACCEPTED : REJECTED));
+    }
+
+    REQUIRE(outcomes_a.size() == gen_a->num_proposed);
+    REQUIRE(outcomes_b.size() == gen_b->num_proposed);
+    CHECK(std::count(outcomes_a.begin(), outcomes_a.end(), ACCEPTED) == long(outcomes_a.size()));
+    CHECK(std::count(outcomes_b.begin(), outcomes_b.end(), REJECTED) == long(outcomes_b.size()));
+
+    //Roughly 3:1
+    CHECK(gen_a->num_proposed > 2 * gen_b->num_proposed);
+    CHECK(gen_a->num_proposed < 4 * gen_b->num_proposed);
+}
+
+TEST_CASE("weighted_move_generator_adapts_weights", "[vpr]") {
+    std::vector<e_move_result> outcomes_good;
+    std::vector<e_move_result> outcomes_bad;
+
+    WeightedMoveGenerator generator(/*adaptive=*/true);
+    auto good = new FakeMoveGenerator(outcomes_good);
+    generator.add_generator("good", std::unique_ptr<MoveGenerator>(good), 1.);
+    generator.add_generator("bad", std::unique_ptr<MoveGenerator>(new FakeMoveGenerator(outcomes_bad)), 1.);
+
+    vtr::srandom(1);
+    t_pl_blocks_to_be_moved blocks_affected(0);
+
+    //Moves from 'good' are always accepted, those from 'bad' never are
+    for (size_t imove = 0; imove < 20000; ++imove) {
+        size_t num_good = good->num_proposed;
+        generator.propose_move(blocks_affected, 1.);
+        generator.process_outcome(outcome_stats(good->num_proposed > num_good ? ACCEPTED : REJECTED));
+    }
+
+    //'good' should now dominate, but 'bad' keeps its minimum probability
+    CHECK(generator.generator_probability(0) > 0.5);
+    CHECK(generator.generator_probability(1) > 0.);
+}
+
+} // namespace
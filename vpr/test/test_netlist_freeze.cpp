@@ -0,0 +1,147 @@
+#include "catch.hpp"
+
+#include <string>
+
+#include "atom_netlist.h"
+#include "logic_types.h"
+
+namespace {
+
+//A LUT-like model (in[2] -> out) and a flip-flop model (D, clk -> Q)
+struct TestModels {
+    TestModels() {
+        lut_in.dir = IN_PORT;
+        lut_in.name = lut_in_name;
+        lut_in.size = 2;
+        lut_out.dir = OUT_PORT;
+        lut_out.name = lut_out_name;
+        lut_out.size = 1;
+        lut.name = lut_name;
+        lut.inputs = &lut_in;
+        lut.outputs = &lut_out;
+
+        ff_d.dir = IN_PORT;
+        ff_d.name = ff_d_name;
+        ff_d.size = 1;
+        ff_d.next = &ff_clk;
+        ff_clk.dir = IN_PORT;
+        ff_clk.name = ff_clk_name;
+        ff_clk.size = 1;
+        ff_clk.is_clock = true;
+        ff_q.dir = OUT_PORT;
+        ff_q.name = ff_q_name;
+        ff_q.size = 1;
+        ff.name = ff_name;
+        ff.inputs = &ff_d;
+        ff.outputs = &ff_q;
+    }
+
+    char lut_name[4] = "lut";
+    char lut_in_name[3] = "in";
+    char lut_out_name[4] = "out";
+    char ff_name[3] = "ff";
+    char ff_d_name[2] = "D";
+    char ff_clk_name[4] = "clk";
+    char ff_q_name[2] = "Q";
+
+    t_model_ports lut_in, lut_out, ff_d, ff_clk, ff_q;
+    t_model lut, ff;
+};
+
+//A chain of LUTs, each also driven by a shared net, and registered by a flip-flop
+void build_netlist(AtomNetlist& netlist, const TestModels& models, int num_luts) {
+    AtomNetId shared = netlist.create_net("shared");
+    AtomNetId clk = netlist.create_net("clk");
+
+    AtomNetId prev = shared;
+    for (int i = 0; i < num_luts; ++i) {
+        std::string name = "lut" + std::to_string(i);
+        AtomBlockId blk = netlist.create_block(name, &models.lut);
+        AtomNetId out = netlist.create_net(name + "_out");
+
+        AtomPortId in_port = netlist.create_port(blk, &models.lut_in);
+        netlist.create_pin(in_port, 0, prev, PinType::SINK);
+        netlist.create_pin(in_port, 1, shared, PinType::SINK);
+        AtomPortId out_port = netlist.create_port(blk, &models.lut_out);
+        netlist.create_pin(out_port, 0, out, PinType::DRIVER);
+
+        prev = out;
+    }
+
+    AtomBlockId ff = netlist.create_block("ff", &models.ff);
+    netlist.create_pin(netlist.create_port(ff, &models.ff_d), 0, prev, PinType::SINK);
+    netlist.create_pin(netlist.create_port(ff, &models.ff_clk), 0, clk, PinType::SINK);
+    netlist.create_pin(netlist.create_port(ff, &models.ff_q), 0, netlist.create_net("q"), PinType::DRIVER);
+}
+
+//Describes the netlist connectivity and name look-ups through the public accessors
+std::string describe(const AtomNetlist& netlist) {
+    std::string desc;
+    for (AtomBlockId blk : netlist.blocks()) {
+        desc += netlist.block_name(blk) + ":";
+        desc += " lookup " + std::to_string(size_t(netlist.find_block(netlist.block_name(blk))));
+        for (AtomPinId pin : netlist.block_input_pins(blk)) desc += " i" + netlist.pin_name(pin);
+        for (AtomPinId pin : netlist.block_output_pins(blk)) desc += " o" + netlist.pin_name(pin);
+        for (AtomPinId pin : netlist.block_clock_pins(blk)) desc += " c" + netlist.pin_name(pin);
+        for (AtomPortId port : netlist.block_ports(blk)) {
+            desc += " " + netlist.port_name(port) + "[";
+            for (AtomPinId pin : netlist.port_pins(port)) desc += " " + std::to_string(netlist.pin_port_bit(pin));
+            desc += " ]";
+        }
+        desc += "\n";
+    }
+    for (AtomNetId net : netlist.nets()) {
+        desc += netlist.net_name(net) + ":";
+        desc += " lookup " + std::to_string(size_t(netlist.find_net(netlist.net_name(net))));
+        AtomPinId driver = netlist.net_driver(net);
+        desc += " driver " + (driver ? netlist.pin_name(driver) : std::string("none"));
+        for (AtomPinId pin : netlist.net_sinks(net)) desc += " " + netlist.pin_name(pin);
+        desc += "\n";
+    }
+    return desc;
+}
+
+TEST_CASE("netlist_freeze", "[vpr]") {
+    TestModels models;
+    AtomNetlist netlist("top");
+    build_netlist(netlist, models, 100);
+    REQUIRE(netlist.verify());
+
+    const std::string orig_desc = describe(netlist);
+    const size_t orig_bytes = netlist.list_and_lookup_memory_bytes();
+
+    netlist.freeze();
+    REQUIRE(netlist.is_frozen());
+    REQUIRE(netlist.verify());
+    CHECK(describe(netlist) == orig_desc);
+    CHECK(netlist.list_and_lookup_memory_bytes() < orig_bytes);
+    CHECK(!netlist.find_net("missing"));
+    CHECK(!netlist.find_block("missing"));
+
+    SECTION("mutation thaws") {
+        AtomNetId extra = netlist.create_net("extra");
+        CHECK(!netlist.is_frozen());
+        CHECK(netlist.find_net("extra") == extra);
+        REQUIRE(netlist.verify());
+
+        netlist.remove_net(extra);
+        netlist.remove_and_compress();
+        REQUIRE(netlist.verify());
+        CHECK(describe(netlist) == orig_desc);
+    }
+
+    SECTION("remove and compress") {
+        netlist.remove_block(netlist.find_block("ff"));
+        CHECK(!netlist.is_frozen());
+        netlist.remove_and_compress();
+        REQUIRE(netlist.verify());
+
+        netlist.freeze();
+        REQUIRE(netlist.verify());
+        CHECK(!netlist.find_block("ff"));
+        CHECK(netlist.find_block("lut99"));
+        CHECK(netlist.net_sinks(netlist.find_net("lut99_out")).size() == 0);
+    }
+}
+
+} // namespace
@@ -0,0 +1,166 @@
+#include "catch.hpp"
+
+#include <cstdio>
+#include <vector>
+
+#include "vtr_memory.h"
+
+#include "vpr_error.h"
+#include "globals.h"
+#include "power.h"
+#include "power_callibrate.h"
+#include "power_characterization.h"
+#include "power_cmos_tech.h"
+#include "power_components.h"
+#include "power_lowlevel.h"
+#include "PowerSpicedComponent.h"
+
+namespace {
+
+#ifdef VTR_ENABLE_CAPNPROTO
+static constexpr const char kTechFile[] = "../../openfpga_flow/tech/PTM_45nm/45nm.xml";
+static constexpr const char kCharacterizationBin[] = "test_power_characterization.bin";
+static constexpr const char kCorruptCharacterizationBin[] = "test_power_characterization_corrupt.bin";
+
+//Sets up a fresh power context, with nothing loaded or callibrated yet
+static void init_power_ctx(t_power_arch* power_arch) {
+    auto& power_ctx = g_vpr_ctx.mutable_power();
+
+    power_arch->C_wire_local = 0.;
+    power_arch->logical_effort_factor = 4.;
+    power_arch->transistors_per_SRAM_bit = 6.;
+    power_arch->mux_transistor_size = 1.;
+    power_arch->FF_size = 1.;
+    power_arch->LUT_transistor_size = 1.;
+    power_ctx.arch = power_arch;
+
+    power_ctx.commonly_used = new t_power_commonly_used;
+    power_ctx.tech = (t_power_tech*)vtr::calloc(1, sizeof(t_power_tech));
+    power_ctx.output = (t_power_output*)vtr::calloc(1, sizeof(t_power_output));
+    power_ctx.output->num_logs = POWER_LOG_NUM_TYPES;
+    power_ctx.output->logs = (t_log*)vtr::calloc(power_ctx.output->num_logs, sizeof(t_log));
+}
+
+//Samples the scale factors of every callibrated component, including between
+//and beyond the callibrated numbers of inputs and transistor sizes
+static std::vector<float> sample_scale_factors() {
+    auto& power_ctx = g_vpr_ctx.power();
+
+    std::vector<float> scale_factors;
+    for (int i = 0; i < POWER_CALLIB_COMPONENT_MAX; i++) {
+        PowerSpicedComponent* component = power_ctx.commonly_used->component_callibration[i];
+        for (int num_inputs : {1, 2, 4, 6, 9, 20}) {
+            for (float transistor_size : {0.5f, 1.f, 3.f, 10.f, 60.f}) {
+                scale_factors.push_back(component->scale_factor(num_inputs, transistor_size));
+            }
+        }
+    }
+    return scale_factors;
+}
+
+static void check_transistor_size(const t_transistor_size_inf& loaded, const t_transistor_size_inf& expected) {
+    CHECK(loaded.size == expected.size);
+    CHECK(loaded.leakage_subthreshold == expected.leakage_subthreshold);
+    CHECK(loaded.leakage_gate == expected.leakage_gate);
+    CHECK(loaded.C_g == expected.C_g);
+    CHECK(loaded.C_s == expected.C_s);
+    CHECK(loaded.C_d == expected.C_d);
+}
+
+static void check_transistor(const t_transistor_inf& loaded, const t_transistor_inf& expected) {
+    check_transistor_size(*loaded.long_trans_inf, *expected.long_trans_inf);
+    REQUIRE(loaded.num_size_entries == expected.num_size_entries);
+    for (int i = 0; i < expected.num_size_entries; i++) {
+        check_transistor_size(loaded.size_inf[i], expected.size_inf[i]);
+    }
+}
+
+static void check_tech(const t_power_tech& loaded, const t_power_tech& expected) {
+    CHECK(loaded.tech_size == expected.tech_size);
+    CHECK(loaded.temperature == expected.temperature);
+    CHECK(loaded.Vdd == expected.Vdd);
+    CHECK(loaded.PN_ratio == expected.PN_ratio);
+
+    check_transistor(loaded.NMOS_inf, expected.NMOS_inf);
+    check_transistor(loaded.PMOS_inf, expected.PMOS_inf);
+
+    REQUIRE(loaded.num_nmos_mux_info == expected.num_nmos_mux_info);
+    for (int nmos_idx = 0; nmos_idx < expected.num_nmos_mux_info; nmos_idx++) {
+        const t_power_nmos_mux_inf& loaded_mux = loaded.nmos_mux_info[nmos_idx];
+        const t_power_nmos_mux_inf& expected_mux = expected.nmos_mux_info[nmos_idx];
+        CHECK(loaded_mux.nmos_size == expected_mux.nmos_size);
+        REQUIRE(loaded_mux.max_mux_sl_size == expected_mux.max_mux_sl_size);
+        for (int mux_size = 0; mux_size <= expected_mux.max_mux_sl_size; mux_size++) {
+            const t_power_mux_volt_inf& loaded_volt = loaded_mux.mux_voltage_inf[mux_size];
+            const t_power_mux_volt_inf& expected_volt = expected_mux.mux_voltage_inf[mux_size];
+            REQUIRE(loaded_volt.num_voltage_pairs == expected_volt.num_voltage_pairs);
+            for (int i = 0; i < expected_volt.num_voltage_pairs; i++) {
+                CHECK(loaded_volt.mux_voltage_pairs[i].v_in == expected_volt.mux_voltage_pairs[i].v_in);
+                CHECK(loaded_volt.mux_voltage_pairs[i].v_out_min == expected_volt.mux_voltage_pairs[i].v_out_min);
+                CHECK(loaded_volt.mux_voltage_pairs[i].v_out_max == expected_volt.mux_voltage_pairs[i].v_out_max);
+            }
+        }
+    }
+
+    REQUIRE(loaded.num_nmos_leakage_info == expected.num_nmos_leakage_info);
+    for (int nmos_idx = 0; nmos_idx < expected.num_nmos_leakage_info; nmos_idx++) {
+        const t_power_nmos_leakage_inf& loaded_leakage = loaded.nmos_leakage_info[nmos_idx];
+        const t_power_nmos_leakage_inf& expected_leakage = expected.nmos_leakage_info[nmos_idx];
+        CHECK(loaded_leakage.nmos_size == expected_leakage.nmos_size);
+        REQUIRE(loaded_leakage.num_leakage_pairs == expected_leakage.num_leakage_pairs);
+        for (int i = 0; i < expected_leakage.num_leakage_pairs; i++) {
+            CHECK(loaded_leakage.leakage_pairs[i].v_ds == expected_leakage.leakage_pairs[i].v_ds);
+            CHECK(loaded_leakage.leakage_pairs[i].i_ds == expected_leakage.leakage_pairs[i].i_ds);
+        }
+    }
+}
+
+TEST_CASE("round_trip_power_characterization", "[vpr]") {
+    t_arch arch;
+    arch.architecture_id = (char*)"test_arch_id";
+
+    //Characterize from the technology properties file
+    t_power_arch power_arch;
+    init_power_ctx(&power_arch);
+    power_tech_init(kTechFile);
+    power_lowlevel_init();
+    power_components_init();
+    power_callibrate();
+
+    const t_power_tech* callibrated_tech = g_vpr_ctx.power().tech;
+    std::vector<float> callibrated_scale_factors = sample_scale_factors();
+
+    power_write_characterization(kCharacterizationBin, kTechFile, &arch);
+
+    //Load the characterization written
+    t_power_arch loaded_power_arch;
+    init_power_ctx(&loaded_power_arch);
+    REQUIRE(power_read_characterization(kCharacterizationBin, kTechFile, &arch));
+
+    check_tech(*g_vpr_ctx.power().tech, *callibrated_tech);
+
+    std::vector<float> loaded_scale_factors = sample_scale_factors();
+    REQUIRE(loaded_scale_factors.size() == callibrated_scale_factors.size());
+    for (size_t i = 0; i < callibrated_scale_factors.size(); i++) {
+        CHECK(loaded_scale_factors[i] == callibrated_scale_factors[i]);
+    }
+
+    //A characterization for a different architecture is not loaded
+    t_arch other_arch;
+    other_arch.architecture_id = (char*)"other_arch_id";
+    init_power_ctx(&loaded_power_arch);
+    CHECK(!power_read_characterization(kCharacterizationBin, kTechFile, &other_arch));
+
+    //Nor is a missing one
+    CHECK(!power_read_characterization("missing_power_characterization.bin", kTechFile, &arch));
+
+    //A corrupt characterization is an error
+    FILE* f = std::fopen(kCorruptCharacterizationBin, "wb");
+    REQUIRE(f != nullptr);
+    std::fputs("not a power characterization", f);
+    std::fclose(f);
+    CHECK_THROWS_AS(power_read_characterization(kCorruptCharacterizationBin, kTechFile, &arch), const VprError&);
+}
+#endif
+
+} // namespace
@@ -0,0 +1,170 @@
+#include "catch.hpp"
+
+#include <mutex>
+#include <vector>
+
+#include "route_net_partition.h"
+
+namespace {
+
+static t_bb make_bb(int xmin, int xmax, int ymin, int ymax) {
+    t_bb bb;
+    bb.xmin = xmin;
+    bb.xmax = xmax;
+    bb.ymin = ymin;
+    bb.ymax = ymax;
+    return bb;
+}
+
+static std::unique_ptr<t_net_partition> make_partition(const t_bb& region, std::vector<ClusterNetId> nets) {
+    auto partition = std::make_unique<t_net_partition>();
+    partition->region = region;
+    partition->nets = std::move(nets);
+    return partition;
+}
+
+//A routing attempt: the net and the region it was confined to
+struct t_attempt {
+    ClusterNetId net_id;
+    bool confined;
+    t_bb region;
+};
+
+//Fake net router: each net needs to reach the given x coordinate, so fails if
+//it is confined to a region not containing it
+class FakeNetRouter {
+  public:
+    FakeNetRouter(const vtr::vector<ClusterNetId, int>& required_x)
+        : required_x_(required_x) {}
+
+    t_net_router router() {
+        return [this](ClusterNetId net_id, float* /*pin_criticality*/, t_rt_node** /*rt_node_of_sink*/, RouterStats& router_stats, bool& was_rerouted) {
+            const t_bb* region = get_net_routing_region();
+
+            std::lock_guard<std::mutex> lock(mutex_);
+            attempts.push_back({net_id, region != nullptr, region ? *region : t_bb()});
+
+            int x = required_x_[net_id];
+            if (region && (x < region->xmin || x > region->xmax)) {
+                return false;
+            }
+            ++router_stats.nets_routed;
+            was_rerouted = true;
+            return true;
+        };
+    }
+
+    std::vector<t_attempt> attempts;
+
+  private:
+    vtr::vector<ClusterNetId, int> required_x_;
+    std::mutex mutex_;
+};
+
+TEST_CASE("net_partition_stores_nets_in_deepest_cell", "[vpr]") {
+    vtr::vector<ClusterNetId, t_bb> footprints;
+    footprints.push_back(make_bb(0, 1, 0, 1)); //Left
+    footprints.push_back(make_bb(0, 2, 2, 3)); //Left
+    footprints.push_back(make_bb(6, 7, 0, 3)); //Right
+    footprints.push_back(make_bb(2, 6, 1, 2)); //Crosses any vertical cut
+
+    std::vector<ClusterNetId> nets = {ClusterNetId(0), ClusterNetId(1), ClusterNetId(2), ClusterNetId(3)};
+    auto partition = build_net_partition(make_bb(0, 7, 0, 3), nets, footprints, 1);
+
+    REQUIRE(partition->children[0]);
+    REQUIRE(partition->children[1]);
+    CHECK(partition->nets == std::vector<ClusterNetId>({ClusterNetId(3)}));
+    CHECK(partition->children[0]->nets == std::vector<ClusterNetId>({ClusterNetId(0), ClusterNetId(1)}));
+    CHECK(partition->children[1]->nets == std::vector<ClusterNetId>({ClusterNetId(2)}));
+    CHECK(partition->children[0]->region.xmax + 1 == partition->children[1]->region.xmin);
+}
+
+TEST_CASE("net_partition_retries_nets_leaving_their_region", "[vpr]") {
+    //Net 0 lies in the left half but must reach x = 6, in the right half
+    vtr::vector<ClusterNetId, int> required_x;
+    required_x.push_back(6);
+    required_x.push_back(5);
+    FakeNetRouter fake_router(required_x);
+
+    auto root = make_partition(make_bb(0, 7, 0, 7), {});
+    root->children[0] = make_partition(make_bb(0, 3, 0, 7), {ClusterNetId(0)});
+    root->children[1] = make_partition(make_bb(4, 7, 0, 7), {ClusterNetId(1)});
+
+    route_net_partition(*root, /*confine_to_region=*/false, 2, fake_router.router());
+
+    CHECK(root->children[0]->failed_nets == std::vector<ClusterNetId>({ClusterNetId(0)}));
+    CHECK(root->failed_nets.empty());
+
+    //Net 0 was attempted within its region, then unconfined by the root
+    std::vector<t_attempt> net0_attempts;
+    for (const auto& attempt : fake_router.attempts) {
+        if (attempt.net_id == ClusterNetId(0)) net0_attempts.push_back(attempt);
+    }
+    REQUIRE(net0_attempts.size() == 2);
+    CHECK(net0_attempts[0].confined);
+    CHECK(net0_attempts[0].region.xmax == 3);
+    CHECK(!net0_attempts[1].confined);
+
+    RouterStats stats;
+    std::vector<ClusterNetId> rerouted_nets;
+    size_t nets_routed_concurrently = 0;
+    CHECK(collect_net_partition_results(*root, stats, rerouted_nets, nets_routed_concurrently));
+    CHECK(stats.nets_routed == 2);
+    CHECK(nets_routed_concurrently == 1);
+    CHECK(rerouted_nets == std::vector<ClusterNetId>({ClusterNetId(1), ClusterNetId(0)}));
+}
+
+TEST_CASE("net_partition_retries_through_enclosing_regions", "[vpr]") {
+    //Net 0 lies in the leftmost quarter; it fits neither its quarter nor its
+    //half, and net 1 needs its half but not its quarter
+    vtr::vector<ClusterNetId, int> required_x;
+    required_x.push_back(6);
+    required_x.push_back(3);
+    FakeNetRouter fake_router(required_x);
+
+    auto root = make_partition(make_bb(0, 7, 0, 7), {});
+    root->children[0] = make_partition(make_bb(0, 3, 0, 7), {});
+    root->children[1] = make_partition(make_bb(4, 7, 0, 7), {});
+    root->children[0]->children[0] = make_partition(make_bb(0, 1, 0, 7), {ClusterNetId(0), ClusterNetId(1)});
+    root->children[0]->children[1] = make_partition(make_bb(2, 3, 0, 7), {});
+    root->children[1]->children[0] = make_partition(make_bb(4, 5, 0, 7), {});
+    root->children[1]->children[1] = make_partition(make_bb(6, 7, 0, 7), {});
+
+    route_net_partition(*root, /*confine_to_region=*/false, 2, fake_router.router());
+
+    CHECK(root->children[0]->children[0]->failed_nets == std::vector<ClusterNetId>({ClusterNetId(0), ClusterNetId(1)}));
+    CHECK(root->children[0]->failed_nets == std::vector<ClusterNetId>({ClusterNetId(0)}));
+    CHECK(fake_router.attempts.size() == 5);
+
+    RouterStats stats;
+    std::vector<ClusterNetId> rerouted_nets;
+    size_t nets_routed_concurrently = 0;
+    CHECK(collect_net_partition_results(*root, stats, rerouted_nets, nets_routed_concurrently));
+    CHECK(rerouted_nets == std::vector<ClusterNetId>({ClusterNetId(1), ClusterNetId(0)}));
+}
+
+TEST_CASE("net_partition_reports_unroutable_nets", "[vpr]") {
+    //Net 0 can not be routed at all
+    vtr::vector<ClusterNetId, int> required_x;
+    required_x.push_back(2);
+    FakeNetRouter fake_router(required_x);
+    t_net_router route_net = fake_router.router();
+    t_net_router failing_route_net = [&](ClusterNetId net_id, float* pin_criticality, t_rt_node** rt_node_of_sink, RouterStats& router_stats, bool& was_rerouted) {
+        route_net(net_id, pin_criticality, rt_node_of_sink, router_stats, was_rerouted);
+        return false;
+    };
+
+    auto root = make_partition(make_bb(0, 7, 0, 7), {});
+    root->children[0] = make_partition(make_bb(0, 3, 0, 7), {ClusterNetId(0)});
+    root->children[1] = make_partition(make_bb(4, 7, 0, 7), {});
+
+    route_net_partition(*root, /*confine_to_region=*/false, 2, failing_route_net);
+    CHECK(fake_router.attempts.size() == 2);
+
+    RouterStats stats;
+    std::vector<ClusterNetId> rerouted_nets;
+    size_t nets_routed_concurrently = 0;
+    CHECK(!collect_net_partition_results(*root, stats, rerouted_nets, nets_routed_concurrently));
+}
+
+} // namespace
@@ -0,0 +1,126 @@
+#include "catch.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include "vtr_log.h"
+
+#include "router_heap.h"
+
+namespace {
+
+static void push_node(RouterHeap& heap, int inode, float cost) {
+    t_heap* elem = heap.alloc();
+    elem->index = inode;
+    elem->cost = cost;
+    heap.add_to_heap(elem);
+}
+
+TEST_CASE("router_heap_pops_in_cost_order", "[vpr]") {
+    constexpr int kNumElements = 10000;
+
+    for (e_heap_type type : {e_heap_type::BINARY_HEAP, e_heap_type::FOUR_ARY_HEAP}) {
+        RouterHeap heap(type);
+
+        std::mt19937 rng(1);
+        std::uniform_real_distribution<float> cost_dist(0., 1.);
+        std::vector<float> costs;
+        for (int i = 0; i < kNumElements; ++i) {
+            costs.push_back(cost_dist(rng));
+            push_node(heap, i, costs.back());
+        }
+        REQUIRE(heap.is_valid());
+        REQUIRE(heap.size() == kNumElements);
+
+        std::sort(costs.begin(), costs.end());
+        for (float cost : costs) {
+            t_heap* elem = heap.get_heap_head();
+            REQUIRE(elem != nullptr);
+            CHECK(elem->cost == cost);
+            heap.free(elem);
+        }
+        CHECK(heap.is_empty_heap());
+        CHECK(heap.num_allocated() == 0);
+    }
+}
+
+TEST_CASE("router_heap_build_heap", "[vpr]") {
+    for (e_heap_type type : {e_heap_type::BINARY_HEAP, e_heap_type::FOUR_ARY_HEAP}) {
+        RouterHeap heap(type);
+
+        for (int i = 0; i < 1000; ++i) {
+            t_heap* elem = heap.alloc();
+            elem->index = i;
+            elem->cost = (i * 7919) % 1000;
+            heap.push_back(elem);
+        }
+        heap.build_heap();
+        REQUIRE(heap.is_valid());
+
+        float prev_cost = -1.;
+        while (!heap.is_empty_heap()) {
+            t_heap* elem = heap.get_heap_head();
+            CHECK(elem->cost >= prev_cost);
+            prev_cost = elem->cost;
+            heap.free(elem);
+        }
+    }
+}
+
+TEST_CASE("router_heap_skips_invalidated_entries", "[vpr]") {
+    RouterHeap heap;
+
+    t_heap* elem = heap.alloc();
+    elem->index = 1;
+    elem->cost = 1.;
+    elem->u.prev.node = 10;
+    heap.add_to_heap(elem);
+    push_node(heap, 2, 2.);
+
+    heap.invalidate_heap_entries(1, 10);
+
+    t_heap* head = heap.get_heap_head();
+    REQUIRE(head != nullptr);
+    CHECK(head->index == 2);
+    heap.free(head);
+
+    CHECK(heap.is_empty_heap());
+    CHECK(heap.num_allocated() == 0);
+}
+
+//Micro-benchmark of the router heap types (run explicitly with '[benchmark]')
+TEST_CASE("router_heap_benchmark", "[.][benchmark]") {
+    constexpr int kNumOps = 4000000;
+    constexpr int kMaxSize = 50000;
+
+    for (e_heap_type type : {e_heap_type::BINARY_HEAP, e_heap_type::FOUR_ARY_HEAP}) {
+        RouterHeap heap(type);
+
+        //Mimic a wavefront expansion: costs grow as the search proceeds
+        std::mt19937 rng(1);
+        std::uniform_real_distribution<float> cost_dist(0., 1.);
+        float base_cost = 0.;
+
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < kNumOps; ++i) {
+            if (heap.size() < kMaxSize && (heap.is_empty_heap() || cost_dist(rng) < 0.75)) {
+                push_node(heap, i, base_cost + cost_dist(rng));
+            } else {
+                t_heap* elem = heap.get_heap_head();
+                base_cost = elem->cost;
+                heap.free(elem);
+            }
+        }
+        heap.empty_heap();
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+        VTR_LOG("%s heap: %zu pushes in %.3f sec, heap pushes per second: %.3g\n",
+                (type == e_heap_type::BINARY_HEAP) ? "binary" : "four_ary",
+                heap.num_pushes(), elapsed.count(), heap.num_pushes() / elapsed.count());
+        CHECK(heap.num_allocated() == 0);
+    }
+}
+
+} // namespace
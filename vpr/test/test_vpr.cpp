@@ -14,6 +14,8 @@ using Catch::Matchers::Equals;
 
 static constexpr const char kArchFile[] = "test_read_arch_metadata.xml";
 static constexpr const char kRrGraphFile[] = "test_read_rrgraph_metadata.xml";
+static constexpr const char kRrGraphBinFile[] = "test_read_rrgraph.bin";
+static constexpr const char kNetBinFile[] = "test_read_netlist.bin";
 
 TEST_CASE("read_arch_metadata", "[vpr]") {
     t_arch arch;
@@ -191,4 +193,309 @@ TEST_CASE("read_rr_graph_metadata", "[vpr]") {
     vpr_free_all(arch, vpr_setup);
 }
 
+#ifdef VTR_ENABLE_CAPNPROTO
+//Summary of an rr node used to compare rr graphs (t_rr_node is not copyable)
+struct t_node_summary {
+    t_rr_type type;
+    std::vector<short> loc; //xlow, ylow, xhigh, yhigh, ptc, capacity, cost_index
+    float R;
+    float C;
+    std::vector<std::pair<int, short>> edges; //sink node, switch
+
+    explicit t_node_summary(const t_rr_node& node)
+        : type(node.type())
+        , loc({node.xlow(), node.ylow(), node.xhigh(), node.yhigh(), node.ptc_num(), node.capacity(), node.cost_index()})
+        , R(node.R())
+        , C(node.C()) {
+        for (t_edge_size iedge = 0; iedge < node.num_edges(); ++iedge) {
+            edges.emplace_back(node.edge_sink_node(iedge), node.edge_switch(iedge));
+        }
+    }
+};
+
+TEST_CASE("read_rr_graph_binary", "[vpr]") {
+    std::vector<t_node_summary> rr_nodes;
+    std::vector<t_rr_switch_inf> rr_switch_inf;
+    t_rr_node_indices rr_node_indices;
+    int src_inode = -1;
+
+    {
+        t_vpr_setup vpr_setup;
+        t_arch arch;
+        t_options options;
+        const char* argv[] = {
+            "test_vpr",
+            kArchFile,
+            "wire.eblif",
+            "--route_chan_width",
+            "100",
+        };
+        vpr_init(sizeof(argv) / sizeof(argv[0]), argv,
+                 &options, &vpr_setup, &arch);
+        vpr_create_device(vpr_setup, arch);
+
+        const auto& device_ctx = g_vpr_ctx.device();
+        for (const auto& node : device_ctx.rr_nodes) {
+            rr_nodes.emplace_back(node);
+        }
+        rr_switch_inf = device_ctx.rr_switch_inf;
+        rr_node_indices = device_ctx.rr_node_indices;
+
+        for (int inode = 0; inode < (int)device_ctx.rr_nodes.size(); ++inode) {
+            if (device_ctx.rr_nodes[inode].num_edges() > 0) {
+                src_inode = inode;
+                break;
+            }
+        }
+        REQUIRE(src_inode != -1);
+        vpr::add_rr_node_metadata(src_inode, "node", "test node");
+
+        write_rr_graph(kRrGraphBinFile, vpr_setup.Segments);
+        vpr_free_all(arch, vpr_setup);
+    }
+
+    t_vpr_setup vpr_setup;
+    t_arch arch;
+    t_options options;
+    const char* argv[] = {
+        "test_vpr",
+        kArchFile,
+        "wire.eblif",
+        "--route_chan_width",
+        "100",
+        "--read_rr_graph",
+        kRrGraphBinFile,
+    };
+
+    vpr_init(sizeof(argv) / sizeof(argv[0]), argv,
+             &options, &vpr_setup, &arch);
+    vpr_create_device(vpr_setup, arch);
+
+    const auto& device_ctx = g_vpr_ctx.device();
+    REQUIRE(device_ctx.rr_nodes.size() == rr_nodes.size());
+    for (size_t inode = 0; inode < rr_nodes.size(); ++inode) {
+        t_node_summary node(device_ctx.rr_nodes[inode]);
+        const auto& expected = rr_nodes[inode];
+        CHECK(node.type == expected.type);
+        CHECK(node.loc == expected.loc);
+        CHECK(node.R == expected.R);
+        CHECK(node.C == expected.C);
+        CHECK(node.edges == expected.edges);
+    }
+
+    REQUIRE(device_ctx.rr_switch_inf.size() == rr_switch_inf.size());
+    for (size_t iswitch = 0; iswitch < rr_switch_inf.size(); ++iswitch) {
+        CHECK(device_ctx.rr_switch_inf[iswitch].type() == rr_switch_inf[iswitch].type());
+        CHECK(device_ctx.rr_switch_inf[iswitch].Tdel == rr_switch_inf[iswitch].Tdel);
+    }
+
+    CHECK(device_ctx.rr_node_indices == rr_node_indices);
+
+    REQUIRE(device_ctx.rr_node_metadata.size() == 1);
+    auto* value = device_ctx.rr_node_metadata.at(src_inode).one("node");
+    REQUIRE(value != nullptr);
+    CHECK_THAT(value->as_string(), Equals("test node"));
+
+    vpr_free_all(arch, vpr_setup);
+}
+#endif
+
+//Places wire.eblif with --parallel_placement and returns the block locations
+static std::vector<t_pl_loc> parallel_place(const char* num_workers) {
+    t_vpr_setup vpr_setup;
+    t_arch arch;
+    t_options options;
+    const char* argv[] = {
+        "test_vpr",
+        kArchFile,
+        "wire.eblif",
+        "--route_chan_width",
+        "100",
+        "--pack",
+        "--place",
+        "--parallel_placement",
+        "on",
+        "--seed",
+        "3",
+        "--num_workers",
+        num_workers,
+    };
+    vpr_init(sizeof(argv) / sizeof(argv[0]), argv,
+             &options, &vpr_setup, &arch);
+    REQUIRE(vpr_flow(vpr_setup, arch));
+
+    std::vector<t_pl_loc> locs;
+    for (const auto& block_loc : g_vpr_ctx.placement().block_locs) {
+        locs.push_back(block_loc.loc);
+    }
+
+    vpr_free_all(arch, vpr_setup);
+    return locs;
+}
+
+TEST_CASE("parallel_placement_is_deterministic", "[vpr]") {
+    std::vector<t_pl_loc> one_worker = parallel_place("1");
+    std::vector<t_pl_loc> four_workers = parallel_place("4");
+
+    REQUIRE(!one_worker.empty());
+    CHECK(one_worker == four_workers);
+}
+
+//Packs wire.eblif and returns the name of the cluster holding each atom
+static std::vector<std::string> packed_atom_clusters(const char* parallel_packing) {
+    t_vpr_setup vpr_setup;
+    t_arch arch;
+    t_options options;
+    const char* argv[] = {
+        "test_vpr",
+        kArchFile,
+        "wire.eblif",
+        "--pack",
+        "--parallel_packing",
+        parallel_packing,
+    };
+    vpr_init(sizeof(argv) / sizeof(argv[0]), argv,
+             &options, &vpr_setup, &arch);
+    REQUIRE(vpr_flow(vpr_setup, arch));
+
+    auto& atom_ctx = g_vpr_ctx.atom();
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+    std::vector<std::string> atom_clusters;
+    for (AtomBlockId blk : atom_ctx.nlist.blocks()) {
+        atom_clusters.push_back(cluster_ctx.clb_nlist.block_name(atom_ctx.lookup.atom_clb(blk)));
+    }
+
+    vpr_free_all(arch, vpr_setup);
+    return atom_clusters;
+}
+
+TEST_CASE("parallel_packing_matches_serial", "[vpr]") {
+    std::vector<std::string> serial = packed_atom_clusters("off");
+    std::vector<std::string> parallel = packed_atom_clusters("on");
+
+    REQUIRE(!serial.empty());
+    CHECK(serial == parallel);
+}
+
+#ifdef VTR_ENABLE_CAPNPROTO
+//Summary of a cluster used to compare clustered netlists (pbs hold pointers
+//into the architecture, which is reloaded between the netlists)
+struct t_cluster_summary {
+    std::string name;
+    std::string type;
+    std::vector<std::string> pbs;      //Pre-order pb tree: name and mode of each pb
+    std::vector<std::string> pin_nets; //Net on each logical pin of the cluster
+    std::vector<std::string> routes;   //Intra-cluster routing of each pb pin
+
+    explicit t_cluster_summary(ClusterBlockId blk) {
+        const auto& clb_nlist = g_vpr_ctx.clustering().clb_nlist;
+        const auto& atom_nlist = g_vpr_ctx.atom().nlist;
+        const t_pb* pb = clb_nlist.block_pb(blk);
+
+        name = clb_nlist.block_name(blk);
+        type = clb_nlist.block_type(blk)->name;
+        add_pbs(pb);
+
+        for (int ipin = 0; ipin < clb_nlist.block_type(blk)->pb_type->num_pins; ++ipin) {
+            ClusterNetId net = clb_nlist.block_net(blk, ipin);
+            pin_nets.push_back(net ? clb_nlist.net_name(net) : "");
+        }
+
+        for (const auto& route : pb->pb_route) {
+            std::string route_str = std::to_string(route.first) + " ";
+            route_str += route.second.atom_net_id ? atom_nlist.net_name(route.second.atom_net_id) : "-";
+            route_str += " " + std::to_string(route.second.driver_pb_pin_id);
+            for (int sink : route.second.sink_pb_pin_ids) {
+                route_str += " " + std::to_string(sink);
+            }
+            if (route.second.pb_graph_pin) {
+                route_str += " @" + std::to_string(route.second.pb_graph_pin->pin_count_in_cluster);
+            }
+            routes.push_back(route_str);
+        }
+    }
+
+    void add_pbs(const t_pb* pb) {
+        pbs.push_back(std::string(pb->name ? pb->name : "-") + " " + std::to_string(pb->mode));
+        if (pb->is_primitive()) return;
+        for (int itype = 0; itype < pb->get_num_child_types(); ++itype) {
+            for (int ichild = 0; ichild < pb->get_num_children_of_type(itype); ++ichild) {
+                add_pbs(&pb->child_pbs[itype][ichild]);
+            }
+        }
+    }
+};
+
+//Summarizes the loaded clustered netlist, and the cluster holding each atom
+static std::vector<t_cluster_summary> summarize_clusters(std::vector<std::string>* atom_clusters) {
+    const auto& clb_nlist = g_vpr_ctx.clustering().clb_nlist;
+    const auto& atom_ctx = g_vpr_ctx.atom();
+
+    std::vector<t_cluster_summary> clusters;
+    for (ClusterBlockId blk : clb_nlist.blocks()) {
+        clusters.emplace_back(blk);
+    }
+    for (AtomBlockId blk : atom_ctx.nlist.blocks()) {
+        atom_clusters->push_back(clb_nlist.block_name(atom_ctx.lookup.atom_clb(blk)));
+    }
+    return clusters;
+}
+
+TEST_CASE("read_netlist_binary", "[vpr]") {
+    std::vector<t_cluster_summary> xml_clusters;
+    std::vector<std::string> xml_atom_clusters;
+
+    {
+        //Packs and loads the .net file, writing it out in the binary format
+        t_vpr_setup vpr_setup;
+        t_arch arch;
+        t_options options;
+        const char* argv[] = {
+            "test_vpr",
+            kArchFile,
+            "wire.eblif",
+            "--pack",
+            "--write_binary_net_file",
+            kNetBinFile,
+        };
+        vpr_init(sizeof(argv) / sizeof(argv[0]), argv,
+                 &options, &vpr_setup, &arch);
+        REQUIRE(vpr_flow(vpr_setup, arch));
+
+        xml_clusters = summarize_clusters(&xml_atom_clusters);
+        vpr_free_all(arch, vpr_setup);
+    }
+
+    t_vpr_setup vpr_setup;
+    t_arch arch;
+    t_options options;
+    const char* argv[] = {
+        "test_vpr",
+        kArchFile,
+        "wire.eblif",
+        "--net_file",
+        kNetBinFile,
+    };
+    vpr_init(sizeof(argv) / sizeof(argv[0]), argv,
+             &options, &vpr_setup, &arch);
+    vpr_load_packing(vpr_setup, arch);
+
+    std::vector<std::string> bin_atom_clusters;
+    std::vector<t_cluster_summary> bin_clusters = summarize_clusters(&bin_atom_clusters);
+
+    REQUIRE(!xml_clusters.empty());
+    REQUIRE(bin_clusters.size() == xml_clusters.size());
+    for (size_t i = 0; i < xml_clusters.size(); ++i) {
+        CHECK(bin_clusters[i].name == xml_clusters[i].name);
+        CHECK(bin_clusters[i].type == xml_clusters[i].type);
+        CHECK(bin_clusters[i].pbs == xml_clusters[i].pbs);
+        CHECK(bin_clusters[i].pin_nets == xml_clusters[i].pin_nets);
+        CHECK(bin_clusters[i].routes == xml_clusters[i].routes);
+    }
+    CHECK(bin_atom_clusters == xml_atom_clusters);
+
+    vpr_free_all(arch, vpr_setup);
+}
+#endif
+
 } // namespace
@@ -226,6 +226,7 @@ typedef struct s_timing_inf {
     float T_opin_cblock;
     /* end */
 	char * SDCFile; /* only here for convenience of passing to path_delay.c */
+	int num_workers; /* number of threads used by the level-parallel timing analysis in path_delay.c */
 } t_timing_inf;
 
 struct s_pb_type;
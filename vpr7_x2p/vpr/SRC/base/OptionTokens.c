@@ -14,6 +14,7 @@ struct s_TokenPair OptionBaseTokenList[] = {
 				OT_GENERATE_POST_SYNTHESIS_NETLIST }, { "timing_analysis",
 				OT_TIMING_ANALYSIS }, { "timing_analyze_only_with_net_delay",
 				OT_TIMING_ANALYZE_ONLY_WITH_NET_DELAY },
+		{ "timing_num_workers", OT_TIMING_NUM_WORKERS },
 		{ "init_t", OT_INIT_T }, { "alpha_t", OT_ALPHA_T }, { "exit_t",
 				OT_EXIT_T }, { "inner_num", OT_INNER_NUM }, { "seed", OT_SEED },
 		{ "place_cost_exp", OT_PLACE_COST_EXP }, { "td_place_exp_first",
@@ -66,6 +67,8 @@ struct s_TokenPair OptionBaseTokenList[] = {
         { "fpga_x2p_compact_routing_hierarchy", OT_FPGA_X2P_COMPACT_ROUTING_HIERARCHY }, /* use a compact routing hierarchy in SPICE/Verilog generation */
         { "fpga_x2p_output_sb_xml", OT_FPGA_X2P_OUTPUT_SB_XML }, /* use a compact routing hierarchy in SPICE/Verilog generation */
         { "fpga_x2p_duplicate_grid_pin", OT_FPGA_X2P_DUPLICATE_GRID_PIN }, /* Duplicate the pins at each side of a grid when generating SPICE and Verilog netlists */
+        { "fpga_x2p_num_config_chains", OT_FPGA_X2P_NUM_CONFIG_CHAINS }, /* Number of parallel configuration chains in the top-level module */
+        { "fpga_x2p_config_chain_order", OT_FPGA_X2P_CONFIG_CHAIN_ORDER }, /* The order to chain configurable blocks in the top-level module */
         /* Xifan TANG: FPGA SPICE Support */
         { "fpga_spice", OT_FPGA_SPICE },/* Xifan TANG: SPICE Model Support, turn on the functionality*/
         { "fpga_spice_dir", OT_FPGA_SPICE_DIR },/* Xifan TANG: SPICE Model Support, directory of spice netlists*/
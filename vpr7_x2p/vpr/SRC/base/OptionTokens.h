@@ -16,6 +16,7 @@ enum e_OptionBaseToken {
 	OT_CREATE_ECHO_FILE,
 	OT_TIMING_ANALYSIS,
 	OT_TIMING_ANALYZE_ONLY_WITH_NET_DELAY,
+	OT_TIMING_NUM_WORKERS,
 	OT_GENERATE_POST_SYNTHESIS_NETLIST,
 	OT_INIT_T,
 	OT_ALPHA_T,
@@ -83,6 +84,8 @@ enum e_OptionBaseToken {
     OT_FPGA_X2P_COMPACT_ROUTING_HIERARCHY, /* use a compact routing hierarchy in SPICE/Verilog generation */
     OT_FPGA_X2P_OUTPUT_SB_XML, /* output switch blocks to XML files */
     OT_FPGA_X2P_DUPLICATE_GRID_PIN, /* Duplicate the pins at each side of a grid when generating SPICE and Verilog netlists */
+    OT_FPGA_X2P_NUM_CONFIG_CHAINS, /* Number of parallel configuration chains in the top-level module */
+    OT_FPGA_X2P_CONFIG_CHAIN_ORDER, /* The order to chain configurable blocks in the top-level module */
     /* Xifan TANG: FPGA SPICE Support */
     OT_FPGA_SPICE, /* Xifan TANG: FPGA SPICE Model Support */
     OT_FPGA_SPICE_DIR, /* Xifan TANG: FPGA SPICE Model Support */
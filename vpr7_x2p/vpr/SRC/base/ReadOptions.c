@@ -353,6 +353,8 @@ ProcessOption(INP char **Args, INOUTP t_options * Options) {
 		return Args;
 	case OT_TIMING_ANALYSIS:
 		return ReadOnOff(Args, &Options->TimingAnalysis);
+	case OT_TIMING_NUM_WORKERS:
+		return ReadInt(Args, &Options->timing_num_workers);
 	case OT_OUTFILE_PREFIX:
 		return ReadString(Args, &Options->out_file_prefix);
 	case OT_CREATE_ECHO_FILE:
@@ -493,6 +495,10 @@ ProcessOption(INP char **Args, INOUTP t_options * Options) {
       return ReadString(Args, &Options->sb_xml_dir);
     case OT_FPGA_X2P_DUPLICATE_GRID_PIN:
       return Args;
+    case OT_FPGA_X2P_NUM_CONFIG_CHAINS:
+      return ReadInt(Args, &Options->fpga_x2p_num_config_chains);
+    case OT_FPGA_X2P_CONFIG_CHAIN_ORDER:
+      return ReadString(Args, &Options->fpga_x2p_config_chain_order);
     /* Xifan TANG: FPGA SPICE Model Options*/
     case OT_FPGA_SPICE:
       return Args;
@@ -645,6 +651,9 @@ static void MergeOptions(INOUTP t_options * dest, INP t_options * src, int id)
 		case OT_TIMING_ANALYSIS:
 			dest->TimingAnalysis = src->TimingAnalysis;
 			break;
+		case OT_TIMING_NUM_WORKERS:
+			dest->timing_num_workers = src->timing_num_workers;
+			break;
 		case OT_OUTFILE_PREFIX:
 			dest->out_file_prefix = src->out_file_prefix;
 			break;
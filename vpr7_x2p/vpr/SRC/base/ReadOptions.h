@@ -23,6 +23,7 @@ struct s_options {
 	int GraphPause;
 	float constant_net_delay;
 	boolean TimingAnalysis;
+	int timing_num_workers;
 	boolean CreateEchoFile;
     boolean Generate_Post_Synthesis_Netlist;
 	/* Clustering options */
@@ -95,6 +96,8 @@ struct s_options {
     float fpga_spice_signal_density_weight;
     float fpga_spice_sim_window_size;
     char* sb_xml_dir;
+    int fpga_x2p_num_config_chains;
+    char* fpga_x2p_config_chain_order;
 
     /* Xifan TANG: SPICE Support*/
     char* spice_dir;
@@ -359,6 +359,17 @@ static void SetupTiming(INP t_options Options, INP t_arch Arch,
 	} else {
 		Timing->SDCFile = (char*) my_strdup(Options.SDCFile);
 	}
+
+	/* Serial timing analysis unless the user asks for more threads */
+	Timing->num_workers = 1;
+	if (Options.Count[OT_TIMING_NUM_WORKERS]) {
+		if (Options.timing_num_workers < 1) {
+			vpr_printf(TIO_MESSAGE_ERROR, "--timing_num_workers must be at least 1 (got %d).\n",
+					Options.timing_num_workers);
+			exit(1);
+		}
+		Timing->num_workers = Options.timing_num_workers;
+	}
 }
 
 /* This loads up VPR's switch_inf data by combining the switches from 
@@ -1281,6 +1292,33 @@ static void SetupFpgaSpiceOpts(t_options Options,
     fpga_spice_opts->duplicate_grid_pin = TRUE;
   }
 
+  /* Find the number of configuration chains in the top-level module */
+  fpga_spice_opts->num_config_chains = 1;
+  if (Options.Count[OT_FPGA_X2P_NUM_CONFIG_CHAINS]) { 
+    fpga_spice_opts->num_config_chains = Options.fpga_x2p_num_config_chains;
+    if (1 > fpga_spice_opts->num_config_chains) {
+      vpr_printf(TIO_MESSAGE_ERROR, 
+                 "Invalid number of configuration chains (%d)! Expect a positive integer.\n",
+                 fpga_spice_opts->num_config_chains);
+      exit(1);
+    }
+  }
+
+  /* Find the order to chain configurable blocks in the top-level module */
+  fpga_spice_opts->config_chain_order = CONFIG_CHAIN_ORDER_SERPENTINE;
+  if (Options.Count[OT_FPGA_X2P_CONFIG_CHAIN_ORDER]) { 
+    if (0 == strcmp("serpentine", Options.fpga_x2p_config_chain_order)) {
+      fpga_spice_opts->config_chain_order = CONFIG_CHAIN_ORDER_SERPENTINE;
+    } else if (0 == strcmp("wirelength", Options.fpga_x2p_config_chain_order)) {
+      fpga_spice_opts->config_chain_order = CONFIG_CHAIN_ORDER_WIRELENGTH;
+    } else {
+      vpr_printf(TIO_MESSAGE_ERROR, 
+                 "Invalid configuration chain order (%s)! Expect serpentine|wirelength.\n",
+                 Options.fpga_x2p_config_chain_order);
+      exit(1);
+    }
+  }
+
   /* Decide if we need to do FPGA-SPICE */
   fpga_spice_opts->do_fpga_spice = FALSE;
   if (( TRUE == fpga_spice_opts->SpiceOpts.do_spice)
@@ -97,6 +97,8 @@ void vpr_print_usage(void) {
       "\t[--place] [--route] [--timing_analyze_only_with_net_delay <float>]\n");
   vpr_printf(TIO_MESSAGE_INFO,
       "\t[--fast] [--full_stats] [--timing_analysis on | off] [--outfile_prefix <string>]\n");
+  vpr_printf(TIO_MESSAGE_INFO,
+      "\t[--timing_num_workers <int>]\n");
   vpr_printf(TIO_MESSAGE_INFO,
       "\t[--blif_file <string>][--net_file <string>][--place_file <string>]\n");
   vpr_printf(TIO_MESSAGE_INFO,
@@ -176,6 +178,8 @@ void vpr_print_usage(void) {
   vpr_printf(TIO_MESSAGE_INFO, "\t--fpga_x2p_compact_routing_hierarchy\n");
   vpr_printf(TIO_MESSAGE_INFO, "\t--fpga_x2p_output_sb_xml <directory_path_output_switch_block_XML>\n");
   vpr_printf(TIO_MESSAGE_INFO, "\t--fpga_x2p_duplicate_grid_pin\n");
+  vpr_printf(TIO_MESSAGE_INFO, "\t--fpga_x2p_num_config_chains <int>\n");
+  vpr_printf(TIO_MESSAGE_INFO, "\t--fpga_x2p_config_chain_order <serpentine|wirelength>\n");
   vpr_printf(TIO_MESSAGE_INFO, "SPICE Support Options:\n");
   vpr_printf(TIO_MESSAGE_INFO, "\t--fpga_spice\n");
   vpr_printf(TIO_MESSAGE_INFO, "\t--fpga_spice_dir <directory_path_output_spice_netlists>\n");
@@ -1292,6 +1292,13 @@ struct s_bitstream_gen_opts {
   char* bitstream_output_file;
 };
 
+/* The order to chain configurable blocks in the top-level module */
+enum e_config_chain_order {
+  CONFIG_CHAIN_ORDER_SERPENTINE, /* Tiles are chained row by row in a snake-like way */
+  CONFIG_CHAIN_ORDER_WIRELENGTH, /* Tiles are chained to minimize the wirelength between neighbouring tiles */
+  NUM_CONFIG_CHAIN_ORDERS
+};
+
 typedef struct s_fpga_spice_opts t_fpga_spice_opts;
 struct s_fpga_spice_opts {
   boolean do_fpga_spice;
@@ -1304,6 +1311,10 @@ struct s_fpga_spice_opts {
   boolean compact_routing_hierarchy; /* use compact routing hierarchy */
   boolean duplicate_grid_pin; /* Duplicate pins at each side of the grid */
 
+  /* Configuration chains in the top-level module */
+  int num_config_chains; /* Number of parallel configuration chains */
+  enum e_config_chain_order config_chain_order; /* The order to chain configurable blocks */
+
   /* Signal Density */
   float signal_density_weight;
   float sim_window_size;
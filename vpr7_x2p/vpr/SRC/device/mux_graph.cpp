@@ -3,7 +3,6 @@
  * data structures in mux_graph.h
  *************************************************/
 #include <cmath>
-#include <list>
 #include <map>
 #include <algorithm>
 
@@ -44,27 +43,14 @@ MuxGraph::node_range MuxGraph::nodes() const {
   return vtr::make_range(node_ids_.begin(), node_ids_.end());
 }
 
-/* Find the non-input nodes */
-std::vector<MuxNodeId> MuxGraph::non_input_nodes() const {
+/* Find the non-input nodes 
+ * The node list is sorted level by level, 
+ * and it is cached when building the node lookup
+ */
+MuxGraph::node_list_range MuxGraph::non_input_nodes() const {
   /* Must be an valid graph */
   VTR_ASSERT_SAFE(valid_mux_graph());
-  std::vector<MuxNodeId> node_list;
-  
-  /* Build the node list, level by level */
-  for (size_t level = 0; level < num_node_levels(); ++level) {
-    for (size_t node_type = 0; node_type < size_t(NUM_MUX_NODE_TYPES); ++node_type) {
-      /* Bypass any nodes which are not OUTPUT and INTERNAL */
-      if (size_t(MUX_INPUT_NODE) == node_type) { 
-        continue;
-      }
-      /* Reach here, this is either an OUTPUT or INTERNAL node */ 
-      for (auto node : node_lookup_[level][node_type]) { 
-        node_list.push_back(node); 
-      }
-    }
-  }
-
-  return node_list;
+  return vtr::make_range(non_input_nodes_.begin(), non_input_nodes_.end());
 }
 
 MuxGraph::edge_range MuxGraph::edges() const {
@@ -99,48 +85,28 @@ std::vector<size_t> MuxGraph::node_levels() const {
 size_t MuxGraph::num_inputs() const {
   /* need to check if the graph is valid or not */
   VTR_ASSERT_SAFE(valid_mux_graph());
-  /* Sum up the number of INPUT nodes in each level */
-  size_t num_inputs = 0;
-  for (auto node_per_level : node_lookup_) {
-    num_inputs += node_per_level[MUX_INPUT_NODE].size();
-  }
-  return num_inputs;
+  return input_nodes_.size();
 }
 
 /* Return the node ids of all the inputs of the multiplexer */
-std::vector<MuxNodeId> MuxGraph::inputs() const {
-  std::vector<MuxNodeId> input_nodes; 
+MuxGraph::node_list_range MuxGraph::inputs() const {
   /* need to check if the graph is valid or not */
   VTR_ASSERT_SAFE(valid_mux_graph());
-  /* Add the input nodes in each level */
-  for (auto node_per_level : node_lookup_) {
-    input_nodes.insert(input_nodes.end(), node_per_level[MUX_INPUT_NODE].begin(), node_per_level[MUX_INPUT_NODE].end());
-  }
-  return input_nodes;
+  return vtr::make_range(input_nodes_.begin(), input_nodes_.end());
 }
 
 /* Find the number of outputs in the MUX graph */
 size_t MuxGraph::num_outputs() const {
   /* need to check if the graph is valid or not */
   VTR_ASSERT_SAFE(valid_mux_graph());
-  /* Sum up the number of INPUT nodes in each level */
-  size_t num_outputs = 0;
-  for (auto node_per_level : node_lookup_) {
-    num_outputs += node_per_level[MUX_OUTPUT_NODE].size();
-  }
-  return num_outputs;
+  return output_nodes_.size();
 }
 
 /* Return the node ids of all the outputs of the multiplexer */
-std::vector<MuxNodeId> MuxGraph::outputs() const {
-  std::vector<MuxNodeId> output_nodes; 
+MuxGraph::node_list_range MuxGraph::outputs() const {
   /* need to check if the graph is valid or not */
   VTR_ASSERT_SAFE(valid_mux_graph());
-  /* Add the output nodes in each level */
-  for (auto node_per_level : node_lookup_) {
-    output_nodes.insert(output_nodes.end(), node_per_level[MUX_OUTPUT_NODE].begin(), node_per_level[MUX_OUTPUT_NODE].end());
-  }
-  return output_nodes;
+  return vtr::make_range(output_nodes_.begin(), output_nodes_.end());
 }
 
 /* Find the edge between two MUX nodes */
@@ -150,8 +116,8 @@ std::vector<MuxEdgeId> MuxGraph::find_edges(const MuxNodeId& from_node, const Mu
   VTR_ASSERT(valid_node_id(from_node));
   VTR_ASSERT(valid_node_id(to_node));
 
-  for (const auto& edge : node_out_edges_[from_node]) {
-    for (const auto& cand : edge_sink_nodes_[edge]) {
+  for (const auto& edge : node_out_edges(from_node)) {
+    for (const auto& cand : edge_sink_nodes(edge)) {
       if (cand == to_node) {
         /* This is the wanted edge, add to list */
         edges.push_back(edge);
@@ -162,19 +128,48 @@ std::vector<MuxEdgeId> MuxGraph::find_edges(const MuxNodeId& from_node, const Mu
   return edges;
 }
 
+/* Find the unique edge between two MUX nodes
+ * Unlike find_edges(), this does not allocate any memory,
+ * which is preferred when there is at most one edge between the nodes
+ */
+MuxEdgeId MuxGraph::find_edge(const MuxNodeId& from_node, const MuxNodeId& to_node) const {
+  MuxEdgeId ret_edge = MuxEdgeId::INVALID();
+  size_t edge_cnt = 0;
+
+  VTR_ASSERT(valid_node_id(from_node));
+  VTR_ASSERT(valid_node_id(to_node));
+
+  for (const auto& edge : node_out_edges(from_node)) {
+    for (const auto& cand : edge_sink_nodes(edge)) {
+      if (cand == to_node) {
+        ret_edge = edge;
+        edge_cnt++;
+      }
+    }
+  }
+
+  /* We should either find an edge or nothing */
+  VTR_ASSERT((0 == edge_cnt) || (1 == edge_cnt));
+
+  return ret_edge;
+}
+
 /* Find the number of levels in the MUX graph */
 size_t MuxGraph::num_levels() const {
   /* need to check if the graph is valid or not */
   VTR_ASSERT_SAFE(valid_mux_graph());
   /* The num_levels by definition excludes the level for outputs, so a deduection is applied */
-  return node_lookup_.size() - 1; 
+  return num_node_levels() - 1; 
 }
 
 /* Find the actual number of levels in the MUX graph */
 size_t MuxGraph::num_node_levels() const {
   /* need to check if the graph is valid or not */
   VTR_ASSERT_SAFE(valid_mux_graph());
-  return node_lookup_.size(); 
+  if (true == node_lookup_offsets_.empty()) {
+    return 0;
+  }
+  return (node_lookup_offsets_.size() - 1) / size_t(NUM_MUX_NODE_TYPES); 
 }
 
 /* Find the number of configuration memories in the MUX graph */
@@ -189,15 +184,16 @@ size_t MuxGraph::num_memory_bits_at_level(const size_t& level) const {
   /* need to check if the graph is valid or not */
   VTR_ASSERT_SAFE(valid_level(level));
   VTR_ASSERT_SAFE(valid_mux_graph());
-  return mem_lookup_[level].size(); 
+  return mem_lookup_offsets_[level + 1] - mem_lookup_offsets_[level]; 
 }
 
 /* Return memory id at level */
-std::vector<MuxMemId> MuxGraph::memories_at_level(const size_t& level) const {
+MuxGraph::mem_list_range MuxGraph::memories_at_level(const size_t& level) const {
   /* need to check if the graph is valid or not */
   VTR_ASSERT_SAFE(valid_level(level));
   VTR_ASSERT_SAFE(valid_mux_graph());
-  return mem_lookup_[level]; 
+  return vtr::make_range(mem_lookup_.begin() + mem_lookup_offsets_[level], 
+                         mem_lookup_.begin() + mem_lookup_offsets_[level + 1]); 
 }
 
 /* Find the number of nodes at a given level in the MUX graph */
@@ -206,11 +202,9 @@ size_t MuxGraph::num_nodes_at_level(const size_t& level) const {
   VTR_ASSERT_SAFE(valid_level(level));
   VTR_ASSERT_SAFE(valid_mux_graph());
   
-  size_t num_nodes = 0;
-  for (size_t node_type = 0; node_type < size_t(NUM_MUX_NODE_TYPES); ++node_type) {
-    num_nodes += node_lookup_[level][node_type].size(); 
-  }
-  return num_nodes; 
+  /* Nodes of all the types at a level are stored contiguously in the lookup */
+  return node_lookup_offsets_[(level + 1) * size_t(NUM_MUX_NODE_TYPES)]
+       - node_lookup_offsets_[level * size_t(NUM_MUX_NODE_TYPES)]; 
 }
 
 /* Find the level of a node */
@@ -228,17 +222,37 @@ size_t MuxGraph::node_index_at_level(const MuxNodeId& node) const {
 }
 
 /* Find the  input edges for a node */
-std::vector<MuxEdgeId> MuxGraph::node_in_edges(const MuxNodeId& node) const {
+MuxGraph::edge_list_range MuxGraph::node_in_edges(const MuxNodeId& node) const {
+  /* validate the node */
+  VTR_ASSERT(valid_node_id(node));
+  VTR_ASSERT_SAFE(valid_edge_csr());
+  return vtr::make_range(node_in_edge_list_.begin() + node_in_edge_offsets_[size_t(node)],
+                         node_in_edge_list_.begin() + node_in_edge_offsets_[size_t(node) + 1]);
+}
+
+/* Find the output edges for a node */
+MuxGraph::edge_list_range MuxGraph::node_out_edges(const MuxNodeId& node) const {
   /* validate the node */
   VTR_ASSERT(valid_node_id(node));
-  return node_in_edges_[node];
+  VTR_ASSERT_SAFE(valid_edge_csr());
+  return vtr::make_range(node_out_edge_list_.begin() + node_out_edge_offsets_[size_t(node)],
+                         node_out_edge_list_.begin() + node_out_edge_offsets_[size_t(node) + 1]);
 }
 
 /* Find the input nodes for a edge */
-std::vector<MuxNodeId> MuxGraph::edge_src_nodes(const MuxEdgeId& edge) const {
+MuxGraph::node_list_range MuxGraph::edge_src_nodes(const MuxEdgeId& edge) const {
   /* validate the edge */
   VTR_ASSERT(valid_edge_id(edge));
-  return edge_src_nodes_[edge];
+  return vtr::make_range(edge_src_nodes_.begin() + size_t(edge),
+                         edge_src_nodes_.begin() + size_t(edge) + 1);
+}
+
+/* Find the output nodes for a edge */
+MuxGraph::node_list_range MuxGraph::edge_sink_nodes(const MuxEdgeId& edge) const {
+  /* validate the edge */
+  VTR_ASSERT(valid_edge_id(edge));
+  return vtr::make_range(edge_sink_nodes_.begin() + size_t(edge),
+                         edge_sink_nodes_.begin() + size_t(edge) + 1);
 }
 
 /* Find the mem that control the edge */
@@ -266,7 +280,7 @@ std::vector<size_t> MuxGraph::branch_sizes() const {
       continue;
     }
 
-    size_t branch_size = node_in_edges_[node].size();
+    size_t branch_size = node_in_edges(node).size();
 
     /* make sure the branch size is valid */
     VTR_ASSERT_SAFE(valid_mux_implementation_num_inputs(branch_size));
@@ -302,7 +316,7 @@ std::vector<size_t> MuxGraph::branch_sizes(const size_t& level) const {
       continue;
     }
 
-    size_t branch_size = node_in_edges_[node].size();
+    size_t branch_size = node_in_edges(node).size();
 
     /* make sure the branch size is valid */
     VTR_ASSERT_SAFE(valid_mux_implementation_num_inputs(branch_size));
@@ -351,10 +365,9 @@ MuxGraph MuxGraph::subgraph(const MuxNodeId& root_node) const {
 
   /* Add input nodes and edges to subgraph */
   size_t input_cnt = 0;
-  for (auto edge_origin : this->node_in_edges_[root_node]) {
-    VTR_ASSERT_SAFE(1 == edge_src_nodes_[edge_origin].size());
+  for (auto edge_origin : this->node_in_edges(root_node)) {
     /* Add nodes */
-    MuxNodeId from_node_origin = this->edge_src_nodes_[edge_origin][0];
+    MuxNodeId from_node_origin = this->edge_src_nodes_[size_t(edge_origin)];
     MuxNodeId from_node_subgraph = mux_graph.add_node(MUX_INPUT_NODE);
     /* Configure the nodes */
     mux_graph.node_levels_[from_node_subgraph] = 0;
@@ -376,7 +389,7 @@ MuxGraph MuxGraph::subgraph(const MuxNodeId& root_node) const {
   std::map<MuxMemId, MuxMemId> mem2mem_map;
 
   /* Add memory bits and configure edges */
-  for (auto edge_origin : this->node_in_edges_[root_node]) {
+  for (auto edge_origin : this->node_in_edges(root_node)) {
     MuxMemId mem_origin = this->edge_mem_ids_[edge_origin];
     /* Try to find if the mem is already in the list */
     std::map<MuxMemId, MuxMemId>::iterator it = mem2mem_map.find(mem_origin);
@@ -396,6 +409,7 @@ MuxGraph MuxGraph::subgraph(const MuxNodeId& root_node) const {
   }
 
   /* Since the graph is finalized, it is time to build the fast look-up */
+  mux_graph.build_edge_csr();
   mux_graph.build_node_lookup();
   mux_graph.build_mem_lookup();
 
@@ -422,7 +436,7 @@ std::vector<MuxGraph> MuxGraph::build_mux_branch_graphs() const {
       continue;
     }
 
-    size_t branch_size = node_in_edges_[node].size();
+    size_t branch_size = node_in_edges(node).size();
 
     /* make sure the branch size is valid */
     VTR_ASSERT_SAFE(valid_mux_implementation_num_inputs(branch_size));
@@ -479,12 +493,10 @@ bool MuxGraph::is_node_output(const MuxNodeId& node_id) const {
 
 /* Get the node id of a given input */
 MuxNodeId MuxGraph::node_id(const MuxInputId& input_id) const {
-  /* Use the node_lookup to accelerate the search */
-  for (const auto& lvl : node_lookup_) {
-    for (const auto& cand_node : lvl[MUX_INPUT_NODE]) {
-      if (input_id == node_input_ids_[cand_node]) {
-        return cand_node; 
-      }
+  /* Use the cached input list to accelerate the search */
+  for (const auto& cand_node : input_nodes_) {
+    if (input_id == node_input_ids_[cand_node]) {
+      return cand_node; 
     }
   } 
 
@@ -493,12 +505,10 @@ MuxNodeId MuxGraph::node_id(const MuxInputId& input_id) const {
 
 /* Get the node id of a given output */
 MuxNodeId MuxGraph::node_id(const MuxOutputId& output_id) const {
-  /* Use the node_lookup to accelerate the search */
-  for (const auto& lvl : node_lookup_) {
-    for (const auto& cand_node : lvl[MUX_OUTPUT_NODE]) {
-      if (output_id == node_output_ids_[cand_node]) {
-        return cand_node; 
-      }
+  /* Use the cached output list to accelerate the search */
+  for (const auto& cand_node : output_nodes_) {
+    if (output_id == node_output_ids_[cand_node]) {
+      return cand_node; 
     }
   } 
 
@@ -516,22 +526,25 @@ MuxNodeId MuxGraph::node_id(const size_t& node_level, const size_t& node_index_a
   MuxNodeId ret_node = MuxNodeId::INVALID(); 
 
   /* Search in the fast look up */
-  if (node_level >= node_lookup_.size()) {
+  if (node_level >= num_node_levels()) {
     return ret_node; 
   }
   
   size_t node_cnt = 0;
-  /* Node level is valid, search in the node list */
-  for (const auto& nodes_by_type : node_lookup_[node_level]) {
+  /* Node level is valid, search in the node list, 
+   * nodes of all the types at the level are stored contiguously 
+   */
+  for (size_t inode = node_lookup_offsets_[node_level * size_t(NUM_MUX_NODE_TYPES)];
+       inode < node_lookup_offsets_[(node_level + 1) * size_t(NUM_MUX_NODE_TYPES)];
+       ++inode) {
+    const MuxNodeId& node = node_lookup_[inode];
     /* Search the node_index_at_level of each node */
-    for (const auto& node : nodes_by_type) {
-      if (node_index_at_level != node_ids_at_level_[node]) {
-        continue;
-      } 
-      /* Find the node, assign value and update the counter */
-      ret_node = node;
-      node_cnt++; 
-    }
+    if (node_index_at_level != node_ids_at_level_[node]) {
+      continue;
+    } 
+    /* Find the node, assign value and update the counter */
+    ret_node = node;
+    node_cnt++; 
   }
 
   /* We should either find a node or nothing */
@@ -540,7 +553,11 @@ MuxNodeId MuxGraph::node_id(const size_t& node_level, const size_t& node_index_a
   return ret_node;
 }
 
-/* Decode memory bits based on an input id and an output id */
+/* Decode memory bits based on an input id and an output id 
+ * Each node in a MUX graph (except the outputs) has exactly one fan-out,
+ * so the forward propagation is a walk along a single path, 
+ * which requires no search queue 
+ */
 vtr::vector<MuxMemId, bool> MuxGraph::decode_memory_bits(const MuxInputId& input_id,
                                                          const MuxOutputId& output_id) const {
   /* initialize the memory bits: TODO: support default value */ 
@@ -550,31 +567,20 @@ vtr::vector<MuxMemId, bool> MuxGraph::decode_memory_bits(const MuxInputId& input
   VTR_ASSERT_SAFE(valid_input_id(input_id));
   VTR_ASSERT_SAFE(valid_output_id(output_id));
 
-  /* Mark all the nodes as not visited */
-  vtr::vector<MuxNodeId, bool> visited(nodes().size(), false); 
-
-  /* Create a queue for Breadth-First Search */ 
-  std::list<MuxNodeId> queue; 
-
-  /* Mark the input node as visited and enqueue it */
-  visited[node_id(input_id)] = true; 
-  queue.push_back(node_id(input_id)); 
+  /* Find the output node only once, the search is linear */
+  MuxNodeId des_node = node_id(output_id); 
 
   /* Create a flag to indicate if the route is success or not */
   bool route_success = false;
 
-  while(!queue.empty()) { 
-    /* Dequeue a mux node from queue, 
-     * we will walk through all the fan-in of this node in this loop
-     */
-    MuxNodeId node_to_expand = queue.front(); 
-    queue.pop_front(); 
-                                                                                                               /* Get all fan-in nodes of the dequeued node
-     * If the node has not been visited,  
-     * then mark it visited and enqueue it
-     */
-    VTR_ASSERT_SAFE (1 == node_out_edges_[node_to_expand].size());
-    MuxEdgeId edge = node_out_edges_[node_to_expand][0];
+  /* Start from the input node and visit the fan-out until reaching the output node 
+   * Note that the outputs of fracturable LUTs may still have a fan-out
+   */
+  MuxNodeId node_to_expand = node_id(input_id);
+  while (0 < node_out_edges(node_to_expand).size()) {
+    /* Get the fan-out edge of the node */
+    VTR_ASSERT_SAFE (1 == node_out_edges(node_to_expand).size());
+    MuxEdgeId edge = node_out_edge_list_[node_out_edge_offsets_[size_t(node_to_expand)]];
 
     /* Configure the mem bits: 
      * if inv_mem is enabled, it means 0 to enable this edge 
@@ -588,23 +594,16 @@ vtr::vector<MuxMemId, bool> MuxGraph::decode_memory_bits(const MuxInputId& input
       mem_bits[mem] = true;
     }
 
-    /* each edge must have 1 fan-out */
-    VTR_ASSERT_SAFE (1 == edge_sink_nodes_[edge].size());
-
-    /* Get the fan-out node */
-    MuxNodeId next_node = edge_sink_nodes_[edge][0]; 
+    /* Get the fan-out node, each edge must have 1 fan-out */
+    MuxNodeId next_node = edge_sink_nodes_[size_t(edge)]; 
 
     /* If next node is the output node we want, we can finish here */
-    if (next_node == node_id(output_id)) {
+    if (next_node == des_node) {
       route_success = true;
       break;
     }
 
-    /* Add next node to the queue if not visited yet */
-    if (false == visited[next_node]) { 
-       visited[next_node] = true; 
-       queue.push_back(next_node); 
-    }
+    node_to_expand = next_node;
   }
 
   /* Routing must be success! */
@@ -616,6 +615,8 @@ vtr::vector<MuxMemId, bool> MuxGraph::decode_memory_bits(const MuxInputId& input
 /* Find the input node that the memory bits will route an output node to 
  * This function backward propagate from the output node to an input node
  * assuming the memory bits are applied  
+ * The memory bits select exactly one fan-in edge of each node,
+ * so the backward propagation is a walk along a single path
  */
 MuxInputId MuxGraph::find_input_node_driven_by_output_node(const std::map<MuxMemId, bool>& memory_bits,
                                                            const MuxOutputId& output_id) const {
@@ -625,32 +626,15 @@ MuxInputId MuxGraph::find_input_node_driven_by_output_node(const std::map<MuxMem
   /* valid the output */
   VTR_ASSERT_SAFE(valid_output_id(output_id));
 
-  /* Start from the output node */
-  /* Mark all the nodes as not visited */
-  vtr::vector<MuxNodeId, bool> visited(nodes().size(), false); 
-
-  /* Create a queue for Breadth-First Search */ 
-  std::list<MuxNodeId> queue; 
-
-  /* Mark the output node as visited and enqueue it */
-  visited[node_id(output_id)] = true; 
-  queue.push_back(node_id(output_id)); 
-
   /* Record the destination input id */
   MuxInputId des_input_id = MuxInputId::INVALID();
 
-  while(!queue.empty()) { 
-    /* Dequeue a mux node from queue, 
-     * we will walk through all the fan-in of this node in this loop
-     */
-    MuxNodeId node_to_expand = queue.front(); 
-    queue.pop_front(); 
-                                                                                                               /* Get all fan-in nodes of the dequeued node
-     * If the node has not been visited,  
-     * then mark it visited and enqueue it
-     */
+  /* Start from the output node */
+  MuxNodeId node_to_expand = node_id(output_id);
+  /* The path can be no longer than the number of levels */
+  for (size_t lvl = 0; lvl < num_node_levels(); ++lvl) {
     MuxEdgeId next_edge = MuxEdgeId::INVALID(); 
-    for (const MuxEdgeId& edge : node_in_edges_[node_to_expand]) {
+    for (const MuxEdgeId& edge : node_in_edges(node_to_expand)) {
       /* Configure the mem bits and find the edge that will propagate the signal 
        * if inv_mem is enabled, it means false to enable this edge 
        * otherwise, it is true to enable this edge
@@ -665,11 +649,8 @@ MuxInputId MuxGraph::find_input_node_driven_by_output_node(const std::map<MuxMem
     /* We must have a valid next edge */
     VTR_ASSERT(MuxEdgeId::INVALID() != next_edge);
 
-    /* each edge must have 1 fan-out */
-    VTR_ASSERT_SAFE (1 == edge_src_nodes_[next_edge].size());
-
-    /* Get the fan-in node */
-    MuxNodeId next_node = edge_src_nodes_[next_edge][0]; 
+    /* Get the fan-in node, each edge must have 1 fan-in */
+    MuxNodeId next_node = edge_src_nodes_[size_t(next_edge)]; 
 
     /* If next node is an input node, we can finish here */
     if (true == is_node_input(next_node)) {
@@ -677,11 +658,7 @@ MuxInputId MuxGraph::find_input_node_driven_by_output_node(const std::map<MuxMem
       break;
     }
 
-    /* Add next node to the queue if not visited yet */
-    if (false == visited[next_node]) { 
-       visited[next_node] = true; 
-       queue.push_back(next_node); 
-    }
+    node_to_expand = next_node;
   }
 
   /* Routing must be success! */
@@ -690,6 +667,18 @@ MuxInputId MuxGraph::find_input_node_driven_by_output_node(const std::map<MuxMem
   return des_input_id;
 }
 
+/**************************************************
+ * Private accessors
+ *************************************************/
+/* Find the nodes of a given type at a given level */
+MuxGraph::node_list_range MuxGraph::nodes_at_level(const size_t& level, 
+                                                   const enum e_mux_graph_node_type& node_type) const {
+  VTR_ASSERT(level < num_node_levels());
+  size_t lookup_index = level * size_t(NUM_MUX_NODE_TYPES) + size_t(node_type);
+  return vtr::make_range(node_lookup_.begin() + node_lookup_offsets_[lookup_index],
+                         node_lookup_.begin() + node_lookup_offsets_[lookup_index + 1]);
+}
+
 /**************************************************
  * Private mutators: basic operations 
  *************************************************/
@@ -704,8 +693,9 @@ MuxNodeId MuxGraph::add_node(const enum e_mux_graph_node_type& node_type) {
   node_output_ids_.push_back(MuxOutputId::INVALID());
   node_levels_.push_back(-1);
   node_ids_at_level_.push_back(-1);
-  node_in_edges_.emplace_back();
-  node_out_edges_.emplace_back();
+  /* The edge connectivity arrays are out of date */
+  node_in_edge_offsets_.clear();
+  node_out_edge_offsets_.clear();
 
   return node;
 }
@@ -720,16 +710,18 @@ MuxEdgeId MuxGraph::add_edge(const MuxNodeId& from_node, const MuxNodeId& to_nod
   edge_mem_ids_.push_back(MuxMemId::INVALID());
   edge_inv_mem_.push_back(false);
 
-  /* update the edge-node connections */
+  /* update the edge-node connections 
+   * The node-to-edge connections are built later by build_edge_csr()
+   */
   VTR_ASSERT(valid_node_id(from_node));
-  edge_src_nodes_.emplace_back();
-  edge_src_nodes_[edge].push_back(from_node);
-  node_out_edges_[from_node].push_back(edge);
+  edge_src_nodes_.push_back(from_node);
 
   VTR_ASSERT(valid_node_id(to_node));
-  edge_sink_nodes_.emplace_back();
-  edge_sink_nodes_[edge].push_back(to_node);
-  node_in_edges_[to_node].push_back(edge);
+  edge_sink_nodes_.push_back(to_node);
+
+  /* The edge connectivity arrays are out of date */
+  node_in_edge_offsets_.clear();
+  node_out_edge_offsets_.clear();
 
   return edge;
 }
@@ -1007,7 +999,7 @@ void MuxGraph::add_fracturable_outputs(const CircuitLibrary& circuit_lib,
     for (const auto& output_idx : circuit_lib.port_lut_output_masks(port)) {
       size_t num_matched_nodes = 0;
       /* Iterate over node and find the internal nodes, which match the frac_level and output_idx */
-      for (const auto& node : node_lookup_[frac_level][MUX_INTERNAL_NODE]) {
+      for (const auto& node : nodes_at_level(frac_level, MUX_INTERNAL_NODE)) {
         if (node_ids_at_level_[node] != output_idx) {
           /* Bypass condition */
           continue;
@@ -1028,7 +1020,7 @@ void MuxGraph::add_fracturable_outputs(const CircuitLibrary& circuit_lib,
         continue; /* Finish here, go to next */
       }
       /* Sometime the wanted node is already an output, do a double check */
-      for (const auto& node : node_lookup_[frac_level][MUX_OUTPUT_NODE]) {
+      for (const auto& node : nodes_at_level(frac_level, MUX_OUTPUT_NODE)) {
         if (node_ids_at_level_[node] != output_idx) {
           /* Bypass condition */
           continue;
@@ -1095,6 +1087,7 @@ void MuxGraph::build_mux_graph(const CircuitLibrary& circuit_lib,
   }
 
   /* Since the graph is finalized, it is time to build the fast look-up */
+  build_edge_csr();
   build_node_lookup();
   build_mem_lookup();
 
@@ -1105,6 +1098,39 @@ void MuxGraph::build_mux_graph(const CircuitLibrary& circuit_lib,
   }
 }
 
+/* Freeze the edge connectivity into CSR arrays
+ * The edges are bucketed by their sink (source) nodes with a counting sort,
+ * which keeps the edges of each node in the order they were added 
+ */
+void MuxGraph::build_edge_csr() {
+  size_t num_nodes = node_ids_.size();
+
+  node_in_edge_offsets_.assign(num_nodes + 1, 0);
+  node_out_edge_offsets_.assign(num_nodes + 1, 0);
+
+  /* Count the fan-in and fan-out of each node */
+  for (auto edge : edges()) {
+    node_in_edge_offsets_[size_t(edge_sink_nodes_[size_t(edge)]) + 1]++;
+    node_out_edge_offsets_[size_t(edge_src_nodes_[size_t(edge)]) + 1]++;
+  }
+
+  /* Prefix sum to get the offsets */
+  for (size_t inode = 0; inode < num_nodes; ++inode) {
+    node_in_edge_offsets_[inode + 1] += node_in_edge_offsets_[inode];
+    node_out_edge_offsets_[inode + 1] += node_out_edge_offsets_[inode];
+  }
+
+  /* Fill the edge lists */
+  node_in_edge_list_.resize(edge_ids_.size());
+  node_out_edge_list_.resize(edge_ids_.size());
+  std::vector<size_t> in_edge_cursor(node_in_edge_offsets_.begin(), node_in_edge_offsets_.end() - 1);
+  std::vector<size_t> out_edge_cursor(node_out_edge_offsets_.begin(), node_out_edge_offsets_.end() - 1);
+  for (auto edge : edges()) {
+    node_in_edge_list_[in_edge_cursor[size_t(edge_sink_nodes_[size_t(edge)])]++] = edge;
+    node_out_edge_list_[out_edge_cursor[size_t(edge_src_nodes_[size_t(edge)])]++] = edge;
+  }
+}
+
 /* Build fast node lookup */
 void MuxGraph::build_node_lookup() {
   /* Invalidate the node lookup if necessary */
@@ -1116,16 +1142,42 @@ void MuxGraph::build_node_lookup() {
     num_levels = std::max((int)node_levels_[node], (int)num_levels);
   }
 
-  /* Resize node_lookup */
-  node_lookup_.resize(num_levels + 1);
-  for (size_t lvl = 0; lvl < node_lookup_.size(); ++lvl) {
-    /* Resize by number of node types */
-    node_lookup_[lvl].resize(NUM_MUX_NODE_TYPES);
+  /* Count the nodes of each type at each level */
+  size_t num_buckets = (num_levels + 1) * size_t(NUM_MUX_NODE_TYPES);
+  node_lookup_offsets_.assign(num_buckets + 1, 0);
+  for (auto node : nodes()) {
+    size_t bucket = node_levels_[node] * size_t(NUM_MUX_NODE_TYPES) + size_t(node_types_[node]);
+    node_lookup_offsets_[bucket + 1]++;
+  }
+  for (size_t ibucket = 0; ibucket < num_buckets; ++ibucket) {
+    node_lookup_offsets_[ibucket + 1] += node_lookup_offsets_[ibucket];
   }
 
   /* Fill the node lookup */
+  node_lookup_.resize(node_ids_.size());
+  std::vector<size_t> bucket_cursor(node_lookup_offsets_.begin(), node_lookup_offsets_.end() - 1);
   for (auto node : nodes()) {
-    node_lookup_[node_levels_[node]][size_t(node_types_[node])].push_back(node);
+    size_t bucket = node_levels_[node] * size_t(NUM_MUX_NODE_TYPES) + size_t(node_types_[node]);
+    node_lookup_[bucket_cursor[bucket]++] = node;
+  }
+
+  /* Cache the inputs, outputs and non-input nodes, level by level */
+  for (size_t lvl = 0; lvl < num_levels + 1; ++lvl) {
+    for (const auto& node : nodes_at_level(lvl, MUX_INPUT_NODE)) {
+      input_nodes_.push_back(node);
+    }
+    for (const auto& node : nodes_at_level(lvl, MUX_OUTPUT_NODE)) {
+      output_nodes_.push_back(node);
+    }
+    for (size_t node_type = 0; node_type < size_t(NUM_MUX_NODE_TYPES); ++node_type) {
+      /* Bypass any nodes which are not OUTPUT and INTERNAL */
+      if (size_t(MUX_INPUT_NODE) == node_type) { 
+        continue;
+      }
+      for (const auto& node : nodes_at_level(lvl, e_mux_graph_node_type(node_type))) {
+        non_input_nodes_.push_back(node);
+      }
+    }
   }
 }
 
@@ -1140,22 +1192,36 @@ void MuxGraph::build_mem_lookup() {
     num_levels = std::max((int)mem_levels_[mem], (int)num_levels);
   }
 
-  /* Resize mem_lookup */
-  mem_lookup_.resize(num_levels + 1);
+  /* Count the mems at each level */
+  mem_lookup_offsets_.assign(num_levels + 2, 0);
   for (auto mem : memories()) {
-    /* Categorize mem nodes into mem_lookup */
-    mem_lookup_[mem_levels_[mem]].push_back(mem);
+    mem_lookup_offsets_[mem_levels_[mem] + 1]++;
+  }
+  for (size_t lvl = 0; lvl < num_levels + 1; ++lvl) {
+    mem_lookup_offsets_[lvl + 1] += mem_lookup_offsets_[lvl];
+  }
+
+  /* Categorize mem nodes into mem_lookup */
+  mem_lookup_.resize(mem_ids_.size());
+  std::vector<size_t> level_cursor(mem_lookup_offsets_.begin(), mem_lookup_offsets_.end() - 1);
+  for (auto mem : memories()) {
+    mem_lookup_[level_cursor[mem_levels_[mem]]++] = mem;
   }
 }
 
 /* Invalidate (empty) the node fast lookup*/
 void MuxGraph::invalidate_node_lookup() {
   node_lookup_.clear();
+  node_lookup_offsets_.clear();
+  input_nodes_.clear();
+  output_nodes_.clear();
+  non_input_nodes_.clear();
 }
 
 /* Invalidate (empty) the mem fast lookup*/
 void MuxGraph::invalidate_mem_lookup() {
   mem_lookup_.clear();
+  mem_lookup_offsets_.clear();
 }
  
 /**************************************************
@@ -1177,11 +1243,9 @@ bool MuxGraph::valid_mem_id(const MuxMemId& mem) const {
 
 /* validate an input id (from which data path signal will be progagated to the output) */
 bool MuxGraph::valid_input_id(const MuxInputId& input_id) const {
-  for (const auto& lvl : node_lookup_) {
-    for (const auto& node : lvl[MUX_INPUT_NODE]) {
-      if (size_t(input_id) > size_t(node_input_ids_[node])) {
-        return false;
-      }
+  for (const auto& node : input_nodes_) {
+    if (size_t(input_id) > size_t(node_input_ids_[node])) {
+      return false;
     }
   } 
 
@@ -1190,11 +1254,9 @@ bool MuxGraph::valid_input_id(const MuxInputId& input_id) const {
 
 /* validate an output id */
 bool MuxGraph::valid_output_id(const MuxOutputId& output_id) const {
-  for (const auto& lvl : node_lookup_) {
-    for (const auto& node : lvl[MUX_OUTPUT_NODE]) {
-      if (size_t(output_id) > size_t(node_output_ids_[node])) {
-        return false;
-      }
+  for (const auto& node : output_nodes_) {
+    if (size_t(output_id) > size_t(node_output_ids_[node])) {
+      return false;
     }
   } 
 
@@ -1205,6 +1267,11 @@ bool MuxGraph::valid_level(const size_t& level) const {
   return level < num_node_levels(); 
 }
 
+bool MuxGraph::valid_edge_csr() const {
+  return (node_ids_.size() + 1 == node_in_edge_offsets_.size())
+      && (node_ids_.size() + 1 == node_out_edge_offsets_.size());
+}
+
 bool MuxGraph::valid_node_lookup() const {
   return node_lookup_.empty();
 }
@@ -1221,7 +1288,7 @@ bool MuxGraph::valid_mux_graph() const {
       continue;
     }
     /* other nodes should have 1 fan-out */
-    if (1 != node_out_edges_[node].size()) {
+    if (1 != node_out_edges(node).size()) {
       return false;
     }
   }
@@ -1230,13 +1297,10 @@ bool MuxGraph::valid_mux_graph() const {
   for (const auto& node : nodes()) {
     if (MUX_INPUT_NODE == node_types_[node]) {
       MuxNodeId next_node = node;
-      while ( 0 < node_out_edges_[next_node].size() ) {
-        MuxEdgeId edge = node_out_edges_[next_node][0];
-        /* each edge must have 1 fan-out */
-        if (1 != edge_sink_nodes_[edge].size()) {
-          return false;
-        }
-        next_node = edge_sink_nodes_[edge][0]; 
+      while ( 0 < node_out_edges(next_node).size() ) {
+        MuxEdgeId edge = *node_out_edges(next_node).begin();
+        /* each edge must have 1 fan-out, which is guaranteed by the storage */
+        next_node = edge_sink_nodes_[size_t(edge)]; 
       }
       if (MUX_OUTPUT_NODE != node_types_[next_node]) {
         return false;
@@ -28,6 +28,7 @@
 #define MUX_GRAPH_H
 
 #include <map>
+#include <vector>
 #include "vtr_vector.h"
 #include "vtr_range.h"
 #include "mux_graph_fwd.h"
@@ -49,6 +50,17 @@ class MuxGraph {
     typedef vtr::Range<node_iterator> node_range;
     typedef vtr::Range<edge_iterator> edge_range;
     typedef vtr::Range<mem_iterator> mem_range;
+
+    /* Ranges over the flat (CSR) arrays built when the graph is frozen.
+     * They point into the internal storage, so no copy is made per query
+     */
+    typedef std::vector<MuxNodeId>::const_iterator node_list_iterator;
+    typedef std::vector<MuxEdgeId>::const_iterator edge_list_iterator;
+    typedef std::vector<MuxMemId>::const_iterator mem_list_iterator;
+
+    typedef vtr::Range<node_list_iterator> node_list_range;
+    typedef vtr::Range<edge_list_iterator> edge_list_range;
+    typedef vtr::Range<mem_list_iterator> mem_list_range;
   public: /* Public Constructors */
     /* Create an object based on a Circuit Model which is MUX */
     MuxGraph(const CircuitLibrary& circuit_lib, 
@@ -60,7 +72,7 @@ class MuxGraph {
   public: /* Public accessors: Aggregates */
     node_range nodes() const;
     /* Find the non-input nodes */
-    std::vector<MuxNodeId> non_input_nodes() const;
+    node_list_range non_input_nodes() const;
     edge_range edges() const;
     mem_range memories() const;
     /* Find the number of levels in terms of the multiplexer */
@@ -70,12 +82,14 @@ class MuxGraph {
   public: /* Public accessors: Data query */
     /* Find the number of inputs in the MUX graph */
     size_t num_inputs() const;
-    std::vector<MuxNodeId> inputs() const;
+    node_list_range inputs() const;
     /* Find the number of outputs in the MUX graph */
     size_t num_outputs() const;
-    std::vector<MuxNodeId> outputs() const;
+    node_list_range outputs() const;
     /* Find the edge between two MUX nodes */
     std::vector<MuxEdgeId> find_edges(const MuxNodeId& from_node, const MuxNodeId& to_node) const;
+    /* Find the unique edge between two MUX nodes, return an invalid id if there is none */
+    MuxEdgeId find_edge(const MuxNodeId& from_node, const MuxNodeId& to_node) const;
     /* Find the number of levels in the MUX graph */
     size_t num_levels() const;
     size_t num_node_levels() const;
@@ -84,7 +98,7 @@ class MuxGraph {
     /* Find the number of SRAMs at a level in the MUX graph */
     size_t num_memory_bits_at_level(const size_t& level) const;
     /* Return memory id at level */
-    std::vector<MuxMemId> memories_at_level(const size_t& level) const;
+    mem_list_range memories_at_level(const size_t& level) const;
     /* Find the number of nodes at a given level in the MUX graph */
     size_t num_nodes_at_level(const size_t& level) const;
     /* Find the level of a node */
@@ -92,9 +106,13 @@ class MuxGraph {
     /* Find the index of a node at its level */
     size_t node_index_at_level(const MuxNodeId& node) const;
     /* Find the input edges for a node */
-    std::vector<MuxEdgeId> node_in_edges(const MuxNodeId& node) const;
+    edge_list_range node_in_edges(const MuxNodeId& node) const;
+    /* Find the output edges for a node */
+    edge_list_range node_out_edges(const MuxNodeId& node) const;
     /* Find the input nodes for a edge */
-    std::vector<MuxNodeId> edge_src_nodes(const MuxEdgeId& edge) const;
+    node_list_range edge_src_nodes(const MuxEdgeId& edge) const;
+    /* Find the output nodes for a edge */
+    node_list_range edge_sink_nodes(const MuxEdgeId& edge) const;
     /* Find the mem that control the edge */
     MuxMemId find_edge_mem(const MuxEdgeId& edge) const;
     /* Identify if the edge is controlled by the inverted output of a mem */
@@ -133,6 +151,9 @@ class MuxGraph {
      */
     MuxInputId find_input_node_driven_by_output_node(const std::map<MuxMemId, bool>& memory_bits,
                                                      const MuxOutputId& output_id) const;
+  private: /* Private accessors */
+    /* Find the nodes of a given type at a given level */
+    node_list_range nodes_at_level(const size_t& level, const enum e_mux_graph_node_type& node_type) const;
   private: /* Private mutators : basic operations */
      /* Add a unconfigured node to the MuxGraph */
      MuxNodeId add_node(const enum e_mux_graph_node_type& node_type);
@@ -158,6 +179,8 @@ class MuxGraph {
     /* Convert some internal node to outputs according to fracturable LUT circuit design specifications */
     void add_fracturable_outputs(const CircuitLibrary& circuit_lib, 
                                  const CircuitModelId& circuit_model);
+    /* Freeze the edge connectivity into compact (CSR) arrays */
+    void build_edge_csr();
     /* Build fast node lookup */
     void build_node_lookup();
     /* Build fast mem lookup */
@@ -170,6 +193,8 @@ class MuxGraph {
     bool valid_input_id(const MuxInputId& input_id) const;
     bool valid_output_id(const MuxOutputId& output_id) const;
     bool valid_level(const size_t& level) const;
+    /* validate edge connectivity arrays */
+    bool valid_edge_csr() const;
     /* validate/invalidate node lookup */
     bool valid_node_lookup() const;
     void invalidate_node_lookup();
@@ -183,12 +208,22 @@ class MuxGraph {
     vtr::vector<MuxNodeId, MuxOutputId> node_output_ids_;                 /* Unique ids for each node as an input of the MUX */
     vtr::vector<MuxNodeId, size_t> node_levels_;                       /* at which level, each node belongs to */
     vtr::vector<MuxNodeId, size_t> node_ids_at_level_;                       /* the index at the level that each node belongs to */
-    vtr::vector<MuxNodeId, std::vector<MuxEdgeId>> node_in_edges_;       /* ids of incoming edges to each node */
-    vtr::vector<MuxNodeId, std::vector<MuxEdgeId>> node_out_edges_;      /* ids of outgoing edges from each node */
+
+    /* Incoming/outgoing edges of each node, in compressed sparse row (CSR) form:
+     * the edges of node i are stored in [node_*_edge_offsets_[i], node_*_edge_offsets_[i + 1])
+     * The arrays are built by build_edge_csr() once all the edges are added
+     */
+    std::vector<size_t> node_in_edge_offsets_;                          /* [num_nodes + 1] */
+    std::vector<MuxEdgeId> node_in_edge_list_;                          /* ids of incoming edges to each node */
+    std::vector<size_t> node_out_edge_offsets_;                         /* [num_nodes + 1] */
+    std::vector<MuxEdgeId> node_out_edge_list_;                         /* ids of outgoing edges from each node */
 
     vtr::vector<MuxEdgeId, MuxEdgeId> edge_ids_;                        /* Unique ids for each edge */
-    vtr::vector<MuxEdgeId, std::vector<MuxNodeId>> edge_src_nodes_;     /* source nodes drive this edge */
-    vtr::vector<MuxEdgeId, std::vector<MuxNodeId>> edge_sink_nodes_;    /* sink nodes this edge drives */
+    /* Each edge is driven by one source node and drives one sink node, 
+     * so the edge id itself is the CSR offset in the two arrays below
+     */
+    std::vector<MuxNodeId> edge_src_nodes_;                             /* source nodes drive this edge */
+    std::vector<MuxNodeId> edge_sink_nodes_;                            /* sink nodes this edge drives */
     vtr::vector<MuxEdgeId, CircuitModelId> edge_models_; /* type of each edge: tgate/pass-gate */
     vtr::vector<MuxEdgeId, MuxMemId> edge_mem_ids_;                   /* ids of memory bit that control the edge */
     vtr::vector<MuxEdgeId, bool> edge_inv_mem_;                       /* if the edge is controlled by an inverted output of a memory bit */
@@ -196,11 +231,18 @@ class MuxGraph {
     vtr::vector<MuxMemId, MuxMemId> mem_ids_;                        /* ids of configuration memories */
     vtr::vector<MuxMemId, size_t> mem_levels_;                        /* ids of configuration memories */
 
-    /* fast look-up */
-    typedef std::vector<std::vector<std::vector<MuxNodeId>>> NodeLookup;
-    mutable NodeLookup node_lookup_; /* [num_levels][num_types][num_nodes_per_level] */ 
-    typedef std::vector<std::vector<MuxMemId>> MemLookup;
-    mutable MemLookup mem_lookup_; /* [num_levels][num_mems_per_level] */ 
+    /* fast look-up, in CSR form:
+     * nodes of type t at level l are stored in 
+     * [node_lookup_offsets_[l * NUM_MUX_NODE_TYPES + t], node_lookup_offsets_[l * NUM_MUX_NODE_TYPES + t + 1])
+     */
+    std::vector<MuxNodeId> node_lookup_;        /* [num_levels * num_types * num_nodes_per_level] */ 
+    std::vector<size_t> node_lookup_offsets_;   /* [num_levels * num_types + 1] */
+    std::vector<MuxNodeId> input_nodes_;        /* cached list of input nodes, sorted by levels */
+    std::vector<MuxNodeId> output_nodes_;       /* cached list of output nodes, sorted by levels */
+    std::vector<MuxNodeId> non_input_nodes_;    /* cached list of output and internal nodes, sorted by levels */
+    /* mems at level l are stored in [mem_lookup_offsets_[l], mem_lookup_offsets_[l + 1]) */
+    std::vector<MuxMemId> mem_lookup_;          /* [num_levels * num_mems_per_level] */ 
+    std::vector<size_t> mem_lookup_offsets_;    /* [num_levels + 1] */
 };
 
 #endif
@@ -79,6 +79,44 @@ std::vector<size_t> ModuleManager::configurable_child_instances(const ModuleId&
   return configurable_child_instances_[parent_module];
 }
 
+/* Find all the configuration regions under a parent module */
+ModuleManager::config_region_range ModuleManager::regions(const ModuleId& parent_module) const {
+  /* Validate the module_id */
+  VTR_ASSERT(valid_module_id(parent_module));
+
+  return vtr::make_range(config_region_ids_[parent_module].begin(), config_region_ids_[parent_module].end());
+}
+
+/* Find the configurable child modules that belong to a configuration region */
+std::vector<ModuleId> ModuleManager::region_configurable_children(const ModuleId& parent_module, 
+                                                                  const ConfigRegionId& region) const {
+  /* Validate the module_id and region id */
+  VTR_ASSERT(valid_region_id(parent_module, region));
+
+  std::vector<ModuleId> region_children;
+  region_children.reserve(config_region_children_[parent_module][region].size());
+  for (const size_t& child_index : config_region_children_[parent_module][region]) {
+    region_children.push_back(configurable_children_[parent_module][child_index]);
+  }
+
+  return region_children;
+}
+
+/* Find the instances of configurable child modules that belong to a configuration region */
+std::vector<size_t> ModuleManager::region_configurable_child_instances(const ModuleId& parent_module, 
+                                                                       const ConfigRegionId& region) const {
+  /* Validate the module_id and region id */
+  VTR_ASSERT(valid_region_id(parent_module, region));
+
+  std::vector<size_t> region_child_instances;
+  region_child_instances.reserve(config_region_children_[parent_module][region].size());
+  for (const size_t& child_index : config_region_children_[parent_module][region]) {
+    region_child_instances.push_back(configurable_child_instances_[parent_module][child_index]);
+  }
+
+  return region_child_instances;
+}
+
 /* Find the source ids of modules */
 ModuleManager::module_net_src_range ModuleManager::module_net_sources(const ModuleId& module, const ModuleNetId& net) const {
   /* Validate the module_id */
@@ -447,6 +485,8 @@ ModuleId ModuleManager::add_module(const std::string& name) {
   child_instance_names_.emplace_back();
   configurable_children_.emplace_back();
   configurable_child_instances_.emplace_back();
+  config_region_ids_.emplace_back();
+  config_region_children_.emplace_back();
 
   port_ids_.emplace_back();
   ports_.emplace_back();
@@ -623,6 +663,41 @@ void ModuleManager::add_configurable_child(const ModuleId& parent_module,
   configurable_child_instances_[parent_module].push_back(child_instance);
 }
 
+/* Add a configuration region to a module */
+ConfigRegionId ModuleManager::add_config_region(const ModuleId& module) {
+  /* Validate the module id */
+  VTR_ASSERT ( valid_module_id(module) );
+
+  /* Create an new id */
+  ConfigRegionId region = ConfigRegionId(config_region_ids_[module].size());
+  config_region_ids_[module].push_back(region);
+  config_region_children_[module].emplace_back();
+
+  return region;
+}
+
+/* Assign a configurable child module to a configuration region 
+ * Note: this function should be called after add_configurable_child!
+ * The config_child_id is the index of the child in the configurable_children() list,
+ * which is used to double check that the child module and instance are consistent
+ * The child module will be configured in the region following
+ * the sequence of calling this function 
+ */
+void ModuleManager::add_configurable_child_to_region(const ModuleId& parent_module, 
+                                                     const ConfigRegionId& region,
+                                                     const ModuleId& child_module, 
+                                                     const size_t& child_instance,
+                                                     const size_t& config_child_id) {
+  /* Validate the id of parent module and region */
+  VTR_ASSERT ( valid_region_id(parent_module, region) );
+  /* Ensure that the child is a configurable child of the parent module */
+  VTR_ASSERT ( config_child_id < configurable_children_[parent_module].size() );
+  VTR_ASSERT ( child_module == configurable_children_[parent_module][config_child_id] );
+  VTR_ASSERT ( child_instance == configurable_child_instances_[parent_module][config_child_id] );
+
+  config_region_children_[parent_module][region].push_back(config_child_id);
+}
+
 /* Add a net to the connection graph of the module */ 
 ModuleNetId ModuleManager::create_module_net(const ModuleId& module) {
   /* Validate the module id */
@@ -759,6 +834,13 @@ bool ModuleManager::valid_module_net_id(const ModuleId& module, const ModuleNetI
   return ( size_t(net) < net_ids_[module].size() ) && ( net == net_ids_[module][net] ); 
 }
 
+bool ModuleManager::valid_region_id(const ModuleId& module, const ConfigRegionId& region) const {
+  if (false == valid_module_id(module)) {
+    return false;
+  }
+  return ( size_t(region) < config_region_ids_[module].size() ) && ( region == config_region_ids_[module][region] ); 
+}
+
 void ModuleManager::invalidate_name2id_map() {
   name_id_map_.clear();
 }
@@ -42,12 +42,14 @@ class ModuleManager {
     typedef vtr::vector<ModuleNetId, ModuleNetId>::const_iterator module_net_iterator;
     typedef vtr::vector<ModuleNetSrcId, ModuleNetSrcId>::const_iterator module_net_src_iterator;
     typedef vtr::vector<ModuleNetSinkId, ModuleNetSinkId>::const_iterator module_net_sink_iterator;
+    typedef vtr::vector<ConfigRegionId, ConfigRegionId>::const_iterator config_region_iterator;
 
     typedef vtr::Range<module_iterator> module_range;
     typedef vtr::Range<module_port_iterator> module_port_range;
     typedef vtr::Range<module_net_iterator> module_net_range;
     typedef vtr::Range<module_net_src_iterator> module_net_src_range;
     typedef vtr::Range<module_net_sink_iterator> module_net_sink_range;
+    typedef vtr::Range<config_region_iterator> config_region_range;
 
   public: /* Public aggregators */
     /* Find all the modules */
@@ -64,6 +66,12 @@ class ModuleManager {
     std::vector<ModuleId> configurable_children(const ModuleId& parent_module) const;
     /* Find all the instances of configurable child modules under a parent module */
     std::vector<size_t> configurable_child_instances(const ModuleId& parent_module) const;
+    /* Find all the configuration regions under a parent module */
+    config_region_range regions(const ModuleId& parent_module) const;
+    /* Find the configurable child modules that belong to a configuration region */
+    std::vector<ModuleId> region_configurable_children(const ModuleId& parent_module, const ConfigRegionId& region) const;
+    /* Find the instances of configurable child modules that belong to a configuration region */
+    std::vector<size_t> region_configurable_child_instances(const ModuleId& parent_module, const ConfigRegionId& region) const;
     /* Find the source ids of modules */
     module_net_src_range module_net_sources(const ModuleId& module, const ModuleNetId& net) const;
     /* Find the sink ids of modules */
@@ -152,6 +160,12 @@ class ModuleManager {
     void set_child_instance_name(const ModuleId& parent_module, const ModuleId& child_module, const size_t& instance_id, const std::string& instance_name);
     /* Add a configurable child module to module */
     void add_configurable_child(const ModuleId& module, const ModuleId& child_module, const size_t& child_instance);
+    /* Add a configuration region to a module */
+    ConfigRegionId add_config_region(const ModuleId& module);
+    /* Assign a configurable child module to a configuration region of its parent module */
+    void add_configurable_child_to_region(const ModuleId& parent_module, const ConfigRegionId& region,
+                                          const ModuleId& child_module, const size_t& child_instance,
+                                          const size_t& config_child_id);
     /* Add a net to the connection graph of the module */ 
     ModuleNetId create_module_net(const ModuleId& module);
     /* Set the name of net */
@@ -169,6 +183,7 @@ class ModuleManager {
     bool valid_module_id(const ModuleId& module) const;
     bool valid_module_port_id(const ModuleId& module, const ModulePortId& port) const;
     bool valid_module_net_id(const ModuleId& module, const ModuleNetId& net) const;
+    bool valid_region_id(const ModuleId& module, const ConfigRegionId& region) const;
   private: /* Private validators/invalidators */
     void invalidate_name2id_map();
     void invalidate_port_lookup();
@@ -191,6 +206,15 @@ class ModuleManager {
     vtr::vector<ModuleId, std::vector<ModuleId>> configurable_children_;                /* Child modules with configurable memory bits that this module contain */
     vtr::vector<ModuleId, std::vector<size_t>> configurable_child_instances_;           /* Instances of child modules with configurable memory bits that this module contain */
 
+    /* Configuration regions split the configurable children of a module into groups,
+     * each of which is programmed through its own configuration protocol (e.g., a
+     * separated configuration chain). A region stores the indices of its children 
+     * in the configurable_children_ list, following the sequence of configuration.
+     * A module without any region is configured as a whole
+     */
+    vtr::vector<ModuleId, vtr::vector<ConfigRegionId, ConfigRegionId>> config_region_ids_;     /* Unique ids of configuration regions in each module */
+    vtr::vector<ModuleId, vtr::vector<ConfigRegionId, std::vector<size_t>>> config_region_children_; /* Indices of configurable children in each region */
+
     /* Port-level data */
     vtr::vector<ModuleId, vtr::vector<ModulePortId, ModulePortId>> port_ids_;    /* List of ports for each Module */ 
     vtr::vector<ModuleId, vtr::vector<ModulePortId, BasicPort>> ports_;    /* List of ports for each Module */ 
@@ -16,6 +16,7 @@ struct module_pin_id_tag;
 struct module_net_id_tag;
 struct module_net_src_id_tag;
 struct module_net_sink_id_tag;
+struct config_region_id_tag;
 
 typedef vtr::StrongId<module_id_tag> ModuleId;
 typedef vtr::StrongId<instance_id_tag> InstanceId;
@@ -24,6 +25,7 @@ typedef vtr::StrongId<module_pin_id_tag> ModulePinId;
 typedef vtr::StrongId<module_net_id_tag> ModuleNetId;
 typedef vtr::StrongId<module_net_src_id_tag> ModuleNetSrcId;
 typedef vtr::StrongId<module_net_sink_id_tag> ModuleNetSinkId;
+typedef vtr::StrongId<config_region_id_tag> ConfigRegionId;
 
 class ModuleManager;
 
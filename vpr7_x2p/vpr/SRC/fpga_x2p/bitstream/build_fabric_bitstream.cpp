@@ -63,6 +63,19 @@ void rec_build_module_fabric_dependent_bitstream(const BitstreamManager& bitstre
   }
 }
 
+/********************************************************************
+ * Count the number of configuration bits under a block
+ *******************************************************************/
+static 
+size_t rec_find_block_num_config_bits(const BitstreamManager& bitstream_manager,
+                                      const ConfigBlockId& block) {
+  size_t num_config_bits = bitstream_manager.block_bits(block).size();
+  for (const ConfigBlockId& child_block : bitstream_manager.block_children(block)) {
+    num_config_bits += rec_find_block_num_config_bits(bitstream_manager, child_block);
+  }
+  return num_config_bits;
+}
+
 /********************************************************************
  * A top-level function re-organizes the bitstream for a specific 
  * FPGA fabric, where configuration bits are organized in the sequence
@@ -97,9 +110,28 @@ std::vector<ConfigBitId> build_fabric_dependent_bitstream(const BitstreamManager
   VTR_ASSERT(1 == top_block.size());
   VTR_ASSERT(0 == top_module_name.compare(bitstream_manager.block_name(top_block[0])));
 
-  rec_build_module_fabric_dependent_bitstream(bitstream_manager, top_block[0],
-                                              module_manager, top_module, 
-                                              fabric_bitstream);
+  /* When the top module is split into configuration regions, 
+   * the bitstream is built region by region, so that
+   * the bits of each region form a contiguous slice in the fabric bitstream
+   */
+  if (0 == module_manager.regions(top_module).size()) {
+    rec_build_module_fabric_dependent_bitstream(bitstream_manager, top_block[0],
+                                                module_manager, top_module, 
+                                                fabric_bitstream);
+  } else {
+    for (const ConfigRegionId& region : module_manager.regions(top_module)) {
+      std::vector<ModuleId> region_children = module_manager.region_configurable_children(top_module, region);
+      std::vector<size_t> region_child_instances = module_manager.region_configurable_child_instances(top_module, region);
+      for (size_t child_id = 0; child_id < region_children.size(); ++child_id) {
+        std::string instance_name = module_manager.instance_name(top_module, region_children[child_id], region_child_instances[child_id]);
+        ConfigBlockId child_block = bitstream_manager.find_child_block(top_block[0], instance_name); 
+        VTR_ASSERT(true == bitstream_manager.valid_block_id(child_block));
+        rec_build_module_fabric_dependent_bitstream(bitstream_manager, child_block,
+                                                    module_manager, region_children[child_id], 
+                                                    fabric_bitstream);
+      }
+    }
+  }
 
   /* Time-consuming sanity check: Uncomment these codes only for debugging!!!
    * Check which configuration bits are not touched 
@@ -133,3 +165,42 @@ std::vector<ConfigBitId> build_fabric_dependent_bitstream(const BitstreamManager
   
   return fabric_bitstream;
 }
+
+/********************************************************************
+ * Find the number of configuration bits in each configuration region
+ * of the top module. The fabric bitstream built by 
+ * build_fabric_dependent_bitstream() is a concatenation of the regions
+ * in the same sequence as returned here.
+ * If the top module has no regions, the whole fabric is a single region 
+ *******************************************************************/
+std::vector<size_t> find_fabric_bitstream_region_sizes(const BitstreamManager& bitstream_manager,
+                                                       const ModuleManager& module_manager) {
+  std::vector<size_t> region_sizes;
+
+  std::string top_module_name = generate_fpga_top_module_name();
+  ModuleId top_module = module_manager.find_module(top_module_name);
+  VTR_ASSERT(true == module_manager.valid_module_id(top_module));
+
+  if (0 == module_manager.regions(top_module).size()) {
+    region_sizes.push_back(bitstream_manager.bits().size());
+    return region_sizes;
+  }
+
+  std::vector<ConfigBlockId> top_block = find_bitstream_manager_top_blocks(bitstream_manager);
+  VTR_ASSERT(1 == top_block.size());
+
+  for (const ConfigRegionId& region : module_manager.regions(top_module)) {
+    std::vector<ModuleId> region_children = module_manager.region_configurable_children(top_module, region);
+    std::vector<size_t> region_child_instances = module_manager.region_configurable_child_instances(top_module, region);
+    size_t region_size = 0;
+    for (size_t child_id = 0; child_id < region_children.size(); ++child_id) {
+      std::string instance_name = module_manager.instance_name(top_module, region_children[child_id], region_child_instances[child_id]);
+      ConfigBlockId child_block = bitstream_manager.find_child_block(top_block[0], instance_name); 
+      VTR_ASSERT(true == bitstream_manager.valid_block_id(child_block));
+      region_size += rec_find_block_num_config_bits(bitstream_manager, child_block);
+    }
+    region_sizes.push_back(region_size);
+  }
+
+  return region_sizes;
+}
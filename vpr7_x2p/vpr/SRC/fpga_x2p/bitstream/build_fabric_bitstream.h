@@ -8,4 +8,7 @@
 std::vector<ConfigBitId> build_fabric_dependent_bitstream(const BitstreamManager& bitstream_manager,
                                                           const ModuleManager& module_manager);
 
+std::vector<size_t> find_fabric_bitstream_region_sizes(const BitstreamManager& bitstream_manager,
+                                                       const ModuleManager& module_manager);
+
 #endif
@@ -63,7 +63,7 @@ std::vector<bool> build_cmos_mux_bitstream(const CircuitLibrary& circuit_lib,
   size_t implemented_mux_size = find_mux_implementation_num_inputs(circuit_lib, mux_model, mux_size);
   /* Note that the mux graph is indexed using datapath MUX size!!!! */
   MuxId mux_graph_id = mux_lib.mux_graph(mux_model, mux_size);
-  const MuxGraph mux_graph = mux_lib.mux_graph(mux_graph_id);
+  const MuxGraph& mux_graph = mux_lib.mux_graph(mux_graph_id);
 
   size_t datapath_id = path_id;
 
@@ -79,7 +79,7 @@ std::vector<bool> build_cmos_mux_bitstream(const CircuitLibrary& circuit_lib,
   VTR_ASSERT(1 == mux_graph.outputs().size());
 
   /* Generate the memory bits */
-  vtr::vector<MuxMemId, bool> raw_bitstream = mux_graph.decode_memory_bits(MuxInputId(datapath_id), mux_graph.output_id(mux_graph.outputs()[0]));
+  vtr::vector<MuxMemId, bool> raw_bitstream = mux_graph.decode_memory_bits(MuxInputId(datapath_id), mux_graph.output_id(*mux_graph.outputs().begin()));
 
   std::vector<bool> mux_bitstream;
   for (const bool& bit : raw_bitstream) {
@@ -105,27 +105,29 @@ std::vector<bool> build_cmos_mux_bitstream(const CircuitLibrary& circuit_lib,
     std::vector<size_t> encoder_data;
 
     /* Exception: there is only 1 memory at this level, bitstream will not be changed!!! */
-    if (1 == mux_graph.memories_at_level(level).size()) {
-      mux_bitstream.push_back(raw_bitstream[mux_graph.memories_at_level(level)[0]]);
+    if (1 == mux_graph.num_memory_bits_at_level(level)) {
+      mux_bitstream.push_back(raw_bitstream[*mux_graph.memories_at_level(level).begin()]);
       continue;
     }
 
     /* Otherwise: we follow a regular recipe */
-    for (size_t mem_index = 0; mem_index < mux_graph.memories_at_level(level).size(); ++mem_index) {
+    size_t mem_index = 0;
+    for (const MuxMemId& mem : mux_graph.memories_at_level(level)) {
       /* Conversion rule: true = 1, false = 0 */
-      if (true == raw_bitstream[mux_graph.memories_at_level(level)[mem_index]]) {
+      if (true == raw_bitstream[mem]) {
         encoder_data.push_back(mem_index);
       } 
+      mem_index++;
     }
     /* There should be at most one '1' */
     VTR_ASSERT( (0 == encoder_data.size()) || (1 == encoder_data.size()));
     /* Convert to encoded bits */
     std::vector<size_t> encoder_addr;
     if (0 == encoder_data.size()) { 
-      encoder_addr = my_itobin_vec(0, find_mux_local_decoder_addr_size(mux_graph.memories_at_level(level).size()));
+      encoder_addr = my_itobin_vec(0, find_mux_local_decoder_addr_size(mux_graph.num_memory_bits_at_level(level)));
     } else {
       VTR_ASSERT(1 == encoder_data.size());
-      encoder_addr = my_itobin_vec(encoder_data[0], find_mux_local_decoder_addr_size(mux_graph.memories_at_level(level).size()));
+      encoder_addr = my_itobin_vec(encoder_data[0], find_mux_local_decoder_addr_size(mux_graph.num_memory_bits_at_level(level)));
     }
     /* Build final mux bitstream */
     for (const size_t& bit : encoder_addr) {
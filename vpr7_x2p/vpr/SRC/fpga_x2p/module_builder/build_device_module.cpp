@@ -126,7 +126,9 @@ ModuleManager build_device_module_graph(const t_vpr_setup& vpr_setup,
                    clb2clb_directs, 
                    arch.sram_inf.verilog_sram_inf_orgz->type, sram_model, 
                    TRUE == vpr_setup.FPGA_SPICE_Opts.compact_routing_hierarchy,
-                   TRUE == vpr_setup.FPGA_SPICE_Opts.duplicate_grid_pin);
+                   TRUE == vpr_setup.FPGA_SPICE_Opts.duplicate_grid_pin,
+                   vpr_setup.FPGA_SPICE_Opts.config_chain_order,
+                   (size_t)vpr_setup.FPGA_SPICE_Opts.num_config_chains);
 
   /* Now a critical correction has to be done!
    * In the module construction, we always use prefix of ports because they are binded
@@ -161,21 +161,21 @@ void build_cmos_mux_branch_body(ModuleManager& module_manager,
       /* Add module nets to connect the mux input and tgate input */
       module_manager.add_module_net_sink(mux_module, mux_input_nets[size_t(mux_graph.input_id(mux_input))], tgate_module_id, tgate_instance, tgate_module_input, tgate_module_input_port.get_lsb());
 
-      /* if there is a connection between the input and output, a tgate will be outputted */
-      std::vector<MuxEdgeId> edges = mux_graph.find_edges(mux_input, mux_output);
-      /* There should be only one edge or no edge*/
-      VTR_ASSERT((1 == edges.size()) || (0 == edges.size()));
+      /* if there is a connection between the input and output, a tgate will be outputted 
+       * There should be only one edge or no edge
+       */
+      MuxEdgeId edge = mux_graph.find_edge(mux_input, mux_output);
       /* No need to output tgates if there are no edges between two nodes */
-      if (0 == edges.size()) {
+      if (MuxEdgeId::INVALID() == edge) {
         continue;
       }
 
       /* Add module nets to connect the mux output and tgate output */
       module_manager.add_module_net_source(mux_module, mux_output_nets[size_t(mux_graph.output_id(mux_output))], tgate_module_id, tgate_instance, tgate_module_output, tgate_module_output_port.get_lsb());
 
-      MuxMemId mux_mem = mux_graph.find_edge_mem(edges[0]);
+      MuxMemId mux_mem = mux_graph.find_edge_mem(edge);
       /* Add module nets to connect the mem input and tgate mem input */
-      if (false == mux_graph.is_edge_use_inv_mem(edges[0])) {
+      if (false == mux_graph.is_edge_use_inv_mem(edge)) {
         /* wire mem to mem of module, and wire mem_inv to mem_inv of module */
         module_manager.add_module_net_sink(mux_module, mux_mem_nets[size_t(mux_mem)], tgate_module_id, tgate_instance, tgate_module_mem, tgate_module_mem_port.get_lsb());
         module_manager.add_module_net_sink(mux_module, mux_mem_inv_nets[size_t(mux_mem)], tgate_module_id, tgate_instance, tgate_module_mem_inv, tgate_module_mem_inv_port.get_lsb());
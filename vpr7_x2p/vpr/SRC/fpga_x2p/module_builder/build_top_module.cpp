@@ -293,7 +293,9 @@ void build_top_module(ModuleManager& module_manager,
                       const e_sram_orgz& sram_orgz_type,
                       const CircuitModelId& sram_model,
                       const bool& compact_routing_hierarchy,
-                      const bool& duplicate_grid_pin) {
+                      const bool& duplicate_grid_pin,
+                      const e_config_chain_order& config_chain_order,
+                      const size_t& num_config_chains) {
   /* Start time count */
   clock_t t_start = clock();
 
@@ -346,22 +348,26 @@ void build_top_module(ModuleManager& module_manager,
     add_reserved_sram_ports_to_module_manager(module_manager, top_module, module_num_shared_config_bits);
   }
 
+  /* Organize the list of memory modules and instances 
+   * This should be done before adding SRAM ports, 
+   * as the number of configuration regions determines the port size
+   */
+  organize_top_module_memory_modules(module_manager, top_module, 
+                                     circuit_lib, sram_orgz_type, sram_model,
+                                     device_size, grids, grid_instance_ids, 
+                                     L_device_rr_gsb, sb_instance_ids, cb_instance_ids,
+                                     compact_routing_hierarchy,
+                                     config_chain_order, num_config_chains);
+
   /* Add SRAM ports from the sub-modules under this Verilog module
    * This is a much easier job after adding sub modules (instances), 
    * we just need to find all the I/O ports from the child modules and build a list of it
    */
   size_t module_num_config_bits = find_module_num_config_bits_from_child_modules(module_manager, top_module, circuit_lib, sram_model, sram_orgz_type); 
   if (0 < module_num_config_bits) {
-    add_sram_ports_to_module_manager(module_manager, top_module, circuit_lib, sram_model, sram_orgz_type, module_num_config_bits);
+    add_top_module_sram_ports(module_manager, top_module, circuit_lib, sram_model, sram_orgz_type, module_num_config_bits);
   }
 
-  /* Organize the list of memory modules and instances */
-  organize_top_module_memory_modules(module_manager, top_module, 
-                                     circuit_lib, sram_orgz_type, sram_model,
-                                     device_size, grids, grid_instance_ids, 
-                                     L_device_rr_gsb, sb_instance_ids, cb_instance_ids,
-                                     compact_routing_hierarchy);
-
   /* Add module nets to connect memory cells inside
    * This is a one-shot addition that covers all the memory modules in this pb module!
    */
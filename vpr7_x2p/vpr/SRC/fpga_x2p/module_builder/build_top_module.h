@@ -21,6 +21,8 @@ void build_top_module(ModuleManager& module_manager,
                       const e_sram_orgz& sram_orgz_type,
                       const CircuitModelId& sram_model,
                       const bool& compact_routing_hierarchy,
-                      const bool& duplicate_grid_pin);
+                      const bool& duplicate_grid_pin,
+                      const e_config_chain_order& config_chain_order,
+                      const size_t& num_config_chains);
 
 #endif
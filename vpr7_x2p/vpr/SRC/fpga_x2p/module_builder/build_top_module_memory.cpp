@@ -2,6 +2,9 @@
  * This file includes functions that are used to organize memories 
  * in the top module of FPGA fabric
  *******************************************************************/
+#include <cstdlib>
+#include <algorithm>
+#include <numeric>
 #include "vtr_assert.h"
 
 #include "rr_blocks_utils.h"
@@ -11,9 +14,15 @@
 #include "globals.h"
 #include "verilog_global.h"
 
+#include "fpga_x2p_mem_utils.h"
 #include "module_manager_utils.h"
 #include "build_top_module_memory.h"
 
+/* A tile to be chained, which is the coordinate of the tile 
+ * and the border side of the tile (NUM_SIDES for core tiles) 
+ */
+typedef std::pair<vtr::Point<size_t>, e_side> t_top_module_tile;
+
 /********************************************************************
  * This function adds the CBX/CBY of a tile
  * to the memory modules and memory instances 
@@ -158,6 +167,206 @@ void organize_top_module_tile_memory_modules(ModuleManager& module_manager,
   }
 }
 
+/********************************************************************
+ * Re-order the tiles to be chained so that the distance between 
+ * two neighbouring tiles in the chain is as short as possible.
+ * This is a greedy nearest-neighbour walk starting from the first tile,
+ * which is the tile closest to the configuration chain head.
+ * At each step, we search the unvisited tiles ring by ring 
+ * (in Manhattan distance) around the current tile and pick the first one.
+ * Ties are broken in a fixed order, so that the result is deterministic
+ *******************************************************************/
+static 
+std::vector<t_top_module_tile> sort_top_module_tiles_by_wirelength(const vtr::Point<size_t>& device_size,
+                                                                    const std::vector<t_top_module_tile>& tiles) {
+  std::vector<t_top_module_tile> sorted_tiles;
+  if (true == tiles.empty()) {
+    return sorted_tiles;
+  }
+  sorted_tiles.reserve(tiles.size());
+
+  /* Build a fast look-up from coordinate to tile index */
+  std::vector<std::vector<size_t>> tile_lookup(device_size.x(), std::vector<size_t>(device_size.y(), size_t(-1)));
+  for (size_t itile = 0; itile < tiles.size(); ++itile) {
+    tile_lookup[tiles[itile].first.x()][tiles[itile].first.y()] = itile;
+  }
+  std::vector<bool> tile_visited(tiles.size(), false);
+
+  size_t cur_tile = 0;
+  size_t max_dist = device_size.x() + device_size.y();
+  while (true) {
+    sorted_tiles.push_back(tiles[cur_tile]);
+    tile_visited[cur_tile] = true;
+    if (sorted_tiles.size() == tiles.size()) {
+      break;
+    }
+
+    /* Search the closest unvisited tile */
+    int cur_x = tiles[cur_tile].first.x();
+    int cur_y = tiles[cur_tile].first.y();
+    size_t next_tile = size_t(-1);
+    for (int dist = 1; dist <= (int)max_dist && size_t(-1) == next_tile; ++dist) {
+      for (int dx = -dist; dx <= dist && size_t(-1) == next_tile; ++dx) {
+        int dy = dist - std::abs(dx);
+        int cand_ys[2] = {cur_y - dy, cur_y + dy};
+        for (int icand = 0; icand < ((0 == dy) ? 1 : 2); ++icand) {
+          int x = cur_x + dx;
+          int y = cand_ys[icand];
+          if ( (x < 0) || (y < 0) 
+            || (x >= (int)device_size.x()) || (y >= (int)device_size.y()) ) {
+            continue;
+          }
+          size_t cand_tile = tile_lookup[x][y];
+          if ( (size_t(-1) != cand_tile) && (false == tile_visited[cand_tile]) ) {
+            next_tile = cand_tile;
+            break;
+          }
+        }
+      }
+    }
+    /* There must be a tile left */
+    VTR_ASSERT(size_t(-1) != next_tile);
+    cur_tile = next_tile;
+  }
+
+  return sorted_tiles;
+}
+
+/********************************************************************
+ * Split the configurable children of the top-level module into
+ * a number of configuration regions, each of which will be a 
+ * configuration chain. 
+ * The sequence of configurable children is kept, and each region
+ * takes a contiguous slice of it, so that neighbouring memory modules 
+ * stay in the same chain. The slices are balanced by the number of 
+ * configuration bits, so that the longest chain, which determines
+ * the number of programming clock cycles, is as short as possible.
+ *******************************************************************/
+static 
+void build_top_module_config_regions(ModuleManager& module_manager, 
+                                     const ModuleId& top_module,
+                                     const CircuitLibrary& circuit_lib,
+                                     const e_sram_orgz& sram_orgz_type,
+                                     const CircuitModelId& sram_model,
+                                     const size_t& num_config_chains) {
+  std::vector<ModuleId> children = module_manager.configurable_children(top_module);
+  std::vector<size_t> child_instances = module_manager.configurable_child_instances(top_module);
+
+  /* Nothing to split */
+  if (true == children.empty()) {
+    return;
+  }
+
+  std::vector<size_t> child_num_config_bits;
+  size_t num_config_bits = 0;
+  for (const ModuleId& child : children) {
+    child_num_config_bits.push_back(find_module_num_config_bits(module_manager, child,
+                                                                circuit_lib, sram_model, 
+                                                                sram_orgz_type));
+    num_config_bits += child_num_config_bits.back();
+  }
+
+  /* We cannot have more chains than configurable children */
+  size_t num_regions = std::min(num_config_chains, children.size());
+  if (num_regions < num_config_chains) {
+    vpr_printf(TIO_MESSAGE_WARNING,
+               "Only %lu configurable blocks in the top-level module, reduce the number of configuration chains from %lu to %lu!\n",
+               children.size(), num_config_chains, num_regions);
+  }
+
+  size_t ichild = 0;
+  size_t acc_num_config_bits = 0;
+  for (size_t iregion = 0; iregion < num_regions; ++iregion) {
+    ConfigRegionId region = module_manager.add_config_region(top_module);
+    /* The last region takes all the rest */
+    if (iregion == num_regions - 1) {
+      for (; ichild < children.size(); ++ichild) {
+        module_manager.add_configurable_child_to_region(top_module, region, children[ichild], child_instances[ichild], ichild);
+      }
+      break;
+    }
+    /* Each region has at least one child, and we should leave 
+     * at least one child for each of the remaining regions.
+     * Keep adding children as long as the accumulated number of bits 
+     * gets closer to the target
+     */
+    float target_num_config_bits = (float)num_config_bits * (iregion + 1) / num_regions;
+    size_t num_regions_left = num_regions - iregion - 1;
+    do {
+      module_manager.add_configurable_child_to_region(top_module, region, children[ichild], child_instances[ichild], ichild);
+      acc_num_config_bits += child_num_config_bits[ichild];
+      ++ichild;
+    } while ( (ichild + num_regions_left < children.size())
+           && (acc_num_config_bits + 0.5 * child_num_config_bits[ichild] < target_num_config_bits) );
+  }
+}
+
+/********************************************************************
+ * Report the statistics of configuration chains in the top-level module:
+ * the number of configuration bits of each chain and 
+ * the estimated wirelength of each chain, which is the sum of
+ * Manhattan distance (in the unit of tiles) between neighbouring memory modules  
+ *******************************************************************/
+static 
+void report_top_module_config_chains(const ModuleManager& module_manager, 
+                                     const ModuleId& top_module,
+                                     const CircuitLibrary& circuit_lib,
+                                     const e_sram_orgz& sram_orgz_type,
+                                     const CircuitModelId& sram_model,
+                                     const std::vector<vtr::Point<size_t>>& child_coords) {
+  std::vector<ModuleId> children = module_manager.configurable_children(top_module);
+  VTR_ASSERT(child_coords.size() == children.size());
+
+  /* A module without regions is a single chain */
+  std::vector<std::vector<size_t>> chains;
+  std::vector<size_t> region_child_ids(children.size());
+  if (0 == module_manager.regions(top_module).size()) {
+    for (size_t ichild = 0; ichild < children.size(); ++ichild) {
+      region_child_ids[ichild] = ichild;
+    }
+    chains.push_back(region_child_ids);
+  } else {
+    size_t ichild = 0;
+    for (const ConfigRegionId& region : module_manager.regions(top_module)) {
+      chains.emplace_back();
+      for (size_t irc = 0; irc < module_manager.region_configurable_children(top_module, region).size(); ++irc) {
+        chains.back().push_back(ichild++);
+      }
+    }
+  }
+
+  std::vector<size_t> chain_lengths(chains.size(), 0);
+  std::vector<size_t> chain_wirelengths(chains.size(), 0);
+  for (size_t ichain = 0; ichain < chains.size(); ++ichain) {
+    for (size_t irc = 0; irc < chains[ichain].size(); ++irc) {
+      size_t ichild = chains[ichain][irc];
+      chain_lengths[ichain] += find_module_num_config_bits(module_manager, children[ichild],
+                                                           circuit_lib, sram_model, 
+                                                           sram_orgz_type);
+      if (0 < irc) {
+        const vtr::Point<size_t>& prev_coord = child_coords[chains[ichain][irc - 1]];
+        const vtr::Point<size_t>& cur_coord = child_coords[ichild];
+        chain_wirelengths[ichain] += std::abs((int)cur_coord.x() - (int)prev_coord.x())
+                                   + std::abs((int)cur_coord.y() - (int)prev_coord.y());
+      }
+    }
+  }
+
+  /* Note that the fabric builder is printing a message without a line break */
+  vpr_printf(TIO_MESSAGE_INFO,
+             "\n\tOrganized %lu configurable blocks into %lu configuration region(s): longest region %lu bits, wirelength %lu tiles\n",
+             children.size(), chains.size(), 
+             *std::max_element(chain_lengths.begin(), chain_lengths.end()),
+             std::accumulate(chain_wirelengths.begin(), chain_wirelengths.end(), (size_t)0));
+  if (1 < chains.size()) {
+    for (size_t ichain = 0; ichain < chains.size(); ++ichain) {
+      vpr_printf(TIO_MESSAGE_INFO,
+                 "\tConfiguration region[%lu]: %lu blocks, %lu bits, wirelength %lu tiles\n",
+                 ichain, chains[ichain].size(), chain_lengths[ichain], chain_wirelengths[ichain]);
+    }
+  }
+}
+
 /********************************************************************
  * Organize the list of memory modules and instances
  * This function will record all the sub modules of the top-level module
@@ -168,6 +377,13 @@ void organize_top_module_tile_memory_modules(ModuleManager& module_manager,
  * the sequence of memory_modules and memory_instances will follow
  * a chain of tiles considering their physical location
  *
+ * The default order of tiles is shown below. When the wirelength-driven 
+ * order is selected, the tiles are re-ordered by a nearest-neighbour walk 
+ * starting from the same head. 
+ * When more than one configuration chain is required, the memory modules 
+ * are then split into balanced configuration regions, each of which is
+ * driven by a separated configuration chain head.
+ *
  * Inter tile connection:
  *    +--------------------------------------------------------+
  *    |              +------+------+-----+------+              |
@@ -228,7 +444,9 @@ void organize_top_module_memory_modules(ModuleManager& module_manager,
                                         const DeviceRRGSB& L_device_rr_gsb,
                                         const std::vector<std::vector<size_t>>& sb_instance_ids,
                                         const std::map<t_rr_type, std::vector<std::vector<size_t>>>& cb_instance_ids,
-                                        const bool& compact_routing_hierarchy) {
+                                        const bool& compact_routing_hierarchy,
+                                        const e_config_chain_order& config_chain_order,
+                                        const size_t& num_config_chains) {
   /* Ensure clean vectors to return */
   VTR_ASSERT(true == module_manager.configurable_children(top_module).empty());
 
@@ -275,48 +493,195 @@ void organize_top_module_memory_modules(ModuleManager& module_manager,
     io_coords[LEFT].push_back(vtr::Point<size_t>(0, iy));
   }
 
+  std::vector<t_top_module_tile> tiles;
   for (const e_side& io_side : io_sides) {
     for (const vtr::Point<size_t>& io_coord : io_coords[io_side]) {
-      /* Identify the GSB that surrounds the grid */
-      organize_top_module_tile_memory_modules(module_manager, top_module, 
-                                              circuit_lib, sram_orgz_type, sram_model,
-                                              grids, grid_instance_ids,
-                                              L_device_rr_gsb, sb_instance_ids, cb_instance_ids,
-                                              compact_routing_hierarchy,
-                                              io_coord, io_side);
+      tiles.push_back(t_top_module_tile(io_coord, io_side));
     }
   }
 
   /* For the core grids */
-  std::vector<vtr::Point<size_t>> core_coords;
   bool positive_direction = true;
   for (size_t iy = 1; iy < device_size.y() - 1; ++iy) {
     /* For positive direction: -----> */
     if (true == positive_direction) {
       for (size_t ix = 1; ix < device_size.x() - 1; ++ix) {
-        core_coords.push_back(vtr::Point<size_t>(ix, iy)); 
+        tiles.push_back(t_top_module_tile(vtr::Point<size_t>(ix, iy), NUM_SIDES)); 
       }
     } else {
       VTR_ASSERT(false == positive_direction);
       /* For negative direction: -----> */
       for (size_t ix = device_size.x() - 2; ix >= 1; --ix) {
-        core_coords.push_back(vtr::Point<size_t>(ix, iy)); 
+        tiles.push_back(t_top_module_tile(vtr::Point<size_t>(ix, iy), NUM_SIDES)); 
       }
     }
     /* Flip the positive direction to be negative */
     positive_direction = !positive_direction;
   }
 
-  for (const vtr::Point<size_t>& core_coord : core_coords) {
-    organize_top_module_tile_memory_modules(module_manager, top_module,  
-                                            circuit_lib, sram_orgz_type, sram_model, 
+  /* Re-order the tiles if required */
+  switch (config_chain_order) {
+  case CONFIG_CHAIN_ORDER_SERPENTINE:
+    /* Nothing to do, tiles are already in the serpentine order */
+    break;
+  case CONFIG_CHAIN_ORDER_WIRELENGTH:
+    tiles = sort_top_module_tiles_by_wirelength(device_size, tiles);
+    break;
+  default:
+    vpr_printf(TIO_MESSAGE_ERROR,
+               "(File:%s,[LINE%d])Invalid order of configuration chain!\n",
+               __FILE__, __LINE__);
+    exit(1);
+  }
+
+  /* Add the memory modules tile by tile, 
+   * and record the tile coordinate of each memory module 
+   */
+  std::vector<vtr::Point<size_t>> child_coords;
+  for (const t_top_module_tile& tile : tiles) {
+    /* Identify the GSB that surrounds the grid */
+    organize_top_module_tile_memory_modules(module_manager, top_module, 
+                                            circuit_lib, sram_orgz_type, sram_model,
                                             grids, grid_instance_ids,
                                             L_device_rr_gsb, sb_instance_ids, cb_instance_ids,
                                             compact_routing_hierarchy,
-                                            core_coord, NUM_SIDES);
+                                            tile.first, tile.second);
+    child_coords.resize(module_manager.configurable_children(top_module).size(), tile.first);
   }
+
+  /* Split the memory modules into parallel configuration chains 
+   * Only configuration chain supports multiple regions now
+   */
+  if (1 < num_config_chains) {
+    if (SPICE_SRAM_SCAN_CHAIN == sram_orgz_type) {
+      build_top_module_config_regions(module_manager, top_module, 
+                                      circuit_lib, sram_orgz_type, sram_model,
+                                      num_config_chains);
+    } else {
+      vpr_printf(TIO_MESSAGE_WARNING,
+                 "Multiple configuration chains are only applicable to configuration chain organization! Use a single configuration region instead.\n");
+    }
+  }
+
+  report_top_module_config_chains(module_manager, top_module, 
+                                  circuit_lib, sram_orgz_type, sram_model,
+                                  child_coords);
 }
 
+/********************************************************************
+ * Add the SRAM ports to the top-level module
+ * For configuration chains, the top-level module has one head and
+ * one tail for each configuration region:
+ *   ccff_head[0] ---> region[0] ---> ccff_tail[0]
+ *   ccff_head[1] ---> region[1] ---> ccff_tail[1]
+ *   ...
+ * Otherwise, it follows the same rule as other modules
+ *
+ * Note: this function should be called after organize_top_module_memory_modules()
+ *******************************************************************/
+void add_top_module_sram_ports(ModuleManager& module_manager, 
+                               const ModuleId& top_module,
+                               const CircuitLibrary& circuit_lib,
+                               const CircuitModelId& sram_model,
+                               const e_sram_orgz& sram_orgz_type,
+                               const size_t& num_config_bits) {
+  size_t num_regions = module_manager.regions(top_module).size();
+
+  if ( (SPICE_SRAM_SCAN_CHAIN != sram_orgz_type)
+    || (0 == num_regions) ) {
+    add_sram_ports_to_module_manager(module_manager, top_module, circuit_lib, sram_model, sram_orgz_type, num_config_bits);
+    return;
+  }
+
+  /* Note that configuration chain tail is an output while head is an input 
+   * IMPORTANT: this is co-designed with function generate_sram_port_names()
+   * If the return vector is changed, the following codes MUST be adapted!
+   */
+  std::vector<std::string> sram_port_names = generate_sram_port_names(circuit_lib, sram_model, sram_orgz_type);
+  VTR_ASSERT(2 == sram_port_names.size());
+  module_manager.add_port(top_module, BasicPort(sram_port_names[0], num_regions), ModuleManager::MODULE_INPUT_PORT);
+  module_manager.add_port(top_module, BasicPort(sram_port_names[1], num_regions), ModuleManager::MODULE_OUTPUT_PORT);
+}
+
+/*********************************************************************
+ * Connect the memory modules of each configuration region in a chain
+ * The i-th pin of the head/tail ports of the top-level module
+ * drives/is driven by the chain of the i-th region
+ *
+ *                   +--------+    +--------+            +--------+
+ *  ccff_head[i] --->| Memory |--->| Memory |--->... --->| Memory |----> ccff_tail[i]
+ *                   | Module |    | Module |            | Module |
+ *                   |   [0]  |    |   [1]  |            |  [N-1] |             
+ *                   +--------+    +--------+            +--------+
+ *********************************************************************/
+static 
+void add_top_module_nets_cmos_memory_chain_config_bus_by_region(ModuleManager& module_manager,
+                                                                const ModuleId& parent_module,
+                                                                const e_sram_orgz& sram_orgz_type) {
+  ModulePortId head_port_id = module_manager.find_module_port(parent_module, generate_sram_port_name(sram_orgz_type, SPICE_MODEL_PORT_INPUT)); 
+  ModulePortId tail_port_id = module_manager.find_module_port(parent_module, generate_sram_port_name(sram_orgz_type, SPICE_MODEL_PORT_OUTPUT)); 
+  BasicPort head_port = module_manager.module_port(parent_module, head_port_id);
+  BasicPort tail_port = module_manager.module_port(parent_module, tail_port_id);
+  /* Each region should have a head and a tail */
+  VTR_ASSERT(head_port.get_width() == module_manager.regions(parent_module).size());
+  VTR_ASSERT(tail_port.get_width() == module_manager.regions(parent_module).size());
+
+  std::string child_head_port_name = generate_configuration_chain_head_name();
+  std::string child_tail_port_name = generate_configuration_chain_tail_name();
+
+  size_t region_index = 0;
+  for (const ConfigRegionId& region : module_manager.regions(parent_module)) {
+    std::vector<ModuleId> children = module_manager.region_configurable_children(parent_module, region);
+    std::vector<size_t> child_instances = module_manager.region_configurable_child_instances(parent_module, region);
+    VTR_ASSERT(false == children.empty());
+
+    /* Source of the next net: the head of the region */
+    ModuleId net_src_module_id = parent_module; 
+    size_t net_src_instance_id = 0;
+    ModulePortId net_src_port_id = head_port_id;
+    size_t net_src_pin = head_port.pins()[region_index];
+
+    for (size_t mem_index = 0; mem_index <= children.size(); ++mem_index) {
+      ModuleId net_sink_module_id;
+      size_t net_sink_instance_id;
+      ModulePortId net_sink_port_id;
+      size_t net_sink_pin;
+      if (mem_index < children.size()) {
+        /* Sink is the head of the next memory module */
+        net_sink_module_id = children[mem_index]; 
+        net_sink_instance_id = child_instances[mem_index];
+        net_sink_port_id = module_manager.find_module_port(net_sink_module_id, child_head_port_name); 
+        /* Configuration chain head of a memory module is a 1-bit port */
+        VTR_ASSERT(1 == module_manager.module_port(net_sink_module_id, net_sink_port_id).get_width());
+        net_sink_pin = module_manager.module_port(net_sink_module_id, net_sink_port_id).pins()[0];
+      } else {
+        /* Sink is the tail of the region */
+        net_sink_module_id = parent_module; 
+        net_sink_instance_id = 0;
+        net_sink_port_id = tail_port_id;
+        net_sink_pin = tail_port.pins()[region_index];
+      }
+
+      /* Create a net and add source and sink to it */
+      ModuleNetId net = module_manager.create_module_net(parent_module);
+      module_manager.add_module_net_source(parent_module, net, net_src_module_id, net_src_instance_id, net_src_port_id, net_src_pin);
+      module_manager.add_module_net_sink(parent_module, net, net_sink_module_id, net_sink_instance_id, net_sink_port_id, net_sink_pin);
+
+      if (mem_index == children.size()) {
+        break;
+      }
+
+      /* The tail of this memory module drives the next net */
+      net_src_module_id = net_sink_module_id;
+      net_src_instance_id = net_sink_instance_id;
+      net_src_port_id = module_manager.find_module_port(net_src_module_id, child_tail_port_name); 
+      VTR_ASSERT(1 == module_manager.module_port(net_src_module_id, net_src_port_id).get_width());
+      net_src_pin = module_manager.module_port(net_src_module_id, net_src_port_id).pins()[0];
+    }
+
+    ++region_index;
+  }
+}
 
 /*********************************************************************
  * Add the port-to-port connection between all the memory modules 
@@ -371,7 +736,12 @@ void add_top_module_nets_cmos_memory_config_bus(ModuleManager& module_manager,
     /* Nothing to do */
     break;
   case SPICE_SRAM_SCAN_CHAIN: {
-    add_module_nets_cmos_memory_chain_config_bus(module_manager, parent_module, SPICE_SRAM_SCAN_CHAIN);
+    /* Multiple configuration chains when configuration regions are defined */
+    if (0 < module_manager.regions(parent_module).size()) {
+      add_top_module_nets_cmos_memory_chain_config_bus_by_region(module_manager, parent_module, SPICE_SRAM_SCAN_CHAIN);
+    } else {
+      add_module_nets_cmos_memory_chain_config_bus(module_manager, parent_module, SPICE_SRAM_SCAN_CHAIN);
+    }
     break;
   }
   case SPICE_SRAM_MEMORY_BANK:
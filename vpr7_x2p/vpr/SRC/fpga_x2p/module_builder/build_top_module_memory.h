@@ -3,6 +3,7 @@
 
 #include <vector>
 #include <map>
+#include "vpr_types.h"
 #include "module_manager.h"
 #include "spice_types.h"
 #include "circuit_library.h"
@@ -19,7 +20,16 @@ void organize_top_module_memory_modules(ModuleManager& module_manager,
                                         const DeviceRRGSB& L_device_rr_gsb,
                                         const std::vector<std::vector<size_t>>& sb_instance_ids,
                                         const std::map<t_rr_type, std::vector<std::vector<size_t>>>& cb_instance_ids,
-                                        const bool& compact_routing_hierarchy);
+                                        const bool& compact_routing_hierarchy,
+                                        const e_config_chain_order& config_chain_order,
+                                        const size_t& num_config_chains);
+
+void add_top_module_sram_ports(ModuleManager& module_manager, 
+                               const ModuleId& top_module,
+                               const CircuitLibrary& circuit_lib,
+                               const CircuitModelId& sram_model,
+                               const e_sram_orgz& sram_orgz_type,
+                               const size_t& num_config_bits);
 
 void add_top_module_nets_memory_config_bus(ModuleManager& module_manager,
                                            const ModuleId& parent_module,
@@ -1,3 +1,4 @@
+#include <string.h>
 /* Include vpr structs*/
 #include "util.h"
 #include "arch_types.h"
@@ -33,6 +34,32 @@ boolean shell_setup_fpga_x2p_setup(t_shell_env* env, t_opt_info* opts) {
   env->vpr_setup.FPGA_SPICE_Opts.sim_window_size = get_opt_float_val(opts, "sim_window_size", 0.5);
   env->vpr_setup.FPGA_SPICE_Opts.compact_routing_hierarchy = is_opt_set(opts, "compact_routing_hierarchy", FALSE);
 
+  env->vpr_setup.FPGA_SPICE_Opts.num_config_chains = get_opt_int_val(opts, "num_config_chains", 1);
+  if (1 > env->vpr_setup.FPGA_SPICE_Opts.num_config_chains) {
+    vpr_printf(TIO_MESSAGE_ERROR, 
+               "Invalid number of configuration chains (%d)! Expect a positive integer.\n",
+               env->vpr_setup.FPGA_SPICE_Opts.num_config_chains);
+    return FALSE;
+  }
+
+  env->vpr_setup.FPGA_SPICE_Opts.config_chain_order = CONFIG_CHAIN_ORDER_SERPENTINE; /* DEFAULT */
+  char* temp = get_opt_val(opts, "config_chain_order");
+  if (NULL != temp) {
+    if (0 == strcmp(temp, "serpentine")) {
+      env->vpr_setup.FPGA_SPICE_Opts.config_chain_order = CONFIG_CHAIN_ORDER_SERPENTINE;
+    } else if (0 == strcmp(temp, "wirelength")) {
+      env->vpr_setup.FPGA_SPICE_Opts.config_chain_order = CONFIG_CHAIN_ORDER_WIRELENGTH;
+    } else {
+      vpr_printf(TIO_MESSAGE_ERROR, 
+                 "Invalid configuration chain order (%s)! Expect serpentine|wirelength.\n",
+                 temp);
+      my_free(temp);
+      return FALSE;
+    }
+  }
+  /* Free */
+  my_free(temp);
+
   return TRUE;
 }
 
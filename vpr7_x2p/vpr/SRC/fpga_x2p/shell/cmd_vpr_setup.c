@@ -191,7 +191,7 @@ void shell_setup_vpr_arch(t_shell_env* env, t_opt_info* opts) {
   return;
 }
 
-void shell_setup_vpr_timing(t_shell_env* env) {
+void shell_setup_vpr_timing(t_shell_env* env, t_opt_info* opts) {
   /* Don't do anything if they don't want timing */
   if (FALSE == env->vpr_setup.TimingEnabled) {
     memset(&(env->vpr_setup.Timing), 0, sizeof(t_timing_inf));
@@ -206,6 +206,13 @@ void shell_setup_vpr_timing(t_shell_env* env) {
   /* If the user specified an SDC filename on the command line, look for specified_name.sdc, otherwise look for circuit_name.sdc*/
   env->vpr_setup.Timing.SDCFile = env->vpr_setup.FileNameOpts.SDCFile;
 
+  env->vpr_setup.Timing.num_workers = get_opt_int_val(opts, "timing_num_workers", 1); /* DEFAULT */
+  if (1 > env->vpr_setup.Timing.num_workers) {
+    vpr_printf(TIO_MESSAGE_ERROR, "--timing_num_workers must be at least 1 (got %d).\n",
+               env->vpr_setup.Timing.num_workers);
+    exit(1);
+  }
+
   return;
 }
 
@@ -249,7 +256,7 @@ void shell_execute_vpr_setup(t_shell_env* env,
 
   /* VPR setup timing */
   vpr_printf(TIO_MESSAGE_INFO, "Setting up timing engine...\n");
-  shell_setup_vpr_timing(env);
+  shell_setup_vpr_timing(env, opts);
  
   /* init global variables */
   vpr_printf(TIO_MESSAGE_INFO, "Setting up some global variables...\n");
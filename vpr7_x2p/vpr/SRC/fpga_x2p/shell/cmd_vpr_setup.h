@@ -7,6 +7,7 @@ t_opt_info setup_vpr_opts[] = {
   {"activity_file", "--activity_file", 0, OPT_WITHVAL, OPT_CHAR, OPT_OPT, OPT_NONDEF, "Specify the activity file for input benchmark in purpose of power estimation"},
   {"power_properties", "--power_properties", 0, OPT_WITHVAL, OPT_CHAR, OPT_OPT, OPT_NONDEF, "Specify the power property XML for power estimation"},
   {"timing_analysis", "--timing_analysis", 0, OPT_NONVAL, OPT_CHAR, OPT_OPT, OPT_NONDEF, "Specify if timing-driven and timing analysis should be enabled"},
+  {"timing_num_workers", "--timing_num_workers", 0, OPT_WITHVAL, OPT_INT, OPT_OPT, OPT_NONDEF, "Specify the number of threads used by timing analysis"},
   {"out_file_prefix", "--out_file_prefix", 0, OPT_WITHVAL, OPT_CHAR, OPT_OPT, OPT_NONDEF, "Specify the prefix of files to be "},
   {"net_file", "--net_file", 0, OPT_WITHVAL, OPT_CHAR, OPT_OPT, OPT_NONDEF, "Specify the netlist outputted by packers"},
   {"place_file", "--place_file", 0, OPT_WITHVAL, OPT_CHAR, OPT_OPT, OPT_NONDEF, "Specify the netlist outputted by placers"},
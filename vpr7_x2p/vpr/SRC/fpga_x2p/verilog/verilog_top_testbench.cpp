@@ -6,12 +6,14 @@
 #include <ctime>
 #include <iomanip>
 #include <algorithm>
+#include <numeric>
 
 #include "vtr_assert.h"
 #include "device_port.h"
 #include "util.h"
 
 #include "bitstream_manager_utils.h"
+#include "build_fabric_bitstream.h"
 
 #include "fpga_x2p_naming.h"
 #include "fpga_x2p_utils.h"
@@ -42,20 +44,22 @@ constexpr char* TOP_TESTBENCH_ERROR_COUNTER = "nb_error";
 
 /********************************************************************
  * Print local wires for configuration chain protocols
+ * Each configuration chain has its own head and tail
  *******************************************************************/
 static 
-void print_verilog_top_testbench_config_chain_port(std::fstream& fp) {
+void print_verilog_top_testbench_config_chain_port(std::fstream& fp,
+                                                   const size_t& num_config_chains) {
   /* Validate the file stream */
   check_file_handler(fp);
 
   /* Print the head of configuraion-chains here */
   print_verilog_comment(fp, std::string("---- Configuration-chain head -----"));
-  BasicPort config_chain_head_port(generate_configuration_chain_head_name(), 1);
+  BasicPort config_chain_head_port(generate_configuration_chain_head_name(), num_config_chains);
   fp << generate_verilog_port(VERILOG_PORT_REG, config_chain_head_port) << ";" << std::endl;
 
   /* Print the tail of configuration-chains here */
   print_verilog_comment(fp, std::string("---- Configuration-chain tail -----"));
-  BasicPort config_chain_tail_port(generate_configuration_chain_tail_name(), 1);
+  BasicPort config_chain_tail_port(generate_configuration_chain_tail_name(), num_config_chains);
   fp << generate_verilog_port(VERILOG_PORT_WIRE, config_chain_tail_port) << ";" << std::endl;
 }
 
@@ -64,13 +68,14 @@ void print_verilog_top_testbench_config_chain_port(std::fstream& fp) {
  *******************************************************************/
 static 
 void print_verilog_top_testbench_config_protocol_port(std::fstream& fp,
-                                                      const e_sram_orgz& sram_orgz_type) {
+                                                      const e_sram_orgz& sram_orgz_type,
+                                                      const size_t& num_config_regions) {
   switch(sram_orgz_type) {
   case SPICE_SRAM_STANDALONE:
     /* TODO */
     break;
   case SPICE_SRAM_SCAN_CHAIN:
-    print_verilog_top_testbench_config_chain_port(fp);
+    print_verilog_top_testbench_config_chain_port(fp, num_config_regions);
     break;
   case SPICE_SRAM_MEMORY_BANK:
     /* TODO */
@@ -291,6 +296,7 @@ void print_verilog_top_testbench_ports(std::fstream& fp,
                                        const std::vector<t_logical_block>& L_logical_blocks,
                                        const std::vector<std::string>& clock_port_names,
                                        const e_sram_orgz& sram_orgz_type,
+                                       const size_t& num_config_regions,
                                        const std::string& circuit_name){
   /* Validate the file stream */
   check_file_handler(fp);
@@ -352,7 +358,7 @@ void print_verilog_top_testbench_ports(std::fstream& fp,
   fp << generate_verilog_port(VERILOG_PORT_REG, set_port) << ";" << std::endl;
 
   /* Configuration ports depend on the organization of SRAMs */
-  print_verilog_top_testbench_config_protocol_port(fp, sram_orgz_type);
+  print_verilog_top_testbench_config_protocol_port(fp, sram_orgz_type, num_config_regions);
 
   /* Create a clock port if the benchmark have one but not in the default name! 
    * We will wire the clock directly to the operating clock directly
@@ -433,17 +439,18 @@ void print_verilog_top_testbench_benchmark_instance(std::fstream& fp,
  * Print tasks (processes) in Verilog format, 
  * which is very useful in generating stimuli for each clock cycle 
  * This function is tuned for configuration-chain manipulation: 
- * During each programming cycle, we feed the input of scan chain with a memory bit
+ * During each programming cycle, we feed the input of each scan chain with a memory bit
  *******************************************************************/
 static 
-void print_verilog_top_testbench_load_bitstream_task_configuration_chain(std::fstream& fp) {
+void print_verilog_top_testbench_load_bitstream_task_configuration_chain(std::fstream& fp,
+                                                                         const size_t& num_config_chains) {
 
   /* Validate the file stream */
   check_file_handler(fp);
 
   BasicPort prog_clock_port(std::string(top_tb_prog_clock_port_name), 1);
-  BasicPort cc_head_port(generate_configuration_chain_head_name(), 1);
-  BasicPort cc_head_value(generate_configuration_chain_head_name() + std::string("_val"), 1);
+  BasicPort cc_head_port(generate_configuration_chain_head_name(), num_config_chains);
+  BasicPort cc_head_value(generate_configuration_chain_head_name() + std::string("_val"), num_config_chains);
 
   /* Add an empty line as splitter */
   fp << std::endl;
@@ -474,12 +481,13 @@ void print_verilog_top_testbench_load_bitstream_task_configuration_chain(std::fs
  *******************************************************************/
 static 
 void print_verilog_top_testbench_load_bitstream_task(std::fstream& fp,
-                                                     const e_sram_orgz& sram_orgz_type) {
+                                                     const e_sram_orgz& sram_orgz_type,
+                                                     const size_t& num_config_regions) {
   switch (sram_orgz_type) {
   case SPICE_SRAM_STANDALONE:
     break;
   case SPICE_SRAM_SCAN_CHAIN:
-    print_verilog_top_testbench_load_bitstream_task_configuration_chain(fp);
+    print_verilog_top_testbench_load_bitstream_task_configuration_chain(fp, num_config_regions);
     break;
   case SPICE_SRAM_MEMORY_BANK:
     /* TODO: 
@@ -641,7 +649,8 @@ void print_verilog_top_testbench_generic_stimulus(std::fstream& fp,
 static 
 void print_verilog_top_testbench_configuration_chain_bitstream(std::fstream& fp,
                                                                const BitstreamManager& bitstream_manager,
-                                                               const std::vector<ConfigBitId>& fabric_bitstream) {
+                                                               const std::vector<ConfigBitId>& fabric_bitstream,
+                                                               const std::vector<size_t>& config_chain_lengths) {
   /* Validate the file stream */
   check_file_handler(fp);
 
@@ -651,7 +660,7 @@ void print_verilog_top_testbench_configuration_chain_bitstream(std::fstream& fp,
    * We do not care the value of scan_chain head during the first programming cycle 
    * It is reset anyway
    */
-  BasicPort config_chain_head_port(generate_configuration_chain_head_name(), 1);
+  BasicPort config_chain_head_port(generate_configuration_chain_head_name(), config_chain_lengths.size());
   std::vector<size_t> initial_values(config_chain_head_port.get_width(), 0);
 
   print_verilog_comment(fp, "----- Begin bitstream loading during configuration phase -----");
@@ -666,12 +675,32 @@ void print_verilog_top_testbench_configuration_chain_bitstream(std::fstream& fp,
 
   /* Attention: the configuration chain protcol requires the last configuration bit is fed first
    * We will visit the fabric bitstream in a reverse way  
+   *
+   * The fabric bitstream is a concatenation of the bitstreams of all the chains.
+   * All the chains are loaded in parallel, and the shorter chains are
+   * padded with leading zeros so that all the chains complete at the same cycle
    */
-  std::vector<ConfigBitId> cc_bitstream = fabric_bitstream;
-  std::reverse(cc_bitstream.begin(), cc_bitstream.end());
-  for (const ConfigBitId& bit_id : cc_bitstream) {
+  VTR_ASSERT(fabric_bitstream.size() == std::accumulate(config_chain_lengths.begin(), config_chain_lengths.end(), (size_t)0));
+  size_t max_chain_length = *std::max_element(config_chain_lengths.begin(), config_chain_lengths.end());
+  std::vector<size_t> chain_offsets(config_chain_lengths.size(), 0);
+  for (size_t ichain = 1; ichain < config_chain_lengths.size(); ++ichain) {
+    chain_offsets[ichain] = chain_offsets[ichain - 1] + config_chain_lengths[ichain - 1]; 
+  }
+
+  std::vector<size_t> cycle_values(config_chain_lengths.size(), 0);
+  for (size_t icycle = 0; icycle < max_chain_length; ++icycle) {
+    for (size_t ichain = 0; ichain < config_chain_lengths.size(); ++ichain) {
+      size_t num_padding_bits = max_chain_length - config_chain_lengths[ichain];
+      if (icycle < num_padding_bits) {
+        cycle_values[ichain] = 0;
+        continue;
+      }
+      /* The last bit of a chain goes first */
+      size_t bit_index = chain_offsets[ichain] + config_chain_lengths[ichain] - 1 - (icycle - num_padding_bits);
+      cycle_values[ichain] = (size_t)bitstream_manager.bit_value(fabric_bitstream[bit_index]);
+    }
     fp << "\t\t" << std::string(TOP_TESTBENCH_CC_PROG_TASK_NAME);
-    fp << "(1'b" << (size_t)bitstream_manager.bit_value(bit_id) << ");" << std::endl;
+    fp << "(" << generate_verilog_constant_values(cycle_values) << ");" << std::endl;
   }
 
   /* Raise the flag of configuration done when bitstream loading is complete */
@@ -700,14 +729,15 @@ static
 void print_verilog_top_testbench_bitstream(std::fstream& fp,
                                            const e_sram_orgz& sram_orgz_type,
                                            const BitstreamManager& bitstream_manager,
-                                           const std::vector<ConfigBitId>& fabric_bitstream) {
+                                           const std::vector<ConfigBitId>& fabric_bitstream,
+                                           const std::vector<size_t>& config_region_sizes) {
   /* Branch on the type of configuration protocol */
   switch (sram_orgz_type) {
   case SPICE_SRAM_STANDALONE:
     /* TODO */
     break;
   case SPICE_SRAM_SCAN_CHAIN:
-    print_verilog_top_testbench_configuration_chain_bitstream(fp, bitstream_manager, fabric_bitstream);
+    print_verilog_top_testbench_configuration_chain_bitstream(fp, bitstream_manager, fabric_bitstream, config_region_sizes);
     break;
   case SPICE_SRAM_MEMORY_BANK:
     /* TODO */
@@ -782,10 +812,15 @@ void print_verilog_top_testbench(const ModuleManager& module_manager,
   /* Preparation: find all the clock ports */
   std::vector<std::string> clock_port_names = find_benchmark_clock_port_name(L_logical_blocks);
 
+  /* Preparation: find the number of configuration bits in each configuration region,
+   * which are programmed in parallel 
+   */
+  std::vector<size_t> config_region_sizes = find_fabric_bitstream_region_sizes(bitstream_manager, module_manager);
+
   /* Start of testbench */
   print_verilog_top_testbench_ports(fp, module_manager, top_module, 
                                     L_logical_blocks, clock_port_names,
-                                    sram_orgz_type, circuit_name);
+                                    sram_orgz_type, config_region_sizes.size(), circuit_name);
 
   /* Find the clock period */
   float prog_clock_period = (1./simulation_parameters.stimulate_params.prog_clock_freq);
@@ -793,8 +828,9 @@ void print_verilog_top_testbench(const ModuleManager& module_manager,
   /* Estimate the number of configuration clock cycles 
    * by traversing the linked-list and count the number of SRAM=1 or BL=1&WL=1 in it.
    * We plus 1 additional config clock cycle here because we need to reset everything during the first clock cycle
+   * Configuration regions are programmed in parallel, so only the largest region matters
    */
-  size_t num_config_clock_cycles = 1 + fabric_bitstream.size();
+  size_t num_config_clock_cycles = 1 + *std::max_element(config_region_sizes.begin(), config_region_sizes.end());
 
   /* Generate stimuli for general control signals */
   print_verilog_top_testbench_generic_stimulus(fp,
@@ -826,11 +862,12 @@ void print_verilog_top_testbench(const ModuleManager& module_manager,
                                                  L_logical_blocks);
 
   /* Print tasks used for loading bitstreams */
-  print_verilog_top_testbench_load_bitstream_task(fp, sram_orgz_type);
+  print_verilog_top_testbench_load_bitstream_task(fp, sram_orgz_type, config_region_sizes.size());
 
   /* load bitstream to FPGA fabric in a configuration phase */
   print_verilog_top_testbench_bitstream(fp, sram_orgz_type,
-                                        bitstream_manager, fabric_bitstream);
+                                        bitstream_manager, fabric_bitstream,
+                                        config_region_sizes);
 
   /* Add stimuli for reset, set, clock and iopad signals */
   print_verilog_testbench_random_stimuli(fp, L_logical_blocks, 
@@ -1,6 +1,7 @@
 /*#include <stdlib.h> */
 #include <stdio.h>
 #include <math.h>
+#include <time.h>
 #include <assert.h>
 #include "util.h"
 #include "vpr_types.h"
@@ -100,12 +101,29 @@ typedef struct s_pl_blocks_to_be_moved {
 	t_pl_moved_block * moved_blocks;
 }t_pl_blocks_to_be_moved;
 
+/* Bounding box information of all the nets, stored as a struct of arrays  *
+ * rather than an array of struct s_bb.  Each coordinate is contiguous in  *
+ * memory, so that the cost kernels evaluating a batch of nets can stream  *
+ * through one field at a time instead of striding over whole structs.     *
+ * Every field is indexed as [0...num_nets-1].                             */
+typedef struct s_bb_soa {
+	int *xmin;
+	int *xmax;
+	int *ymin;
+	int *ymax;
+}t_bb_soa;
+
 
 /********************** Variables local to place.c ***************************/
 
 /* Cost of a net, and a temporary cost of a net used during move assessment. */
 static float *net_cost = NULL, *temp_net_cost = NULL; /* [0..num_nets-1] */
 
+/* [0..num_nets-1]. Expected crossing count of each net used by get_net_cost. *
+ * It only depends on the fanout of the net, so it is computed once instead   *
+ * of on every evaluation of the net cost.                                    */
+static float *net_crossing = NULL;
+
 /* legal positions for type */
 typedef struct s_legal_pos {
 	int x;
@@ -152,7 +170,7 @@ static int **net_pin_index = NULL;
  * blocks on each of a net's bounding box (to allow efficient updates),      *
  * respectively.                                                             */
 
-static struct s_bb *bb_coords = NULL, *bb_num_on_edges = NULL;
+static t_bb_soa bb_coords, bb_num_on_edges;
 
 /* Store the information on the blocks to be moved in a swap during     *
  * placement, in the form of array of structs instead of struct with    *
@@ -172,10 +190,19 @@ static float **chanx_place_cost_fac, **chany_place_cost_fac;
 
 /* The following arrays are used by the try_swap function for speed.   */
 /* [0...num_nets-1] */
-static struct s_bb *ts_bb_coord_new = NULL;
-static struct s_bb *ts_bb_edge_new = NULL;
+static t_bb_soa ts_bb_coord_new, ts_bb_edge_new;
 static int *ts_nets_to_update = NULL;
 
+/* Packed operands of the batched net cost evaluation in try_swap. Entry i *
+ * belongs to the net ts_nets_to_update[i].  [0...num_nets-1]              */
+static float *ts_cost_span_x = NULL, *ts_cost_span_y = NULL;
+static float *ts_cost_fac_x = NULL, *ts_cost_fac_y = NULL;
+static float *ts_cost_crossing = NULL, *ts_cost_new = NULL;
+
+/* Pin coordinates of the net whose bounding box is computed from scratch. *
+ * [0...max_net_pins-1]                                                    */
+static int *ts_pin_x = NULL, *ts_pin_y = NULL;
+
 /* The pl_macros array stores all the carry chains placement macros.   *
  * [0...num_pl_macros-1]                                                  */
 static t_pl_macro * pl_macros = NULL;
@@ -189,6 +216,9 @@ static int num_swap_accepted = 0;
 static int num_swap_aborted = 0;
 static int num_ts_called = 0;
 
+/* CPU time spent in the annealer, used to report the swap throughput. */
+static float place_anneal_seconds = 0.;
+
 /* Expected crossing counts for nets with different #'s of pins.  From *
  * ICCAD 94 pp. 690 - 695 (with linear interpolation applied by me).   *
  * Multiplied to bounding box of a net to better estimate wire length  *
@@ -288,19 +318,28 @@ static enum swap_result assess_swap(float delta_c, float t);
 
 static boolean find_to(int x_from, int y_from, t_type_ptr type, float rlim, int *x_to, int *y_to);
 
-static void get_non_updateable_bb(int inet, struct s_bb *bb_coord_new);
+static void get_non_updateable_bb(int inet, t_bb_soa *bb_coord_new);
 
-static void update_bb(int inet, struct s_bb *bb_coord_new,
-		struct s_bb *bb_edge_new, int xold, int yold, int xnew, int ynew);
+static void update_bb(int inet, int xold, int yold, int xnew, int ynew);
 		
 static int find_affected_nets(int *nets_to_update);
 
-static float get_net_cost(int inet, struct s_bb *bb_ptr);
+static float get_net_cost(int inet, t_bb_soa *bb_ptr);
+
+static float comp_affected_nets_cost(int num_nets_affected);
+
+static void get_bb_from_scratch(int inet, t_bb_soa *coords,
+		t_bb_soa *num_on_edges);
+
+static double get_net_wirelength_estimate(int inet, t_bb_soa *bbptr);
 
-static void get_bb_from_scratch(int inet, struct s_bb *coords,
-		struct s_bb *num_on_edges);
+static void alloc_bb_soa(t_bb_soa *bb, int num_entries);
 
-static double get_net_wirelength_estimate(int inet, struct s_bb *bbptr);
+static void free_bb_soa(t_bb_soa *bb);
+
+static void load_bb_soa_entry(t_bb_soa *bb, int inet, struct s_bb *bb_entry);
+
+static void store_bb_soa_entry(t_bb_soa *bb, int inet, struct s_bb *bb_entry);
 
 static void free_try_swap_arrays(void);
 
@@ -333,6 +372,7 @@ void try_place(struct s_placer_opts placer_opts,
 	float abort_rate;
 	char msg[BUFSIZE];
 	t_slack * slacks = NULL;
+	clock_t anneal_begin, anneal_end;
 
 	/* Allocated here because it goes into timing critical code where each memory allocation is expensive */
 
@@ -446,7 +486,7 @@ void try_place(struct s_placer_opts placer_opts,
 		}
 
 		load_timing_graph_net_delays(net_delay);
-		do_timing_analysis(slacks, FALSE, FALSE, FALSE);
+		do_incremental_timing_analysis(slacks, FALSE);
 		load_criticalities(slacks, crit_exponent);
 		if (getEchoEnabled()) {
 			if(isEchoFileEnabled(E_ECHO_INITIAL_PLACEMENT_TIMING_GRAPH))
@@ -503,6 +543,8 @@ void try_place(struct s_placer_opts placer_opts,
 	final_rlim = 1;
 	inverse_delta_rlim = 1 / (first_rlim - final_rlim);
 
+	anneal_begin = clock();
+
 	t = starting_t(&cost, &bb_cost, &timing_cost,
 			old_region_occ_x, old_region_occ_y,
 			annealing_sched, move_lim, rlim,
@@ -562,7 +604,7 @@ void try_place(struct s_placer_opts placer_opts,
 				 *because it accesses point_to_point_delay array */
 
 				load_timing_graph_net_delays(net_delay);
-				do_timing_analysis(slacks, FALSE, FALSE, FALSE);
+				do_incremental_timing_analysis(slacks, FALSE);
 				load_criticalities(slacks, crit_exponent);
 				/*recompute costs from scratch, based on new criticalities */
 				comp_td_costs(&timing_cost, &delay_cost);
@@ -631,7 +673,7 @@ void try_place(struct s_placer_opts placer_opts,
 					 * criticalities; then update the timing cost since it will change.
 					 */
 					load_timing_graph_net_delays(net_delay);
-					do_timing_analysis(slacks, FALSE, FALSE, FALSE);
+					do_incremental_timing_analysis(slacks, FALSE);
 					load_criticalities(slacks, crit_exponent);
 					comp_td_costs(&timing_cost, &delay_cost);
 				}
@@ -752,7 +794,7 @@ void try_place(struct s_placer_opts placer_opts,
 						num_nets);
 
 			load_timing_graph_net_delays(net_delay);
-			do_timing_analysis(slacks, FALSE, FALSE, FALSE);
+			do_incremental_timing_analysis(slacks, FALSE);
 			load_criticalities(slacks, crit_exponent);
 			/*recompute criticaliies */
 			comp_td_costs(&timing_cost, &delay_cost);
@@ -800,7 +842,7 @@ void try_place(struct s_placer_opts placer_opts,
 					}
 
 					load_timing_graph_net_delays(net_delay);
-					do_timing_analysis(slacks, FALSE, FALSE, FALSE);
+					do_incremental_timing_analysis(slacks, FALSE);
 					load_criticalities(slacks, crit_exponent);
 					comp_td_costs(&timing_cost, &delay_cost);
 				}
@@ -818,6 +860,9 @@ void try_place(struct s_placer_opts placer_opts,
 #endif
 	}
 	tot_iter += move_lim;
+
+	anneal_end = clock();
+	place_anneal_seconds = (float) (anneal_end - anneal_begin) / CLOCKS_PER_SEC;
 	success_rat = ((float) success_sum) / move_lim;
 	if (success_sum == 0) {
 		av_cost = cost;
@@ -871,7 +916,7 @@ void try_place(struct s_placer_opts placer_opts,
 		 *the same values that the placer is using*/
 		load_timing_graph_net_delays(net_delay);
 
-		do_timing_analysis(slacks, FALSE, FALSE, FALSE);
+		do_incremental_timing_analysis(slacks, FALSE);
 
 		if (getEchoEnabled()) {
 			if(isEchoFileEnabled(E_ECHO_PLACEMENT_SINK_DELAYS))
@@ -907,6 +952,11 @@ void try_place(struct s_placer_opts placer_opts,
 	vpr_printf(TIO_MESSAGE_INFO, "\tSwap reject rate: %g\n", reject_rate);
 	vpr_printf(TIO_MESSAGE_INFO, "\tSwap accept rate: %g\n", accept_rate);
 	vpr_printf(TIO_MESSAGE_INFO, "\tSwap abort rate: %g\n",	abort_rate);
+	/* Swap throughput of the annealer, including the timing updates in between. */
+	vpr_printf(TIO_MESSAGE_INFO, "Placement annealing took %g seconds.\n", place_anneal_seconds);
+	if (place_anneal_seconds > 0.) {
+		vpr_printf(TIO_MESSAGE_INFO, "\tSwap throughput: %g swaps/sec\n", num_ts_called / place_anneal_seconds);
+	}
 	
 
 #ifdef SPEC
@@ -927,6 +977,73 @@ void try_place(struct s_placer_opts placer_opts,
 	free_try_swap_arrays();
 }
 
+float place_swap_benchmark(struct s_placer_opts placer_opts,
+		t_chan_width_dist chan_width_dist, t_direct_inf *directs,
+		int num_directs, int num_swaps, float t) {
+
+	/* Micro-benchmark of the swap routine.  Places the circuit at random   *
+	 * and times num_swaps calls of try_swap at temperature t, with the     *
+	 * bounding box cost only and the range limit of the first temperature. *
+	 * Returns the number of swaps per second.                              */
+
+	int iswap;
+	float rlim, cost, bb_cost, timing_cost, delay_cost, swaps_per_sec,
+		**old_region_occ_x, **old_region_occ_y;
+	clock_t begin, end;
+
+	num_swap_rejected = 0;
+	num_swap_accepted = 0;
+	num_swap_aborted = 0;
+	num_ts_called = 0;
+
+	placer_opts.place_algorithm = BOUNDING_BOX_PLACE;
+	placer_opts.enable_timing_computations = FALSE;
+
+	init_chan(placer_opts.place_chan_width, chan_width_dist);
+
+	alloc_and_load_placement_structs(
+			placer_opts.place_cost_exp,
+			&old_region_occ_x, &old_region_occ_y, placer_opts,
+			directs, num_directs);
+
+	initial_placement(placer_opts.pad_loc_type, placer_opts.pad_loc_file);
+
+	cost = bb_cost = comp_bb_cost(NORMAL);
+	timing_cost = 0;
+	delay_cost = 0;
+	rlim = (float) std::max(nx + 1, ny + 1);
+
+	begin = clock();
+	for (iswap = 0; iswap < num_swaps; iswap++) {
+		try_swap(t, &cost, &bb_cost, &timing_cost, rlim,
+				old_region_occ_x, old_region_occ_y,
+				BOUNDING_BOX_PLACE, 0., 0., 0., &delay_cost);
+	}
+	end = clock();
+
+	swaps_per_sec = 0.;
+	if (end > begin) {
+		swaps_per_sec = num_swaps / ((float) (end - begin) / CLOCKS_PER_SEC);
+	}
+
+	vpr_printf(TIO_MESSAGE_INFO, "Swap benchmark at t = %g: %d swaps (%d accepted, %d rejected, %d aborted) took %g seconds, %g swaps/sec\n",
+			t, num_swaps, num_swap_accepted, num_swap_rejected, num_swap_aborted,
+			(float) (end - begin) / CLOCKS_PER_SEC, swaps_per_sec);
+
+	/* The incrementally updated cost must match a recomputation */
+	if (fabs(bb_cost - comp_bb_cost(CHECK)) > bb_cost * ERROR_TOL) {
+		vpr_printf(TIO_MESSAGE_ERROR, "in place_swap_benchmark: bb_cost drifted from the recomputed cost.\n");
+		exit(1);
+	}
+
+	free_placement_structs(
+				old_region_occ_x, old_region_occ_y,
+				placer_opts);
+	free_try_swap_arrays();
+
+	return swaps_per_sec;
+}
+
 static int count_connections() {
 	/*only count non-global connections */
 
@@ -1400,11 +1517,9 @@ static enum swap_result try_swap(float t, float *cost, float *bb_cost, float *ti
 				if (clb_net[inet].num_sinks < SMALL_NET) {
 					if(bb_updated_before[inet] == NOT_UPDATED_YET)
 						/* Brute force bounding box recomputation, once only for speed. */
-						get_non_updateable_bb(inet, &ts_bb_coord_new[inet]);
+						get_non_updateable_bb(inet, &ts_bb_coord_new);
 				} else {
-					update_bb(inet, &ts_bb_coord_new[inet],
-							&ts_bb_edge_new[inet], 
-							blocks_affected.moved_blocks[iblk].xold, 
+					update_bb(inet, blocks_affected.moved_blocks[iblk].xold, 
 							blocks_affected.moved_blocks[iblk].yold + block[bnum].type->pin_height[iblk_pin],
 							blocks_affected.moved_blocks[iblk].xnew, 
 							blocks_affected.moved_blocks[iblk].ynew + block[bnum].type->pin_height[iblk_pin]);
@@ -1412,14 +1527,9 @@ static enum swap_result try_swap(float t, float *cost, float *bb_cost, float *ti
 			}
 		}
 			
-		/* Now update the cost function. The cost is only updated once for every net  *
-		 * May have to do major optimizations here later.                             */
-		for (inet_affected = 0; inet_affected < num_nets_affected; inet_affected++) {
-			inet = ts_nets_to_update[inet_affected];
-
-			temp_net_cost[inet] = get_net_cost(inet, &ts_bb_coord_new[inet]);
-			bb_delta_c += temp_net_cost[inet] - net_cost[inet];
-		}
+		/* Now update the cost function. The cost is only updated once for every net, *
+		 * and all the affected nets are evaluated together as one batch.             */
+		bb_delta_c = comp_affected_nets_cost(num_nets_affected);
 
 		if (place_algorithm == NET_TIMING_DRIVEN_PLACE
 				|| place_algorithm == PATH_TIMING_DRIVEN_PLACE) {
@@ -1456,9 +1566,16 @@ static enum swap_result try_swap(float t, float *cost, float *bb_cost, float *ti
 			for (inet_affected = 0; inet_affected < num_nets_affected; inet_affected++) {
 				inet = ts_nets_to_update[inet_affected];
 
-				bb_coords[inet] = ts_bb_coord_new[inet];
-				if (clb_net[inet].num_sinks >= SMALL_NET)
-					bb_num_on_edges[inet] = ts_bb_edge_new[inet];
+				bb_coords.xmin[inet] = ts_bb_coord_new.xmin[inet];
+				bb_coords.xmax[inet] = ts_bb_coord_new.xmax[inet];
+				bb_coords.ymin[inet] = ts_bb_coord_new.ymin[inet];
+				bb_coords.ymax[inet] = ts_bb_coord_new.ymax[inet];
+				if (clb_net[inet].num_sinks >= SMALL_NET) {
+					bb_num_on_edges.xmin[inet] = ts_bb_edge_new.xmin[inet];
+					bb_num_on_edges.xmax[inet] = ts_bb_edge_new.xmax[inet];
+					bb_num_on_edges.ymin[inet] = ts_bb_edge_new.ymin[inet];
+					bb_num_on_edges.ymax[inet] = ts_bb_edge_new.ymax[inet];
+				}
 			
 				net_cost[inet] = temp_net_cost[inet];
 
@@ -1950,17 +2067,16 @@ static float comp_bb_cost(enum cost_methods method) {
 			 * so they can use a fast bounding box calculator.                    */
 
 			if (clb_net[inet].num_sinks >= SMALL_NET && method == NORMAL) {
-				get_bb_from_scratch(inet, &bb_coords[inet],
-						&bb_num_on_edges[inet]);
+				get_bb_from_scratch(inet, &bb_coords, &bb_num_on_edges);
 			} else {
-				get_non_updateable_bb(inet, &bb_coords[inet]);
+				get_non_updateable_bb(inet, &bb_coords);
 			}
 
-			net_cost[inet] = get_net_cost(inet, &bb_coords[inet]);
+			net_cost[inet] = get_net_cost(inet, &bb_coords);
 			cost += net_cost[inet];
 			if (method == CHECK)
 				expected_wirelength += get_net_wirelength_estimate(inet,
-						&bb_coords[inet]);
+						&bb_coords);
 		}
 	}
 
@@ -2012,8 +2128,9 @@ static void free_placement_structs(
 
 	free(net_cost);
 	free(temp_net_cost);
-	free(bb_num_on_edges);
-	free(bb_coords);
+	free(net_crossing);
+	free_bb_soa(&bb_num_on_edges);
+	free_bb_soa(&bb_coords);
 	
 	free_placement_macros_structs();
 	
@@ -2023,8 +2140,7 @@ static void free_placement_structs(
 	
 	net_cost = NULL; /* Defensive coding. */
 	temp_net_cost = NULL;
-	bb_num_on_edges = NULL;
-	bb_coords = NULL;
+	net_crossing = NULL;
 	pl_macros = NULL;
 
 	/* Frees up all the data structure used in vpr_utils. */
@@ -2107,8 +2223,20 @@ static void alloc_and_load_placement_structs(
 		temp_net_cost[inet] = -1.;
 	}
 	
-	bb_coords = (struct s_bb *) my_malloc(num_nets * sizeof(struct s_bb));
-	bb_num_on_edges = (struct s_bb *) my_malloc(num_nets * sizeof(struct s_bb));
+	/* Get the expected "crossing count" of a net, based on its number *
+	 * of pins.  Extrapolate for very large nets.                      */
+	net_crossing = (float *) my_malloc(num_nets * sizeof(float));
+	for (inet = 0; inet < num_nets; inet++) {
+		if ((clb_net[inet].num_sinks + 1) > 50) {
+			net_crossing[inet] = 2.7933 + 0.02616 * ((clb_net[inet].num_sinks + 1) - 50);
+			/*    crossing = 3.0;    Old value  */
+		} else {
+			net_crossing[inet] = cross_count[(clb_net[inet].num_sinks + 1) - 1];
+		}
+	}
+
+	alloc_bb_soa(&bb_coords, num_nets);
+	alloc_bb_soa(&bb_num_on_edges, num_nets);
 
 	/* Shouldn't use them; crash hard if I do!   */
 	*old_region_occ_x = NULL;
@@ -2124,13 +2252,27 @@ static void alloc_and_load_placement_structs(
 }
 
 static void alloc_and_load_try_swap_structs() {
+	int inet, max_net_pins;
+
 	/* Allocate the local bb_coordinate storage, etc. only once. */
 	/* Allocate with size num_nets for any number of nets affected. */
-	ts_bb_coord_new = (struct s_bb *) my_calloc(
-			num_nets, sizeof(struct s_bb));
-	ts_bb_edge_new = (struct s_bb *) my_calloc(
-			num_nets, sizeof(struct s_bb));
+	alloc_bb_soa(&ts_bb_coord_new, num_nets);
+	alloc_bb_soa(&ts_bb_edge_new, num_nets);
 	ts_nets_to_update = (int *) my_calloc(num_nets, sizeof(int));
+
+	ts_cost_span_x = (float *) my_calloc(num_nets, sizeof(float));
+	ts_cost_span_y = (float *) my_calloc(num_nets, sizeof(float));
+	ts_cost_fac_x = (float *) my_calloc(num_nets, sizeof(float));
+	ts_cost_fac_y = (float *) my_calloc(num_nets, sizeof(float));
+	ts_cost_crossing = (float *) my_calloc(num_nets, sizeof(float));
+	ts_cost_new = (float *) my_calloc(num_nets, sizeof(float));
+
+	max_net_pins = 1;
+	for (inet = 0; inet < num_nets; inet++) {
+		max_net_pins = std::max(max_net_pins, clb_net[inet].num_sinks + 1);
+	}
+	ts_pin_x = (int *) my_calloc(max_net_pins, sizeof(int));
+	ts_pin_y = (int *) my_calloc(max_net_pins, sizeof(int));
 		
 	/* Allocate with size num_blocks for any number of moved block. */
 	blocks_affected.moved_blocks = (t_pl_moved_block*)my_calloc(
@@ -2139,95 +2281,75 @@ static void alloc_and_load_try_swap_structs() {
 	
 }
 
-static void get_bb_from_scratch(int inet, struct s_bb *coords,
-		struct s_bb *num_on_edges) {
+static void get_bb_from_scratch(int inet, t_bb_soa *coords,
+		t_bb_soa *num_on_edges) {
 
 	/* This routine finds the bounding box of each net from scratch (i.e.    *
 	 * from only the block location information).  It updates both the       *
 	 * coordinate and number of pins on each edge information.  It         *
-	 * should only be called when the bounding box information is not valid. */
+	 * should only be called when the bounding box information is not valid. *
+	 * The pin coordinates are gathered into ts_pin_x/ts_pin_y first, so the  *
+	 * min/max reductions and the edge counts below are branch-free loops    *
+	 * over contiguous arrays that the compiler can vectorize.               */
 
 	int ipin, bnum, pnum, x, y, xmin, xmax, ymin, ymax;
 	int xmin_edge, xmax_edge, ymin_edge, ymax_edge;
 	int n_pins;
 
 	n_pins = clb_net[inet].num_sinks + 1;
-	
-	bnum = clb_net[inet].node_block[0];
-	pnum = clb_net[inet].node_block_pin[0];
-
-	x = block[bnum].x;
-	y = block[bnum].y + block[bnum].type->pin_height[pnum];
 
-	x = std::max(std::min(x, nx), 1);
-	y = std::max(std::min(y, ny), 1);
-
-	xmin = x;
-	ymin = y;
-	xmax = x;
-	ymax = y;
-	xmin_edge = 1;
-	ymin_edge = 1;
-	xmax_edge = 1;
-	ymax_edge = 1;
-
-	for (ipin = 1; ipin < n_pins; ipin++) {
+	/* Code below counts IO blocks as being within the 1..nx, 1..ny clb array. *
+	 * This is because channels do not go out of the 0..nx, 0..ny range, and   *
+	 * I always take all channels impinging on the bounding box to be within   *
+	 * that bounding box.  Hence, this "movement" of IO blocks does not affect *
+	 * the which channels are included within the bounding box, and it         *
+	 * simplifies the code a lot.                                              */
+	for (ipin = 0; ipin < n_pins; ipin++) {
 		bnum = clb_net[inet].node_block[ipin];
 		pnum = clb_net[inet].node_block_pin[ipin];
 		x = block[bnum].x;
 		y = block[bnum].y + block[bnum].type->pin_height[pnum];
 
-		/* Code below counts IO blocks as being within the 1..nx, 1..ny clb array. *
-		 * This is because channels do not go out of the 0..nx, 0..ny range, and   *
-		 * I always take all channels impinging on the bounding box to be within   *
-		 * that bounding box.  Hence, this "movement" of IO blocks does not affect *
-		 * the which channels are included within the bounding box, and it         *
-		 * simplifies the code a lot.                                              */
-
-		x = std::max(std::min(x, nx), 1);
-		y = std::max(std::min(y, ny), 1);
+		ts_pin_x[ipin] = std::max(std::min(x, nx), 1);
+		ts_pin_y[ipin] = std::max(std::min(y, ny), 1);
+	}
 
-		if (x == xmin) {
-			xmin_edge++;
-		}
-		if (x == xmax) { /* Recall that xmin could equal xmax -- don't use else */
-			xmax_edge++;
-		} else if (x < xmin) {
-			xmin = x;
-			xmin_edge = 1;
-		} else if (x > xmax) {
-			xmax = x;
-			xmax_edge = 1;
-		}
+	xmin = ts_pin_x[0];
+	ymin = ts_pin_y[0];
+	xmax = ts_pin_x[0];
+	ymax = ts_pin_y[0];
+	for (ipin = 1; ipin < n_pins; ipin++) {
+		xmin = std::min(xmin, ts_pin_x[ipin]);
+		xmax = std::max(xmax, ts_pin_x[ipin]);
+		ymin = std::min(ymin, ts_pin_y[ipin]);
+		ymax = std::max(ymax, ts_pin_y[ipin]);
+	}
 
-		if (y == ymin) {
-			ymin_edge++;
-		}
-		if (y == ymax) {
-			ymax_edge++;
-		} else if (y < ymin) {
-			ymin = y;
-			ymin_edge = 1;
-		} else if (y > ymax) {
-			ymax = y;
-			ymax_edge = 1;
-		}
+	xmin_edge = 0;
+	ymin_edge = 0;
+	xmax_edge = 0;
+	ymax_edge = 0;
+	for (ipin = 0; ipin < n_pins; ipin++) {
+		xmin_edge += (ts_pin_x[ipin] == xmin);
+		xmax_edge += (ts_pin_x[ipin] == xmax);
+		ymin_edge += (ts_pin_y[ipin] == ymin);
+		ymax_edge += (ts_pin_y[ipin] == ymax);
 	}
 
 	/* Copy the coordinates and number on edges information into the proper   *
 	 * structures.                                                            */
-	coords->xmin = xmin;
-	coords->xmax = xmax;
-	coords->ymin = ymin;
-	coords->ymax = ymax;
-
-	num_on_edges->xmin = xmin_edge;
-	num_on_edges->xmax = xmax_edge;
-	num_on_edges->ymin = ymin_edge;
-	num_on_edges->ymax = ymax_edge;
+	coords->xmin[inet] = xmin;
+	coords->xmax[inet] = xmax;
+	coords->ymin[inet] = ymin;
+	coords->ymax[inet] = ymax;
+
+	num_on_edges->xmin[inet] = xmin_edge;
+	num_on_edges->xmax[inet] = xmax_edge;
+	num_on_edges->ymin[inet] = ymin_edge;
+	num_on_edges->ymax[inet] = ymax_edge;
 }
 
-static double get_net_wirelength_estimate(int inet, struct s_bb *bbptr) {
+static double get_net_wirelength_estimate(int inet, t_bb_soa *bbptr) {
 
 	/* WMF: Finds the estimate of wirelength due to one net by looking at   *
 	 * its coordinate bounding box.                                         */
@@ -2255,29 +2377,25 @@ static double get_net_wirelength_estimate(int inet, struct s_bb *bbptr) {
 	/* Cost = wire length along channel * cross_count / average      *
 	 * channel capacity.   Do this for x, then y direction and add.  */
 
-	ncost = (bbptr->xmax - bbptr->xmin + 1) * crossing;
+	ncost = (bbptr->xmax[inet] - bbptr->xmin[inet] + 1) * crossing;
 
-	ncost += (bbptr->ymax - bbptr->ymin + 1) * crossing;
+	ncost += (bbptr->ymax[inet] - bbptr->ymin[inet] + 1) * crossing;
 
 	return (ncost);
 }
 
-static float get_net_cost(int inet, struct s_bb *bbptr) {
+static float get_net_cost(int inet, t_bb_soa *bbptr) {
 
 	/* Finds the cost due to one net by looking at its coordinate bounding  *
-	 * box.                                                                 */
-
-	float ncost, crossing;
+	 * box.  Must stay in sync with comp_affected_nets_cost.                */
 
-	/* Get the expected "crossing count" of a net, based on its number *
-	 * of pins.  Extrapolate for very large nets.                      */
+	float ncost;
+	int xmin, xmax, ymin, ymax;
 
-	if ((clb_net[inet].num_sinks + 1) > 50) {
-		crossing = 2.7933 + 0.02616 * ((clb_net[inet].num_sinks + 1) - 50);
-		/*    crossing = 3.0;    Old value  */
-	} else {
-		crossing = cross_count[(clb_net[inet].num_sinks + 1) - 1];
-	}
+	xmin = bbptr->xmin[inet];
+	xmax = bbptr->xmax[inet];
+	ymin = bbptr->ymin[inet];
+	ymax = bbptr->ymax[inet];
 
 	/* Could insert a check for xmin == xmax.  In that case, assume  *
 	 * connection will be made with no bends and hence no x-cost.    *
@@ -2286,16 +2404,62 @@ static float get_net_cost(int inet, struct s_bb *bbptr) {
 	/* Cost = wire length along channel * cross_count / average      *
 	 * channel capacity.   Do this for x, then y direction and add.  */
 
-	ncost = (bbptr->xmax - bbptr->xmin + 1) * crossing
-			* chanx_place_cost_fac[bbptr->ymax][bbptr->ymin - 1];
+	ncost = (xmax - xmin + 1) * net_crossing[inet]
+			* chanx_place_cost_fac[ymax][ymin - 1];
 
-	ncost += (bbptr->ymax - bbptr->ymin + 1) * crossing
-			* chany_place_cost_fac[bbptr->xmax][bbptr->xmin - 1];
+	ncost += (ymax - ymin + 1) * net_crossing[inet]
+			* chany_place_cost_fac[xmax][xmin - 1];
 
 	return (ncost);
 }
 
-static void get_non_updateable_bb(int inet, struct s_bb *bb_coord_new) {
+static float comp_affected_nets_cost(int num_nets_affected) {
+
+	/* Evaluates get_net_cost for all the nets in ts_nets_to_update, using  *
+	 * their new bounding boxes in ts_bb_coord_new, stores the results in   *
+	 * temp_net_cost and returns the change in bounding box cost.           *
+	 * The work is split in three passes: the irregular lookups (bounding   *
+	 * boxes and channel cost factors) are gathered into packed arrays,     *
+	 * the cost arithmetic then runs as a straight loop over those arrays   *
+	 * that the compiler turns into SIMD code, and the costs are finally    *
+	 * scattered back.  The delta is summed in net order, so the result is  *
+	 * exactly the one of the per-net evaluation.                           */
+
+	int inet_affected, inet, xmin, xmax, ymin, ymax;
+	float bb_delta_c;
+
+	for (inet_affected = 0; inet_affected < num_nets_affected; inet_affected++) {
+		inet = ts_nets_to_update[inet_affected];
+		xmin = ts_bb_coord_new.xmin[inet];
+		xmax = ts_bb_coord_new.xmax[inet];
+		ymin = ts_bb_coord_new.ymin[inet];
+		ymax = ts_bb_coord_new.ymax[inet];
+
+		ts_cost_span_x[inet_affected] = (float) (xmax - xmin + 1);
+		ts_cost_span_y[inet_affected] = (float) (ymax - ymin + 1);
+		ts_cost_fac_x[inet_affected] = chanx_place_cost_fac[ymax][ymin - 1];
+		ts_cost_fac_y[inet_affected] = chany_place_cost_fac[xmax][xmin - 1];
+		ts_cost_crossing[inet_affected] = net_crossing[inet];
+	}
+
+	for (inet_affected = 0; inet_affected < num_nets_affected; inet_affected++) {
+		ts_cost_new[inet_affected] = ts_cost_span_x[inet_affected] * ts_cost_crossing[inet_affected]
+				* ts_cost_fac_x[inet_affected];
+		ts_cost_new[inet_affected] += ts_cost_span_y[inet_affected] * ts_cost_crossing[inet_affected]
+				* ts_cost_fac_y[inet_affected];
+	}
+
+	bb_delta_c = 0.;
+	for (inet_affected = 0; inet_affected < num_nets_affected; inet_affected++) {
+		inet = ts_nets_to_update[inet_affected];
+		temp_net_cost[inet] = ts_cost_new[inet_affected];
+		bb_delta_c += temp_net_cost[inet] - net_cost[inet];
+	}
+
+	return (bb_delta_c);
+}
+
+static void get_non_updateable_bb(int inet, t_bb_soa *bb_coord_new) {
 
 	/* Finds the bounding box of a net and stores its coordinates in the  *
 	 * bb_coord_new data structure.  This routine should only be called   *
@@ -2344,29 +2508,30 @@ static void get_non_updateable_bb(int inet, struct s_bb *bb_coord_new) {
 	 * clip to 1 in both directions as well (since minimum channel index *
 	 * is 0).  See route.c for a channel diagram.                        */
 
-	bb_coord_new->xmin = std::max(std::min(xmin, nx), 1);
-	bb_coord_new->ymin = std::max(std::min(ymin, ny), 1);
-	bb_coord_new->xmax = std::max(std::min(xmax, nx), 1);
-	bb_coord_new->ymax = std::max(std::min(ymax, ny), 1);
+	bb_coord_new->xmin[inet] = std::max(std::min(xmin, nx), 1);
+	bb_coord_new->ymin[inet] = std::max(std::min(ymin, ny), 1);
+	bb_coord_new->xmax[inet] = std::max(std::min(xmax, nx), 1);
+	bb_coord_new->ymax[inet] = std::max(std::min(ymax, ny), 1);
 }
 
-static void update_bb(int inet, struct s_bb *bb_coord_new,
-		struct s_bb *bb_edge_new, int xold, int yold, int xnew, int ynew) {
+static void update_bb(int inet, int xold, int yold, int xnew, int ynew) {
 
 	/* Updates the bounding box of a net by storing its coordinates in    *
-	 * the bb_coord_new data structure and the number of blocks on each   *
-	 * edge in the bb_edge_new data structure.  This routine should only  *
-	 * be called for large nets, since it has some overhead relative to   *
-	 * just doing a brute force bounding box calculation.  The bounding   *
-	 * box coordinate and edge information for inet must be valid before  *
-	 * this routine is called.                                            *
+	 * ts_bb_coord_new and the number of blocks on each edge in           *
+	 * ts_bb_edge_new.  This routine should only be called for large      *
+	 * nets, since it has some overhead relative to just doing a brute    *
+	 * force bounding box calculation.  The bounding box coordinate and   *
+	 * edge information for inet must be valid before this routine is    *
+	 * called.                                                            *
 	 * Currently assumes channels on both sides of the CLBs forming the   *
 	 * edges of the bounding box can be used.  Essentially, I am assuming *
 	 * the pins always lie on the outside of the bounding box.            *
 	 * The x and y coordinates are the pin's x and y coordinates.         */
 	/* IO blocks are considered to be one cell in for simplicity.         */
 	
-	struct s_bb *curr_bb_edge, *curr_bb_coord;
+	struct s_bb curr_bb_edge_buf, curr_bb_coord_buf, bb_edge_new_buf, bb_coord_new_buf;
+	struct s_bb *curr_bb_edge = &curr_bb_edge_buf, *curr_bb_coord = &curr_bb_coord_buf;
+	struct s_bb *bb_edge_new = &bb_edge_new_buf, *bb_coord_new = &bb_coord_new_buf;
 		
 	xnew = std::max(std::min(xnew, nx), 1);
 	ynew = std::max(std::min(ynew, ny), 1);
@@ -2380,14 +2545,14 @@ static void update_bb(int inet, struct s_bb *bb_coord_new,
 	}
 	else if (bb_updated_before[inet] == NOT_UPDATED_YET)
 	{	/* The net had NOT been updated before, could use the old values */
-		curr_bb_coord = &bb_coords[inet];
-		curr_bb_edge = &bb_num_on_edges[inet];
+		load_bb_soa_entry(&bb_coords, inet, curr_bb_coord);
+		load_bb_soa_entry(&bb_num_on_edges, inet, curr_bb_edge);
 		bb_updated_before[inet] = UPDATED_ONCE;
 	}
 	else
 	{	/* The net had been updated before, must use the new values */
-		curr_bb_coord = bb_coord_new;
-		curr_bb_edge = bb_edge_new;
+		load_bb_soa_entry(&ts_bb_coord_new, inet, curr_bb_coord);
+		load_bb_soa_entry(&ts_bb_edge_new, inet, curr_bb_edge);
 	}
 
 	/* Check if I can update the bounding box incrementally. */
@@ -2398,7 +2563,7 @@ static void update_bb(int inet, struct s_bb *bb_coord_new,
 
 		if (xold == curr_bb_coord->xmax) { /* Old position at xmax. */
 			if (curr_bb_edge->xmax == 1) {
-				get_bb_from_scratch(inet, bb_coord_new, bb_edge_new);
+				get_bb_from_scratch(inet, &ts_bb_coord_new, &ts_bb_edge_new);
 				bb_updated_before[inet] = GOT_FROM_SCRATCH;
 				return;
 			} else {
@@ -2437,7 +2602,7 @@ static void update_bb(int inet, struct s_bb *bb_coord_new,
 
 		if (xold == curr_bb_coord->xmin) { /* Old position at xmin. */
 			if (curr_bb_edge->xmin == 1) {
-				get_bb_from_scratch(inet, bb_coord_new, bb_edge_new);
+				get_bb_from_scratch(inet, &ts_bb_coord_new, &ts_bb_edge_new);
 				bb_updated_before[inet] = GOT_FROM_SCRATCH;
 				return;
 			} else {
@@ -2484,7 +2649,7 @@ static void update_bb(int inet, struct s_bb *bb_coord_new,
 
 		if (yold == curr_bb_coord->ymax) { /* Old position at ymax. */
 			if (curr_bb_edge->ymax == 1) {
-				get_bb_from_scratch(inet, bb_coord_new, bb_edge_new);
+				get_bb_from_scratch(inet, &ts_bb_coord_new, &ts_bb_edge_new);
 				bb_updated_before[inet] = GOT_FROM_SCRATCH;
 				return;
 			} else {
@@ -2522,7 +2687,7 @@ static void update_bb(int inet, struct s_bb *bb_coord_new,
 
 		if (yold == curr_bb_coord->ymin) { /* Old position at ymin. */
 			if (curr_bb_edge->ymin == 1) {
-				get_bb_from_scratch(inet, bb_coord_new, bb_edge_new);
+				get_bb_from_scratch(inet, &ts_bb_coord_new, &ts_bb_edge_new);
 				bb_updated_before[inet] = GOT_FROM_SCRATCH;
 				return;
 			} else {
@@ -2561,10 +2726,49 @@ static void update_bb(int inet, struct s_bb *bb_coord_new,
 		bb_edge_new->ymax = curr_bb_edge->ymax;
 	}
 
+	store_bb_soa_entry(&ts_bb_coord_new, inet, bb_coord_new);
+	store_bb_soa_entry(&ts_bb_edge_new, inet, bb_edge_new);
+
 	if (bb_updated_before[inet] == NOT_UPDATED_YET)
 		bb_updated_before[inet] = UPDATED_ONCE;
 }
 
+static void alloc_bb_soa(t_bb_soa *bb, int num_entries) {
+
+	/* Allocates the coordinate arrays of a set of num_entries bounding boxes. */
+
+	bb->xmin = (int *) my_calloc(num_entries, sizeof(int));
+	bb->xmax = (int *) my_calloc(num_entries, sizeof(int));
+	bb->ymin = (int *) my_calloc(num_entries, sizeof(int));
+	bb->ymax = (int *) my_calloc(num_entries, sizeof(int));
+}
+
+static void free_bb_soa(t_bb_soa *bb) {
+	free(bb->xmin);
+	free(bb->xmax);
+	free(bb->ymin);
+	free(bb->ymax);
+
+	bb->xmin = NULL; /* Defensive coding. */
+	bb->xmax = NULL;
+	bb->ymin = NULL;
+	bb->ymax = NULL;
+}
+
+static void load_bb_soa_entry(t_bb_soa *bb, int inet, struct s_bb *bb_entry) {
+	bb_entry->xmin = bb->xmin[inet];
+	bb_entry->xmax = bb->xmax[inet];
+	bb_entry->ymin = bb->ymin[inet];
+	bb_entry->ymax = bb->ymax[inet];
+}
+
+static void store_bb_soa_entry(t_bb_soa *bb, int inet, struct s_bb *bb_entry) {
+	bb->xmin[inet] = bb_entry->xmin;
+	bb->xmax[inet] = bb_entry->xmax;
+	bb->ymin[inet] = bb_entry->ymin;
+	bb->ymax[inet] = bb_entry->ymax;
+}
+
 static void alloc_legal_placements() {
 	int i, j, k;
 
@@ -3167,16 +3371,30 @@ static void print_clb_placement(const char *fname) {
 #endif
 
 static void free_try_swap_arrays(void) {
-	if(ts_bb_coord_new != NULL) {
-		free(ts_bb_coord_new);
-		free(ts_bb_edge_new);
+	if(ts_nets_to_update != NULL) {
+		free_bb_soa(&ts_bb_coord_new);
+		free_bb_soa(&ts_bb_edge_new);
 		free(ts_nets_to_update);
+		free(ts_cost_span_x);
+		free(ts_cost_span_y);
+		free(ts_cost_fac_x);
+		free(ts_cost_fac_y);
+		free(ts_cost_crossing);
+		free(ts_cost_new);
+		free(ts_pin_x);
+		free(ts_pin_y);
 		free(blocks_affected.moved_blocks);
 		free(bb_updated_before);
 		
-		ts_bb_coord_new = NULL;
-		ts_bb_edge_new = NULL;
 		ts_nets_to_update = NULL;
+		ts_cost_span_x = NULL;
+		ts_cost_span_y = NULL;
+		ts_cost_fac_x = NULL;
+		ts_cost_fac_y = NULL;
+		ts_cost_crossing = NULL;
+		ts_cost_new = NULL;
+		ts_pin_x = NULL;
+		ts_pin_y = NULL;
 		blocks_affected.moved_blocks = NULL;
 		blocks_affected.num_moved_blocks = 0;
 		bb_updated_before = NULL;
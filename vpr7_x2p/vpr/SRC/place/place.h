@@ -3,3 +3,7 @@ void try_place(struct s_placer_opts placer_opts,
 		t_chan_width_dist chan_width_dist, struct s_router_opts router_opts,
 		struct s_det_routing_arch det_routing_arch, t_segment_inf * segment_inf,
 		t_timing_inf timing_inf, t_direct_inf *directs, int num_directs);
+
+float place_swap_benchmark(struct s_placer_opts placer_opts,
+		t_chan_width_dist chan_width_dist, t_direct_inf *directs,
+		int num_directs, int num_swaps, float t);
@@ -0,0 +1,62 @@
+/**
+ Placement swap throughput benchmark.
+
+ Reads the architecture and circuit like the regular vpr interface, places
+ the circuit at random and times the swap routine of the annealer, once at
+ an infinite temperature (every legal swap is accepted) and once at zero
+ temperature (only improving swaps are accepted).
+
+ Usage: vpr_place_bench <num_swaps> <vpr arguments>
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <time.h>
+
+#include "vpr_api.h"
+#include "place.h"
+
+int main(int argc, char **argv) {
+  t_options Options;
+  t_arch Arch;
+  t_vpr_setup vpr_setup;
+  int num_swaps;
+  float hot_swaps_per_sec, greedy_swaps_per_sec;
+
+  if (argc < 2 || (num_swaps = atoi(argv[1])) <= 0) {
+    fprintf(stderr, "Usage: %s <num_swaps> <vpr arguments>\n", argv[0]);
+    return 1;
+  }
+
+  /* Read options, architecture, and circuit netlist.
+   * The swap count takes the place of the program name. */
+  vpr_init(argc - 1, argv + 1, &Options, &vpr_setup, &Arch);
+
+  /* If the user requests packing, do packing */
+  if (vpr_setup.PackerOpts.doPacking) {
+    vpr_pack(vpr_setup, Arch);
+  }
+
+  vpr_init_pre_place_and_route(vpr_setup, Arch);
+
+  /* Each run starts from the same random initial placement */
+  my_srandom(vpr_setup.PlacerOpts.seed);
+  hot_swaps_per_sec = place_swap_benchmark(vpr_setup.PlacerOpts, Arch.Chans,
+                                           Arch.Directs, Arch.num_directs,
+                                           num_swaps, HUGE_POSITIVE_FLOAT);
+
+  my_srandom(vpr_setup.PlacerOpts.seed);
+  greedy_swaps_per_sec = place_swap_benchmark(vpr_setup.PlacerOpts, Arch.Chans,
+                                              Arch.Directs, Arch.num_directs,
+                                              num_swaps, 0.);
+
+  vpr_printf(TIO_MESSAGE_INFO, "Swap throughput: %g swaps/sec (t = inf), %g swaps/sec (t = 0)\n",
+             hot_swaps_per_sec, greedy_swaps_per_sec);
+
+  /* free data structures */
+  vpr_free_all(Arch, Options, vpr_setup);
+
+  return 0;
+}
@@ -240,7 +240,7 @@ boolean try_timing_driven_route(struct s_router_opts router_opts,
 	#ifdef HACK_LUT_PIN_SWAPPING
 			do_timing_analysis(slacks, FALSE, TRUE, FALSE);
 	#else
-			do_timing_analysis(slacks, FALSE, FALSE, FALSE);
+			do_incremental_timing_analysis(slacks, FALSE);
 	#endif
 
 			/* Print critical path delay - convert to nanoseconds. */
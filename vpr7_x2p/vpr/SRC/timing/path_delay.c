@@ -2,6 +2,16 @@
 #include <string.h>
 #include <limits.h>
 #include <math.h>
+#include <vector>
+#include <mutex>
+#include <algorithm>
+
+#ifdef VPR_USE_TBB
+#include "tbb/task_arena.h"
+#include "tbb/parallel_for.h"
+#include "tbb/blocked_range.h"
+#endif
+
 #include "util.h"
 #include "vpr_types.h"
 #include "globals.h"
@@ -169,6 +179,69 @@ instead of the equivalent but more convoluted:
 Only use this array if you want the actual edges themselves or the index 
 of the driver tnode. */
 
+static int f_timing_num_workers = 1; 
+/* Number of threads used by the level-parallel timing analysis of post-packed
+netlists. Set from t_timing_inf when the timing graph is built; 1 keeps the
+original serial traversal. */
+
+static int * f_tnode_fanin_offset = NULL; /* [0..num_tnodes] */
+static int * f_tnode_fanin_from = NULL; /* [0..num_timing_edges - 1] */
+static t_tedge ** f_tnode_fanin_edge = NULL; /* [0..num_timing_edges - 1] */
+/* Fanin view of the timing graph, used by the level-parallel traversal so that 
+each tnode can gather its own arrival time instead of having it scattered by its 
+drivers. The in-edges of tnode inode are [f_tnode_fanin_offset[inode]..
+f_tnode_fanin_offset[inode + 1] - 1]; f_tnode_fanin_from gives the driving tnode 
+and f_tnode_fanin_edge the driver's out-edge, whose Tdel is always up to date.
+Built on the first level-parallel analysis and freed with the timing graph. */
+
+static int * f_tnode_level = NULL; /* [0..num_tnodes - 1] level of each tnode in tnodes_at_level */
+static int * f_tnode_driven_net = NULL; /* [0..num_tnodes - 1] net driven by each tnode, or OPEN */
+static std::vector<int> f_timing_sinks; /* tnodes without out-edges */
+/* Built together with the fanin view above. */
+
+#define TIMING_PARALLEL_GRAIN 256 /* Minimum number of tnodes handed to a thread at once */
+
+typedef struct s_constraint_traversal {
+	int source_clock_domain;
+	int sink_clock_domain;
+	float * T_arr; /* [0..num_tnodes - 1] private arrival times of this traversal */
+	float * T_req; /* [0..num_tnodes - 1] private required times of this traversal */
+	float cpd; /* Critical path delay found on this traversal */
+	float least_slack; /* Least slack found on this traversal */
+	float max_Tarr; /* Max of all arrival times, used to relax required times */
+	float criticality_denom; /* Max of all arrival times and the constraint */
+	int num_dangling_nodes;
+} t_constraint_traversal;
+
+typedef struct s_incremental_traversal {
+	std::vector<std::vector<int> > level_queue; /* [0..num_tnode_levels - 1] tnodes to update */
+	std::vector<char> is_queued; /* [0..num_tnodes - 1] */
+	std::vector<int> changed_tnodes; /* tnodes whose T_arr or T_req changed on the last update */
+	boolean is_criticality_denom_changed;
+} t_incremental_traversal;
+
+typedef struct s_incremental_timing {
+	boolean is_valid; /* Do the traversals below match the current timing graph and slacks? */
+	boolean is_seeding; /* Is do_timing_analysis building the traversals below? */
+	boolean is_final_analysis;
+	boolean update_slack;
+	t_slack * slacks;
+	std::vector<t_constraint_traversal> traversals; /* All analysed domain pairs, in the serial order */
+	std::vector<float> T_arr_buffer; /* Storage behind traversals[].T_arr */
+	std::vector<float> T_req_buffer; /* Storage behind traversals[].T_req */
+	std::vector<t_incremental_traversal> scratch; /* [0..traversals.size() - 1] */
+	std::vector<int> dirty_nets; /* Nets whose delays changed since the last analysis */
+	std::vector<char> is_net_dirty; /* [0..num_timing_nets - 1] */
+} t_incremental_timing;
+
+static t_incremental_timing f_incremental_timing;
+/* State kept by do_incremental_timing_analysis between two analyses: the arrival
+and required times of every domain pair, plus the nets whose delays have been 
+changed by load_timing_graph_net_delays since. Any other timing analysis of the
+graph invalidates it. */
+
+#define INCREMENTAL_TIMING_MAX_DIRTY_NET_FRACTION 0.25 /* Above this, a full analysis is cheaper */
+
 /***************** Subroutines local to this module *************************/
 
 static t_slack * alloc_slacks(void);
@@ -187,6 +260,31 @@ static float do_timing_analysis_for_constraint(int source_clock_domain, int sink
 	boolean is_prepacked, boolean is_final_analysis, long * max_critical_input_paths_ptr, 
 	long * max_critical_output_paths_ptr);
 
+static float do_timing_analysis_levelized(t_slack * slacks, boolean is_final_analysis, boolean update_slack);
+
+static void do_timing_analysis_for_constraint_levelized(t_constraint_traversal * traversal, 
+	boolean is_final_analysis);
+
+static float find_levelized_T_arr(const float * T_arr, int inode, boolean * is_reached);
+
+static float find_levelized_T_req(const t_constraint_traversal * traversal, int inode, 
+	boolean is_final_analysis);
+
+static boolean has_valid_fanout_T_req(const float * T_req, int inode);
+
+static void load_constraint_traversal_stats(t_constraint_traversal * traversal);
+
+static void update_constraint_traversal_incrementally(t_constraint_traversal * traversal, 
+	t_incremental_traversal * scratch, boolean is_final_analysis);
+
+static void update_net_slacks_from_traversals(t_slack * slacks, int inet, boolean update_slack);
+
+static void invalidate_incremental_timing(void);
+
+static void alloc_and_load_tnode_fanins(void);
+
+static void free_tnode_fanins(void);
+
 #ifdef PATH_COUNTING
 static void do_path_counting(float criticality_denom);
 #endif
@@ -263,6 +361,15 @@ t_slack * alloc_and_load_timing_graph(t_timing_inf timing_inf) {
 
 	num_sinks = alloc_and_load_timing_graph_levels();
 
+	f_timing_num_workers = std::max(1, timing_inf.num_workers);
+#ifndef VPR_USE_TBB
+	if (f_timing_num_workers > 1) {
+		vpr_printf(TIO_MESSAGE_WARNING, "VPR was built without a parallel execution engine: timing analysis will run on 1 thread instead of %d.\n",
+				f_timing_num_workers);
+		f_timing_num_workers = 1;
+	}
+#endif
+
 	check_timing_graph(num_sinks);
 
 	slacks = alloc_slacks();
@@ -382,8 +489,15 @@ void load_timing_graph_net_delays(float **net_delay) {
 		/* Note that the edges of a tnode corresponding to a CLB or INPAD opin must  *
 		 * be in the same order as the pins of the net driven by the tnode.          */
 
-		for (ipin = 1; ipin < (timing_nets[inet].num_sinks + 1); ipin++)
+		for (ipin = 1; ipin < (timing_nets[inet].num_sinks + 1); ipin++) {
+			/* Remember which nets changed for the next incremental timing analysis */
+			if (f_incremental_timing.is_valid && tedge[ipin - 1].Tdel != net_delay[inet][ipin]
+				&& !f_incremental_timing.is_net_dirty[inet]) {
+				f_incremental_timing.is_net_dirty[inet] = TRUE;
+				f_incremental_timing.dirty_nets.push_back(inet);
+			}
 			tedge[ipin - 1].Tdel = net_delay[inet][ipin];
+		}
 	}
 }
 
@@ -408,6 +522,15 @@ void free_timing_graph(t_slack * slacks) {
 	free(tnode);
 	free(f_net_to_driver_tnode);
 	free_ivec_vector(tnodes_at_level, 0, num_tnode_levels - 1);
+	free_tnode_fanins();
+
+	invalidate_incremental_timing();
+	f_incremental_timing.slacks = NULL;
+	std::vector<t_constraint_traversal>().swap(f_incremental_timing.traversals);
+	std::vector<float>().swap(f_incremental_timing.T_arr_buffer);
+	std::vector<float>().swap(f_incremental_timing.T_req_buffer);
+	std::vector<t_incremental_traversal>().swap(f_incremental_timing.scratch);
+	std::vector<char>().swap(f_incremental_timing.is_net_dirty);
 
 	free(slacks->slack);
 	free(slacks->timing_criticality);
@@ -1715,6 +1838,8 @@ void do_timing_analysis(t_slack * slacks, boolean is_prepacked, boolean do_lut_i
 	long max_critical_output_paths, max_critical_input_paths;
 	t_pb *pb;
 
+	boolean is_levelized = FALSE; /* Run the domain pairs and the levels of the timing graph in parallel? */
+
 #if SLACK_DEFINITION == 'S'
 	float smallest_slack_in_design = HUGE_POSITIVE_FLOAT;
 	/* Shift all slacks upwards by this number if it is negative. */
@@ -1723,6 +1848,12 @@ void do_timing_analysis(t_slack * slacks, boolean is_prepacked, boolean do_lut_i
 	/* Denominator of criticality for shifted - max of all arrival times and all constraints. */
 #endif
 
+	/* Any analysis other than the one seeding do_incremental_timing_analysis
+	makes the kept arrival and required times stale. */
+	if (!f_incremental_timing.is_seeding) {
+		invalidate_incremental_timing();
+	}
+
 	/* Reset LUT input rebalancing. */
 	for (inode = 0; inode < num_tnodes; inode++) {
 		if (tnode[inode].type == TN_PRIMITIVE_OPIN && tnode[inode].pb_graph_pin != NULL) {
@@ -1784,37 +1915,52 @@ void do_timing_analysis(t_slack * slacks, boolean is_prepacked, boolean do_lut_i
 	we update the slacks, timing criticalities and (if necessary) path criticalities or
 	normalized costs used by the clusterer. */
 
-	for (source_clock_domain = 0; source_clock_domain < g_sdc->num_constrained_clocks; source_clock_domain++) {
-		for (sink_clock_domain = 0; sink_clock_domain < g_sdc->num_constrained_clocks; sink_clock_domain++) {
-			if (g_sdc->domain_constraint[source_clock_domain][sink_clock_domain] > NEGATIVE_EPSILON) { /* i.e. != DO_NOT_ANALYSE */
+#ifndef PATH_COUNTING
+	/* Post-packed analyses may use the level-parallel traversal, which gives 
+	bit-identical slacks. It is also the one which keeps the traversals for 
+	do_incremental_timing_analysis. Pre-packed analyses and path counting depend
+	on the visiting order of the serial traversal and always use it. */
+	is_levelized = (boolean) (!is_prepacked && (f_timing_num_workers > 1 || f_incremental_timing.is_seeding));
+#endif
 
-				/* Perform the forward and backward traversal for this constraint. */
-				criticality_denom = do_timing_analysis_for_constraint(source_clock_domain, sink_clock_domain, 
-					is_prepacked, is_final_analysis, &max_critical_input_paths, &max_critical_output_paths);
+	if (is_levelized) {
+		criticality_denom = do_timing_analysis_levelized(slacks, is_final_analysis, update_slack);
+#if SLACK_DEFINITION == 'S'
+		criticality_denom_global = std::max(criticality_denom_global, criticality_denom);
+#endif
+	} else {
+		for (source_clock_domain = 0; source_clock_domain < g_sdc->num_constrained_clocks; source_clock_domain++) {
+			for (sink_clock_domain = 0; sink_clock_domain < g_sdc->num_constrained_clocks; sink_clock_domain++) {
+				if (g_sdc->domain_constraint[source_clock_domain][sink_clock_domain] > NEGATIVE_EPSILON) { /* i.e. != DO_NOT_ANALYSE */
+
+					/* Perform the forward and backward traversal for this constraint. */
+					criticality_denom = do_timing_analysis_for_constraint(source_clock_domain, sink_clock_domain, 
+						is_prepacked, is_final_analysis, &max_critical_input_paths, &max_critical_output_paths);
 #ifdef PATH_COUNTING
-				/* Weight the importance of each net, used in slack calculation. */
-				do_path_counting(criticality_denom);
+					/* Weight the importance of each net, used in slack calculation. */
+					do_path_counting(criticality_denom);
 #endif
 
-				/* Update the slack and criticality for each edge of each net which was  
-				analysed on the most recent traversal and has a lower (slack) or 
-				higher (criticality) value than before. */
-				update_slacks(slacks, source_clock_domain, sink_clock_domain, criticality_denom, update_slack);
+					/* Update the slack and criticality for each edge of each net which was  
+					analysed on the most recent traversal and has a lower (slack) or 
+					higher (criticality) value than before. */
+					update_slacks(slacks, source_clock_domain, sink_clock_domain, criticality_denom, update_slack);
 
 #ifndef PATH_COUNTING
-				/* Update the normalized costs used by the clusterer. */
-				if (is_prepacked) {
-					update_normalized_costs(criticality_denom, max_critical_input_paths, max_critical_output_paths);
-				}
+					/* Update the normalized costs used by the clusterer. */
+					if (is_prepacked) {
+						update_normalized_costs(criticality_denom, max_critical_input_paths, max_critical_output_paths);
+					}
 #endif
 
 #if SLACK_DEFINITION == 'S'
-				/* Set criticality_denom_global to the max of criticality_denom over all traversals. */
-				criticality_denom_global = std::max(criticality_denom_global, criticality_denom);
+					/* Set criticality_denom_global to the max of criticality_denom over all traversals. */
+					criticality_denom_global = std::max(criticality_denom_global, criticality_denom);
 #endif
+				}
 			}
-		}
-	} 
+		} 
+	}
 
 #ifdef PATH_COUNTING
 	/* Normalize path criticalities by the largest value in the 
@@ -2262,6 +2408,778 @@ static float do_timing_analysis_for_constraint(int source_clock_domain, int sink
 	arrival time and the constraint for this domain pair. */
 	return std::max(max_Tarr, g_sdc->domain_constraint[source_clock_domain][sink_clock_domain]);
 }
+/* Run body(begin, end) over the sub-ranges of [begin, end), in parallel if VPR 
+was built with a parallel execution engine and serially otherwise. */
+template <typename T_body>
+static void timing_parallel_for(int begin, int end, int grain, const T_body & body) {
+	if (begin >= end) {
+		return;
+	}
+#ifdef VPR_USE_TBB
+	tbb::parallel_for(tbb::blocked_range<int>(begin, end, grain), 
+		[&](const tbb::blocked_range<int> & range) {
+			body(range.begin(), range.end());
+		});
+#else
+	(void) grain;
+	body(begin, end);
+#endif
+}
+
+static void alloc_and_load_tnode_fanins(void) {
+
+	/* Builds the fanin view of the timing graph used by the level-parallel
+	traversal, together with the level of each tnode, the net it drives and 
+	the list of sinks. Also checks once that the levelization has put exactly 
+	the timing sources on level 0, which the serial traversal re-checks on 
+	every backward traversal. */
+
+	int inode, iedge, to_node, ilevel, i, inet, num_fanins;
+	int * next_fanin;
+	t_tedge * tedge;
+
+	f_tnode_level = (int *) my_malloc(num_tnodes * sizeof(int));
+	for (ilevel = 0; ilevel < num_tnode_levels; ilevel++) {
+		for (i = 0; i < tnodes_at_level[ilevel].nelem; i++) {
+			inode = tnodes_at_level[ilevel].list[i];
+			if ((0 == ilevel) != (tnode[inode].type == TN_INPAD_SOURCE || tnode[inode].type == TN_FF_SOURCE || tnode[inode].type == TN_CONSTANT_GEN_SOURCE)) {
+				vpr_printf(TIO_MESSAGE_ERROR, "Timing graph %s node %s.%s[%d].\n",
+						(0 == ilevel) ? "started on unexpected" : "discovered unexpected edge to",
+						tnode[inode].pb_graph_pin->parent_node->pb_type->name, 
+						tnode[inode].pb_graph_pin->port->name, 
+						tnode[inode].pb_graph_pin->pin_number);
+				vpr_printf(TIO_MESSAGE_ERROR, "This is a VPR internal error, contact VPR development team.\n"); 
+				exit(1);
+			}
+			f_tnode_level[inode] = ilevel;
+		}
+	}
+
+	f_tnode_driven_net = (int *) my_malloc(num_tnodes * sizeof(int));
+	for (inode = 0; inode < num_tnodes; inode++) {
+		f_tnode_driven_net[inode] = OPEN;
+	}
+	for (inet = 0; inet < num_timing_nets; inet++) {
+		f_tnode_driven_net[f_net_to_driver_tnode[inet]] = inet;
+	}
+
+	f_timing_sinks.clear();
+	for (inode = 0; inode < num_tnodes; inode++) {
+		if (0 == tnode[inode].num_edges) {
+			f_timing_sinks.push_back(inode);
+		}
+	}
+
+	f_tnode_fanin_offset = (int *) my_calloc(num_tnodes + 1, sizeof(int));
+	for (inode = 0; inode < num_tnodes; inode++) {
+		tedge = tnode[inode].out_edges;
+		for (iedge = 0; iedge < tnode[inode].num_edges; iedge++) {
+			f_tnode_fanin_offset[tedge[iedge].to_node + 1]++;
+		}
+	}
+	for (inode = 0; inode < num_tnodes; inode++) {
+		f_tnode_fanin_offset[inode + 1] += f_tnode_fanin_offset[inode];
+	}
+
+	num_fanins = f_tnode_fanin_offset[num_tnodes];
+	f_tnode_fanin_from = (int *) my_malloc(std::max(1, num_fanins) * sizeof(int));
+	f_tnode_fanin_edge = (t_tedge **) my_malloc(std::max(1, num_fanins) * sizeof(t_tedge *));
+
+	/* Fanins are stored in the order of their driving tnodes */
+	next_fanin = (int *) my_malloc(num_tnodes * sizeof(int));
+	for (inode = 0; inode < num_tnodes; inode++) {
+		next_fanin[inode] = f_tnode_fanin_offset[inode];
+	}
+	for (inode = 0; inode < num_tnodes; inode++) {
+		tedge = tnode[inode].out_edges;
+		for (iedge = 0; iedge < tnode[inode].num_edges; iedge++) {
+			to_node = tedge[iedge].to_node;
+			f_tnode_fanin_from[next_fanin[to_node]] = inode;
+			f_tnode_fanin_edge[next_fanin[to_node]] = &tedge[iedge];
+			next_fanin[to_node]++;
+		}
+	}
+	free(next_fanin);
+}
+
+static void free_tnode_fanins(void) {
+	free(f_tnode_fanin_offset);
+	free(f_tnode_fanin_from);
+	free(f_tnode_fanin_edge);
+	free(f_tnode_level);
+	free(f_tnode_driven_net);
+	f_tnode_fanin_offset = NULL;
+	f_tnode_fanin_from = NULL;
+	f_tnode_fanin_edge = NULL;
+	f_tnode_level = NULL;
+	f_tnode_driven_net = NULL;
+	std::vector<int>().swap(f_timing_sinks);
+}
+
+static float do_timing_analysis_levelized(t_slack * slacks, boolean is_final_analysis, boolean update_slack) {
+
+	/* Post-packed counterpart of the traversal loop in do_timing_analysis. 
+	Up to f_timing_num_workers domain pairs are traversed concurrently, each on 
+	private T_arr/T_req arrays, and the tnodes of each level are split across 
+	threads within a traversal. The results of each pair are then merged in the
+	same order as the serial loop: the arrays are copied into tnode and 
+	update_slacks runs unchanged. Every value merged is a min or a max of the 
+	same floating-point terms as in the serial traversal, so slacks and 
+	criticalities are bit-identical, and tnode ends up holding the arrival and 
+	required times of the last pair, as before. When seeding the incremental 
+	analysis, the arrays of all pairs are kept in f_incremental_timing. 
+	Returns the max of the criticality denominators of all pairs. */
+
+	int source_clock_domain, sink_clock_domain, ipair, first_pair, last_pair, num_buffers;
+	float max_criticality_denom = HUGE_NEGATIVE_FLOAT;
+	std::vector<t_constraint_traversal> traversals;
+	std::vector<float> T_arr_buffer, T_req_buffer;
+
+	for (source_clock_domain = 0; source_clock_domain < g_sdc->num_constrained_clocks; source_clock_domain++) {
+		for (sink_clock_domain = 0; sink_clock_domain < g_sdc->num_constrained_clocks; sink_clock_domain++) {
+			if (g_sdc->domain_constraint[source_clock_domain][sink_clock_domain] > NEGATIVE_EPSILON) { /* i.e. != DO_NOT_ANALYSE */
+				t_constraint_traversal traversal;
+				traversal.source_clock_domain = source_clock_domain;
+				traversal.sink_clock_domain = sink_clock_domain;
+				traversals.push_back(traversal);
+			}
+		}
+	}
+	if (traversals.empty()) {
+		return max_criticality_denom;
+	}
+
+	if (NULL == f_tnode_fanin_offset) {
+		alloc_and_load_tnode_fanins();
+	}
+
+	/* One pair of arrays per concurrent traversal, or per pair if they are kept */
+	if (f_incremental_timing.is_seeding) {
+		num_buffers = (int) traversals.size();
+	} else {
+		num_buffers = std::min(f_timing_num_workers, (int) traversals.size());
+	}
+	T_arr_buffer.resize((size_t) num_buffers * num_tnodes);
+	T_req_buffer.resize((size_t) num_buffers * num_tnodes);
+
+#ifdef VPR_USE_TBB
+	tbb::task_arena arena(f_timing_num_workers);
+	arena.execute([&]() {
+#endif
+	for (first_pair = 0; first_pair < (int) traversals.size(); first_pair += num_buffers) {
+		last_pair = std::min(first_pair + num_buffers, (int) traversals.size());
+
+		for (ipair = first_pair; ipair < last_pair; ipair++) {
+			traversals[ipair].T_arr = &T_arr_buffer[(size_t) (ipair - first_pair) * num_tnodes];
+			traversals[ipair].T_req = &T_req_buffer[(size_t) (ipair - first_pair) * num_tnodes];
+		}
+
+		timing_parallel_for(first_pair, last_pair, 1, [&](int begin, int end) {
+			for (int jpair = begin; jpair < end; jpair++) {
+				do_timing_analysis_for_constraint_levelized(&traversals[jpair], is_final_analysis);
+			}
+		});
+
+		for (ipair = first_pair; ipair < last_pair; ipair++) {
+			t_constraint_traversal & traversal = traversals[ipair];
+			source_clock_domain = traversal.source_clock_domain;
+			sink_clock_domain = traversal.sink_clock_domain;
+
+			f_timing_stats->cpd[source_clock_domain][sink_clock_domain] = 
+				std::max(f_timing_stats->cpd[source_clock_domain][sink_clock_domain], traversal.cpd);
+			f_timing_stats->least_slack[source_clock_domain][sink_clock_domain] = 
+				std::min(f_timing_stats->least_slack[source_clock_domain][sink_clock_domain], traversal.least_slack);
+
+			if (traversal.num_dangling_nodes > 0 && is_final_analysis) {
+				vpr_printf(TIO_MESSAGE_WARNING, "%d unused pins \n",  traversal.num_dangling_nodes);
+			}
+
+			timing_parallel_for(0, num_tnodes, TIMING_PARALLEL_GRAIN, [&](int begin, int end) {
+				for (int inode = begin; inode < end; inode++) {
+					tnode[inode].T_arr = traversal.T_arr[inode];
+					tnode[inode].T_req = traversal.T_req[inode];
+				}
+			});
+
+			update_slacks(slacks, source_clock_domain, sink_clock_domain, traversal.criticality_denom, update_slack);
+
+			max_criticality_denom = std::max(max_criticality_denom, traversal.criticality_denom);
+		}
+	}
+#ifdef VPR_USE_TBB
+	});
+#endif
+
+	if (f_incremental_timing.is_seeding) {
+		/* Swapping keeps the storage, so traversals[].T_arr/T_req stay valid */
+		f_incremental_timing.traversals.swap(traversals);
+		f_incremental_timing.T_arr_buffer.swap(T_arr_buffer);
+		f_incremental_timing.T_req_buffer.swap(T_req_buffer);
+	}
+
+	return max_criticality_denom;
+}
+
+static void do_timing_analysis_for_constraint_levelized(t_constraint_traversal * traversal, 
+	boolean is_final_analysis) {
+
+	/* Level-parallel version of do_timing_analysis_for_constraint for post-packed 
+	netlists, working on the private arrays traversal->T_arr and traversal->T_req.
+	The forward traversal gathers the arrival time of each tnode from its fanins, 
+	which all lie on earlier levels, instead of scattering it from the drivers; 
+	the backward traversal already only reads later levels. Tnodes of one level 
+	are thus independent and are split across threads. */
+
+	int source_clock_domain = traversal->source_clock_domain;
+	int sink_clock_domain = traversal->sink_clock_domain;
+	float * T_arr = traversal->T_arr;
+	float * T_req = traversal->T_req;
+	int inode, i, ilevel;
+	std::mutex reduce_lock;
+
+	traversal->max_Tarr = HUGE_NEGATIVE_FLOAT;
+
+	/* Reset all arrival and required times. */
+	timing_parallel_for(0, num_tnodes, TIMING_PARALLEL_GRAIN, [&](int begin, int end) {
+		for (int jnode = begin; jnode < end; jnode++) {
+			T_arr[jnode] = HUGE_NEGATIVE_FLOAT;
+			T_req[jnode] = HUGE_POSITIVE_FLOAT;
+		}
+	});
+
+	/* Set arrival times for each top-level tnode on this source domain. */
+	for (i = 0; i < tnodes_at_level[0].nelem; i++) {
+		inode = tnodes_at_level[0].list[i];
+		if (tnode[inode].clock_domain == source_clock_domain) {
+			if (tnode[inode].type == TN_FF_SOURCE) { 
+				T_arr[inode] = tnode[inode].clock_delay;
+			} else if (tnode[inode].type == TN_INPAD_SOURCE) { 
+				T_arr[inode] = 0.;
+			}
+		}
+	}
+
+	/* Forward traversal. A tnode which receives at least one 
+	arrival time takes part in max_Tarr. */
+	for (ilevel = 1; ilevel < num_tnode_levels; ilevel++) {
+		const int * level_tnodes = tnodes_at_level[ilevel].list;
+
+		timing_parallel_for(0, tnodes_at_level[ilevel].nelem, TIMING_PARALLEL_GRAIN, [&](int begin, int end) {
+			float chunk_max_Tarr = HUGE_NEGATIVE_FLOAT;
+
+			for (int j = begin; j < end; j++) {
+				int jnode = level_tnodes[j];
+				boolean is_reached;
+				float node_T_arr = find_levelized_T_arr(T_arr, jnode, &is_reached);
+				if (is_reached) {
+					T_arr[jnode] = node_T_arr;
+					chunk_max_Tarr = std::max(chunk_max_Tarr, node_T_arr);
+				}
+			}
+
+			std::lock_guard<std::mutex> lock(reduce_lock);
+			traversal->max_Tarr = std::max(traversal->max_Tarr, chunk_max_Tarr);
+		});
+	}
+
+	/* Backward traversal from sinks to sources. */
+	for (ilevel = num_tnode_levels - 1; ilevel >= 0; ilevel--) {
+		const int * level_tnodes = tnodes_at_level[ilevel].list;
+
+		timing_parallel_for(0, tnodes_at_level[ilevel].nelem, TIMING_PARALLEL_GRAIN, [&](int begin, int end) {
+			for (int j = begin; j < end; j++) {
+				int jnode = level_tnodes[j];
+				T_req[jnode] = find_levelized_T_req(traversal, jnode, is_final_analysis);
+			}
+		});
+	}
+
+	load_constraint_traversal_stats(traversal);
+
+	/* The criticality denominator is the maximum of the max 
+	arrival time and the constraint for this domain pair. */
+	traversal->criticality_denom = std::max(traversal->max_Tarr, g_sdc->domain_constraint[source_clock_domain][sink_clock_domain]);
+}
+
+static float find_levelized_T_arr(const float * T_arr, int inode, boolean * is_reached) {
+
+	/* Arrival time of a non-source tnode: the max over its fanins with a valid 
+	arrival time of T_arr (fanin) + Tdel. is_reached tells whether there was any 
+	such fanin; if not, HUGE_NEGATIVE_FLOAT is returned. */
+
+	int ifanin, from_node;
+	float node_T_arr = HUGE_NEGATIVE_FLOAT;
+
+	*is_reached = FALSE;
+	for (ifanin = f_tnode_fanin_offset[inode]; ifanin < f_tnode_fanin_offset[inode + 1]; ifanin++) {
+		from_node = f_tnode_fanin_from[ifanin];
+		if (T_arr[from_node] < NEGATIVE_EPSILON) {
+			continue; /* This fanin is not on the source clock domain */
+		}
+		node_T_arr = std::max(node_T_arr, T_arr[from_node] + f_tnode_fanin_edge[ifanin]->Tdel);
+		*is_reached = TRUE;
+	}
+	return node_T_arr;
+}
+
+static float find_levelized_T_req(const t_constraint_traversal * traversal, int inode, 
+	boolean is_final_analysis) {
+
+	/* Required time of a tnode, once the required times of its fanouts are known.
+	Follows the backward traversal of do_timing_analysis_for_constraint: tnodes
+	which are skipped there keep HUGE_POSITIVE_FLOAT. */
+
+	int source_clock_domain = traversal->source_clock_domain;
+	int sink_clock_domain = traversal->sink_clock_domain;
+	const float * T_arr = traversal->T_arr;
+	const float * T_req = traversal->T_req;
+	int num_edges = tnode[inode].num_edges;
+	t_tedge * tedge = tnode[inode].out_edges;
+	float constraint, node_T_req;
+	int icf, iedge;
+
+	if (num_edges == 0) { /* sink */
+		if (tnode[inode].type == TN_FF_CLOCK || T_arr[inode] < HUGE_NEGATIVE_FLOAT + 1) {
+			return HUGE_POSITIVE_FLOAT; /* Skip nodes on the clock net itself, and nodes with unset arrival times. */
+		}
+		if (tnode[inode].clock_domain != sink_clock_domain) { 
+			return HUGE_POSITIVE_FLOAT;
+		}
+
+		if (g_sdc->num_cf_constraints > 0 && (icf = find_cf_constraint(g_sdc->constrained_clocks[source_clock_domain].name, find_tnode_net_name(inode, FALSE))) != -1) {
+			constraint = g_sdc->cf_constraints[icf].constraint;
+			if (constraint < NEGATIVE_EPSILON) { 
+				return HUGE_POSITIVE_FLOAT;
+			}
+		} else {
+			constraint = g_sdc->domain_constraint[source_clock_domain][sink_clock_domain];
+		}
+
+#if SLACK_DEFINITION == 'R'
+		if (is_final_analysis) {
+			return constraint + tnode[inode].clock_delay;
+		}
+		return std::max(constraint + tnode[inode].clock_delay, traversal->max_Tarr);
+#else
+		(void) is_final_analysis;
+		return constraint + tnode[inode].clock_delay;
+#endif
+	} 
+	
+	/* not a sink */
+	if (T_arr[inode] < HUGE_NEGATIVE_FLOAT + 1 || !has_valid_fanout_T_req(T_req, inode)) {
+		return HUGE_POSITIVE_FLOAT; /* Not on a path from the source to the sink clock domain */
+	}
+
+	node_T_req = HUGE_POSITIVE_FLOAT;
+	for (iedge = 0; iedge < num_edges; iedge++) {
+		node_T_req = std::min(node_T_req, T_req[tedge[iedge].to_node] - tedge[iedge].Tdel);
+	}
+	return node_T_req;
+}
+
+static boolean has_valid_fanout_T_req(const float * T_req, int inode) {
+	/* Does any fanout of this tnode have a required time? */
+	int iedge;
+	t_tedge * tedge = tnode[inode].out_edges;
+
+	for (iedge = 0; iedge < tnode[inode].num_edges; iedge++) {
+		if (T_req[tedge[iedge].to_node] < HUGE_POSITIVE_FLOAT) {
+			return TRUE;
+		}
+	}
+	return FALSE;
+}
+
+static void load_constraint_traversal_stats(t_constraint_traversal * traversal) {
+
+	/* Critical path delay, least slack and number of dangling pins of a traversal, 
+	found from the sinks and the edges into them once T_arr and T_req are known. 
+	These are the same minima, maxima and counts as the backward traversal of 
+	do_timing_analysis_for_constraint accumulates, so the order does not matter. */
+
+	int sink_clock_domain = traversal->sink_clock_domain;
+	const float * T_arr = traversal->T_arr;
+	const float * T_req = traversal->T_req;
+	std::mutex reduce_lock;
+
+	traversal->cpd = HUGE_NEGATIVE_FLOAT;
+	traversal->least_slack = HUGE_POSITIVE_FLOAT;
+	traversal->num_dangling_nodes = 0;
+
+	timing_parallel_for(0, (int) f_timing_sinks.size(), TIMING_PARALLEL_GRAIN, [&](int begin, int end) {
+		float chunk_cpd = HUGE_NEGATIVE_FLOAT;
+		float chunk_least_slack = HUGE_POSITIVE_FLOAT;
+		int chunk_num_dangling_nodes = 0;
+
+		for (int i = begin; i < end; i++) {
+			int inode = f_timing_sinks[i];
+
+			if (tnode[inode].clock_domain == sink_clock_domain) {
+				/* Least slack over the edges into sinks on the sink clock domain */
+				for (int ifanin = f_tnode_fanin_offset[inode]; ifanin < f_tnode_fanin_offset[inode + 1]; ifanin++) {
+					int from_node = f_tnode_fanin_from[ifanin];
+					if (T_arr[from_node] < HUGE_NEGATIVE_FLOAT + 1 || !has_valid_fanout_T_req(T_req, from_node)) {
+						continue;
+					}
+					chunk_least_slack = std::min(chunk_least_slack, 
+						(T_req[inode] - f_tnode_fanin_edge[ifanin]->Tdel - T_arr[from_node]));
+				}
+			}
+
+			if (tnode[inode].type == TN_FF_CLOCK || T_arr[inode] < HUGE_NEGATIVE_FLOAT + 1) {
+				continue;
+			}
+			if (!(tnode[inode].type == TN_OUTPAD_SINK || tnode[inode].type == TN_FF_SINK)) {
+				chunk_num_dangling_nodes++;
+			}
+			/* Sinks with a required time are the ones analysed for this constraint */
+			if (T_req[inode] < HUGE_POSITIVE_FLOAT) {
+				chunk_cpd = std::max(chunk_cpd, (T_arr[inode] - tnode[inode].clock_delay));
+			}
+		}
+
+		std::lock_guard<std::mutex> lock(reduce_lock);
+		traversal->cpd = std::max(traversal->cpd, chunk_cpd);
+		traversal->least_slack = std::min(traversal->least_slack, chunk_least_slack);
+		traversal->num_dangling_nodes += chunk_num_dangling_nodes;
+	});
+}
+
+static void invalidate_incremental_timing(void) {
+	size_t i;
+
+	f_incremental_timing.is_valid = FALSE;
+	for (i = 0; i < f_incremental_timing.dirty_nets.size(); i++) {
+		f_incremental_timing.is_net_dirty[f_incremental_timing.dirty_nets[i]] = FALSE;
+	}
+	f_incremental_timing.dirty_nets.clear();
+}
+
+void do_incremental_timing_analysis(t_slack * slacks, boolean is_final_analysis) {
+
+	/* Same results as do_timing_analysis(slacks, FALSE, FALSE, is_final_analysis) 
+	on a post-packed timing graph, but only the tnodes in the fanout cones of the 
+	nets whose delays changed since the previous call (and in the fanin cones of 
+	the tnodes whose arrival times changed) are visited again. Arrival and 
+	required times are recomputed exactly as in the full traversal, so the 
+	propagation stops wherever a value comes out unchanged; slacks and 
+	criticalities are then recomputed only for the nets around changed tnodes, 
+	unless the criticality denominator of a domain pair has changed.
+
+	The first call, or the first call after any other timing analysis, runs a 
+	full analysis which keeps the arrival and required times of every domain 
+	pair (2 * num_tnodes floats per pair). Shifted slacks and path counting 
+	depend on the whole graph and always use the full analysis. */
+
+#if SLACK_DEFINITION == 'R' && !defined(PATH_COUNTING)
+	boolean update_slack = (boolean) (is_final_analysis || getEchoEnabled());
+	boolean is_criticality_denom_changed = FALSE;
+	std::vector<int> nets_to_update;
+	std::vector<char> is_net_to_update;
+	size_t ipair, i;
+	int inet, inode, ifanin, iclock, jclock;
+
+	if (!f_incremental_timing.is_valid 
+		|| f_incremental_timing.slacks != slacks
+		|| f_incremental_timing.is_final_analysis != is_final_analysis
+		|| f_incremental_timing.update_slack != update_slack
+		|| f_incremental_timing.dirty_nets.size() > INCREMENTAL_TIMING_MAX_DIRTY_NET_FRACTION * num_timing_nets) {
+		/* Full analysis, keeping the traversals of all domain pairs */
+		f_incremental_timing.is_seeding = TRUE;
+		do_timing_analysis(slacks, FALSE, FALSE, is_final_analysis);
+		f_incremental_timing.is_seeding = FALSE;
+
+		f_incremental_timing.is_valid = TRUE;
+		f_incremental_timing.slacks = slacks;
+		f_incremental_timing.is_final_analysis = is_final_analysis;
+		f_incremental_timing.update_slack = update_slack;
+		f_incremental_timing.is_net_dirty.assign(num_timing_nets, FALSE);
+		f_incremental_timing.dirty_nets.clear();
+		f_incremental_timing.scratch.resize(f_incremental_timing.traversals.size());
+		for (ipair = 0; ipair < f_incremental_timing.scratch.size(); ipair++) {
+			f_incremental_timing.scratch[ipair].level_queue.assign(num_tnode_levels, std::vector<int>());
+			f_incremental_timing.scratch[ipair].is_queued.assign(num_tnodes, FALSE);
+			f_incremental_timing.scratch[ipair].changed_tnodes.clear();
+		}
+		return;
+	}
+
+	if (f_incremental_timing.dirty_nets.empty() || f_incremental_timing.traversals.empty()) {
+		return; /* Nothing changed since the last analysis */
+	}
+
+#ifdef VPR_USE_TBB
+	tbb::task_arena arena(f_timing_num_workers);
+	arena.execute([&]() {
+#endif
+	/* Domain pairs are independent: update them concurrently */
+	timing_parallel_for(0, (int) f_incremental_timing.traversals.size(), 1, [&](int begin, int end) {
+		for (int jpair = begin; jpair < end; jpair++) {
+			update_constraint_traversal_incrementally(&f_incremental_timing.traversals[jpair], 
+				&f_incremental_timing.scratch[jpair], is_final_analysis);
+		}
+	});
+
+	/* Statistics, in the same order as the full analysis */
+	for (iclock = 0; iclock < g_sdc->num_constrained_clocks; iclock++) {	
+		for (jclock = 0; jclock < g_sdc->num_constrained_clocks; jclock++) {
+			f_timing_stats->cpd[iclock][jclock] = HUGE_NEGATIVE_FLOAT;
+			f_timing_stats->least_slack[iclock][jclock] = HUGE_POSITIVE_FLOAT;
+		}
+	}
+	for (ipair = 0; ipair < f_incremental_timing.traversals.size(); ipair++) {
+		t_constraint_traversal & traversal = f_incremental_timing.traversals[ipair];
+		f_timing_stats->cpd[traversal.source_clock_domain][traversal.sink_clock_domain] = traversal.cpd;
+		f_timing_stats->least_slack[traversal.source_clock_domain][traversal.sink_clock_domain] = traversal.least_slack;
+		if (traversal.num_dangling_nodes > 0 && is_final_analysis) {
+			vpr_printf(TIO_MESSAGE_WARNING, "%d unused pins \n",  traversal.num_dangling_nodes);
+		}
+		if (f_incremental_timing.scratch[ipair].is_criticality_denom_changed) {
+			is_criticality_denom_changed = TRUE;
+		}
+	}
+
+	/* Nets whose slacks may have changed: all of them if a criticality denominator 
+	changed, otherwise the nets with new delays and the nets driving or driven by
+	a changed tnode. */
+	if (is_criticality_denom_changed) {
+		nets_to_update.resize(num_timing_nets);
+		for (inet = 0; inet < num_timing_nets; inet++) {
+			nets_to_update[inet] = inet;
+		}
+	} else {
+		is_net_to_update.assign(num_timing_nets, FALSE);
+		nets_to_update = f_incremental_timing.dirty_nets;
+		for (i = 0; i < nets_to_update.size(); i++) {
+			is_net_to_update[nets_to_update[i]] = TRUE;
+		}
+		for (ipair = 0; ipair < f_incremental_timing.scratch.size(); ipair++) {
+			const std::vector<int> & changed_tnodes = f_incremental_timing.scratch[ipair].changed_tnodes;
+			for (i = 0; i < changed_tnodes.size(); i++) {
+				inode = changed_tnodes[i];
+				inet = f_tnode_driven_net[inode];
+				if (OPEN != inet && !is_net_to_update[inet]) {
+					is_net_to_update[inet] = TRUE;
+					nets_to_update.push_back(inet);
+				}
+				for (ifanin = f_tnode_fanin_offset[inode]; ifanin < f_tnode_fanin_offset[inode + 1]; ifanin++) {
+					inet = f_tnode_driven_net[f_tnode_fanin_from[ifanin]];
+					if (OPEN != inet && !is_net_to_update[inet]) {
+						is_net_to_update[inet] = TRUE;
+						nets_to_update.push_back(inet);
+					}
+				}
+			}
+		}
+	}
+
+	timing_parallel_for(0, (int) nets_to_update.size(), TIMING_PARALLEL_GRAIN, [&](int begin, int end) {
+		for (int j = begin; j < end; j++) {
+			update_net_slacks_from_traversals(slacks, nets_to_update[j], update_slack);
+		}
+	});
+#ifdef VPR_USE_TBB
+	});
+#endif
+
+	/* Like the full analysis, leave the times of the last domain pair in tnode */
+	{
+		const t_constraint_traversal & last_traversal = f_incremental_timing.traversals.back();
+		const std::vector<int> & changed_tnodes = f_incremental_timing.scratch.back().changed_tnodes;
+		for (i = 0; i < changed_tnodes.size(); i++) {
+			inode = changed_tnodes[i];
+			tnode[inode].T_arr = last_traversal.T_arr[inode];
+			tnode[inode].T_req = last_traversal.T_req[inode];
+		}
+	}
+
+	for (i = 0; i < f_incremental_timing.dirty_nets.size(); i++) {
+		f_incremental_timing.is_net_dirty[f_incremental_timing.dirty_nets[i]] = FALSE;
+	}
+	f_incremental_timing.dirty_nets.clear();
+#else
+	do_timing_analysis(slacks, FALSE, FALSE, is_final_analysis);
+#endif
+}
+
+static void update_constraint_traversal_incrementally(t_constraint_traversal * traversal, 
+	t_incremental_traversal * scratch, boolean is_final_analysis) {
+
+	/* Brings the arrival and required times of one domain pair up to date with 
+	the net delays. Tnodes are revisited level by level, starting from the sinks 
+	of the nets in f_incremental_timing.dirty_nets; a tnode whose time changes 
+	queues its fanouts (forward) or fanins (backward). */
+
+	float * T_arr = traversal->T_arr;
+	float * T_req = traversal->T_req;
+	float old_max_Tarr = traversal->max_Tarr, old_criticality_denom = traversal->criticality_denom;
+	float node_T_arr, node_T_req;
+	boolean is_reached, is_max_Tarr_stale = FALSE;
+	size_t i, k;
+	int inode, iedge, ifanin, ilevel, driver_node, num_forward_changes;
+	std::vector<std::vector<int> > & level_queue = scratch->level_queue;
+	std::vector<char> & is_queued = scratch->is_queued;
+	std::vector<int> & changed_tnodes = scratch->changed_tnodes;
+	const std::vector<int> & dirty_nets = f_incremental_timing.dirty_nets;
+
+	changed_tnodes.clear();
+
+	/* Forward: start from the sinks of the nets with new delays */
+	for (i = 0; i < dirty_nets.size(); i++) {
+		driver_node = f_net_to_driver_tnode[dirty_nets[i]];
+		for (iedge = 0; iedge < tnode[driver_node].num_edges; iedge++) {
+			inode = tnode[driver_node].out_edges[iedge].to_node;
+			if (!is_queued[inode]) {
+				is_queued[inode] = TRUE;
+				level_queue[f_tnode_level[inode]].push_back(inode);
+			}
+		}
+	}
+
+	for (ilevel = 1; ilevel < num_tnode_levels; ilevel++) {
+		for (k = 0; k < level_queue[ilevel].size(); k++) {
+			inode = level_queue[ilevel][k];
+			is_queued[inode] = FALSE;
+
+			node_T_arr = find_levelized_T_arr(T_arr, inode, &is_reached);
+			if (node_T_arr == T_arr[inode]) {
+				continue;
+			}
+			if (T_arr[inode] == old_max_Tarr && node_T_arr < old_max_Tarr) {
+				is_max_Tarr_stale = TRUE; /* The max may have come down */
+			}
+			traversal->max_Tarr = std::max(traversal->max_Tarr, node_T_arr);
+			T_arr[inode] = node_T_arr;
+			changed_tnodes.push_back(inode);
+
+			for (iedge = 0; iedge < tnode[inode].num_edges; iedge++) {
+				int to_node = tnode[inode].out_edges[iedge].to_node;
+				if (!is_queued[to_node]) {
+					is_queued[to_node] = TRUE;
+					level_queue[f_tnode_level[to_node]].push_back(to_node);
+				}
+			}
+		}
+		level_queue[ilevel].clear();
+	}
+
+	if (is_max_Tarr_stale) {
+		traversal->max_Tarr = HUGE_NEGATIVE_FLOAT;
+		for (inode = 0; inode < num_tnodes; inode++) {
+			if (f_tnode_level[inode] > 0) {
+				traversal->max_Tarr = std::max(traversal->max_Tarr, T_arr[inode]);
+			}
+		}
+	}
+
+	/* Backward: start from the tnodes with new arrival times, the drivers of the 
+	nets with new delays and, if the relaxed required times moved, the sinks. */
+	num_forward_changes = (int) changed_tnodes.size();
+	for (k = 0; k < (size_t) num_forward_changes; k++) {
+		inode = changed_tnodes[k];
+		if (!is_queued[inode]) {
+			is_queued[inode] = TRUE;
+			level_queue[f_tnode_level[inode]].push_back(inode);
+		}
+	}
+	for (i = 0; i < dirty_nets.size(); i++) {
+		inode = f_net_to_driver_tnode[dirty_nets[i]];
+		if (!is_queued[inode]) {
+			is_queued[inode] = TRUE;
+			level_queue[f_tnode_level[inode]].push_back(inode);
+		}
+	}
+#if SLACK_DEFINITION == 'R'
+	if (!is_final_analysis && traversal->max_Tarr != old_max_Tarr) {
+		for (i = 0; i < f_timing_sinks.size(); i++) {
+			inode = f_timing_sinks[i];
+			if (tnode[inode].clock_domain == traversal->sink_clock_domain && !is_queued[inode]) {
+				is_queued[inode] = TRUE;
+				level_queue[f_tnode_level[inode]].push_back(inode);
+			}
+		}
+	}
+#endif
+
+	for (ilevel = num_tnode_levels - 1; ilevel >= 0; ilevel--) {
+		for (k = 0; k < level_queue[ilevel].size(); k++) {
+			inode = level_queue[ilevel][k];
+			is_queued[inode] = FALSE;
+
+			node_T_req = find_levelized_T_req(traversal, inode, is_final_analysis);
+			if (node_T_req == T_req[inode]) {
+				continue;
+			}
+			T_req[inode] = node_T_req;
+			changed_tnodes.push_back(inode);
+
+			for (ifanin = f_tnode_fanin_offset[inode]; ifanin < f_tnode_fanin_offset[inode + 1]; ifanin++) {
+				int from_node = f_tnode_fanin_from[ifanin];
+				if (!is_queued[from_node]) {
+					is_queued[from_node] = TRUE;
+					level_queue[f_tnode_level[from_node]].push_back(from_node);
+				}
+			}
+		}
+		level_queue[ilevel].clear();
+	}
+
+	load_constraint_traversal_stats(traversal);
+
+	traversal->criticality_denom = std::max(traversal->max_Tarr, 
+		g_sdc->domain_constraint[traversal->source_clock_domain][traversal->sink_clock_domain]);
+	scratch->is_criticality_denom_changed = (boolean) (traversal->criticality_denom != old_criticality_denom);
+}
+
+static void update_net_slacks_from_traversals(t_slack * slacks, int inet, boolean update_slack) {
+
+	/* Recomputes the slack and criticality of every sink pin of a net from the 
+	kept traversals, as update_slacks does for one traversal at a time after a 
+	full reset (T_req-relaxed slacks only). */
+
+	int ipin, iedge, to_node;
+	int inode = f_net_to_driver_tnode[inet];
+	int num_edges = tnode[inode].num_edges;
+	t_tedge * tedge = tnode[inode].out_edges;
+	float T_arr, T_req, Tdel, slk, timing_criticality;
+	size_t ipair;
+
+	for (ipin = 1; ipin <= timing_nets[inet].num_sinks; ipin++) {
+		slacks->slack[inet][ipin] = HUGE_POSITIVE_FLOAT; 
+		slacks->timing_criticality[inet][ipin] = 0.; 
+	}
+
+	for (ipair = 0; ipair < f_incremental_timing.traversals.size(); ipair++) {
+		const t_constraint_traversal & traversal = f_incremental_timing.traversals[ipair];
+
+		T_arr = traversal.T_arr[inode];
+		if (!(T_arr > HUGE_NEGATIVE_FLOAT + 1 && traversal.T_req[inode] < HUGE_POSITIVE_FLOAT - 1)) {
+			continue;
+		}
+		for (iedge = 0; iedge < num_edges; iedge++) {
+			to_node = tedge[iedge].to_node;
+			if (!(traversal.T_arr[to_node] > HUGE_NEGATIVE_FLOAT + 1 && traversal.T_req[to_node] < HUGE_POSITIVE_FLOAT - 1)) {
+				continue;
+			}
+			Tdel = tedge[iedge].Tdel;
+			T_req = traversal.T_req[to_node];
+
+			if (update_slack) {
+				slk = T_req - T_arr - Tdel;
+				if (slk < slacks->slack[inet][iedge + 1]) { 
+					slacks->slack[inet][iedge + 1] = slk;
+				}
+			}
+
+			timing_criticality = 1 - (T_req - T_arr - Tdel)/traversal.criticality_denom;
+			if (timing_criticality > slacks->timing_criticality[inet][iedge + 1]) {
+				slacks->timing_criticality[inet][iedge + 1] = timing_criticality; 
+			}
+		}
+	}
+}
+
 #ifdef PATH_COUNTING
 static void do_path_counting(float criticality_denom) {
 	/* Count the importance of the number of paths going through each net 